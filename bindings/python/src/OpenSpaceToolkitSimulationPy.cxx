@@ -3,6 +3,7 @@
 #include <OpenSpaceToolkitSimulationPy/Utility/ArrayCasting.hpp>
 #include <OpenSpaceToolkitSimulationPy/Utility/ShiftToString.hpp>
 #include <pybind11/eigen.h>
+#include <pybind11/functional.h>
 #include <pybind11/numpy.h>
 #include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
@@ -10,6 +11,7 @@
 
 #include <OpenSpaceToolkitSimulationPy/Component.cpp>
 #include <OpenSpaceToolkitSimulationPy/Entity.cpp>
+#include <OpenSpaceToolkitSimulationPy/Event.cpp>
 #include <OpenSpaceToolkitSimulationPy/Satellite.cpp>
 #include <OpenSpaceToolkitSimulationPy/Simulator.cpp>
 #include <OpenSpaceToolkitSimulationPy/Utility/ComponentHolder.cpp>
@@ -35,4 +37,5 @@ PYBIND11_MODULE(OpenSpaceToolkitSimulationPy, m)
     OpenSpaceToolkitSimulationPy_Entity(m);
     OpenSpaceToolkitSimulationPy_Component(m);
     OpenSpaceToolkitSimulationPy_Satellite(m);
+    OpenSpaceToolkitSimulationPy_Event(m);
 }
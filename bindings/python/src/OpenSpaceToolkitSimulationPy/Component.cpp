@@ -174,6 +174,20 @@ inline void OpenSpaceToolkitSimulationPy_Component(pybind11::module& aModule)
                 )doc"
             )
 
+            .def(
+                "get_state",
+                &Component::getState,
+                R"doc(
+                    Get the component state, as held by the simulator.
+
+                    Returns:
+                        State: The component state.
+
+                    Example:
+                        >>> state = component.get_state()
+                )doc"
+            )
+
             .def(
                 "get_tags",
                 &Component::getTags,
@@ -16,6 +16,7 @@ inline void OpenSpaceToolkitSimulationPy_Component_Geometry(pybind11::module& aM
     using ostk::physics::coordinate::Frame;
     using ObjectGeometry = ostk::physics::environment::object::Geometry;
     using ostk::physics::environment::object::Celestial;
+    using ostk::physics::time::Instant;
 
     using ostk::simulation::Component;
     using ostk::simulation::component::Geometry;
@@ -144,6 +145,48 @@ inline void OpenSpaceToolkitSimulationPy_Component_Geometry(pybind11::module& aM
             )doc"
         )
 
+        .def(
+            "intersects",
+            overload_cast<const ObjectGeometry&, const Instant&>(&Geometry::intersects, const_),
+            arg("geometry"),
+            arg("instant"),
+            R"doc(
+                Check if this geometry intersects another geometry at a given instant.
+
+                Args:
+                    geometry (Geometry): The other geometry.
+                    instant (Instant): The instant.
+
+                Returns:
+                    bool: True if geometries intersect at the instant, False otherwise.
+
+                Example:
+                    >>> geometry.intersects(other_geometry, instant)
+                    False
+            )doc"
+        )
+
+        .def(
+            "intersects",
+            overload_cast<const Celestial&, const Instant&>(&Geometry::intersects, const_),
+            arg("celestial_object"),
+            arg("instant"),
+            R"doc(
+                Check if this geometry intersects a celestial object at a given instant.
+
+                Args:
+                    celestial_object (Celestial): The celestial object (planet, moon, etc.).
+                    instant (Instant): The instant.
+
+                Returns:
+                    bool: True if geometry intersects the celestial object at the instant, False otherwise.
+
+                Example:
+                    >>> geometry.intersects(earth, instant)
+                    False
+            )doc"
+        )
+
         .def(
             "contains",
             overload_cast<const ObjectGeometry&>(&Geometry::contains, const_),
@@ -182,6 +225,48 @@ inline void OpenSpaceToolkitSimulationPy_Component_Geometry(pybind11::module& aM
             )doc"
         )
 
+        .def(
+            "contains",
+            overload_cast<const ObjectGeometry&, const Instant&>(&Geometry::contains, const_),
+            arg("geometry"),
+            arg("instant"),
+            R"doc(
+                Check if this geometry contains another geometry at a given instant.
+
+                Args:
+                    geometry (Geometry): The other geometry.
+                    instant (Instant): The instant.
+
+                Returns:
+                    bool: True if this geometry contains the other at the instant, False otherwise.
+
+                Example:
+                    >>> geometry.contains(small_geometry, instant)
+                    True
+            )doc"
+        )
+
+        .def(
+            "contains",
+            overload_cast<const Celestial&, const Instant&>(&Geometry::contains, const_),
+            arg("celestial"),
+            arg("instant"),
+            R"doc(
+                Check if this geometry contains a celestial object at a given instant.
+
+                Args:
+                    celestial (Celestial): The celestial object.
+                    instant (Instant): The instant.
+
+                Returns:
+                    bool: True if this geometry contains the celestial object at the instant, False otherwise.
+
+                Example:
+                    >>> geometry.contains(moon, instant)
+                    False
+            )doc"
+        )
+
         .def(
             "access_composite",
             &Geometry::accessComposite,
@@ -213,7 +298,7 @@ inline void OpenSpaceToolkitSimulationPy_Component_Geometry(pybind11::module& aM
 
         .def(
             "get_geometry_in",
-            &Geometry::getGeometryIn,
+            overload_cast<const Shared<const Frame>&>(&Geometry::getGeometryIn, const_),
             arg("frame"),
             R"doc(
                 Get the geometry expressed in a different reference frame.
@@ -229,6 +314,26 @@ inline void OpenSpaceToolkitSimulationPy_Component_Geometry(pybind11::module& aM
             )doc"
         )
 
+        .def(
+            "get_geometry_in",
+            overload_cast<const Shared<const Frame>&, const Instant&>(&Geometry::getGeometryIn, const_),
+            arg("frame"),
+            arg("instant"),
+            R"doc(
+                Get the geometry expressed in a different reference frame at a given instant.
+
+                Args:
+                    frame (Frame): The target reference frame.
+                    instant (Instant): The instant.
+
+                Returns:
+                    Geometry: The geometry in the target frame.
+
+                Example:
+                    >>> geometry_in_gcrf = geometry.get_geometry_in(gcrf, instant)
+            )doc"
+        )
+
         .def(
             "intersection_with",
             overload_cast<const ObjectGeometry&>(&Geometry::intersectionWith, const_),
@@ -265,6 +370,46 @@ inline void OpenSpaceToolkitSimulationPy_Component_Geometry(pybind11::module& aM
             )doc"
         )
 
+        .def(
+            "intersection_with",
+            overload_cast<const ObjectGeometry&, const Instant&>(&Geometry::intersectionWith, const_),
+            arg("geometry"),
+            arg("instant"),
+            R"doc(
+                Compute the intersection of this geometry with another geometry at a given instant.
+
+                Args:
+                    geometry (Geometry): The other geometry.
+                    instant (Instant): The instant.
+
+                Returns:
+                    Geometry: The intersection geometry.
+
+                Example:
+                    >>> intersection = geometry.intersection_with(other_geometry, instant)
+            )doc"
+        )
+
+        .def(
+            "intersection_with",
+            overload_cast<const Celestial&, const Instant&>(&Geometry::intersectionWith, const_),
+            arg("celestial_object"),
+            arg("instant"),
+            R"doc(
+                Compute the intersection of this geometry with a celestial object at a given instant.
+
+                Args:
+                    celestial_object (Celestial): The celestial object.
+                    instant (Instant): The instant.
+
+                Returns:
+                    Geometry: The intersection geometry.
+
+                Example:
+                    >>> intersection = geometry.intersection_with(earth, instant)
+            )doc"
+        )
+
         .def_static(
             "undefined",
             &Geometry::Undefined,
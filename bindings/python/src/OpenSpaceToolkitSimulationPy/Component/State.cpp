@@ -71,6 +71,22 @@ inline void OpenSpaceToolkitSimulationPy_Component_State(pybind11::module& aModu
             )doc"
         )
 
+        .def(
+            "is_verbose",
+            &State::isVerbose,
+            R"doc(
+                Check if verbose mode is enabled.
+
+                Returns:
+                    bool: True if verbose mode is enabled.
+
+                Example:
+                    >>> state = State(State.Status.Idle, True)
+                    >>> state.is_verbose()
+                    True
+            )doc"
+        )
+
         .def_static(
             "undefined",
             &State::Undefined,
@@ -0,0 +1,14 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkitSimulationPy/Event/Detector.cpp>
+#include <OpenSpaceToolkitSimulationPy/Event/Scheduler.cpp>
+
+inline void OpenSpaceToolkitSimulationPy_Event(pybind11::module& aModule)
+{
+    // Create python submodule
+    auto event = aModule.def_submodule("event");
+
+    // Add objects to python submodule
+    OpenSpaceToolkitSimulationPy_Event_Detector(event);
+    OpenSpaceToolkitSimulationPy_Event_Scheduler(event);
+}
@@ -0,0 +1,371 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Event/Detector.hpp>
+
+inline void OpenSpaceToolkitSimulationPy_Event_Detector(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Shared;
+
+    using ObjectGeometry = ostk::physics::environment::object::Geometry;
+    using ostk::physics::environment::object::Celestial;
+    using ostk::physics::time::Duration;
+
+    using ostk::simulation::component::Geometry;
+    using ostk::simulation::event::Detector;
+
+    {
+        class_<Detector> detector_class(
+            aModule,
+            "Detector",
+            R"doc(
+                Detector of the instants at which a geometric predicate changes value.
+
+                The predicate, between a component geometry and a target, is sampled over an interval
+                at a coarse step. Every step over which its value changes is refined by bisection down
+                to a time tolerance. Events shorter than the coarse step may be missed.
+            )doc"
+        );
+
+        enum_<Detector::Predicate>(
+            detector_class,
+            "Predicate",
+            R"doc(
+                Enumeration of geometric predicates.
+            )doc"
+        )
+
+            .value(
+                "Undefined",
+                Detector::Predicate::Undefined,
+                R"doc(
+                    Undefined predicate.
+                )doc"
+            )
+
+            .value(
+                "Intersects",
+                Detector::Predicate::Intersects,
+                R"doc(
+                    The geometry intersects the target.
+                )doc"
+            )
+
+            .value(
+                "Contains",
+                Detector::Predicate::Contains,
+                R"doc(
+                    The geometry contains the target.
+                )doc"
+            );
+
+        class_<Detector::Crossing> crossing_class(
+            detector_class,
+            "Crossing",
+            R"doc(
+                An instant at which the predicate changes value.
+            )doc"
+        );
+
+        enum_<Detector::Crossing::Type>(
+            crossing_class,
+            "Type",
+            R"doc(
+                Enumeration of crossing types.
+            )doc"
+        )
+
+            .value(
+                "Entry",
+                Detector::Crossing::Type::Entry,
+                R"doc(
+                    The predicate becomes true.
+                )doc"
+            )
+
+            .value(
+                "Exit",
+                Detector::Crossing::Type::Exit,
+                R"doc(
+                    The predicate becomes false.
+                )doc"
+            );
+
+        crossing_class
+
+            .def_readonly(
+                "instant",
+                &Detector::Crossing::instant,
+                R"doc(
+                    The first instant (within tolerance) at which the new value holds.
+                )doc"
+            )
+
+            .def_readonly(
+                "type",
+                &Detector::Crossing::type,
+                R"doc(
+                    The crossing type.
+                )doc"
+            )
+
+            ;
+
+        detector_class
+
+            .def(
+                init<const Shared<const Geometry>&, const ObjectGeometry&, const Detector::Predicate&>(),
+                arg("geometry"),
+                arg("target_geometry"),
+                arg("predicate"),
+                R"doc(
+                    Create a Detector against a target geometry.
+
+                    Args:
+                        geometry (Geometry): The component geometry.
+                        target_geometry (ObjectGeometry): The target geometry.
+                        predicate (Detector.Predicate): The predicate.
+
+                    Returns:
+                        Detector: The detector.
+
+                    Example:
+                        >>> detector = Detector(geometry, target_geometry, Detector.Predicate.Intersects)
+                )doc"
+            )
+
+            .def(
+                init<const Shared<const Geometry>&, const Celestial&, const Detector::Predicate&>(),
+                arg("geometry"),
+                arg("celestial_object"),
+                arg("predicate"),
+                R"doc(
+                    Create a Detector against a celestial object.
+
+                    Args:
+                        geometry (Geometry): The component geometry.
+                        celestial_object (Celestial): The celestial object.
+                        predicate (Detector.Predicate): The predicate.
+
+                    Returns:
+                        Detector: The detector.
+
+                    Example:
+                        >>> detector = Detector(geometry, earth, Detector.Predicate.Intersects)
+                )doc"
+            )
+
+            .def("__str__", &(shiftToString<Detector>))
+            .def("__repr__", &(shiftToString<Detector>))
+
+            .def(
+                "is_defined",
+                &Detector::isDefined,
+                R"doc(
+                    Check if the detector is defined.
+
+                    Returns:
+                        bool: True if the detector is defined, False otherwise.
+                )doc"
+            )
+
+            .def(
+                "access_geometry",
+                &Detector::accessGeometry,
+                return_value_policy::reference_internal,
+                R"doc(
+                    Access the component geometry.
+
+                    Returns:
+                        Geometry: The component geometry.
+                )doc"
+            )
+
+            .def(
+                "access_target",
+                &Detector::accessTarget,
+                return_value_policy::reference_internal,
+                R"doc(
+                    Access the target geometry.
+
+                    Returns:
+                        ObjectGeometry: The target geometry.
+                )doc"
+            )
+
+            .def(
+                "get_predicate",
+                &Detector::getPredicate,
+                R"doc(
+                    Get the predicate.
+
+                    Returns:
+                        Detector.Predicate: The predicate.
+                )doc"
+            )
+
+            .def(
+                "evaluate_at",
+                &Detector::evaluateAt,
+                arg("instant"),
+                R"doc(
+                    Evaluate the predicate at a given instant.
+
+                    Args:
+                        instant (Instant): The instant.
+
+                    Returns:
+                        bool: The predicate value.
+                )doc"
+            )
+
+            .def(
+                "compute_crossings",
+                &Detector::computeCrossings,
+                arg("interval"),
+                arg("step"),
+                arg("tolerance") = DEFAULT_EVENT_TOLERANCE,
+                R"doc(
+                    Compute the crossings of the predicate over an interval.
+
+                    Args:
+                        interval (Interval): The interval.
+                        step (Duration): The coarse sampling step.
+                        tolerance (Duration): The time tolerance on crossing instants (optional).
+
+                    Returns:
+                        list[Detector.Crossing]: The chronologically ordered crossings.
+
+                    Example:
+                        >>> crossings = detector.compute_crossings(interval, Duration.minutes(1.0))
+                )doc"
+            )
+
+            .def(
+                "compute_windows",
+                &Detector::computeWindows,
+                arg("interval"),
+                arg("step"),
+                arg("tolerance") = DEFAULT_EVENT_TOLERANCE,
+                R"doc(
+                    Compute the windows over which the predicate holds within an interval.
+
+                    Args:
+                        interval (Interval): The interval.
+                        step (Duration): The coarse sampling step.
+                        tolerance (Duration): The time tolerance on window bounds (optional).
+
+                    Returns:
+                        list[Interval]: The chronologically ordered windows.
+
+                    Example:
+                        >>> windows = detector.compute_windows(interval, Duration.minutes(1.0))
+                )doc"
+            )
+
+            .def(
+                "compute_crossings_adaptively",
+                &Detector::computeCrossingsAdaptively,
+                arg("interval"),
+                arg("minimum_step"),
+                arg("maximum_step"),
+                arg("tolerance") = DEFAULT_EVENT_TOLERANCE,
+                R"doc(
+                    Compute the crossings of the predicate over an interval, using adaptive steps.
+
+                    Steps are estimated from the angular distance between the target and the boundary of the field
+                    of view, and only shrink to the minimum step close to it.
+
+                    Args:
+                        interval (Interval): The interval.
+                        minimum_step (Duration): The minimum sampling step.
+                        maximum_step (Duration): The maximum sampling step.
+                        tolerance (Duration): The time tolerance on crossing instants (optional).
+
+                    Returns:
+                        list[Detector.Crossing]: The chronologically ordered crossings.
+
+                    Example:
+                        >>> crossings = detector.compute_crossings_adaptively(
+                        ...     interval, Duration.seconds(1.0), Duration.minutes(10.0)
+                        ... )
+                )doc"
+            )
+
+            .def(
+                "compute_windows_adaptively",
+                &Detector::computeWindowsAdaptively,
+                arg("interval"),
+                arg("minimum_step"),
+                arg("maximum_step"),
+                arg("tolerance") = DEFAULT_EVENT_TOLERANCE,
+                R"doc(
+                    Compute the windows over which the predicate holds within an interval, using adaptive steps.
+
+                    Args:
+                        interval (Interval): The interval.
+                        minimum_step (Duration): The minimum sampling step.
+                        maximum_step (Duration): The maximum sampling step.
+                        tolerance (Duration): The time tolerance on window bounds (optional).
+
+                    Returns:
+                        list[Interval]: The chronologically ordered windows.
+
+                    Example:
+                        >>> windows = detector.compute_windows_adaptively(
+                        ...     interval, Duration.seconds(1.0), Duration.minutes(10.0)
+                        ... )
+                )doc"
+            )
+
+            .def(
+                "compute_safe_step_at",
+                &Detector::computeSafeStepAt,
+                arg("instant"),
+                R"doc(
+                    Estimate the step over which the predicate does not change, from a given instant.
+
+                    The estimate is zero close to the field of view boundary, or when the geometries are not
+                    supported. It is undefined if the geometries are at rest relative to each other.
+
+                    Args:
+                        instant (Instant): The instant.
+
+                    Returns:
+                        Duration: The safe step.
+
+                    Example:
+                        >>> safe_step = detector.compute_safe_step_at(instant)
+                )doc"
+            )
+
+            .def_static(
+                "undefined",
+                &Detector::Undefined,
+                R"doc(
+                    Create an undefined detector.
+
+                    Returns:
+                        Detector: An undefined detector.
+                )doc"
+            )
+
+            .def_static(
+                "string_from_predicate",
+                &Detector::StringFromPredicate,
+                arg("predicate"),
+                R"doc(
+                    Convert a predicate to a string.
+
+                    Args:
+                        predicate (Detector.Predicate): The predicate.
+
+                    Returns:
+                        str: The string representation.
+                )doc"
+            )
+
+            ;
+    }
+}
@@ -0,0 +1,86 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Event/Scheduler.hpp>
+
+inline void OpenSpaceToolkitSimulationPy_Event_Scheduler(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::simulation::event::Scheduler;
+
+    class_<Scheduler>(
+        aModule,
+        "Scheduler",
+        R"doc(
+            Priority queue of time-tagged events.
+
+            Events are popped in chronological order. Events scheduled at the same instant are
+            popped in scheduling order.
+        )doc"
+    )
+
+        .def(
+            init<>(),
+            R"doc(
+                Create an empty Scheduler.
+
+                Returns:
+                    Scheduler: The scheduler.
+            )doc"
+        )
+
+        .def(
+            "is_empty",
+            &Scheduler::isEmpty,
+            R"doc(
+                Check if the scheduler has no pending events.
+
+                Returns:
+                    bool: True if the scheduler has no pending events, False otherwise.
+            )doc"
+        )
+
+        .def(
+            "get_event_count",
+            &Scheduler::getEventCount,
+            R"doc(
+                Get the number of pending events.
+
+                Returns:
+                    int: The number of pending events.
+            )doc"
+        )
+
+        .def(
+            "get_next_instant",
+            &Scheduler::getNextInstant,
+            R"doc(
+                Get the instant of the next pending event.
+
+                Returns:
+                    Instant: The instant of the next pending event.
+            )doc"
+        )
+
+        .def(
+            "cancel",
+            &Scheduler::cancel,
+            arg("event_id"),
+            R"doc(
+                Cancel a pending event.
+
+                Args:
+                    event_id (int): The event identifier.
+            )doc"
+        )
+
+        .def(
+            "clear",
+            &Scheduler::clear,
+            R"doc(
+                Cancel all pending events.
+            )doc"
+        )
+
+        ;
+}
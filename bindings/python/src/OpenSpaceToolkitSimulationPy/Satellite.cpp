@@ -2,6 +2,10 @@
 
 #include <OpenSpaceToolkit/Simulation/Satellite.hpp>
 
+#include <OpenSpaceToolkitSimulationPy/Satellite/ChebyshevTable.cpp>
+#include <OpenSpaceToolkitSimulationPy/Satellite/Ephemeris.cpp>
+#include <OpenSpaceToolkitSimulationPy/Satellite/TransformTree.cpp>
+
 inline void OpenSpaceToolkitSimulationPy_Satellite(pybind11::module& aModule)
 {
     using namespace pybind11;
@@ -19,9 +23,18 @@ inline void OpenSpaceToolkitSimulationPy_Satellite(pybind11::module& aModule)
     using ostk::simulation::component::GeometryConfiguration;
     using ostk::simulation::ComponentConfiguration;
     using ostk::simulation::Satellite;
+    using ostk::simulation::satellite::EphemerisConfiguration;
     using ostk::simulation::SatelliteConfiguration;
     using ostk::simulation::Simulator;
 
+    // Registered first, as SatelliteConfiguration defaults to an EphemerisConfiguration
+
+    auto satellite = aModule.def_submodule("satellite");
+
+    OpenSpaceToolkitSimulationPy_Satellite_ChebyshevTable(satellite);
+    OpenSpaceToolkitSimulationPy_Satellite_Ephemeris(satellite);
+    OpenSpaceToolkitSimulationPy_Satellite_TransformTree(satellite);
+
     class_<Satellite, Component, Shared<Satellite>>(
         aModule,
         "Satellite",
@@ -111,6 +124,61 @@ inline void OpenSpaceToolkitSimulationPy_Satellite(pybind11::module& aModule)
             )doc"
         )
 
+        .def(
+            "has_state_at",
+            &Satellite::hasStateAt,
+            arg("instant"),
+            R"doc(
+                Check if the satellite has a state at a given instant.
+
+                Args:
+                    instant (Instant): The instant.
+
+                Returns:
+                    bool: True if the ephemeris or the profile covers the instant.
+
+                Example:
+                    >>> satellite.has_state_at(instant)
+                    True
+            )doc"
+        )
+
+        .def(
+            "get_state_at",
+            &Satellite::getStateAt,
+            arg("instant"),
+            R"doc(
+                Get the satellite state at a given instant.
+
+                Args:
+                    instant (Instant): The instant.
+
+                Returns:
+                    State: The satellite state, in GCRF.
+
+                Example:
+                    >>> state = satellite.get_state_at(instant)
+            )doc"
+        )
+
+        .def(
+            "get_states_at",
+            &Satellite::getStatesAt,
+            arg("instants"),
+            R"doc(
+                Get the satellite states at given instants.
+
+                Args:
+                    instants (list[Instant]): The instants.
+
+                Returns:
+                    list[State]: The satellite states, in GCRF.
+
+                Example:
+                    >>> states = satellite.get_states_at(instants)
+            )doc"
+        )
+
         .def_static(
             "undefined",
             &Satellite::Undefined,
@@ -129,7 +197,10 @@ inline void OpenSpaceToolkitSimulationPy_Satellite(pybind11::module& aModule)
 
         .def_static(
             "configure",
-            &Satellite::Configure,
+            [](const SatelliteConfiguration& aSatelliteConfiguration, const Shared<const Simulator>& aSimulatorSPtr)
+            {
+                return Satellite::Configure(aSatelliteConfiguration, aSimulatorSPtr);
+            },
             arg("configuration"),
             arg("simulator") = nullptr,
             R"doc(
@@ -172,13 +243,15 @@ inline void OpenSpaceToolkitSimulationPy_Satellite(pybind11::module& aModule)
                 const Profile&,
                 const Array<ComponentConfiguration>&,
                 const Array<String>&,
-                const Array<GeometryConfiguration>&>(),
+                const Array<GeometryConfiguration>&,
+                const EphemerisConfiguration&>(),
             arg("id"),
             arg("name"),
             arg("profile"),
             arg("components") = DEFAULT_COMPONENTS,
             arg("tags") = DEFAULT_TAGS,
             arg("geometries") = DEFAULT_GEOMETRIES,
+            arg("ephemeris") = DEFAULT_EPHEMERIS,
             R"doc(
                 Create a SatelliteConfiguration instance.
 
@@ -189,6 +262,7 @@ inline void OpenSpaceToolkitSimulationPy_Satellite(pybind11::module& aModule)
                     components (list[ComponentConfiguration]): Array of component configurations (optional).
                     tags (list[str]): Array of classification tags (optional).
                     geometries (list[GeometryConfiguration]): Array of geometry configurations (optional).
+                    ephemeris (EphemerisConfiguration): The precomputed ephemeris configuration (optional).
 
                 Returns:
                     SatelliteConfiguration: The configuration instance.
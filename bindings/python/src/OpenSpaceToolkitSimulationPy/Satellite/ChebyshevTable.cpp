@@ -0,0 +1,146 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Satellite/ChebyshevTable.hpp>
+
+inline void OpenSpaceToolkitSimulationPy_Satellite_ChebyshevTable(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Size;
+
+    using ostk::mathematics::object::MatrixXd;
+
+    using ostk::physics::time::Duration;
+    using ostk::physics::time::Instant;
+
+    using ostk::simulation::satellite::ChebyshevTable;
+
+    class_<ChebyshevTable>(
+        aModule,
+        "ChebyshevTable",
+        R"doc(
+            Chebyshev polynomial coefficients of satellite states, over consecutive segments of equal duration.
+
+            Each segment holds one polynomial per state component, in GCRF: position (3), attitude
+            quaternion (4, XYZS) and angular velocity (3). Velocity is the derivative of the position polynomials.
+        )doc"
+    )
+
+        .def(
+            init<const Instant&, const Duration&, const Size, const MatrixXd&>(),
+            arg("start_instant"),
+            arg("segment_duration"),
+            arg("degree"),
+            arg("coefficients"),
+            R"doc(
+                Create a ChebyshevTable instance.
+
+                Args:
+                    start_instant (Instant): The start instant of the first segment.
+                    segment_duration (Duration): The duration of each segment.
+                    degree (int): The degree of the polynomials.
+                    coefficients (numpy.ndarray): 10 x (segment count * (degree + 1)) coefficients.
+
+                Returns:
+                    ChebyshevTable: The Chebyshev table.
+            )doc"
+        )
+
+        .def("__str__", &(shiftToString<ChebyshevTable>))
+        .def("__repr__", &(shiftToString<ChebyshevTable>))
+
+        .def(
+            "is_defined",
+            &ChebyshevTable::isDefined,
+            R"doc(
+                Check if the Chebyshev table is defined.
+
+                Returns:
+                    bool: True if the Chebyshev table is defined, False otherwise.
+            )doc"
+        )
+
+        .def(
+            "get_degree",
+            &ChebyshevTable::getDegree,
+            R"doc(
+                Get the degree of the polynomials.
+
+                Returns:
+                    int: The degree.
+            )doc"
+        )
+
+        .def(
+            "get_segment_count",
+            &ChebyshevTable::getSegmentCount,
+            R"doc(
+                Get the number of segments.
+
+                Returns:
+                    int: The number of segments.
+            )doc"
+        )
+
+        .def(
+            "get_segment_duration",
+            &ChebyshevTable::getSegmentDuration,
+            R"doc(
+                Get the duration of each segment.
+
+                Returns:
+                    Duration: The segment duration.
+            )doc"
+        )
+
+        .def(
+            "get_interval",
+            &ChebyshevTable::getInterval,
+            R"doc(
+                Get the interval covered by the segments.
+
+                Returns:
+                    Interval: The covered interval.
+            )doc"
+        )
+
+        .def(
+            "access_coefficients",
+            &ChebyshevTable::accessCoefficients,
+            return_value_policy::reference_internal,
+            R"doc(
+                Access the coefficients.
+
+                Returns:
+                    numpy.ndarray: The coefficient matrix.
+            )doc"
+        )
+
+        .def(
+            "get_state_at",
+            &ChebyshevTable::getStateAt,
+            arg("instant"),
+            R"doc(
+                Get the state at an instant.
+
+                Args:
+                    instant (Instant): An instant, within the interval of the table.
+
+                Returns:
+                    State: The state, in GCRF.
+            )doc"
+        )
+
+        .def_static(
+            "undefined",
+            &ChebyshevTable::Undefined,
+            R"doc(
+                Create an undefined Chebyshev table.
+
+                Returns:
+                    ChebyshevTable: An undefined Chebyshev table.
+            )doc"
+        )
+
+        ;
+}
@@ -0,0 +1,332 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Satellite/Ephemeris.hpp>
+
+inline void OpenSpaceToolkitSimulationPy_Satellite_Ephemeris(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Size;
+
+    using ostk::physics::time::Duration;
+    using ostk::physics::time::Instant;
+    using ostk::physics::time::Interval;
+    using ostk::physics::unit::Angle;
+    using ostk::physics::unit::Length;
+
+    using ostk::astrodynamics::flight::Profile;
+
+    using ostk::simulation::satellite::ChebyshevTable;
+    using ostk::simulation::satellite::Ephemeris;
+    using ostk::simulation::satellite::EphemerisConfiguration;
+    using ostk::simulation::simulator::StateTable;
+
+    {
+        class_<Ephemeris> ephemeris_class(
+            aModule,
+            "Ephemeris",
+            R"doc(
+                Satellite states precomputed over an interval, tabulated or as Chebyshev polynomial segments.
+
+                Tabulated states are interpolated by cubic Hermite polynomials for position and velocity,
+                spherical linear interpolation for attitude and linearly for angular velocity. Chebyshev
+                segments store an order of magnitude less for smooth trajectories.
+            )doc"
+        );
+
+        ephemeris_class
+
+            .def(
+                init<const StateTable&>(),
+                arg("state_table"),
+                R"doc(
+                    Create an Ephemeris instance.
+
+                    Args:
+                        state_table (StateTable): At least two states, at uniformly spaced increasing instants.
+
+                    Returns:
+                        Ephemeris: The ephemeris.
+                )doc"
+            )
+
+            .def(
+                init<const ChebyshevTable&>(),
+                arg("chebyshev_table"),
+                R"doc(
+                    Create a Chebyshev Ephemeris instance.
+
+                    Args:
+                        chebyshev_table (ChebyshevTable): The Chebyshev table.
+
+                    Returns:
+                        Ephemeris: The ephemeris.
+                )doc"
+            )
+
+            .def("__str__", &(shiftToString<Ephemeris>))
+            .def("__repr__", &(shiftToString<Ephemeris>))
+
+            .def(
+                "is_defined",
+                &Ephemeris::isDefined,
+                R"doc(
+                    Check if the ephemeris is defined.
+
+                    Returns:
+                        bool: True if the ephemeris is defined, False otherwise.
+                )doc"
+            )
+
+            .def(
+                "contains",
+                &Ephemeris::contains,
+                arg("instant"),
+                R"doc(
+                    Check if the ephemeris covers an instant.
+
+                    Args:
+                        instant (Instant): The instant.
+
+                    Returns:
+                        bool: True if the instant is within the interval of the ephemeris.
+                )doc"
+            )
+
+            .def(
+                "get_type",
+                &Ephemeris::getType,
+                R"doc(
+                    Get the representation of the ephemeris.
+
+                    Returns:
+                        Ephemeris.Type: The ephemeris type.
+                )doc"
+            )
+
+            .def(
+                "get_interval",
+                &Ephemeris::getInterval,
+                R"doc(
+                    Get the interval covered by the ephemeris.
+
+                    Returns:
+                        Interval: The closed interval between the first and last states.
+                )doc"
+            )
+
+            .def(
+                "get_step",
+                &Ephemeris::getStep,
+                R"doc(
+                    Get the step between states, or the segment duration of a Chebyshev ephemeris.
+
+                    Returns:
+                        Duration: The step.
+                )doc"
+            )
+
+            .def(
+                "access_state_table",
+                &Ephemeris::accessStateTable,
+                return_value_policy::reference_internal,
+                R"doc(
+                    Access the state table.
+
+                    Returns:
+                        StateTable: The state table.
+                )doc"
+            )
+
+            .def(
+                "get_state_at",
+                &Ephemeris::getStateAt,
+                arg("instant"),
+                R"doc(
+                    Get the interpolated state at an instant.
+
+                    Args:
+                        instant (Instant): An instant, within the interval of the ephemeris.
+
+                    Returns:
+                        State: The state, in GCRF.
+
+                    Example:
+                        >>> state = ephemeris.get_state_at(instant)
+                )doc"
+            )
+
+            .def(
+                "access_chebyshev_table",
+                &Ephemeris::accessChebyshevTable,
+                return_value_policy::reference_internal,
+                R"doc(
+                    Access the Chebyshev table of a Chebyshev ephemeris.
+
+                    Returns:
+                        ChebyshevTable: The Chebyshev table.
+                )doc"
+            )
+
+            .def_static(
+                "undefined",
+                &Ephemeris::Undefined,
+                R"doc(
+                    Create an undefined ephemeris.
+
+                    Returns:
+                        Ephemeris: An undefined ephemeris.
+                )doc"
+            )
+
+            .def_static(
+                "generate",
+                overload_cast<
+                    const Profile&,
+                    const Interval&,
+                    const Duration&,
+                    const Length&,
+                    const Angle&,
+                    const Size>(&Ephemeris::Generate),
+                arg("profile"),
+                arg("interval"),
+                arg("step"),
+                arg("position_tolerance") = DEFAULT_EPHEMERIS_POSITION_TOLERANCE,
+                arg("attitude_tolerance") = DEFAULT_EPHEMERIS_ATTITUDE_TOLERANCE,
+                arg("thread_count") = DEFAULT_EPHEMERIS_THREAD_COUNT,
+                R"doc(
+                    Generate an ephemeris by sampling a profile over an interval.
+
+                    The step is shortened so that it divides the interval evenly, then halved
+                    until interpolation errors at segment midpoints are within tolerances.
+
+                    Args:
+                        profile (Profile): The flight profile.
+                        interval (Interval): The interval to sample the profile over.
+                        step (Duration): The maximum step between samples.
+                        position_tolerance (Length): The maximum position interpolation error (optional).
+                        attitude_tolerance (Angle): The maximum attitude interpolation error (optional).
+                        thread_count (int): The sampling thread count, 0 for the hardware concurrency (optional).
+
+                    Returns:
+                        Ephemeris: The ephemeris.
+
+                    Example:
+                        >>> ephemeris = Ephemeris.generate(profile, interval, Duration.minutes(1.0))
+                )doc"
+            )
+
+            .def_static(
+                "fit",
+                overload_cast<
+                    const Profile&,
+                    const Interval&,
+                    const Duration&,
+                    const Size,
+                    const Length&,
+                    const Angle&,
+                    const Size>(&Ephemeris::Fit),
+                arg("profile"),
+                arg("interval"),
+                arg("segment_duration"),
+                arg("degree") = DEFAULT_EPHEMERIS_DEGREE,
+                arg("position_tolerance") = DEFAULT_EPHEMERIS_POSITION_TOLERANCE,
+                arg("attitude_tolerance") = DEFAULT_EPHEMERIS_ATTITUDE_TOLERANCE,
+                arg("thread_count") = DEFAULT_EPHEMERIS_THREAD_COUNT,
+                R"doc(
+                    Fit a Chebyshev ephemeris to a profile over an interval.
+
+                    Segments are halved until errors, checked between Chebyshev nodes, are within tolerances.
+
+                    Args:
+                        profile (Profile): The flight profile.
+                        interval (Interval): The interval to fit the profile over.
+                        segment_duration (Duration): The maximum segment duration.
+                        degree (int): The polynomial degree (optional).
+                        position_tolerance (Length): The maximum position error (optional).
+                        attitude_tolerance (Angle): The maximum attitude error (optional).
+                        thread_count (int): The sampling thread count, 0 for the hardware concurrency (optional).
+
+                    Returns:
+                        Ephemeris: The Chebyshev ephemeris.
+
+                    Example:
+                        >>> ephemeris = Ephemeris.fit(profile, interval, Duration.minutes(30.0))
+                )doc"
+            )
+
+            ;
+
+        enum_<Ephemeris::Type>(
+            ephemeris_class,
+            "Type",
+            R"doc(
+                Enumeration of ephemeris representations.
+            )doc"
+        )
+
+            .value(
+                "Tabulated",
+                Ephemeris::Type::Tabulated,
+                R"doc(
+                    Uniformly sampled states, interpolated.
+                )doc"
+            )
+
+            .value(
+                "Chebyshev",
+                Ephemeris::Type::Chebyshev,
+                R"doc(
+                    Chebyshev polynomial segments.
+                )doc"
+            );
+    }
+
+    class_<EphemerisConfiguration>(
+        aModule,
+        "EphemerisConfiguration",
+        R"doc(
+            Configuration of a precomputed satellite ephemeris.
+
+            An undefined interval (the default) leaves the satellite evaluating its profile directly.
+        )doc"
+    )
+
+        .def(
+            init<
+                const Interval&,
+                const Duration&,
+                const Length&,
+                const Angle&,
+                const Size,
+                const Ephemeris::Type&,
+                const Size>(),
+            arg("interval") = Interval::Undefined(),
+            arg("step") = DEFAULT_EPHEMERIS_STEP,
+            arg("position_tolerance") = DEFAULT_EPHEMERIS_POSITION_TOLERANCE,
+            arg("attitude_tolerance") = DEFAULT_EPHEMERIS_ATTITUDE_TOLERANCE,
+            arg("thread_count") = DEFAULT_EPHEMERIS_THREAD_COUNT,
+            arg("type") = DEFAULT_EPHEMERIS_TYPE,
+            arg("degree") = DEFAULT_EPHEMERIS_DEGREE,
+            R"doc(
+                Create an EphemerisConfiguration instance.
+
+                Args:
+                    interval (Interval): The sampled interval (optional).
+                    step (Duration): The maximum step, or segment duration for a Chebyshev ephemeris (optional).
+                    position_tolerance (Length): The position tolerance (optional).
+                    attitude_tolerance (Angle): The attitude tolerance (optional).
+                    thread_count (int): The sampling thread count (optional).
+                    type (Ephemeris.Type): The representation (optional).
+                    degree (int): The Chebyshev polynomial degree (optional).
+
+                Returns:
+                    EphemerisConfiguration: The configuration instance.
+
+                Example:
+                    >>> config = EphemerisConfiguration(interval=interval, step=Duration.seconds(30.0))
+            )doc"
+        )
+
+        ;
+}
@@ -0,0 +1,106 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Satellite/TransformTree.hpp>
+
+inline void OpenSpaceToolkitSimulationPy_Satellite_TransformTree(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::simulation::Component;
+    using ostk::simulation::satellite::TransformTree;
+
+    class_<TransformTree>(
+        aModule,
+        "TransformTree",
+        R"doc(
+            The frames of a component subtree, flattened for evaluation of their transforms to GCRF at one instant.
+
+            At a new instant, the transform of the root frame to GCRF is evaluated once, then composed with the
+            static mounting transforms of its components. Later queries at that instant are a lookup.
+        )doc"
+    )
+
+        .def(
+            init<const Component&>(),
+            arg("root_component"),
+            R"doc(
+                Create a TransformTree instance.
+
+                Args:
+                    root_component (Component): A root component (typically a satellite), with a frame.
+
+                Returns:
+                    TransformTree: The transform tree.
+            )doc"
+        )
+
+        .def(
+            "contains",
+            &TransformTree::contains,
+            arg("frame"),
+            R"doc(
+                Check if a frame is part of the tree.
+
+                Args:
+                    frame (Frame): A frame.
+
+                Returns:
+                    bool: True if the frame is part of the tree.
+            )doc"
+        )
+
+        .def(
+            "get_size",
+            &TransformTree::getSize,
+            R"doc(
+                Get the number of frames in the tree.
+
+                Returns:
+                    int: The number of frames, root frame included.
+            )doc"
+        )
+
+        .def(
+            "get_mounted_frame_count",
+            &TransformTree::getMountedFrameCount,
+            R"doc(
+                Get the number of frames statically mounted on their parent.
+
+                Returns:
+                    int: The number of frames evaluated by composition.
+            )doc"
+        )
+
+        .def(
+            "get_frames",
+            &TransformTree::getFrames,
+            R"doc(
+                Get the frames of the tree.
+
+                Returns:
+                    list[Frame]: The frames, in preorder from the root frame.
+            )doc"
+        )
+
+        .def(
+            "get_transform_to_gcrf",
+            &TransformTree::getTransformToGCRF,
+            arg("frame"),
+            arg("instant"),
+            R"doc(
+                Get the transform from a frame of the tree to GCRF.
+
+                Args:
+                    frame (Frame): A frame of the tree.
+                    instant (Instant): An instant.
+
+                Returns:
+                    Transform: The transform to GCRF.
+
+                Example:
+                    >>> transform = transform_tree.get_transform_to_gcrf(camera.access_frame(), instant)
+            )doc"
+        )
+
+        ;
+}
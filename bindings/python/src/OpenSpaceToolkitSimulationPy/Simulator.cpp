@@ -2,19 +2,39 @@
 
 #include <OpenSpaceToolkit/Simulation/Simulator.hpp>
 
+#include <OpenSpaceToolkitSimulationPy/Simulator/Checkpoint.cpp>
+#include <OpenSpaceToolkitSimulationPy/Simulator/Ensemble.cpp>
+#include <OpenSpaceToolkitSimulationPy/Simulator/FrameRegistry.cpp>
+#include <OpenSpaceToolkitSimulationPy/Simulator/History.cpp>
+#include <OpenSpaceToolkitSimulationPy/Simulator/Pacer.cpp>
+#include <OpenSpaceToolkitSimulationPy/Simulator/StateCache.cpp>
+#include <OpenSpaceToolkitSimulationPy/Simulator/StateTable.cpp>
+#include <OpenSpaceToolkitSimulationPy/Simulator/TimeRange.cpp>
+
 inline void OpenSpaceToolkitSimulationPy_Simulator(pybind11::module& aModule)
 {
     using namespace pybind11;
 
     using ostk::core::container::Array;
+    using ostk::core::type::Index;
     using ostk::core::type::Shared;
+    using ostk::core::type::Size;
 
     using ostk::physics::Environment;
+    using ostk::physics::time::Duration;
+    using ostk::physics::time::Instant;
+    using ostk::physics::time::Interval;
+
+    using TrajectoryState = ostk::astrodynamics::trajectory::State;
 
+    using ostk::simulation::component::State;
+    using ostk::simulation::event::Detector;
+    using ostk::simulation::event::Scheduler;
     using ostk::simulation::Satellite;
     using ostk::simulation::SatelliteConfiguration;
     using ostk::simulation::Simulator;
     using ostk::simulation::SimulatorConfiguration;
+    using ostk::simulation::simulator::Pacer;
 
     class_<Simulator, Shared<Simulator>>(
         aModule,
@@ -148,6 +168,274 @@ inline void OpenSpaceToolkitSimulationPy_Simulator(pybind11::module& aModule)
             )doc"
         )
 
+        .def(
+            "access_scheduler",
+            &Simulator::accessScheduler,
+            return_value_policy::reference_internal,
+            R"doc(
+                Access the event scheduler.
+
+                Returns:
+                    Scheduler: The event scheduler.
+
+                Example:
+                    >>> simulator.access_scheduler().get_event_count()
+                    0
+            )doc"
+        )
+
+        .def(
+            "get_component_state_with_id",
+            &Simulator::getComponentStateWithId,
+            arg("component_id"),
+            R"doc(
+                Get the state of a component.
+
+                Components whose state has never been set are in the default state.
+
+                Args:
+                    component_id (str): The component identifier.
+
+                Returns:
+                    State: The component state.
+
+                Example:
+                    >>> state = simulator.get_component_state_with_id(camera.get_id())
+            )doc"
+        )
+
+        .def(
+            "evaluate",
+            &Simulator::evaluate,
+            arg("instants"),
+            R"doc(
+                Evaluate the states of all satellites over a time grid.
+
+                The simulation instant is left unchanged. With a thread count set, the grid is split into
+                time shards evaluated concurrently.
+
+                Args:
+                    instants (list[Instant]): The time grid.
+
+                Returns:
+                    dict[str, StateTable]: Map of satellite names to state tables (in GCRF).
+
+                Example:
+                    >>> state_tables = simulator.evaluate(interval.generate_grid(Duration.seconds(10.0)))
+                    >>> positions = state_tables["sat-1"].access_positions()
+            )doc"
+        )
+
+        .def(
+            "range",
+            &Simulator::range,
+            arg("interval"),
+            arg("step"),
+            arg("chunk_size") = 64,
+            arg("prefetch") = true,
+            R"doc(
+                Get a lazy range of satellite states over the grid of an interval.
+
+                The range samples a snapshot of the simulator, evaluated chunk by chunk as it is iterated.
+                The simulation instant is left unchanged.
+
+                Args:
+                    interval (Interval): The interval.
+                    step (Duration): The step.
+                    chunk_size (int): The number of instants evaluated at once (optional).
+                    prefetch (bool): If True, evaluate the next chunk in the background (optional).
+
+                Returns:
+                    TimeRange: The time range.
+
+                Example:
+                    >>> for view in simulator.range(interval, Duration.seconds(10.0)):
+                    ...     state = view.get_satellite_state_with_name("sat-1")
+            )doc"
+        )
+
+        .def(
+            "compute_crossings",
+            &Simulator::computeCrossings,
+            arg("detector"),
+            arg("interval"),
+            arg("step"),
+            arg("tolerance") = DEFAULT_EVENT_TOLERANCE,
+            R"doc(
+                Compute the crossings of a detector over an interval.
+
+                With a thread count set, the interval is split into time shards aligned on the sampling
+                grid, searched concurrently and merged back in time order.
+
+                Args:
+                    detector (Detector): The detector.
+                    interval (Interval): The interval.
+                    step (Duration): The coarse sampling step.
+                    tolerance (Duration): The time tolerance on crossing instants (optional).
+
+                Returns:
+                    list[Detector.Crossing]: The chronologically ordered crossings.
+
+                Example:
+                    >>> crossings = simulator.compute_crossings(detector, interval, Duration.minutes(1.0))
+            )doc"
+        )
+
+        .def(
+            "get_thread_count",
+            &Simulator::getThreadCount,
+            R"doc(
+                Get the thread count used to update satellite states when the simulation time changes.
+
+                Returns:
+                    int: The thread count, 0 if the update phase is disabled.
+
+                Example:
+                    >>> simulator.get_thread_count()
+                    0
+            )doc"
+        )
+
+#if defined(__linux__)
+        .def(
+            "get_process_count",
+            &Simulator::getProcessCount,
+            R"doc(
+                Get the worker process count used to update satellite states when the simulation time changes.
+
+                Only available on Linux.
+
+                Returns:
+                    int: The worker process count, 0 if satellites are not partitioned.
+
+                Example:
+                    >>> simulator.get_process_count()
+                    0
+            )doc"
+        )
+#endif
+
+        .def(
+            "access_history",
+            &Simulator::accessHistory,
+            return_value_policy::reference_internal,
+            R"doc(
+                Access the history of recently visited instants.
+
+                Returns:
+                    History: The history.
+
+                Example:
+                    >>> simulator.access_history().get_instants()
+            )doc"
+        )
+
+        .def(
+            "access_frame_registry",
+            &Simulator::accessFrameRegistry,
+            return_value_policy::reference_internal,
+            R"doc(
+                Access the registry of the frames of the simulator. Forks share the registry.
+
+                Returns:
+                    FrameRegistry: The frame registry.
+
+                Example:
+                    >>> simulator.access_frame_registry().has_frame_with_name("Satellite [1]")
+            )doc"
+        )
+
+        .def(
+            "access_state_cache",
+            &Simulator::accessStateCache,
+            return_value_policy::reference_internal,
+            R"doc(
+                Access the cache of values evaluated lazily at the current simulation time.
+
+                Returns:
+                    StateCache: The state cache.
+
+                Example:
+                    >>> simulator.access_state_cache().is_satellite_dirty("sat-1")
+            )doc"
+        )
+
+        .def(
+            "get_satellite_state_with_name",
+            &Simulator::getSatelliteStateWithName,
+            arg("name"),
+            R"doc(
+                Get the state of a satellite at the current simulation time.
+
+                If the update phase is enabled, the state computed at the last time change is returned.
+                Otherwise, the state is evaluated when first queried at the current time, and reused by
+                subsequent queries.
+
+                Args:
+                    name (str): The satellite name.
+
+                Returns:
+                    State: The satellite state (in GCRF).
+
+                Example:
+                    >>> state = simulator.get_satellite_state_with_name("sat-1")
+            )doc"
+        )
+
+        .def(
+            "get_geometry_in_gcrf",
+            &Simulator::getGeometryInGCRF,
+            arg("geometry"),
+            R"doc(
+                Get a component geometry in GCRF at the current simulation time.
+
+                The geometry is transformed when first queried at the current time, and reused by subsequent
+                queries.
+
+                Args:
+                    geometry (Geometry): The component geometry.
+
+                Returns:
+                    Geometry: The geometry, in GCRF.
+            )doc"
+        )
+
+        .def(
+            "get_celestial_geometry_in_gcrf",
+            &Simulator::getCelestialGeometryInGCRF,
+            arg("celestial_object"),
+            R"doc(
+                Get the geometry of a celestial object in GCRF at the current simulation time.
+
+                The geometry is transformed when first queried at the current time, and reused by subsequent
+                queries.
+
+                Args:
+                    celestial_object (Celestial): The celestial object.
+
+                Returns:
+                    Geometry: The geometry, in GCRF.
+            )doc"
+        )
+
+        .def(
+            "get_transform_to_gcrf",
+            &Simulator::getTransformToGCRF,
+            arg("frame"),
+            R"doc(
+                Get the transform from a frame to GCRF at the current simulation time.
+
+                The transform is evaluated when first queried at the current time, and reused by subsequent
+                queries.
+
+                Args:
+                    frame (Frame): The frame.
+
+                Returns:
+                    Transform: The transform to GCRF.
+            )doc"
+        )
+
         .def(
             "set_instant",
             &Simulator::setInstant,
@@ -179,6 +467,402 @@ inline void OpenSpaceToolkitSimulationPy_Simulator(pybind11::module& aModule)
             )doc"
         )
 
+        .def(
+            "step_backward",
+            &Simulator::stepBackward,
+            arg("duration"),
+            R"doc(
+                Step the simulation back by a duration.
+
+                Instants held in the history are restored from it rather than evaluated again. Events are
+                not replayed.
+
+                Args:
+                    duration (Duration): The time step duration.
+
+                Example:
+                    >>> simulator.step_backward(Duration.seconds(60.0))
+            )doc"
+        )
+
+        .def(
+            "step_forward_adaptively",
+            &Simulator::stepForwardAdaptively,
+            arg("detectors"),
+            arg("minimum_step"),
+            arg("maximum_step"),
+            R"doc(
+                Step the simulation forward by the largest step over which no monitored predicate changes.
+
+                The step is the shortest safe step of all detectors, bounded by the minimum and maximum steps.
+
+                Args:
+                    detectors (list[Detector]): The monitored detectors.
+                    minimum_step (Duration): The minimum step.
+                    maximum_step (Duration): The maximum step.
+
+                Returns:
+                    Duration: The step taken.
+
+                Example:
+                    >>> step = simulator.step_forward_adaptively(
+                    ...     [detector], Duration.seconds(1.0), Duration.minutes(10.0)
+                    ... )
+            )doc"
+        )
+
+        .def(
+            "set_thread_count",
+            &Simulator::setThreadCount,
+            arg("thread_count"),
+            R"doc(
+                Set the thread count used to update satellite states when the simulation time changes.
+
+                When strictly positive, every change of the simulation time evaluates the states of all
+                satellites concurrently and stores them for subsequent queries. A thread count of 0
+                disables the update phase.
+
+                Args:
+                    thread_count (int): The thread count (including the calling thread).
+
+                Example:
+                    >>> simulator.set_thread_count(8)
+            )doc"
+        )
+
+#if defined(__linux__)
+        .def(
+            "set_process_count",
+            &Simulator::setProcessCount,
+            arg("process_count"),
+            R"doc(
+                Set the worker process count used to update satellite states when the simulation time changes.
+
+                When strictly positive, satellites are partitioned over local worker processes: every change of
+                the simulation time evaluates the states of all satellites across the workers, through shared
+                memory, and stores them (in GCRF) for subsequent queries. A process count of 0 stops the
+                workers. Only available on Linux.
+
+                Args:
+                    process_count (int): The worker process count.
+
+                Example:
+                    >>> simulator.set_process_count(4)
+            )doc"
+        )
+#endif
+
+        .def(
+            "set_history_memory_budget",
+            &Simulator::setHistoryMemoryBudget,
+            arg("memory_budget"),
+            R"doc(
+                Set the memory budget of the history of recently visited instants.
+
+                When strictly positive, the satellite and component states at every instant left are
+                recorded. Moving back to a recorded instant restores these states from memory instead of
+                evaluating them: component state changes made since are reverted. The history is cleared
+                when satellites change or a checkpoint is restored. A zero budget disables the history.
+
+                Args:
+                    memory_budget (int): The memory budget [bytes].
+
+                Example:
+                    >>> simulator.set_history_memory_budget(16 * 1024 * 1024)
+            )doc"
+        )
+
+        .def(
+            "add_pre_step_observer",
+            overload_cast<const std::function<void(const Simulator&, const Instant&)>&>(
+                &Simulator::addPreStepObserver
+            ),
+            arg("observer"),
+            R"doc(
+                Add an observer called before every change of the simulation time.
+
+                Observers are called in subscription order, with the new instant, and may not add or
+                remove observers.
+
+                Args:
+                    observer (Callable[[Simulator, Instant], None]): The observer.
+
+                Returns:
+                    int: The observer identifier.
+
+                Example:
+                    >>> observer_id = simulator.add_pre_step_observer(lambda simulator, instant: print(instant))
+            )doc"
+        )
+
+        .def(
+            "add_post_step_observer",
+            overload_cast<const std::function<void(const Simulator&, const Instant&)>&>(
+                &Simulator::addPostStepObserver
+            ),
+            arg("observer"),
+            R"doc(
+                Add an observer called after every change of the simulation time.
+
+                Observers are called in subscription order, once satellite states are updated, and may
+                not add or remove observers.
+
+                Args:
+                    observer (Callable[[Simulator, Instant], None]): The observer.
+
+                Returns:
+                    int: The observer identifier.
+
+                Example:
+                    >>> observer_id = simulator.add_post_step_observer(lambda simulator, instant: print(instant))
+            )doc"
+        )
+
+        .def(
+            "add_satellite_observer",
+            overload_cast<const std::function<void(const Simulator&, const Satellite&, const TrajectoryState&)>&>(
+                &Simulator::addSatelliteObserver
+            ),
+            arg("observer"),
+            R"doc(
+                Add an observer called with every satellite state, after every change of the simulation time.
+
+                Satellites are traversed once per step, in name order. Satellites without a state at the
+                simulation time are observed with an undefined state.
+
+                Args:
+                    observer (Callable[[Simulator, Satellite, State], None]): The observer.
+
+                Returns:
+                    int: The observer identifier.
+
+                Example:
+                    >>> observer_id = simulator.add_satellite_observer(
+                    ...     lambda simulator, satellite, state: print(satellite.get_name(), state)
+                    ... )
+            )doc"
+        )
+
+        .def(
+            "remove_observer",
+            &Simulator::removeObserver,
+            arg("observer_id"),
+            R"doc(
+                Remove an observer.
+
+                Args:
+                    observer_id (int): The observer identifier.
+
+                Example:
+                    >>> simulator.remove_observer(observer_id)
+            )doc"
+        )
+
+        .def(
+            "set_component_state_with_id",
+            &Simulator::setComponentStateWithId,
+            arg("component_id"),
+            arg("state"),
+            R"doc(
+                Set the state of a component.
+
+                Args:
+                    component_id (str): The component identifier.
+                    state (State): The component state.
+
+                Example:
+                    >>> simulator.set_component_state_with_id(camera.get_id(), State(State.Status.Idle))
+            )doc"
+        )
+
+        .def(
+            "schedule_event",
+            &Simulator::scheduleEvent,
+            arg("instant"),
+            arg("callback"),
+            R"doc(
+                Schedule an event.
+
+                When the event fires, the simulation time is set to the event instant and the
+                callback is called with the simulator.
+
+                Args:
+                    instant (Instant): The event instant, not earlier than the simulation instant.
+                    callback (Callable[[Simulator], None]): The callback.
+
+                Returns:
+                    int: The event identifier.
+
+                Example:
+                    >>> event_id = simulator.schedule_event(instant, lambda simulator: print(simulator.get_instant()))
+            )doc"
+        )
+
+        .def(
+            "schedule_component_state_change",
+            &Simulator::scheduleComponentStateChange,
+            arg("instant"),
+            arg("component_id"),
+            arg("state"),
+            R"doc(
+                Schedule a component state change.
+
+                Args:
+                    instant (Instant): The event instant, not earlier than the simulation instant.
+                    component_id (str): The component identifier.
+                    state (State): The component state to set.
+
+                Returns:
+                    int: The event identifier.
+
+                Example:
+                    >>> simulator.schedule_component_state_change(instant, camera.get_id(), State(State.Status.Busy))
+            )doc"
+        )
+
+        .def(
+            "schedule_crossings",
+            &Simulator::scheduleCrossings,
+            arg("detector"),
+            arg("interval"),
+            arg("step"),
+            arg("callback"),
+            R"doc(
+                Detect the crossings of a geometric predicate over an interval, and schedule an event at each.
+
+                Args:
+                    detector (Detector): The detector.
+                    interval (Interval): The interval, not starting earlier than the simulation instant.
+                    step (Duration): The coarse sampling step.
+                    callback (Callable[[Simulator, Detector.Crossing], None]): The callback.
+
+                Returns:
+                    list[int]: The event identifiers.
+
+                Example:
+                    >>> simulator.schedule_crossings(
+                    ...     detector, interval, Duration.minutes(1.0), lambda simulator, crossing: print(crossing.type)
+                    ... )
+            )doc"
+        )
+
+        .def(
+            "cancel_event",
+            &Simulator::cancelEvent,
+            arg("event_id"),
+            R"doc(
+                Cancel a pending event.
+
+                Args:
+                    event_id (int): The event identifier.
+
+                Example:
+                    >>> simulator.cancel_event(event_id)
+            )doc"
+        )
+
+        .def(
+            "run",
+            &Simulator::run,
+            arg("instant"),
+            R"doc(
+                Advance the simulation from event to event, up to a given instant.
+
+                Pending events up to (and including) the instant are fired in chronological order,
+                including events scheduled by callbacks during the run. The simulation time is finally
+                set to the given instant.
+
+                Args:
+                    instant (Instant): The final instant, not earlier than the simulation instant.
+
+                Example:
+                    >>> simulator.run(instant + Duration.days(30.0))
+            )doc"
+        )
+
+        .def(
+            "run_paced",
+            &Simulator::runPaced,
+            arg("instant"),
+            arg("pacer"),
+            arg("frame_callback") = std::function<void(Simulator&, const Pacer::Frame&)>(),
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Advance the simulation up to a given instant, paced by the wall clock.
+
+                The simulation runs frame by frame, firing pending events as `run` does. The frame
+                callback is called after each frame, with its timing, before waiting for the frame
+                deadline.
+
+                Args:
+                    instant (Instant): The final instant, not earlier than the simulation instant.
+                    pacer (Pacer): The pacer.
+                    frame_callback (Callable[[Simulator, Pacer.Frame], None]): Called after each frame (optional).
+
+                Returns:
+                    Pacer.Report: The timing statistics of the run.
+
+                Example:
+                    >>> report = simulator.run_paced(
+                    ...     instant + Duration.hours(1.0), Pacer(10.0, Duration.milliseconds(100.0))
+                    ... )
+            )doc"
+        )
+
+        .def(
+            "fork",
+            &Simulator::fork,
+            R"doc(
+                Fork the simulation into an independent branch.
+
+                The fork starts from the same instant, component states and pending events. Satellite
+                component trees and state maps are shared, and only copied when a branch modifies them. The
+                fork also copies a satellite the first time it hands it out, binding its components to the fork.
+                Profiles, frames and geometry shapes stay shared.
+
+                Returns:
+                    Simulator: The forked simulator.
+
+                Example:
+                    >>> branch = simulator.fork()
+                    >>> branch.step_forward(Duration.minutes(5.0))
+            )doc"
+        )
+
+        .def(
+            "create_checkpoint",
+            &Simulator::createCheckpoint,
+            R"doc(
+                Create a checkpoint of the simulation.
+
+                The checkpoint records the simulation instant, the satellite states and the component states.
+
+                Returns:
+                    Checkpoint: The checkpoint.
+
+                Example:
+                    >>> checkpoint = simulator.create_checkpoint()
+            )doc"
+        )
+
+        .def(
+            "restore",
+            &Simulator::restore,
+            arg("checkpoint"),
+            R"doc(
+                Restore the simulation from a checkpoint.
+
+                The simulator must hold the same satellites and component trees as the checkpoint,
+                typically by being configured identically. Pending events are cancelled.
+
+                Args:
+                    checkpoint (Checkpoint): The checkpoint.
+
+                Example:
+                    >>> simulator.restore(Checkpoint.load(File.path(Path.parse("/tmp/checkpoint.bin"))))
+            )doc"
+        )
+
         .def(
             "add_satellite",
             &Simulator::addSatellite,
@@ -194,6 +878,24 @@ inline void OpenSpaceToolkitSimulationPy_Simulator(pybind11::module& aModule)
             )doc"
         )
 
+        .def(
+            "add_satellites",
+            &Simulator::addSatellites,
+            arg("satellites"),
+            R"doc(
+                Add satellites to the simulation, in a single batch.
+
+                All satellites are validated before any is added. A satellite whose name is already used is
+                not added.
+
+                Args:
+                    satellites (list[Satellite]): The satellites to add.
+
+                Example:
+                    >>> simulator.add_satellites([satellite_1, satellite_2])
+            )doc"
+        )
+
         .def(
             "remove_satellite_with_name",
             &Simulator::removeSatelliteWithName,
@@ -209,6 +911,23 @@ inline void OpenSpaceToolkitSimulationPy_Simulator(pybind11::module& aModule)
             )doc"
         )
 
+        .def(
+            "remove_satellites_with_names",
+            &Simulator::removeSatellitesWithNames,
+            arg("names"),
+            R"doc(
+                Remove satellites from the simulation by name, in a single batch.
+
+                All names are validated before any satellite is removed.
+
+                Args:
+                    names (list[str]): The satellite names.
+
+                Example:
+                    >>> simulator.remove_satellites_with_names(["sat-1", "sat-2"])
+            )doc"
+        )
+
         .def(
             "clear_satellites",
             &Simulator::clearSatellites,
@@ -274,15 +993,17 @@ inline void OpenSpaceToolkitSimulationPy_Simulator(pybind11::module& aModule)
     )
 
         .def(
-            init<const Environment&, const Array<SatelliteConfiguration>&>(),
+            init<const Environment&, const Array<SatelliteConfiguration>&, const Size&>(),
             arg("environment"),
             arg("satellites") = DEFAULT_SATELLITES,
+            arg("thread_count") = DEFAULT_THREAD_COUNT,
             R"doc(
                 Create a SimulatorConfiguration instance.
 
                 Args:
                     environment (Environment): The physics environment.
                     satellites (list[SatelliteConfiguration]): Array of satellite configurations (optional).
+                    thread_count (int): Satellite state update thread count, 0 to disable (optional).
 
                 Returns:
                     SimulatorConfiguration: The configuration instance.
@@ -296,4 +1017,17 @@ inline void OpenSpaceToolkitSimulationPy_Simulator(pybind11::module& aModule)
         )
 
         ;
+
+    // Create python submodule
+    auto simulator = aModule.def_submodule("simulator");
+
+    // Add objects to python submodule
+    OpenSpaceToolkitSimulationPy_Simulator_Checkpoint(simulator);
+    OpenSpaceToolkitSimulationPy_Simulator_Ensemble(simulator);
+    OpenSpaceToolkitSimulationPy_Simulator_FrameRegistry(simulator);
+    OpenSpaceToolkitSimulationPy_Simulator_History(simulator);
+    OpenSpaceToolkitSimulationPy_Simulator_Pacer(simulator);
+    OpenSpaceToolkitSimulationPy_Simulator_StateCache(simulator);
+    OpenSpaceToolkitSimulationPy_Simulator_StateTable(simulator);
+    OpenSpaceToolkitSimulationPy_Simulator_TimeRange(simulator);
 }
@@ -0,0 +1,228 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Simulator/Checkpoint.hpp>
+
+inline void OpenSpaceToolkitSimulationPy_Simulator_Checkpoint(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::String;
+
+    using ostk::simulation::simulator::Checkpoint;
+
+    {
+        class_<Checkpoint> checkpoint_class(
+            aModule,
+            "Checkpoint",
+            R"doc(
+                Snapshot of the dynamic state of a simulation.
+
+                A checkpoint records the simulation instant, the satellite states (in GCRF) and the
+                component trees with their states. Profiles and geometries are not recorded: a checkpoint
+                restores into a simulator built from the same configuration.
+            )doc"
+        );
+
+        class_<Checkpoint::ComponentRecord>(
+            checkpoint_class,
+            "ComponentRecord",
+            R"doc(
+                A recorded component.
+            )doc"
+        )
+
+            .def_readonly(
+                "id",
+                &Checkpoint::ComponentRecord::id,
+                R"doc(
+                    The component identifier.
+                )doc"
+            )
+
+            .def_readonly(
+                "name",
+                &Checkpoint::ComponentRecord::name,
+                R"doc(
+                    The component name.
+                )doc"
+            )
+
+            .def_readonly(
+                "depth",
+                &Checkpoint::ComponentRecord::depth,
+                R"doc(
+                    The depth in the satellite component tree (0 for the satellite itself).
+                )doc"
+            )
+
+            .def_readonly(
+                "state",
+                &Checkpoint::ComponentRecord::state,
+                R"doc(
+                    The component state.
+                )doc"
+            );
+
+        class_<Checkpoint::SatelliteRecord>(
+            checkpoint_class,
+            "SatelliteRecord",
+            R"doc(
+                A recorded satellite.
+            )doc"
+        )
+
+            .def_readonly(
+                "id",
+                &Checkpoint::SatelliteRecord::id,
+                R"doc(
+                    The satellite identifier.
+                )doc"
+            )
+
+            .def_readonly(
+                "name",
+                &Checkpoint::SatelliteRecord::name,
+                R"doc(
+                    The satellite name.
+                )doc"
+            )
+
+            .def_readonly(
+                "state",
+                &Checkpoint::SatelliteRecord::state,
+                R"doc(
+                    The satellite state, in GCRF.
+                )doc"
+            )
+
+            .def_readonly(
+                "component_records",
+                &Checkpoint::SatelliteRecord::componentRecords,
+                R"doc(
+                    The depth-first component records, starting with the satellite itself.
+                )doc"
+            );
+
+        checkpoint_class
+
+            .def("__str__", &(shiftToString<Checkpoint>))
+            .def("__repr__", &(shiftToString<Checkpoint>))
+
+            .def(
+                "is_defined",
+                &Checkpoint::isDefined,
+                R"doc(
+                    Check if the checkpoint is defined.
+
+                    Returns:
+                        bool: True if the checkpoint is defined, False otherwise.
+                )doc"
+            )
+
+            .def(
+                "get_instant",
+                &Checkpoint::getInstant,
+                R"doc(
+                    Get the checkpoint instant.
+
+                    Returns:
+                        Instant: The checkpoint instant.
+                )doc"
+            )
+
+            .def(
+                "access_satellite_records",
+                &Checkpoint::accessSatelliteRecords,
+                R"doc(
+                    Access the satellite records.
+
+                    Returns:
+                        list[Checkpoint.SatelliteRecord]: The satellite records.
+                )doc"
+            )
+
+            .def(
+                "to_bytes",
+                [](const Checkpoint& aCheckpoint) -> bytes
+                {
+                    return bytes(aCheckpoint.toBytes());
+                },
+                R"doc(
+                    Serialize the checkpoint to bytes.
+
+                    Returns:
+                        bytes: The binary representation of the checkpoint.
+
+                    Example:
+                        >>> data = checkpoint.to_bytes()
+                )doc"
+            )
+
+            .def(
+                "save",
+                &Checkpoint::save,
+                arg("file"),
+                R"doc(
+                    Save the checkpoint to a file.
+
+                    Args:
+                        file (File): The file, overwritten if it exists.
+
+                    Example:
+                        >>> checkpoint.save(File.path(Path.parse("/tmp/checkpoint.bin")))
+                )doc"
+            )
+
+            .def_static(
+                "undefined",
+                &Checkpoint::Undefined,
+                R"doc(
+                    Create an undefined checkpoint.
+
+                    Returns:
+                        Checkpoint: An undefined checkpoint.
+                )doc"
+            )
+
+            .def_static(
+                "from_bytes",
+                [](const bytes& aByteString) -> Checkpoint
+                {
+                    return Checkpoint::FromBytes(String(static_cast<std::string>(aByteString)));
+                },
+                arg("data"),
+                R"doc(
+                    Deserialize a checkpoint from bytes.
+
+                    Args:
+                        data (bytes): The binary representation of a checkpoint.
+
+                    Returns:
+                        Checkpoint: The checkpoint.
+
+                    Example:
+                        >>> checkpoint = Checkpoint.from_bytes(data)
+                )doc"
+            )
+
+            .def_static(
+                "load",
+                &Checkpoint::Load,
+                arg("file"),
+                R"doc(
+                    Load a checkpoint from a file, through a memory mapping.
+
+                    Args:
+                        file (File): The checkpoint file.
+
+                    Returns:
+                        Checkpoint: The checkpoint.
+
+                    Example:
+                        >>> checkpoint = Checkpoint.load(File.path(Path.parse("/tmp/checkpoint.bin")))
+                )doc"
+            )
+
+            ;
+    }
+}
@@ -0,0 +1,198 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Simulator/Ensemble.hpp>
+
+inline void OpenSpaceToolkitSimulationPy_Simulator_Ensemble(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Size;
+
+    using ostk::simulation::SimulatorConfiguration;
+    using ostk::simulation::simulator::Ensemble;
+
+    class_<Ensemble> ensemble_class(
+        aModule,
+        "Ensemble",
+        R"doc(
+            Monte Carlo ensemble of simulations.
+
+            Each replica is configured from a perturbation of a base configuration, evaluated into a list
+            of scalar outputs, then discarded. Replicas run concurrently on a thread pool and their outputs
+            are reduced in replica order, so that results are deterministic for a given seed regardless
+            of the thread count. Python functions are called with the GIL held.
+        )doc"
+    );
+
+    class_<Ensemble::Statistics>(
+        ensemble_class,
+        "Statistics",
+        R"doc(
+            Statistics of an output, over the replicas where it is defined.
+        )doc"
+    )
+
+        .def_readonly(
+            "count",
+            &Ensemble::Statistics::count,
+            R"doc(
+                The number of replicas where the output is defined.
+            )doc"
+        )
+
+        .def_readonly(
+            "mean",
+            &Ensemble::Statistics::mean,
+            R"doc(
+                The mean.
+            )doc"
+        )
+
+        .def_readonly(
+            "standard_deviation",
+            &Ensemble::Statistics::standardDeviation,
+            R"doc(
+                The sample standard deviation.
+            )doc"
+        )
+
+        .def_readonly(
+            "minimum",
+            &Ensemble::Statistics::minimum,
+            R"doc(
+                The minimum.
+            )doc"
+        )
+
+        .def_readonly(
+            "maximum",
+            &Ensemble::Statistics::maximum,
+            R"doc(
+                The maximum.
+            )doc"
+        );
+
+    ensemble_class
+
+        .def(
+            init<
+                const SimulatorConfiguration&,
+                const Ensemble::Perturbation&,
+                const Ensemble::Evaluation&,
+                const Size&,
+                const std::uint64_t&,
+                const Size&>(),
+            arg("base_configuration"),
+            arg("perturbation"),
+            arg("evaluation"),
+            arg("replica_count"),
+            arg("seed"),
+            arg("thread_count") = 1,
+            R"doc(
+                Create an ensemble.
+
+                Args:
+                    base_configuration (SimulatorConfiguration): The base simulator configuration.
+                    perturbation (Callable[[SimulatorConfiguration, int, int], SimulatorConfiguration]):
+                        Returns the configuration of a replica, from the base configuration, the replica
+                        index and the replica seed.
+                    evaluation (Callable[[Simulator], list[float]]): Runs a replica and returns its outputs.
+                    replica_count (int): The replica count.
+                    seed (int): The ensemble seed.
+                    thread_count (int): The thread count (optional).
+
+                Returns:
+                    Ensemble: The ensemble.
+
+                Example:
+                    >>> ensemble = Ensemble(configuration, perturbation, evaluation, 1000, 42, 8)
+            )doc"
+        )
+
+        .def(
+            "get_replica_count",
+            &Ensemble::getReplicaCount,
+            R"doc(
+                Get the replica count.
+
+                Returns:
+                    int: The replica count.
+            )doc"
+        )
+
+        .def(
+            "get_seed",
+            &Ensemble::getSeed,
+            R"doc(
+                Get the ensemble seed.
+
+                Returns:
+                    int: The ensemble seed.
+            )doc"
+        )
+
+        .def(
+            "get_thread_count",
+            &Ensemble::getThreadCount,
+            R"doc(
+                Get the thread count.
+
+                Returns:
+                    int: The thread count.
+            )doc"
+        )
+
+        .def(
+            "get_replica_seed",
+            &Ensemble::getReplicaSeed,
+            arg("replica_index"),
+            R"doc(
+                Get the seed of a replica.
+
+                Args:
+                    replica_index (int): The replica index.
+
+                Returns:
+                    int: The replica seed.
+            )doc"
+        )
+
+        .def(
+            "run",
+            &Ensemble::run,
+            arg("reduction") = Ensemble::Reduction(),
+            call_guard<gil_scoped_release>(),
+            R"doc(
+                Run the ensemble and compute output statistics.
+
+                Args:
+                    reduction (Callable[[int, list[float]], None]): Called with each replica index and
+                        outputs, in replica order (optional).
+
+                Returns:
+                    list[Ensemble.Statistics]: The statistics of each output.
+
+                Example:
+                    >>> statistics = ensemble.run()
+            )doc"
+        )
+
+        .def_static(
+            "generate_seed",
+            &Ensemble::GenerateSeed,
+            arg("seed"),
+            arg("replica_index"),
+            R"doc(
+                Derive a replica seed from an ensemble seed, with SplitMix64.
+
+                Args:
+                    seed (int): The ensemble seed.
+                    replica_index (int): The replica index.
+
+                Returns:
+                    int: The replica seed.
+            )doc"
+        )
+
+        ;
+}
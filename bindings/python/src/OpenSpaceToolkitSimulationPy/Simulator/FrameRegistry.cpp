@@ -0,0 +1,118 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Simulator/FrameRegistry.hpp>
+
+inline void OpenSpaceToolkitSimulationPy_Simulator_FrameRegistry(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Shared;
+
+    using ostk::simulation::simulator::FrameRegistry;
+
+    class_<FrameRegistry, Shared<FrameRegistry>>(
+        aModule,
+        "FrameRegistry",
+        R"doc(
+            Registry of the frames of a simulator, by name.
+
+            Frames are constructed outside the global frame registry, so that simulators holding frames of the
+            same name (e.g. replicas of an ensemble) do not replace each other's frames. Frames are referred to
+            weakly, and are released with the satellites and components they are generated for.
+        )doc"
+    )
+
+        .def(
+            init<>(),
+            R"doc(
+                Create a FrameRegistry instance.
+            )doc"
+        )
+
+        .def("__str__", &(shiftToString<FrameRegistry>))
+        .def("__repr__", &(shiftToString<FrameRegistry>))
+
+        .def(
+            "has_frame_with_name",
+            &FrameRegistry::hasFrameWithName,
+            arg("name"),
+            R"doc(
+                Check if a live frame is registered under a name.
+
+                Args:
+                    name (str): The frame name.
+
+                Returns:
+                    bool: True if a live frame is registered under the name.
+            )doc"
+        )
+
+        .def(
+            "get_size",
+            &FrameRegistry::getSize,
+            R"doc(
+                Get the number of live registered frames.
+
+                Returns:
+                    int: The number of live frames.
+            )doc"
+        )
+
+        .def(
+            "access_frame_with_name",
+            &FrameRegistry::accessFrameWithName,
+            arg("name"),
+            R"doc(
+                Access the frame registered under a name.
+
+                Args:
+                    name (str): The frame name.
+
+                Returns:
+                    Frame: The frame.
+            )doc"
+        )
+
+        .def(
+            "construct_frame",
+            &FrameRegistry::constructFrame,
+            arg("name"),
+            arg("is_quasi_inertial"),
+            arg("parent_frame"),
+            arg("provider"),
+            R"doc(
+                Construct a frame and register it, replacing any frame registered under its name.
+
+                Args:
+                    name (str): The frame name.
+                    is_quasi_inertial (bool): True if the frame is quasi-inertial.
+                    parent_frame (Frame): The parent frame.
+                    provider (Provider): The provider of transforms from the parent frame.
+
+                Returns:
+                    Frame: The frame.
+            )doc"
+        )
+
+        .def(
+            "remove_frame_with_name",
+            &FrameRegistry::removeFrameWithName,
+            arg("name"),
+            R"doc(
+                Remove the frame registered under a name, if any.
+
+                Args:
+                    name (str): The frame name.
+            )doc"
+        )
+
+        .def(
+            "clear",
+            &FrameRegistry::clear,
+            R"doc(
+                Remove all frames.
+            )doc"
+        )
+
+        ;
+}
@@ -0,0 +1,173 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Simulator/History.hpp>
+
+inline void OpenSpaceToolkitSimulationPy_Simulator_History(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Size;
+
+    using ostk::simulation::simulator::History;
+
+    class_<History>(
+        aModule,
+        "History",
+        R"doc(
+            Bounded history of simulation states, by instant.
+
+            Each entry holds the satellite states (in GCRF) and the component states at an instant. The
+            history is bounded by a memory budget: the oldest entries are evicted first once it is reached.
+            A zero budget disables the history.
+        )doc"
+    )
+
+        .def(
+            init<const Size&>(),
+            arg("memory_budget"),
+            R"doc(
+                Create a History instance.
+
+                Args:
+                    memory_budget (int): The memory budget [bytes], zero to disable the history.
+            )doc"
+        )
+
+        .def("__str__", &(shiftToString<History>))
+        .def("__repr__", &(shiftToString<History>))
+
+        .def(
+            "is_enabled",
+            &History::isEnabled,
+            R"doc(
+                Check if the history is enabled.
+
+                Returns:
+                    bool: True if the memory budget is not zero.
+            )doc"
+        )
+
+        .def(
+            "is_empty",
+            &History::isEmpty,
+            R"doc(
+                Check if the history is empty.
+
+                Returns:
+                    bool: True if the history holds no entry.
+            )doc"
+        )
+
+        .def(
+            "has_instant",
+            &History::hasInstant,
+            arg("instant"),
+            R"doc(
+                Check if the history holds an entry at an instant.
+
+                Args:
+                    instant (Instant): The instant.
+
+                Returns:
+                    bool: True if the history holds an entry at the instant.
+            )doc"
+        )
+
+        .def(
+            "get_size",
+            &History::getSize,
+            R"doc(
+                Get the number of entries.
+
+                Returns:
+                    int: The number of entries.
+            )doc"
+        )
+
+        .def(
+            "get_memory_budget",
+            &History::getMemoryBudget,
+            R"doc(
+                Get the memory budget.
+
+                Returns:
+                    int: The memory budget [bytes].
+            )doc"
+        )
+
+        .def(
+            "get_memory_usage",
+            &History::getMemoryUsage,
+            R"doc(
+                Get the estimated memory usage of the entries.
+
+                Returns:
+                    int: The estimated memory usage [bytes].
+            )doc"
+        )
+
+        .def(
+            "get_instants",
+            &History::getInstants,
+            R"doc(
+                Get the recorded instants, from oldest to most recently recorded.
+
+                Returns:
+                    list[Instant]: The instants.
+            )doc"
+        )
+
+        .def(
+            "get_satellite_states_at",
+            &History::getSatelliteStatesAt,
+            arg("instant"),
+            R"doc(
+                Get the satellite states recorded at an instant.
+
+                Args:
+                    instant (Instant): The instant.
+
+                Returns:
+                    dict[str, State]: The satellite states (in GCRF), by satellite name.
+            )doc"
+        )
+
+        .def(
+            "set_memory_budget",
+            &History::setMemoryBudget,
+            arg("memory_budget"),
+            R"doc(
+                Set the memory budget, evicting the oldest entries beyond it.
+
+                Args:
+                    memory_budget (int): The memory budget [bytes], zero to disable the history.
+            )doc"
+        )
+
+        .def(
+            "clear",
+            &History::clear,
+            R"doc(
+                Remove all entries.
+            )doc"
+        )
+
+        .def_static(
+            "estimate_entry_size",
+            &History::EstimateEntrySize,
+            arg("satellite_count"),
+            arg("component_count"),
+            R"doc(
+                Estimate the memory size of an entry.
+
+                Args:
+                    satellite_count (int): The number of satellites.
+                    component_count (int): The number of components.
+
+                Returns:
+                    int: The estimated entry size [bytes].
+            )doc"
+        )
+
+        ;
+}
@@ -0,0 +1,324 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Simulator/Pacer.hpp>
+
+inline void OpenSpaceToolkitSimulationPy_Simulator_Pacer(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Real;
+
+    using ostk::physics::time::Duration;
+
+    using ostk::simulation::simulator::Pacer;
+
+    {
+        class_<Pacer> pacer_class(
+            aModule,
+            "Pacer",
+            R"doc(
+                Wall-clock pacing of a simulation run.
+
+                A paced run advances the simulation in frames of fixed wall-clock period: each frame
+                advances the simulation by the frame period scaled by the time ratio, then waits for the
+                frame deadline. A frame overruns when its computation ends after its deadline, and the
+                catch-up policy decides how the following frames recover. An unpaced run (as fast as
+                possible) advances the simulation by a fixed step per frame, without waiting.
+            )doc"
+        );
+
+        enum_<Pacer::CatchUpPolicy>(
+            pacer_class,
+            "CatchUpPolicy",
+            R"doc(
+                Recovery policy after an overrun.
+            )doc"
+        )
+
+            .value(
+                "Skip",
+                Pacer::CatchUpPolicy::Skip,
+                R"doc(
+                    Restart the frame schedule from the overrun: the simulation falls behind the wall clock.
+                )doc"
+            )
+
+            .value(
+                "Burst",
+                Pacer::CatchUpPolicy::Burst,
+                R"doc(
+                    Keep the frame schedule: late frames run back to back until back on time.
+                )doc"
+            )
+
+            .value(
+                "Stretch",
+                Pacer::CatchUpPolicy::Stretch,
+                R"doc(
+                    Restart the frame schedule, and lengthen the next step by the lag.
+                )doc"
+            );
+
+        class_<Pacer::Frame>(
+            pacer_class,
+            "Frame",
+            R"doc(
+                Timing of a frame.
+            )doc"
+        )
+
+            .def_readonly(
+                "index",
+                &Pacer::Frame::index,
+                R"doc(
+                    The frame index.
+                )doc"
+            )
+
+            .def_readonly(
+                "instant",
+                &Pacer::Frame::instant,
+                R"doc(
+                    The simulation instant at the end of the frame.
+                )doc"
+            )
+
+            .def_readonly(
+                "compute_duration",
+                &Pacer::Frame::computeDuration,
+                R"doc(
+                    The wall-clock computation duration.
+                )doc"
+            )
+
+            .def_readonly(
+                "lag",
+                &Pacer::Frame::lag,
+                R"doc(
+                    The wall-clock delay past the frame deadline (zero if on time).
+                )doc"
+            )
+
+            .def_readonly(
+                "is_overrun",
+                &Pacer::Frame::isOverrun,
+                R"doc(
+                    True if the frame ended past its deadline.
+                )doc"
+            );
+
+        class_<Pacer::Report>(
+            pacer_class,
+            "Report",
+            R"doc(
+                Timing statistics of a paced run.
+            )doc"
+        )
+
+            .def_readonly(
+                "frame_count",
+                &Pacer::Report::frameCount,
+                R"doc(
+                    The number of frames.
+                )doc"
+            )
+
+            .def_readonly(
+                "overrun_count",
+                &Pacer::Report::overrunCount,
+                R"doc(
+                    The number of overrun frames.
+                )doc"
+            )
+
+            .def_readonly(
+                "mean_compute_duration",
+                &Pacer::Report::meanComputeDuration,
+                R"doc(
+                    The mean wall-clock computation duration per frame.
+                )doc"
+            )
+
+            .def_readonly(
+                "maximum_compute_duration",
+                &Pacer::Report::maximumComputeDuration,
+                R"doc(
+                    The maximum wall-clock computation duration of a frame.
+                )doc"
+            )
+
+            .def_readonly(
+                "maximum_lag",
+                &Pacer::Report::maximumLag,
+                R"doc(
+                    The maximum delay past a frame deadline.
+                )doc"
+            )
+
+            .def_readonly(
+                "wall_clock_duration",
+                &Pacer::Report::wallClockDuration,
+                R"doc(
+                    The wall-clock duration of the run.
+                )doc"
+            )
+
+            .def_readonly(
+                "achieved_time_ratio",
+                &Pacer::Report::achievedTimeRatio,
+                R"doc(
+                    The simulated duration over the wall-clock duration.
+                )doc"
+            );
+
+        pacer_class
+
+            .def(
+                init<const Real&, const Duration&, const Pacer::CatchUpPolicy&>(),
+                arg("time_ratio"),
+                arg("frame_period"),
+                arg("catch_up_policy") = Pacer::CatchUpPolicy::Skip,
+                R"doc(
+                    Create a paced pacer.
+
+                    Args:
+                        time_ratio (float): The ratio of simulated time to wall-clock time.
+                        frame_period (Duration): The wall-clock frame period.
+                        catch_up_policy (Pacer.CatchUpPolicy): The catch-up policy (optional).
+
+                    Returns:
+                        Pacer: The pacer.
+
+                    Example:
+                        >>> pacer = Pacer(10.0, Duration.milliseconds(100.0))
+                )doc"
+            )
+
+            .def("__str__", &(shiftToString<Pacer>))
+            .def("__repr__", &(shiftToString<Pacer>))
+
+            .def(
+                "is_defined",
+                &Pacer::isDefined,
+                R"doc(
+                    Check if the pacer is defined.
+
+                    Returns:
+                        bool: True if the pacer is defined, False otherwise.
+                )doc"
+            )
+
+            .def(
+                "is_paced",
+                &Pacer::isPaced,
+                R"doc(
+                    Check if the pacer follows the wall clock.
+
+                    Returns:
+                        bool: True if the pacer follows the wall clock, False if it runs as fast as possible.
+                )doc"
+            )
+
+            .def(
+                "get_time_ratio",
+                &Pacer::getTimeRatio,
+                R"doc(
+                    Get the time ratio.
+
+                    Returns:
+                        float: The time ratio (undefined if not paced).
+                )doc"
+            )
+
+            .def(
+                "get_frame_period",
+                &Pacer::getFramePeriod,
+                R"doc(
+                    Get the wall-clock frame period.
+
+                    Returns:
+                        Duration: The frame period (zero if not paced).
+                )doc"
+            )
+
+            .def(
+                "get_step",
+                &Pacer::getStep,
+                R"doc(
+                    Get the simulation step of a frame.
+
+                    Returns:
+                        Duration: The simulation step.
+                )doc"
+            )
+
+            .def(
+                "get_catch_up_policy",
+                &Pacer::getCatchUpPolicy,
+                R"doc(
+                    Get the catch-up policy.
+
+                    Returns:
+                        Pacer.CatchUpPolicy: The catch-up policy.
+                )doc"
+            )
+
+            .def_static(
+                "undefined",
+                &Pacer::Undefined,
+                R"doc(
+                    Create an undefined pacer.
+
+                    Returns:
+                        Pacer: An undefined pacer.
+                )doc"
+            )
+
+            .def_static(
+                "real_time",
+                &Pacer::RealTime,
+                arg("frame_period"),
+                R"doc(
+                    Create a real-time pacer.
+
+                    Args:
+                        frame_period (Duration): The wall-clock frame period.
+
+                    Returns:
+                        Pacer: A real-time pacer.
+                )doc"
+            )
+
+            .def_static(
+                "as_fast_as_possible",
+                &Pacer::AsFastAsPossible,
+                arg("step"),
+                R"doc(
+                    Create a pacer running as fast as possible.
+
+                    Args:
+                        step (Duration): The simulation step per frame.
+
+                    Returns:
+                        Pacer: An unpaced pacer.
+                )doc"
+            )
+
+            .def_static(
+                "string_from_catch_up_policy",
+                &Pacer::StringFromCatchUpPolicy,
+                arg("catch_up_policy"),
+                R"doc(
+                    Convert a catch-up policy to a string.
+
+                    Args:
+                        catch_up_policy (Pacer.CatchUpPolicy): The catch-up policy.
+
+                    Returns:
+                        str: The string representation.
+                )doc"
+            )
+
+            ;
+    }
+}
@@ -0,0 +1,131 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Simulator/StateCache.hpp>
+
+inline void OpenSpaceToolkitSimulationPy_Simulator_StateCache(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::simulation::simulator::StateCache;
+
+    class_<StateCache>(
+        aModule,
+        "StateCache",
+        R"doc(
+            Cache of values evaluated lazily at the current simulation time.
+
+            Satellite states, GCRF geometries of components and celestial objects, and frame transforms to
+            GCRF are evaluated when a query first touches them at the current time, then reused by all
+            queries until the simulation time changes. Lookups are counted as hits or misses.
+        )doc"
+    )
+
+        .def(
+            init<>(),
+            R"doc(
+                Create a StateCache instance.
+            )doc"
+        )
+
+        .def("__str__", &(shiftToString<StateCache>))
+        .def("__repr__", &(shiftToString<StateCache>))
+
+        .def(
+            "is_satellite_dirty",
+            &StateCache::isSatelliteDirty,
+            arg("satellite_name"),
+            R"doc(
+                Check if the state of a satellite is dirty, i.e. not evaluated at the current time.
+
+                Args:
+                    satellite_name (str): The satellite name.
+
+                Returns:
+                    bool: True if the satellite state is dirty.
+            )doc"
+        )
+
+        .def(
+            "is_geometry_dirty",
+            &StateCache::isGeometryDirty,
+            arg("geometry"),
+            R"doc(
+                Check if the GCRF geometry of a component geometry is dirty.
+
+                Args:
+                    geometry (Geometry): The component geometry.
+
+                Returns:
+                    bool: True if the GCRF geometry is dirty.
+            )doc"
+        )
+
+        .def(
+            "is_transform_dirty",
+            &StateCache::isTransformDirty,
+            arg("frame"),
+            R"doc(
+                Check if the transform from a frame to GCRF is dirty.
+
+                Args:
+                    frame (Frame): The frame.
+
+                Returns:
+                    bool: True if the transform is dirty.
+            )doc"
+        )
+
+        .def(
+            "get_generation",
+            &StateCache::getGeneration,
+            R"doc(
+                Get the current generation, incremented on every change of the simulation time.
+
+                Returns:
+                    int: The current generation.
+            )doc"
+        )
+
+        .def(
+            "get_size",
+            &StateCache::getSize,
+            R"doc(
+                Get the number of entries evaluated at the current time.
+
+                Returns:
+                    int: The number of entries.
+            )doc"
+        )
+
+        .def(
+            "get_hit_count",
+            &StateCache::getHitCount,
+            R"doc(
+                Get the number of lookups answered from a clean entry, since the last counter reset.
+
+                Returns:
+                    int: The hit count.
+            )doc"
+        )
+
+        .def(
+            "get_miss_count",
+            &StateCache::getMissCount,
+            R"doc(
+                Get the number of lookups that required an evaluation, since the last counter reset.
+
+                Returns:
+                    int: The miss count.
+            )doc"
+        )
+
+        .def(
+            "reset_counters",
+            &StateCache::resetCounters,
+            R"doc(
+                Reset the hit and miss counters.
+            )doc"
+        )
+
+        ;
+}
@@ -0,0 +1,187 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Simulator/StateTable.hpp>
+
+inline void OpenSpaceToolkitSimulationPy_Simulator_StateTable(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::container::Array;
+
+    using ostk::mathematics::object::MatrixXd;
+
+    using ostk::physics::time::Instant;
+
+    using ostk::simulation::simulator::StateTable;
+
+    class_<StateTable>(
+        aModule,
+        "StateTable",
+        R"doc(
+            Contiguous table of satellite states sampled over a time grid.
+
+            States are expressed in GCRF and stored column-wise: column i of every matrix
+            corresponds to the i-th instant.
+        )doc"
+    )
+
+        .def(
+            init<const Array<Instant>&, const MatrixXd&, const MatrixXd&, const MatrixXd&, const MatrixXd&>(),
+            arg("instants"),
+            arg("positions"),
+            arg("velocities"),
+            arg("attitudes"),
+            arg("angular_velocities"),
+            R"doc(
+                Create a StateTable instance.
+
+                Args:
+                    instants (list[Instant]): The sampled instants.
+                    positions (numpy.ndarray): 3 x N positions [m].
+                    velocities (numpy.ndarray): 3 x N velocities [m/s].
+                    attitudes (numpy.ndarray): 4 x N attitude quaternions (XYZS).
+                    angular_velocities (numpy.ndarray): 3 x N angular velocities [rad/s].
+
+                Returns:
+                    StateTable: The state table.
+            )doc"
+        )
+
+        .def("__str__", &(shiftToString<StateTable>))
+        .def("__repr__", &(shiftToString<StateTable>))
+
+        .def(
+            "is_defined",
+            &StateTable::isDefined,
+            R"doc(
+                Check if the state table is defined.
+
+                Returns:
+                    bool: True if the state table is defined, False otherwise.
+            )doc"
+        )
+
+        .def(
+            "get_size",
+            &StateTable::getSize,
+            R"doc(
+                Get the number of sampled instants.
+
+                Returns:
+                    int: The number of sampled instants.
+            )doc"
+        )
+
+        .def(
+            "access_instants",
+            &StateTable::accessInstants,
+            R"doc(
+                Access the sampled instants.
+
+                Returns:
+                    list[Instant]: The sampled instants.
+            )doc"
+        )
+
+        .def(
+            "access_positions",
+            &StateTable::accessPositions,
+            R"doc(
+                Access the positions.
+
+                Returns:
+                    numpy.ndarray: 3 x N positions [m], in GCRF.
+            )doc"
+        )
+
+        .def(
+            "access_velocities",
+            &StateTable::accessVelocities,
+            R"doc(
+                Access the velocities.
+
+                Returns:
+                    numpy.ndarray: 3 x N velocities [m/s], in GCRF.
+            )doc"
+        )
+
+        .def(
+            "access_attitudes",
+            &StateTable::accessAttitudes,
+            R"doc(
+                Access the attitudes.
+
+                Returns:
+                    numpy.ndarray: 4 x N attitude quaternions (XYZS).
+            )doc"
+        )
+
+        .def(
+            "access_angular_velocities",
+            &StateTable::accessAngularVelocities,
+            R"doc(
+                Access the angular velocities.
+
+                Returns:
+                    numpy.ndarray: 3 x N angular velocities [rad/s].
+            )doc"
+        )
+
+        .def(
+            "get_state_at",
+            &StateTable::getStateAt,
+            arg("index"),
+            R"doc(
+                Get the state at a given index.
+
+                Args:
+                    index (int): The index.
+
+                Returns:
+                    State: The state, in GCRF.
+            )doc"
+        )
+
+        .def_static(
+            "undefined",
+            &StateTable::Undefined,
+            R"doc(
+                Create an undefined state table.
+
+                Returns:
+                    StateTable: An undefined state table.
+            )doc"
+        )
+
+        .def_static(
+            "from_states",
+            &StateTable::FromStates,
+            arg("states"),
+            R"doc(
+                Create a state table from an array of states.
+
+                Args:
+                    states (list[State]): The states.
+
+                Returns:
+                    StateTable: The state table, in GCRF.
+            )doc"
+        )
+
+        .def_static(
+            "concatenate",
+            &StateTable::Concatenate,
+            arg("state_tables"),
+            R"doc(
+                Concatenate state tables, in order.
+
+                Args:
+                    state_tables (list[StateTable]): The state tables. Undefined state tables are skipped.
+
+                Returns:
+                    StateTable: The concatenated state table.
+            )doc"
+        )
+
+        ;
+}
@@ -0,0 +1,200 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Simulator.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator/TimeRange.hpp>
+
+inline void OpenSpaceToolkitSimulationPy_Simulator_TimeRange(pybind11::module& aModule)
+{
+    using namespace pybind11;
+
+    using ostk::core::type::Size;
+
+    using ostk::physics::time::Duration;
+    using ostk::physics::time::Interval;
+
+    using ostk::simulation::Simulator;
+    using ostk::simulation::simulator::TimeRange;
+
+    class_<TimeRange> time_range_class(
+        aModule,
+        "TimeRange",
+        R"doc(
+            A lazy range of satellite states over a time grid.
+
+            The range samples a snapshot of a simulator over the grid of an interval, from its start by a
+            fixed step, up to and including its end. Iterating evaluates the grid chunk by chunk and yields
+            one view per instant. With prefetch enabled, the next chunk is evaluated in the background while
+            the current one is consumed.
+        )doc"
+    );
+
+    class_<TimeRange::View>(
+        time_range_class,
+        "View",
+        R"doc(
+            Satellite states at an instant of the range.
+        )doc"
+    )
+
+        .def(
+            "get_instant",
+            &TimeRange::View::getInstant,
+            R"doc(
+                Get the instant.
+
+                Returns:
+                    Instant: The instant.
+            )doc"
+        )
+
+        .def(
+            "get_index",
+            &TimeRange::View::getIndex,
+            R"doc(
+                Get the column of the instant in the state tables.
+
+                Returns:
+                    int: The column index.
+            )doc"
+        )
+
+        .def(
+            "access_state_table_map",
+            &TimeRange::View::accessStateTableMap,
+            return_value_policy::reference_internal,
+            R"doc(
+                Access the state tables of the chunk, by satellite name.
+
+                Returns:
+                    dict[str, StateTable]: The state tables.
+            )doc"
+        )
+
+        .def(
+            "get_satellite_state_with_name",
+            &TimeRange::View::getSatelliteStateWithName,
+            arg("satellite_name"),
+            R"doc(
+                Get the state of a satellite.
+
+                Args:
+                    satellite_name (str): The satellite name.
+
+                Returns:
+                    State: The satellite state.
+            )doc"
+        );
+
+    time_range_class
+
+        .def(
+            init<const Simulator&, const Interval&, const Duration&, const Size&, const bool&>(),
+            arg("simulator"),
+            arg("interval"),
+            arg("step"),
+            arg("chunk_size") = 64,
+            arg("prefetch") = true,
+            R"doc(
+                Create a time range.
+
+                Args:
+                    simulator (Simulator): The simulator, of which a snapshot is taken.
+                    interval (Interval): The interval.
+                    step (Duration): The step.
+                    chunk_size (int): The number of instants evaluated at once (optional).
+                    prefetch (bool): If True, evaluate the next chunk in the background (optional).
+
+                Returns:
+                    TimeRange: The time range.
+
+                Example:
+                    >>> time_range = TimeRange(simulator, interval, Duration.seconds(10.0))
+            )doc"
+        )
+
+        .def("__str__", &(shiftToString<TimeRange>))
+        .def("__repr__", &(shiftToString<TimeRange>))
+
+        .def("__len__", &TimeRange::getSize)
+
+        .def(
+            "__iter__",
+            [](const TimeRange& aTimeRange)
+            {
+                return make_iterator<return_value_policy::copy>(aTimeRange.begin(), aTimeRange.end());
+            },
+            keep_alive<0, 1>()
+        )
+
+        .def(
+            "get_interval",
+            &TimeRange::getInterval,
+            R"doc(
+                Get the interval.
+
+                Returns:
+                    Interval: The interval.
+            )doc"
+        )
+
+        .def(
+            "get_step",
+            &TimeRange::getStep,
+            R"doc(
+                Get the step.
+
+                Returns:
+                    Duration: The step.
+            )doc"
+        )
+
+        .def(
+            "get_size",
+            &TimeRange::getSize,
+            R"doc(
+                Get the number of instants.
+
+                Returns:
+                    int: The number of instants.
+            )doc"
+        )
+
+        .def(
+            "get_chunk_size",
+            &TimeRange::getChunkSize,
+            R"doc(
+                Get the number of instants evaluated at once.
+
+                Returns:
+                    int: The chunk size.
+            )doc"
+        )
+
+        .def(
+            "is_prefetching",
+            &TimeRange::isPrefetching,
+            R"doc(
+                Check if the next chunk is evaluated in the background.
+
+                Returns:
+                    bool: True if prefetching.
+            )doc"
+        )
+
+        .def(
+            "get_instant_at",
+            &TimeRange::getInstantAt,
+            arg("index"),
+            R"doc(
+                Get an instant of the grid.
+
+                Args:
+                    index (int): The instant index.
+
+                Returns:
+                    Instant: The instant.
+            )doc"
+        )
+
+        ;
+}
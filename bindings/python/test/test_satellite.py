@@ -6,7 +6,9 @@ from datetime import datetime
 
 from ostk.physics import Environment
 from ostk.physics.unit import Length
+from ostk.physics.time import Duration
 from ostk.physics.time import Instant
+from ostk.physics.time import Interval
 from ostk.physics.time import Scale
 from ostk.physics.time import Time
 
@@ -15,6 +17,9 @@ from ostk.astrodynamics.flight import Profile
 
 from ostk.simulation import Satellite
 from ostk.simulation import SatelliteConfiguration
+from ostk.simulation.satellite import Ephemeris
+from ostk.simulation.satellite import EphemerisConfiguration
+from ostk.simulation.satellite import TransformTree
 
 
 @pytest.fixture
@@ -58,3 +63,57 @@ class TestSatellite:
 
     def test_access_profile(self, satellite: Satellite):
         assert satellite.access_profile().is_defined()
+
+    def test_has_state_at(self, satellite: Satellite):
+        assert satellite.has_state_at(Instant.J2000())
+
+    def test_configure_with_ephemeris(self, orbit: Orbit):
+        epoch: Instant = Instant.date_time(datetime(2020, 1, 1, 0, 0, 0), Scale.UTC)
+
+        satellite = Satellite.configure(
+            configuration=SatelliteConfiguration(
+                id="9ea22c07-6977-48a7-8f68-dff758971d57",
+                name="LoftSat-1",
+                profile=Profile.local_orbital_frame_pointing(
+                    orbit=orbit,
+                    orbital_frame_type=Orbit.FrameType.VVLH,
+                ),
+                ephemeris=EphemerisConfiguration(
+                    interval=Interval.closed(epoch, epoch + Duration.minutes(10.0)),
+                    step=Duration.seconds(30.0),
+                ),
+            )
+        )
+
+        assert satellite.get_state_at(epoch + Duration.seconds(45.0)) is not None
+
+    def test_configure_with_chebyshev_ephemeris(self, orbit: Orbit):
+        epoch: Instant = Instant.date_time(datetime(2020, 1, 1, 0, 0, 0), Scale.UTC)
+
+        satellite = Satellite.configure(
+            configuration=SatelliteConfiguration(
+                id="9ea22c07-6977-48a7-8f68-dff758971d57",
+                name="LoftSat-1",
+                profile=Profile.local_orbital_frame_pointing(
+                    orbit=orbit,
+                    orbital_frame_type=Orbit.FrameType.VVLH,
+                ),
+                ephemeris=EphemerisConfiguration(
+                    interval=Interval.closed(epoch, epoch + Duration.hours(1.0)),
+                    step=Duration.minutes(30.0),
+                    type=Ephemeris.Type.Chebyshev,
+                ),
+            )
+        )
+
+        assert satellite.get_state_at(epoch + Duration.seconds(45.0)) is not None
+
+    def test_transform_tree(self, satellite: Satellite):
+        transform_tree = TransformTree(satellite)
+
+        epoch: Instant = Instant.date_time(datetime(2020, 1, 1, 0, 0, 0), Scale.UTC)
+
+        assert transform_tree.get_size() == 1
+        assert transform_tree.get_mounted_frame_count() == 0
+        assert transform_tree.contains(satellite.access_frame())
+        assert transform_tree.get_transform_to_gcrf(satellite.access_frame(), epoch) is not None
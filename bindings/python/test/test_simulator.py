@@ -2,6 +2,8 @@
 
 import pytest
 
+import sys
+
 from datetime import datetime
 
 from ostk.mathematics.geometry.d2.object import Point as Point2d
@@ -18,6 +20,7 @@ from ostk.physics.time import Instant
 from ostk.physics.time import Scale
 from ostk.physics.time import Time
 from ostk.physics.time import Duration
+from ostk.physics.time import Interval
 from ostk.physics.coordinate import Frame
 
 from ostk.astrodynamics.trajectory import Orbit
@@ -31,6 +34,12 @@ from ostk.simulation import Component
 from ostk.simulation import ComponentConfiguration
 from ostk.simulation.component import Geometry
 from ostk.simulation.component import GeometryConfiguration
+from ostk.simulation.event import Detector
+from ostk.simulation.simulator import Checkpoint
+from ostk.simulation.simulator import Ensemble
+from ostk.simulation.simulator import History
+from ostk.simulation.simulator import Pacer
+from ostk.simulation.simulator import TimeRange
 
 
 @pytest.fixture
@@ -153,6 +162,127 @@ class TestSimulator:
 
         assert simulator.get_instant() > initial_instant
 
+    def test_step_backward(self, simulator: Simulator):
+        initial_instant: Instant = simulator.get_instant()
+
+        simulator.step_backward(Duration.seconds(10.0))
+
+        assert simulator.get_instant() < initial_instant
+
+    def test_history(self, simulator: Simulator, satellite_name: str):
+        assert simulator.access_history().is_enabled() is False
+
+        simulator.set_history_memory_budget(1024 * 1024)
+
+        history: History = simulator.access_history()
+
+        assert isinstance(history, History)
+        assert history.is_enabled()
+        assert history.get_memory_budget() == 1024 * 1024
+
+        initial_instant: Instant = simulator.get_instant()
+
+        simulator.step_forward(Duration.seconds(10.0))
+        simulator.step_backward(Duration.seconds(10.0))
+
+        assert simulator.get_instant() == initial_instant
+        assert simulator.access_history().has_instant(initial_instant)
+        assert satellite_name in simulator.access_history().get_satellite_states_at(
+            initial_instant
+        )
+        assert simulator.access_history().get_memory_usage() > 0
+
+        simulator.set_history_memory_budget(0)
+
+        assert simulator.access_history().is_empty()
+
+    def test_set_thread_count(self, simulator: Simulator):
+        assert simulator.get_thread_count() == 0
+
+        simulator.set_thread_count(4)
+
+        assert simulator.get_thread_count() == 4
+
+        simulator.set_thread_count(0)
+
+        assert simulator.get_thread_count() == 0
+
+    def test_state_cache(
+        self,
+        simulator: Simulator,
+        instant: Instant,
+        satellite_name: str,
+    ):
+        simulator.set_instant(instant)
+
+        assert simulator.access_state_cache().is_satellite_dirty(satellite_name)
+
+        state = simulator.get_satellite_state_with_name(satellite_name)
+
+        assert not simulator.access_state_cache().is_satellite_dirty(satellite_name)
+        assert simulator.get_satellite_state_with_name(satellite_name) == state
+
+        assert simulator.access_state_cache().get_hit_count() >= 1
+
+        simulator.access_state_cache().reset_counters()
+
+        assert simulator.access_state_cache().get_hit_count() == 0
+
+        simulator.step_forward(Duration.minutes(1.0))
+
+        assert simulator.access_state_cache().is_satellite_dirty(satellite_name)
+
+        transform = simulator.get_transform_to_gcrf(Frame.ITRF())
+
+        assert transform is not None
+        assert not simulator.access_state_cache().is_transform_dirty(Frame.ITRF())
+
+    def test_frame_registry(
+        self,
+        simulator: Simulator,
+        satellite_name: str,
+    ):
+        frame_name: str = "Satellite [9ea22c07-6977-48a7-8f68-dff758971d57]"
+
+        frame_registry = simulator.access_frame_registry()
+
+        assert frame_registry.get_size() == 2
+        assert frame_registry.has_frame_with_name(frame_name)
+        assert (
+            frame_registry.access_frame_with_name(frame_name)
+            == simulator.access_satellite_with_name(satellite_name).access_frame()
+        )
+        assert not Frame.exists(frame_name)
+
+    @pytest.mark.skipif(sys.platform != "linux", reason="Partitioning is only available on Linux")
+    def test_set_process_count(
+        self,
+        simulator: Simulator,
+        instant: Instant,
+        satellite_name: str,
+    ):
+        simulator.set_instant(instant)
+        simulator.set_process_count(2)
+
+        assert simulator.get_process_count() == 2
+        assert simulator.get_satellite_state_with_name(satellite_name) is not None
+
+        simulator.set_process_count(0)
+
+        assert simulator.get_process_count() == 0
+
+    def test_get_satellite_state_with_name(
+        self,
+        simulator: Simulator,
+        satellite_name: str,
+    ):
+        simulator.set_thread_count(2)
+        simulator.step_forward(Duration.seconds(10.0))
+
+        state = simulator.get_satellite_state_with_name(satellite_name)
+
+        assert state.get_instant() == simulator.get_instant()
+
     def test_add_satellite(
         self,
         environment: Environment,
@@ -169,6 +299,21 @@ class TestSimulator:
 
         assert satellite in simulator.access_satellite_map().values()
 
+    def test_add_satellites(
+        self,
+        environment: Environment,
+        satellite_configuration: SatelliteConfiguration,
+    ):
+        simulator: Simulator = Simulator.configure(
+            SimulatorConfiguration(environment, [])
+        )
+        satellite: Satellite = Satellite.configure(satellite_configuration)
+
+        simulator.add_satellites([satellite])
+
+        assert len(simulator.access_satellite_map()) == 1
+        assert satellite in simulator.access_satellite_map().values()
+
     def test_undefined(self):
         simulator: Simulator = Simulator.undefined()
 
@@ -193,6 +338,22 @@ class TestSimulator:
         assert not simulator.has_satellite_with_name(satellite_name)
         assert len(simulator.access_satellite_map()) == 0
 
+    def test_remove_satellites_with_names(
+        self,
+        simulator: Simulator,
+        satellite_name: str,
+    ):
+        with pytest.raises(Exception):  # RuntimeError
+            simulator.remove_satellites_with_names(
+                [satellite_name, "NonExistentSatellite"]
+            )
+
+        assert simulator.has_satellite_with_name(satellite_name)
+
+        simulator.remove_satellites_with_names([satellite_name])
+
+        assert len(simulator.access_satellite_map()) == 0
+
     def test_remove_satellite_with_name_errors(
         self,
         simulator: Simulator,
@@ -254,3 +415,224 @@ class TestSimulator:
             .is_line_string()
             is True
         )
+
+    def test_event_detection(self, simulator: Simulator, instant: Instant):
+        camera: Component = simulator.access_satellite_with_name(
+            "LoftSat-1"
+        ).access_component_with_name("Camera")
+        earth = simulator.access_environment().access_celestial_object_with_name(
+            "Earth"
+        )
+
+        detector: Detector = Detector(
+            camera.get_geometries()[0],
+            earth,
+            Detector.Predicate.Intersects,
+        )
+
+        assert detector.is_defined()
+        assert detector.evaluate_at(instant) is True
+
+        interval: Interval = Interval.closed(instant, instant + Duration.hours(1.0))
+
+        assert len(detector.compute_crossings(interval, Duration.minutes(5.0))) == 0
+        assert detector.compute_windows(interval, Duration.minutes(5.0)) == [interval]
+
+        assert (
+            len(
+                detector.compute_crossings_adaptively(
+                    interval, Duration.seconds(1.0), Duration.minutes(10.0)
+                )
+            )
+            == 0
+        )
+        assert detector.compute_windows_adaptively(
+            interval, Duration.seconds(1.0), Duration.minutes(10.0)
+        ) == [interval]
+        assert detector.compute_safe_step_at(instant) > Duration.minutes(1.0)
+
+        simulator.set_instant(instant)
+
+        step: Duration = simulator.step_forward_adaptively(
+            [detector], Duration.seconds(1.0), Duration.minutes(10.0)
+        )
+
+        assert step > Duration.minutes(1.0)
+        assert simulator.get_instant() == instant + step
+
+        simulator.set_thread_count(4)
+
+        assert (
+            len(simulator.compute_crossings(detector, interval, Duration.minutes(5.0)))
+            == 0
+        )
+
+    def test_run_paced(self, simulator: Simulator, instant: Instant):
+        simulator.set_instant(instant)
+
+        frames: list[Pacer.Frame] = []
+
+        report: Pacer.Report = simulator.run_paced(
+            instant + Duration.minutes(10.0),
+            Pacer.as_fast_as_possible(Duration.minutes(1.0)),
+            lambda simulator, frame: frames.append(frame),
+        )
+
+        assert simulator.get_instant() == instant + Duration.minutes(10.0)
+        assert report.frame_count == 10
+        assert report.overrun_count == 0
+        assert [frame.index for frame in frames] == list(range(10))
+
+        report = simulator.run_paced(
+            instant + Duration.minutes(11.0),
+            Pacer(600.0, Duration.milliseconds(50.0), Pacer.CatchUpPolicy.Burst),
+        )
+
+        assert report.frame_count == 2
+        assert report.wall_clock_duration >= Duration.milliseconds(100.0)
+
+    def test_observers(self, simulator: Simulator, instant: Instant):
+        simulator.set_instant(instant)
+
+        calls: list[str] = []
+
+        pre_step_observer_id: int = simulator.add_pre_step_observer(
+            lambda simulator, instant: calls.append("pre")
+        )
+        satellite_observer_id: int = simulator.add_satellite_observer(
+            lambda simulator, satellite, state: calls.append(satellite.get_name())
+        )
+        post_step_observer_id: int = simulator.add_post_step_observer(
+            lambda simulator, instant: calls.append("post")
+        )
+
+        simulator.step_forward(Duration.minutes(1.0))
+
+        assert calls == ["pre", "LoftSat-1", "post"]
+
+        simulator.remove_observer(satellite_observer_id)
+        calls.clear()
+
+        simulator.step_forward(Duration.minutes(1.0))
+
+        assert calls == ["pre", "post"]
+
+        simulator.remove_observer(pre_step_observer_id)
+        simulator.remove_observer(post_step_observer_id)
+
+        with pytest.raises(Exception):  # RuntimeError
+            simulator.remove_observer(post_step_observer_id)
+
+    def test_range(self, simulator: Simulator, instant: Instant):
+        simulator.set_instant(instant)
+
+        interval = Interval.closed(instant, instant + Duration.minutes(10.0))
+
+        time_range: TimeRange = simulator.range(interval, Duration.minutes(1.0), 4)
+
+        assert len(time_range) == 11
+        assert time_range.get_chunk_size() == 4
+        assert time_range.is_prefetching()
+
+        instants: list[Instant] = []
+
+        for view in time_range:
+            assert view.get_satellite_state_with_name("LoftSat-1").get_instant() == view.get_instant()
+            instants.append(view.get_instant())
+
+        assert instants == interval.generate_grid(Duration.minutes(1.0))
+        assert simulator.get_instant() == instant
+
+        first_view: TimeRange.View = next(iter(time_range))
+
+        assert first_view.get_instant() == instant
+
+    def test_fork(self, simulator: Simulator, instant: Instant):
+        simulator.set_instant(instant)
+
+        branch: Simulator = simulator.fork()
+
+        branch.set_instant(instant + Duration.hours(1.0))
+
+        assert simulator.get_instant() == instant
+        assert branch.get_instant() == instant + Duration.hours(1.0)
+        assert branch.has_satellite_with_name("LoftSat-1")
+
+    def test_ensemble(
+        self,
+        environment: Environment,
+        satellite_configuration: SatelliteConfiguration,
+        instant: Instant,
+    ):
+        def perturbation(
+            configuration: SimulatorConfiguration, replica_index: int, seed: int
+        ) -> SimulatorConfiguration:
+            return SimulatorConfiguration(
+                environment=environment,
+                satellites=[satellite_configuration],
+            )
+
+        def evaluation(simulator: Simulator) -> list[float]:
+            simulator.set_instant(instant + Duration.minutes(10.0))
+
+            return [float(simulator.get_instant().get_date_time(Scale.UTC).minute)]
+
+        replica_indices: list[int] = []
+
+        statistics: list[Ensemble.Statistics] = Ensemble(
+            SimulatorConfiguration(environment=environment),
+            perturbation,
+            evaluation,
+            replica_count=10,
+            seed=42,
+            thread_count=2,
+        ).run(lambda replica_index, outputs: replica_indices.append(replica_index))
+
+        assert replica_indices == list(range(10))
+        assert len(statistics) == 1
+        assert statistics[0].count == 10
+        assert statistics[0].mean == 10.0
+        assert Ensemble.generate_seed(42, 0) != Ensemble.generate_seed(42, 1)
+
+    def test_checkpoint(self, simulator: Simulator, instant: Instant):
+        simulator.set_instant(instant + Duration.hours(1.0))
+
+        checkpoint: Checkpoint = Checkpoint.from_bytes(
+            simulator.create_checkpoint().to_bytes()
+        )
+
+        assert checkpoint.is_defined()
+        assert checkpoint.get_instant() == instant + Duration.hours(1.0)
+        assert [
+            record.name for record in checkpoint.access_satellite_records()
+        ] == ["LoftSat-1"]
+
+        simulator.set_instant(instant)
+        simulator.restore(checkpoint)
+
+        assert simulator.get_instant() == instant + Duration.hours(1.0)
+
+    def test_run(self, simulator: Simulator, instant: Instant):
+        simulator.set_instant(instant)
+
+        fired_instants: list[Instant] = []
+
+        simulator.schedule_event(
+            instant + Duration.hours(2.0),
+            lambda simulator: fired_instants.append(simulator.get_instant()),
+        )
+        simulator.schedule_event(
+            instant + Duration.hours(1.0),
+            lambda simulator: fired_instants.append(simulator.get_instant()),
+        )
+
+        assert simulator.access_scheduler().get_event_count() == 2
+
+        simulator.run(instant + Duration.days(1.0))
+
+        assert fired_instants == [
+            instant + Duration.hours(1.0),
+            instant + Duration.hours(2.0),
+        ]
+        assert simulator.get_instant() == instant + Duration.days(1.0)
+        assert simulator.access_scheduler().is_empty()
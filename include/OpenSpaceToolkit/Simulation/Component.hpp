@@ -6,6 +6,7 @@
 #include <OpenSpaceToolkit/Simulation/Component/Geometry.hpp>
 #include <OpenSpaceToolkit/Simulation/Component/State.hpp>
 #include <OpenSpaceToolkit/Simulation/Entity.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator/FrameRegistry.hpp>
 #include <OpenSpaceToolkit/Simulation/Utility/ComponentHolder.hpp>
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
@@ -35,6 +36,7 @@ using ostk::physics::coordinate::Frame;
 using ostk::simulation::component::Geometry;
 using ostk::simulation::component::GeometryConfiguration;
 using ostk::simulation::component::State;
+using ostk::simulation::simulator::FrameRegistry;
 using ostk::simulation::utility::ComponentHolder;
 
 #define DEFAULT_COMPONENT_TYPE Component::Type::Undefined
@@ -164,6 +166,7 @@ class Component : public Entity, public ComponentHolder, public std::enable_shar
     const Geometry& accessGeometryWithName(const String& aName) const;
 
     /// @brief Access the simulator.
+    /// @details Components of a satellite handed out by a fork are bound to the fork (see Simulator::fork).
     ///
     /// @code{.cpp}
     ///     const Simulator& simulator = component.accessSimulator();
@@ -181,6 +184,15 @@ class Component : public Entity, public ComponentHolder, public std::enable_shar
     /// @return The component type.
     Component::Type getType() const;
 
+    /// @brief Get the state, as held by the simulator.
+    ///
+    /// @code{.cpp}
+    ///     State state = component.getState();
+    /// @endcode
+    ///
+    /// @return The component state.
+    State getState() const;
+
     /// @brief Get the tags.
     ///
     /// @code{.cpp}
@@ -259,6 +271,9 @@ class Component : public Entity, public ComponentHolder, public std::enable_shar
     static String StringFromType(const Component::Type& aType);
 
     /// @brief Generate a reference frame for a component.
+    /// @details The frame is provided statically: its transform from the parent frame is built once, as mounting
+    ///          orientations do not vary in time. The frame is not registered globally, but in the given frame
+    ///          registry (typically that of the simulator), if any.
     ///
     /// @code{.cpp}
     ///     Shared<const Frame> frame = Component::GenerateFrame("sensor", quaternion, parentFrameSPtr);
@@ -267,9 +282,13 @@ class Component : public Entity, public ComponentHolder, public std::enable_shar
     /// @param [in] aName A name for the frame.
     /// @param [in] aQuaternion An orientation quaternion relative to the parent frame.
     /// @param [in] aParentFrameSPtr A shared pointer to the parent frame.
+    /// @param [in] aFrameRegistrySPtr A shared pointer to a frame registry to register the frame in (optional).
     /// @return A shared pointer to the generated frame.
     static Shared<const Frame> GenerateFrame(
-        const String& aName, const Quaternion& aQuaternion, const Shared<const Frame>& aParentFrameSPtr
+        const String& aName,
+        const Quaternion& aQuaternion,
+        const Shared<const Frame>& aParentFrameSPtr,
+        const Shared<FrameRegistry>& aFrameRegistrySPtr = nullptr
     );
 
    protected:
@@ -284,6 +303,8 @@ class Component : public Entity, public ComponentHolder, public std::enable_shar
     virtual void print(std::ostream& anOutputStream, bool displayDecorators = true) const;
 
    private:
+    friend class Simulator;
+
     Component::Type type_;
     Array<String> tags_;
     Array<Shared<Geometry>> geometries_;  // Array of Geometries defined in Component Frame
@@ -291,6 +312,8 @@ class Component : public Entity, public ComponentHolder, public std::enable_shar
     Weak<const ComponentHolder> parentWPtr_;
     Shared<const Frame> frameSPtr_;
     Shared<const Simulator> simulatorSPtr_;
+
+    void bindSimulator(const Shared<const Simulator>& aSimulatorSPtr);
 };
 
 /// @brief Configuration for constructing a Component.
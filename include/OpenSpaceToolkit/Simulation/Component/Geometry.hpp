@@ -10,6 +10,7 @@
 
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Object/Geometry.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
 namespace ostk
 {
@@ -29,6 +30,7 @@ using ostk::mathematics::geometry::d3::object::Composite;
 using ostk::physics::coordinate::Frame;
 using ObjectGeometry = ostk::physics::environment::object::Geometry;
 using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::Instant;
 
 struct GeometryConfiguration;
 
@@ -144,6 +146,28 @@ class Geometry
     /// @return True if the geometry intersects the celestial object.
     bool intersects(const Celestial& aCelestialObject) const;
 
+    /// @brief Check if the geometry intersects another geometry at a given instant.
+    ///
+    /// @code{.cpp}
+    ///     bool doesIntersect = geometry.intersects(otherGeometry, instant);
+    /// @endcode
+    ///
+    /// @param [in] aGeometry A geometry.
+    /// @param [in] anInstant An instant.
+    /// @return True if the geometries intersect at the instant.
+    bool intersects(const ObjectGeometry& aGeometry, const Instant& anInstant) const;
+
+    /// @brief Check if the geometry intersects a celestial object at a given instant.
+    ///
+    /// @code{.cpp}
+    ///     bool doesIntersect = geometry.intersects(celestialObject, instant);
+    /// @endcode
+    ///
+    /// @param [in] aCelestialObject A celestial object.
+    /// @param [in] anInstant An instant.
+    /// @return True if the geometry intersects the celestial object at the instant.
+    bool intersects(const Celestial& aCelestialObject, const Instant& anInstant) const;
+
     /// @brief Check if the geometry contains another geometry.
     ///
     /// @code{.cpp}
@@ -164,6 +188,28 @@ class Geometry
     /// @return True if the geometry contains the celestial object.
     bool contains(const Celestial& aCelestialObject) const;
 
+    /// @brief Check if the geometry contains another geometry at a given instant.
+    ///
+    /// @code{.cpp}
+    ///     bool doesContain = geometry.contains(otherGeometry, instant);
+    /// @endcode
+    ///
+    /// @param [in] aGeometry A geometry.
+    /// @param [in] anInstant An instant.
+    /// @return True if this geometry contains the other geometry at the instant.
+    bool contains(const ObjectGeometry& aGeometry, const Instant& anInstant) const;
+
+    /// @brief Check if the geometry contains a celestial object at a given instant.
+    ///
+    /// @code{.cpp}
+    ///     bool doesContain = geometry.contains(celestialObject, instant);
+    /// @endcode
+    ///
+    /// @param [in] aCelestialObject A celestial object.
+    /// @param [in] anInstant An instant.
+    /// @return True if the geometry contains the celestial object at the instant.
+    bool contains(const Celestial& aCelestialObject, const Instant& anInstant) const;
+
     /// @brief Access the composite 3D object.
     ///
     /// @code{.cpp}
@@ -183,6 +229,8 @@ class Geometry
     Shared<const Frame> accessFrame() const;
 
     /// @brief Get the geometry expressed in a given frame.
+    /// @details Evaluated at the simulator instant. GCRF geometries are cached by the simulator for all queries at
+    ///          that instant (see Simulator::getGeometryInGCRF).
     ///
     /// @code{.cpp}
     ///     ObjectGeometry geom = geometry.getGeometryIn(frameSPtr);
@@ -192,6 +240,17 @@ class Geometry
     /// @return The geometry in the target frame.
     ObjectGeometry getGeometryIn(const Shared<const Frame>& aFrameSPtr) const;
 
+    /// @brief Get the geometry expressed in a given frame at a given instant.
+    ///
+    /// @code{.cpp}
+    ///     ObjectGeometry geom = geometry.getGeometryIn(frameSPtr, instant);
+    /// @endcode
+    ///
+    /// @param [in] aFrameSPtr A shared pointer to the target frame.
+    /// @param [in] anInstant An instant.
+    /// @return The geometry in the target frame at the instant.
+    ObjectGeometry getGeometryIn(const Shared<const Frame>& aFrameSPtr, const Instant& anInstant) const;
+
     /// @brief Compute the intersection with another geometry.
     ///
     /// @code{.cpp}
@@ -212,6 +271,28 @@ class Geometry
     /// @return The intersection geometry.
     ObjectGeometry intersectionWith(const Celestial& aCelestialObject) const;
 
+    /// @brief Compute the intersection with another geometry at a given instant.
+    ///
+    /// @code{.cpp}
+    ///     ObjectGeometry intersection = geometry.intersectionWith(otherGeometry, instant);
+    /// @endcode
+    ///
+    /// @param [in] aGeometry A geometry.
+    /// @param [in] anInstant An instant.
+    /// @return The intersection geometry.
+    ObjectGeometry intersectionWith(const ObjectGeometry& aGeometry, const Instant& anInstant) const;
+
+    /// @brief Compute the intersection with a celestial object at a given instant.
+    ///
+    /// @code{.cpp}
+    ///     ObjectGeometry intersection = geometry.intersectionWith(celestialObject, instant);
+    /// @endcode
+    ///
+    /// @param [in] aCelestialObject A celestial object.
+    /// @param [in] anInstant An instant.
+    /// @return The intersection geometry.
+    ObjectGeometry intersectionWith(const Celestial& aCelestialObject, const Instant& anInstant) const;
+
     /// @brief Construct an undefined geometry.
     ///
     /// @code{.cpp}
@@ -235,9 +316,13 @@ class Geometry
     );
 
    private:
+    friend class ostk::simulation::Component;
+
     String name_;
-    ObjectGeometry geometry_;
+    Shared<const ObjectGeometry> geometrySPtr_;
     Shared<const Component> componentPtr_;
+
+    Geometry(const Geometry& aGeometry, const Shared<const Component>& aComponentSPtr);
 };
 
 /// @brief Configuration for constructing a Geometry.
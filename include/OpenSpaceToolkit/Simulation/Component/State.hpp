@@ -111,6 +111,16 @@ class State
     /// @return The status.
     State::Status getStatus() const;
 
+    /// @brief Check if verbose mode is enabled.
+    ///
+    /// @code{.cpp}
+    ///     State state(State::Status::Idle, true);
+    ///     bool verbose = state.isVerbose(); // true
+    /// @endcode
+    ///
+    /// @return True if verbose mode is enabled.
+    bool isVerbose() const;
+
     /// @brief Construct an undefined state.
     ///
     /// @code{.cpp}
@@ -0,0 +1,231 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Simulation_Event_Behavior__
+#define __OpenSpaceToolkit_Simulation_Event_Behavior__
+
+#if defined(__cpp_impl_coroutine)
+
+#include <coroutine>
+#include <exception>
+
+#include <OpenSpaceToolkit/Simulation/Event/Detector.hpp>
+
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+
+class Simulator;
+
+namespace event
+{
+
+using ostk::core::type::Index;
+
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+
+/// @brief A coroutine scripting an operational sequence, driven by a simulator.
+/// @details A behavior is a C++20 coroutine returning Behavior. It may co_await a duration, an instant or the next
+///          crossing of a detector: the awaiting behavior is then suspended, and a single event is scheduled to resume
+///          it once due. Suspended behaviors cost nothing between wake-ups.
+///
+///          A behavior does not run until started by a simulator (see Simulator::startBehavior), which owns it from
+///          then on. Exceptions thrown by a behavior are rethrown by the simulator call that resumed it.
+///
+///          As for any coroutine, arguments passed by reference must outlive the behavior: pass temporaries by value.
+///
+///          Only available when built with coroutine support (C++20).
+///
+/// @code{.cpp}
+///     Behavior downlink(Simulator& aSimulator, const Detector aDetector, const Interval anInterval)
+///     {
+///         aSimulator.setComponentStateWithId("camera", State(State::Status::Disabled));
+///         co_await Behavior::WaitFor(Duration::Minutes(5.0));
+///         const Detector::Crossing crossing = co_await Behavior::WaitForCrossing(aDetector, anInterval, step);
+///         ...
+///     }
+///
+///     simulator.startBehavior(downlink(simulator, detector, interval));
+/// @endcode
+class Behavior
+{
+   public:
+    struct promise_type
+    {
+        Simulator* simulatorPtr = nullptr;          ///< The simulator running the behavior.
+        Index id = 0;                               ///< The behavior identifier.
+        Index eventId = 0;                          ///< The identifier of the pending resumption event.
+        bool hasPendingEvent = false;               ///< True if a resumption event is pending.
+        std::exception_ptr exceptionPtr = nullptr;  ///< The exception thrown by the behavior, if any.
+
+        Behavior get_return_object();
+
+        std::suspend_always initial_suspend() noexcept;
+
+        std::suspend_always final_suspend() noexcept;
+
+        void return_void();
+
+        void unhandled_exception();
+    };
+
+    typedef std::coroutine_handle<promise_type> Handle;
+
+    /// @brief Awaitable suspending a behavior until an instant.
+    class WaitAwaiter
+    {
+       public:
+        WaitAwaiter(const Instant& anInstant, const Duration& aDuration);
+
+        bool await_ready() const noexcept;
+
+        void await_suspend(Handle aHandle) const;
+
+        void await_resume() const noexcept;
+
+       private:
+        Instant instant_;
+        Duration duration_;
+    };
+
+    /// @brief Awaitable suspending a behavior until the next crossing of a detector.
+    class CrossingAwaiter
+    {
+       public:
+        CrossingAwaiter(const Detector& aDetector, const Interval& anInterval, const Duration& aStep);
+
+        bool await_ready() const noexcept;
+
+        void await_suspend(Handle aHandle);
+
+        Detector::Crossing await_resume() const noexcept;
+
+       private:
+        Detector detector_;
+        Interval interval_;
+        Duration step_;
+        Detector::Crossing crossing_;
+    };
+
+    Behavior(const Behavior& aBehavior) = delete;
+
+    /// @brief Move constructor.
+    ///
+    /// @param [in] aBehavior A behavior.
+    Behavior(Behavior&& aBehavior) noexcept;
+
+    /// @brief Destructor, destroying the coroutine.
+    ~Behavior();
+
+    Behavior& operator=(const Behavior& aBehavior) = delete;
+
+    /// @brief Move assignment operator.
+    ///
+    /// @param [in] aBehavior A behavior.
+    /// @return A reference to the behavior.
+    Behavior& operator=(Behavior&& aBehavior) noexcept;
+
+    /// @brief Check if the behavior is defined.
+    ///
+    /// @code{.cpp}
+    ///     bool defined = behavior.isDefined();
+    /// @endcode
+    ///
+    /// @return True if the behavior holds a coroutine.
+    bool isDefined() const;
+
+    /// @brief Check if the behavior has completed.
+    ///
+    /// @code{.cpp}
+    ///     bool done = behavior.isDone();
+    /// @endcode
+    ///
+    /// @return True if the behavior has completed.
+    bool isDone() const;
+
+    /// @brief Suspend a behavior for a duration.
+    ///
+    /// @code{.cpp}
+    ///     co_await Behavior::WaitFor(Duration::Minutes(5.0));
+    /// @endcode
+    ///
+    /// @param [in] aDuration A duration, positive.
+    /// @return An awaitable.
+    static WaitAwaiter WaitFor(const Duration& aDuration);
+
+    /// @brief Suspend a behavior until an instant.
+    ///
+    /// @code{.cpp}
+    ///     co_await Behavior::WaitUntil(instant);
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant, not earlier than the simulation instant.
+    /// @return An awaitable.
+    static WaitAwaiter WaitUntil(const Instant& anInstant);
+
+    /// @brief Suspend a behavior until the next crossing of a detector over an interval.
+    /// @details Crossings are detected when the behavior suspends (see Detector::computeCrossings), from the
+    ///          simulation instant to the end of the interval. The behavior resumes at the first crossing, or at the
+    ///          end of the interval with an undefined crossing instant if there is none.
+    ///
+    /// @code{.cpp}
+    ///     const Detector::Crossing crossing =
+    ///         co_await Behavior::WaitForCrossing(detector, interval, Duration::Minutes(1.0));
+    /// @endcode
+    ///
+    /// @param [in] aDetector A detector.
+    /// @param [in] anInterval An interval, not ending earlier than the simulation instant.
+    /// @param [in] aStep A coarse sampling step.
+    /// @return An awaitable, resuming with the crossing.
+    static CrossingAwaiter WaitForCrossing(
+        const Detector& aDetector, const Interval& anInterval, const Duration& aStep
+    );
+
+   private:
+    friend class ostk::simulation::Simulator;
+
+    Handle handle_;
+
+    Behavior(const Handle& aHandle);
+
+    promise_type& accessPromise() const;
+
+    void resume();
+
+    static Simulator& AccessSimulator(const Handle& aHandle);
+
+    static void SuspendUntil(const Handle& aHandle, const Instant& anInstant);
+};
+
+}  // namespace event
+}  // namespace simulation
+}  // namespace ostk
+
+#else
+
+namespace ostk
+{
+namespace simulation
+{
+namespace event
+{
+
+// Declared without coroutine support, so that classes holding behaviors (e.g. Simulator) have the same definition in
+// all translation units.
+class Behavior;
+
+}  // namespace event
+}  // namespace simulation
+}  // namespace ostk
+
+#endif
+
+#endif
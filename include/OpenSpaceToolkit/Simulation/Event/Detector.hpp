@@ -0,0 +1,306 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Simulation_Event_Detector__
+#define __OpenSpaceToolkit_Simulation_Event_Detector__
+
+#include <OpenSpaceToolkit/Simulation/Component/Geometry.hpp>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Geometry.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace event
+{
+
+#define DEFAULT_EVENT_TOLERANCE Duration::Milliseconds(1.0)
+
+using ostk::core::container::Array;
+using ostk::core::type::Shared;
+using ostk::core::type::String;
+
+using ObjectGeometry = ostk::physics::environment::object::Geometry;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+
+using ostk::simulation::component::Geometry;
+
+/// @brief Detects the instants at which a geometric predicate between a component geometry and a target changes.
+/// @details The predicate is sampled over an interval at a coarse step. Every step over which its value changes
+///          brackets a crossing, which is then refined by bisection down to a time tolerance. Events shorter than
+///          the coarse step may be missed.
+///
+///          Adaptive searches replace the coarse step by a safe step, estimated at each sample from the angular
+///          distance between the target and the boundary of the field of view, and from the relative angular
+///          rates. Steps are long far from the boundary, and only shrink to the minimum step close to it.
+///
+/// @code{.cpp}
+///     const Detector detector(cameraGeometrySPtr, earth, Detector::Predicate::Intersects);
+///     const Array<Interval> windows = detector.computeWindows(interval, Duration::Minutes(1.0));
+/// @endcode
+class Detector
+{
+   public:
+    enum class Predicate
+    {
+
+        Undefined,
+        Intersects,
+        Contains
+
+    };
+
+    /// @brief An instant at which the predicate changes value.
+    struct Crossing
+    {
+        enum class Type
+        {
+
+            Entry,  ///< The predicate becomes true.
+            Exit    ///< The predicate becomes false.
+
+        };
+
+        Instant instant;  ///< The first instant (within tolerance) at which the new value holds.
+        Type type;        ///< The crossing type.
+    };
+
+    /// @brief Construct a detector against a target geometry.
+    ///
+    /// @code{.cpp}
+    ///     Detector detector(geometrySPtr, targetGeometry, Detector::Predicate::Intersects);
+    /// @endcode
+    ///
+    /// @param [in] aGeometrySPtr A shared pointer to a component geometry.
+    /// @param [in] aTargetGeometry A target geometry.
+    /// @param [in] aPredicate A predicate.
+    Detector(
+        const Shared<const Geometry>& aGeometrySPtr, const ObjectGeometry& aTargetGeometry, const Predicate& aPredicate
+    );
+
+    /// @brief Construct a detector against a celestial object.
+    ///
+    /// @code{.cpp}
+    ///     Detector detector(geometrySPtr, *earthSPtr, Detector::Predicate::Intersects);
+    /// @endcode
+    ///
+    /// @param [in] aGeometrySPtr A shared pointer to a component geometry.
+    /// @param [in] aCelestialObject A celestial object.
+    /// @param [in] aPredicate A predicate.
+    Detector(
+        const Shared<const Geometry>& aGeometrySPtr, const Celestial& aCelestialObject, const Predicate& aPredicate
+    );
+
+    /// @brief Output stream operator.
+    ///
+    /// @code{.cpp}
+    ///     std::cout << detector;
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream.
+    /// @param [in] aDetector A detector.
+    /// @return A reference to the output stream.
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const Detector& aDetector);
+
+    /// @brief Check if the detector is defined.
+    ///
+    /// @code{.cpp}
+    ///     bool defined = detector.isDefined();
+    /// @endcode
+    ///
+    /// @return True if the detector is defined.
+    bool isDefined() const;
+
+    /// @brief Access the component geometry.
+    ///
+    /// @code{.cpp}
+    ///     const Geometry& geometry = detector.accessGeometry();
+    /// @endcode
+    ///
+    /// @return A reference to the component geometry.
+    const Geometry& accessGeometry() const;
+
+    /// @brief Access the target geometry.
+    ///
+    /// @code{.cpp}
+    ///     const ObjectGeometry& target = detector.accessTarget();
+    /// @endcode
+    ///
+    /// @return A reference to the target geometry.
+    const ObjectGeometry& accessTarget() const;
+
+    /// @brief Get the predicate.
+    ///
+    /// @code{.cpp}
+    ///     Detector::Predicate predicate = detector.getPredicate();
+    /// @endcode
+    ///
+    /// @return The predicate.
+    Predicate getPredicate() const;
+
+    /// @brief Evaluate the predicate at a given instant.
+    ///
+    /// @code{.cpp}
+    ///     bool value = detector.evaluateAt(instant);
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant.
+    /// @return The predicate value at the instant.
+    bool evaluateAt(const Instant& anInstant) const;
+
+    /// @brief Compute the crossings of the predicate over an interval.
+    ///
+    /// @code{.cpp}
+    ///     const Array<Detector::Crossing> crossings =
+    ///         detector.computeCrossings(interval, Duration::Minutes(1.0), Duration::Milliseconds(1.0));
+    /// @endcode
+    ///
+    /// @param [in] anInterval An interval.
+    /// @param [in] aStep A coarse sampling step, strictly positive.
+    /// @param [in] aTolerance A time tolerance on crossing instants, strictly positive.
+    /// @return The chronologically ordered crossings.
+    Array<Crossing> computeCrossings(
+        const Interval& anInterval, const Duration& aStep, const Duration& aTolerance = DEFAULT_EVENT_TOLERANCE
+    ) const;
+
+    /// @brief Compute the crossings of the predicate over an interval, using adaptive steps.
+    ///
+    /// @code{.cpp}
+    ///     const Array<Detector::Crossing> crossings =
+    ///         detector.computeCrossingsAdaptively(interval, Duration::Seconds(1.0), Duration::Minutes(10.0));
+    /// @endcode
+    ///
+    /// @param [in] anInterval An interval.
+    /// @param [in] aMinimumStep A minimum sampling step, strictly positive.
+    /// @param [in] aMaximumStep A maximum sampling step, not shorter than the minimum step.
+    /// @param [in] aTolerance A time tolerance on crossing instants, strictly positive.
+    /// @return The chronologically ordered crossings.
+    Array<Crossing> computeCrossingsAdaptively(
+        const Interval& anInterval,
+        const Duration& aMinimumStep,
+        const Duration& aMaximumStep,
+        const Duration& aTolerance = DEFAULT_EVENT_TOLERANCE
+    ) const;
+
+    /// @brief Compute the windows over which the predicate holds within an interval.
+    /// @details Windows open at the interval start if the predicate holds there, and close at the interval end
+    ///          if it still holds there.
+    ///
+    /// @code{.cpp}
+    ///     const Array<Interval> windows = detector.computeWindows(interval, Duration::Minutes(1.0));
+    /// @endcode
+    ///
+    /// @param [in] anInterval An interval.
+    /// @param [in] aStep A coarse sampling step, strictly positive.
+    /// @param [in] aTolerance A time tolerance on window bounds, strictly positive.
+    /// @return The chronologically ordered windows.
+    Array<Interval> computeWindows(
+        const Interval& anInterval, const Duration& aStep, const Duration& aTolerance = DEFAULT_EVENT_TOLERANCE
+    ) const;
+
+    /// @brief Compute the windows over which the predicate holds within an interval, using adaptive steps.
+    ///
+    /// @code{.cpp}
+    ///     const Array<Interval> windows =
+    ///         detector.computeWindowsAdaptively(interval, Duration::Seconds(1.0), Duration::Minutes(10.0));
+    /// @endcode
+    ///
+    /// @param [in] anInterval An interval.
+    /// @param [in] aMinimumStep A minimum sampling step, strictly positive.
+    /// @param [in] aMaximumStep A maximum sampling step, not shorter than the minimum step.
+    /// @param [in] aTolerance A time tolerance on window bounds, strictly positive.
+    /// @return The chronologically ordered windows.
+    Array<Interval> computeWindowsAdaptively(
+        const Interval& anInterval,
+        const Duration& aMinimumStep,
+        const Duration& aMaximumStep,
+        const Duration& aTolerance = DEFAULT_EVENT_TOLERANCE
+    ) const;
+
+    /// @brief Estimate the step over which the predicate does not change, from a given instant.
+    /// @details The field of view is bounded by its inscribed and circumscribed cones, and the target by its
+    ///          bounding sphere. The predicate can only change while the angular extent of the target lies between
+    ///          both cones: the step is the angular margin to that band, divided by an upper bound of the relative
+    ///          angular rate, with a safety factor. The field of view is also bounded in depth by its base plane:
+    ///          a target angularly inside may cross it, and the step is then limited by the depth margin divided by
+    ///          the range rate along the base normal. The predicate is evaluated at the instant, and the estimate is
+    ///          zero whenever it disagrees with these bounds, e.g. for a target angularly inside but not detected
+    ///          while straddling the base plane. The estimate is also zero close to the angular band, or when the
+    ///          geometries are not supported (a single pyramid against a single ellipsoid, sphere or point). It is
+    ///          undefined if the geometries are at rest relative to each other.
+    ///
+    /// @code{.cpp}
+    ///     const Duration safeStep = detector.computeSafeStepAt(instant);
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant.
+    /// @return The safe step.
+    Duration computeSafeStepAt(const Instant& anInstant) const;
+
+    /// @brief Print the detector to an output stream.
+    ///
+    /// @code{.cpp}
+    ///     detector.print(std::cout, true);
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream.
+    /// @param [in] displayDecorators If true, display decorators.
+    void print(std::ostream& anOutputStream, bool displayDecorators = true) const;
+
+    /// @brief Construct an undefined detector.
+    ///
+    /// @code{.cpp}
+    ///     Detector detector = Detector::Undefined();
+    /// @endcode
+    ///
+    /// @return An undefined detector.
+    static Detector Undefined();
+
+    /// @brief Convert a predicate to a string.
+    ///
+    /// @code{.cpp}
+    ///     String predicateString = Detector::StringFromPredicate(Detector::Predicate::Intersects); // "Intersects"
+    /// @endcode
+    ///
+    /// @param [in] aPredicate A predicate.
+    /// @return The string representation of the predicate.
+    static String StringFromPredicate(const Predicate& aPredicate);
+
+   private:
+    Shared<const Geometry> geometrySPtr_;
+    ObjectGeometry target_;
+    Predicate predicate_;
+
+    Array<Crossing> findCrossings(
+        const Interval& anInterval,
+        const Duration& aMinimumStep,
+        const Duration& aMaximumStep,
+        const Duration& aTolerance,
+        bool& aStartValue
+    ) const;
+
+    Duration computeStepAt(
+        const Instant& anInstant, const Duration& aMinimumStep, const Duration& aMaximumStep
+    ) const;
+
+    Crossing refineCrossing(
+        const Instant& aLowerInstant, const Instant& anUpperInstant, const bool aLowerValue, const Duration& aTolerance
+    ) const;
+};
+
+}  // namespace event
+}  // namespace simulation
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,141 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Simulation_Event_Scheduler__
+#define __OpenSpaceToolkit_Simulation_Event_Scheduler__
+
+#include <functional>
+#include <queue>
+#include <unordered_set>
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+
+class Simulator;
+
+namespace event
+{
+
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::physics::time::Instant;
+
+/// @brief A priority queue of time-tagged events.
+/// @details Events are popped in chronological order. Events scheduled at the same instant are popped in
+///          scheduling order.
+///
+/// @code{.cpp}
+///     Scheduler scheduler;
+///     const Index eventId = scheduler.schedule(instant, [](Simulator& aSimulator) { ... });
+///     const Scheduler::Event event = scheduler.pop();
+/// @endcode
+class Scheduler
+{
+   public:
+    typedef std::function<void(Simulator&)> Callback;
+
+    /// @brief A scheduled event.
+    struct Event
+    {
+        Index id;           ///< The event identifier.
+        Instant instant;    ///< The event instant.
+        Callback callback;  ///< The event callback.
+    };
+
+    /// @brief Construct an empty scheduler.
+    ///
+    /// @code{.cpp}
+    ///     Scheduler scheduler;
+    /// @endcode
+    Scheduler();
+
+    /// @brief Check if the scheduler has no pending events.
+    ///
+    /// @code{.cpp}
+    ///     bool empty = scheduler.isEmpty();
+    /// @endcode
+    ///
+    /// @return True if the scheduler has no pending events.
+    bool isEmpty() const;
+
+    /// @brief Get the number of pending events.
+    ///
+    /// @code{.cpp}
+    ///     Size eventCount = scheduler.getEventCount();
+    /// @endcode
+    ///
+    /// @return The number of pending events.
+    Size getEventCount() const;
+
+    /// @brief Get the instant of the next pending event.
+    ///
+    /// @code{.cpp}
+    ///     Instant nextInstant = scheduler.getNextInstant();
+    /// @endcode
+    ///
+    /// @return The instant of the next pending event.
+    Instant getNextInstant() const;
+
+    /// @brief Schedule an event.
+    ///
+    /// @code{.cpp}
+    ///     const Index eventId = scheduler.schedule(instant, [](Simulator& aSimulator) { ... });
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant.
+    /// @param [in] aCallback A callback, called with the simulator firing the event.
+    /// @return The event identifier.
+    Index schedule(const Instant& anInstant, const Callback& aCallback);
+
+    /// @brief Cancel a pending event.
+    ///
+    /// @code{.cpp}
+    ///     scheduler.cancel(eventId);
+    /// @endcode
+    ///
+    /// @param [in] anEventId An event identifier.
+    void cancel(const Index& anEventId);
+
+    /// @brief Remove and return the next pending event.
+    ///
+    /// @code{.cpp}
+    ///     const Scheduler::Event event = scheduler.pop();
+    ///     event.callback(simulator);
+    /// @endcode
+    ///
+    /// @return The next pending event.
+    Event pop();
+
+    /// @brief Cancel all pending events.
+    ///
+    /// @code{.cpp}
+    ///     scheduler.clear();
+    /// @endcode
+    void clear();
+
+   private:
+    struct EventComparator
+    {
+        bool operator()(const Event& aFirstEvent, const Event& aSecondEvent) const;
+    };
+
+    std::priority_queue<Event, std::vector<Event>, EventComparator> queue_;
+    std::unordered_set<Index> pendingEventIds_;
+    Index nextEventId_;
+
+    void discardCancelledEvents();
+};
+
+}  // namespace event
+}  // namespace simulation
+}  // namespace ostk
+
+#endif
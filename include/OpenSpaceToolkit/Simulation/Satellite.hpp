@@ -5,15 +5,20 @@
 
 #include <OpenSpaceToolkit/Simulation/Component.hpp>
 #include <OpenSpaceToolkit/Simulation/Entity.hpp>
+#include <OpenSpaceToolkit/Simulation/Satellite/Ephemeris.hpp>
+#include <OpenSpaceToolkit/Simulation/Utility/ThreadPool.hpp>
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Map.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Flight/Profile.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
 
 namespace ostk
 {
@@ -23,25 +28,33 @@ namespace simulation
 using ostk::core::container::Array;
 using ostk::core::container::Map;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
 using ostk::physics::coordinate::Frame;
+using ostk::physics::time::Instant;
 
 using ostk::astrodynamics::flight::Profile;
+using TrajectoryState = ostk::astrodynamics::trajectory::State;
 
 using ostk::simulation::Component;
 using ostk::simulation::ComponentConfiguration;
+using ostk::simulation::satellite::Ephemeris;
+using ostk::simulation::satellite::EphemerisConfiguration;
+using ostk::simulation::utility::ThreadPool;
 
 #define DEFAULT_COMPONENTS Array<ComponentConfiguration>::Empty()
 #define DEFAULT_TAGS Array<String>::Empty()
 #define DEFAULT_GEOMETRIES Array<GeometryConfiguration>::Empty()
+#define DEFAULT_EPHEMERIS EphemerisConfiguration()
 
 class Simulator;
 struct SatelliteConfiguration;
 
 /// @brief A satellite in the simulation.
 /// @details A Satellite is a specialized Component that has an associated flight Profile
-///          and a dedicated reference frame derived from that profile.
+///          and a dedicated reference frame derived from that profile. States may be answered from
+///          an Ephemeris precomputed from the profile, within the interval it covers.
 ///
 /// @code{.cpp}
 ///     const Satellite& satellite = simulator.accessSatelliteWithName("sat-1");
@@ -67,6 +80,7 @@ class Satellite : public Component
     /// @param [in] aFrameSPtr A shared pointer to the reference frame.
     /// @param [in] aProfileSPtr A shared pointer to the flight profile.
     /// @param [in] aSimulatorSPtr A shared pointer to the simulator.
+    /// @param [in] anEphemerisSPtr A shared pointer to an ephemeris of the profile (default: none).
     Satellite(
         const String& anId,
         const String& aName,
@@ -75,7 +89,8 @@ class Satellite : public Component
         const Array<Shared<Component>>& aComponentArray,
         const Shared<const Frame>& aFrameSPtr,
         const Shared<const Profile>& aProfileSPtr,
-        const Shared<const Simulator>& aSimulatorSPtr
+        const Shared<const Simulator>& aSimulatorSPtr,
+        const Shared<const Ephemeris>& anEphemerisSPtr = nullptr
     );
 
     /// @brief Copy constructor.
@@ -128,6 +143,49 @@ class Satellite : public Component
     /// @return A shared pointer to the flight profile.
     const Shared<const Profile> accessProfile() const;
 
+    /// @brief Access the ephemeris.
+    ///
+    /// @code{.cpp}
+    ///     const Shared<const Ephemeris> ephemeris = satellite.accessEphemeris();
+    /// @endcode
+    ///
+    /// @return A shared pointer to the ephemeris, nullptr if states are evaluated from the profile.
+    const Shared<const Ephemeris> accessEphemeris() const;
+
+    /// @brief Check if the satellite has a state at a given instant.
+    /// @details True if the ephemeris covers the instant, or if the profile does: tabulated profiles only cover
+    ///          their interval, other profiles cover every instant. A satellite with a state at an instant may
+    ///          still fail to evaluate it, e.g. if its profile is ill-formed.
+    ///
+    /// @code{.cpp}
+    ///     bool hasState = satellite.hasStateAt(instant);
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant.
+    /// @return True if the satellite has a state at the instant.
+    bool hasStateAt(const Instant& anInstant) const;
+
+    /// @brief Get the state of the satellite at a given instant.
+    /// @details Interpolated from the ephemeris if it covers the instant, evaluated from the profile otherwise.
+    ///
+    /// @code{.cpp}
+    ///     TrajectoryState state = satellite.getStateAt(instant);
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant.
+    /// @return The state (in GCRF) at the instant.
+    TrajectoryState getStateAt(const Instant& anInstant) const;
+
+    /// @brief Get the states of the satellite at given instants.
+    ///
+    /// @code{.cpp}
+    ///     Array<TrajectoryState> states = satellite.getStatesAt(instants);
+    /// @endcode
+    ///
+    /// @param [in] anInstantArray An array of instants.
+    /// @return An array of states (in GCRF), one per instant.
+    Array<TrajectoryState> getStatesAt(const Array<Instant>& anInstantArray) const;
+
     /// @brief Print the satellite to an output stream.
     ///
     /// @code{.cpp}
@@ -148,6 +206,9 @@ class Satellite : public Component
     static Satellite Undefined();
 
     /// @brief Configure a satellite from a configuration.
+    /// @details If the configuration defines an ephemeris interval, the ephemeris is generated (or fitted) here, once.
+    ///          Profile states are sampled on the given thread pool, if any, so that configuring many satellites
+    ///          reuses the same threads; otherwise on a pool of the configured ephemeris thread count.
     ///
     /// @code{.cpp}
     ///     Shared<Satellite> satellite = Satellite::Configure(satelliteConfiguration, simulatorSPtr);
@@ -155,12 +216,22 @@ class Satellite : public Component
     ///
     /// @param [in] aSatelliteConfiguration A satellite configuration.
     /// @param [in] aSimulatorSPtr A shared pointer to the simulator.
+    /// @param [in] aThreadPoolSPtr A shared pointer to a thread pool to sample the ephemeris on (optional).
     /// @return A shared pointer to the configured satellite.
     static Shared<Satellite> Configure(
-        const SatelliteConfiguration& aSatelliteConfiguration, const Shared<const Simulator>& aSimulatorSPtr
+        const SatelliteConfiguration& aSatelliteConfiguration,
+        const Shared<const Simulator>& aSimulatorSPtr,
+        const Shared<ThreadPool>& aThreadPoolSPtr = nullptr
     );
 
     /// @brief Generate a reference frame for the satellite from a flight profile.
+    /// @details The transforms of the frame at its last few instants are memoized, so that resolving the frame
+    ///          repeatedly at an instant (e.g. once per component and geometry of the satellite) evaluates the
+    ///          profile once. The profile being immutable, memoized transforms never go stale. The frame provider
+    ///          is a satellite::FrameProvider, which the simulator seeds with the satellite states it evaluates.
+    ///
+    ///          The frame is not registered globally, but in the given frame registry (typically that of the
+    ///          simulator), if any.
     ///
     /// @code{.cpp}
     ///     Shared<const Frame> frame = Satellite::GenerateFrame("sat-1", profileSPtr);
@@ -168,11 +239,21 @@ class Satellite : public Component
     ///
     /// @param [in] aName A name for the frame.
     /// @param [in] aProfile A shared pointer to the flight profile.
+    /// @param [in] aMemoCapacity A number of instants to memoize transforms at (default: 8).
+    /// @param [in] anEphemerisSPtr A shared pointer to an ephemeris of the profile, used where it covers.
+    /// @param [in] aFrameRegistrySPtr A shared pointer to a frame registry to register the frame in (optional).
     /// @return A shared pointer to the generated frame.
-    static Shared<const Frame> GenerateFrame(const String& aName, const Shared<const Profile>& aProfile);
+    static Shared<const Frame> GenerateFrame(
+        const String& aName,
+        const Shared<const Profile>& aProfile,
+        const Size aMemoCapacity = 8,
+        const Shared<const Ephemeris>& anEphemerisSPtr = nullptr,
+        const Shared<FrameRegistry>& aFrameRegistrySPtr = nullptr
+    );
 
    private:
     Shared<const Profile> profileSPtr_;
+    Shared<const Ephemeris> ephemerisSPtr_;
 };
 
 /// @brief Configuration for constructing a Satellite.
@@ -184,6 +265,7 @@ struct SatelliteConfiguration
     const Array<ComponentConfiguration> components = DEFAULT_COMPONENTS;  ///< The child component configurations.
     const Array<String> tags = DEFAULT_TAGS;                              ///< The tags.
     const Array<GeometryConfiguration> geometries = DEFAULT_GEOMETRIES;   ///< The geometry configurations.
+    const EphemerisConfiguration ephemeris = DEFAULT_EPHEMERIS;           ///< The ephemeris configuration.
 };
 
 }  // namespace simulation
@@ -0,0 +1,180 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Simulation_Satellite_ChebyshevTable__
+#define __OpenSpaceToolkit_Simulation_Satellite_ChebyshevTable__
+
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace satellite
+{
+
+using ostk::core::type::Index;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::MatrixXd;
+
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+
+using TrajectoryState = ostk::astrodynamics::trajectory::State;
+
+/// @brief A table of Chebyshev polynomial coefficients of satellite states, over consecutive segments of equal
+///        duration.
+/// @details Each segment holds the coefficients of one polynomial per state component, in GCRF: position (3),
+///          attitude quaternion (4, XYZS) and angular velocity (3). Velocity is the derivative of the position
+///          polynomials, so that it is not stored (as in SPICE SPK type 2 segments).
+///
+///          Coefficients are stored contiguously, one column per degree and one row per component, segment after
+///          segment. A state query locates its segment by division and evaluates all components at once by the
+///          Clenshaw recurrence, along with the derivative of the series.
+///
+/// @code{.cpp}
+///     ChebyshevTable chebyshevTable(startInstant, Duration::Minutes(30.0), 12, coefficients);
+///     const TrajectoryState state = chebyshevTable.getStateAt(instant);
+/// @endcode
+class ChebyshevTable
+{
+   public:
+    /// @brief The number of fitted state components: position (3), attitude (4) and angular velocity (3).
+    static const Size ComponentCount;
+
+    /// @brief Constructor.
+    ///
+    /// @code{.cpp}
+    ///     ChebyshevTable chebyshevTable(startInstant, Duration::Minutes(30.0), 12, coefficients);
+    /// @endcode
+    ///
+    /// @param [in] aStartInstant The start instant of the first segment.
+    /// @param [in] aSegmentDuration The duration of each segment, strictly positive.
+    /// @param [in] aDegree The degree of the polynomials.
+    /// @param [in] aCoefficientMatrix A ComponentCount x (segment count * (degree + 1)) coefficient matrix.
+    ChebyshevTable(
+        const Instant& aStartInstant,
+        const Duration& aSegmentDuration,
+        const Size aDegree,
+        const MatrixXd& aCoefficientMatrix
+    );
+
+    /// @brief Output stream operator.
+    ///
+    /// @code{.cpp}
+    ///     std::cout << chebyshevTable;
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream.
+    /// @param [in] aChebyshevTable A Chebyshev table.
+    /// @return A reference to the output stream.
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const ChebyshevTable& aChebyshevTable);
+
+    /// @brief Check if the Chebyshev table is defined.
+    ///
+    /// @code{.cpp}
+    ///     bool defined = chebyshevTable.isDefined();
+    /// @endcode
+    ///
+    /// @return True if the Chebyshev table is defined.
+    bool isDefined() const;
+
+    /// @brief Get the degree of the polynomials.
+    ///
+    /// @code{.cpp}
+    ///     Size degree = chebyshevTable.getDegree();
+    /// @endcode
+    ///
+    /// @return The degree.
+    Size getDegree() const;
+
+    /// @brief Get the number of segments.
+    ///
+    /// @code{.cpp}
+    ///     Size segmentCount = chebyshevTable.getSegmentCount();
+    /// @endcode
+    ///
+    /// @return The number of segments.
+    Size getSegmentCount() const;
+
+    /// @brief Get the duration of each segment.
+    ///
+    /// @code{.cpp}
+    ///     Duration segmentDuration = chebyshevTable.getSegmentDuration();
+    /// @endcode
+    ///
+    /// @return The segment duration.
+    Duration getSegmentDuration() const;
+
+    /// @brief Get the interval covered by the segments.
+    ///
+    /// @code{.cpp}
+    ///     Interval interval = chebyshevTable.getInterval();
+    /// @endcode
+    ///
+    /// @return The closed interval between the start of the first segment and the end of the last one.
+    Interval getInterval() const;
+
+    /// @brief Access the coefficients.
+    ///
+    /// @code{.cpp}
+    ///     const MatrixXd& coefficients = chebyshevTable.accessCoefficients();
+    /// @endcode
+    ///
+    /// @return A reference to the coefficient matrix.
+    const MatrixXd& accessCoefficients() const;
+
+    /// @brief Get the state at an instant.
+    ///
+    /// @code{.cpp}
+    ///     TrajectoryState state = chebyshevTable.getStateAt(instant);
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant, within the interval of the table.
+    /// @return The state (in GCRF) at the instant.
+    TrajectoryState getStateAt(const Instant& anInstant) const;
+
+    /// @brief Print the Chebyshev table to an output stream.
+    ///
+    /// @code{.cpp}
+    ///     chebyshevTable.print(std::cout, true);
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream.
+    /// @param [in] displayDecorators If true, display decorators.
+    void print(std::ostream& anOutputStream, bool displayDecorators = true) const;
+
+    /// @brief Construct an undefined Chebyshev table.
+    ///
+    /// @code{.cpp}
+    ///     ChebyshevTable chebyshevTable = ChebyshevTable::Undefined();
+    /// @endcode
+    ///
+    /// @return An undefined Chebyshev table.
+    static ChebyshevTable Undefined();
+
+   private:
+    Instant startInstant_;
+    Real segmentSeconds_;
+    Size degree_;
+    Size segmentCount_;
+    MatrixXd coefficients_;
+};
+
+}  // namespace satellite
+}  // namespace simulation
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,347 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Simulation_Satellite_Ephemeris__
+#define __OpenSpaceToolkit_Simulation_Satellite_Ephemeris__
+
+#include <OpenSpaceToolkit/Simulation/Satellite/ChebyshevTable.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator/StateTable.hpp>
+#include <OpenSpaceToolkit/Simulation/Utility/ThreadPool.hpp>
+
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/Profile.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+#define DEFAULT_EPHEMERIS_STEP Duration::Minutes(1.0)
+#define DEFAULT_EPHEMERIS_POSITION_TOLERANCE Length::Meters(1e-2)
+#define DEFAULT_EPHEMERIS_ATTITUDE_TOLERANCE Angle::Degrees(1e-3)
+#define DEFAULT_EPHEMERIS_THREAD_COUNT 0
+#define DEFAULT_EPHEMERIS_TYPE Ephemeris::Type::Tabulated
+#define DEFAULT_EPHEMERIS_DEGREE 12
+
+namespace ostk
+{
+namespace simulation
+{
+namespace satellite
+{
+
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::flight::Profile;
+using TrajectoryState = ostk::astrodynamics::trajectory::State;
+
+using ostk::simulation::simulator::StateTable;
+using ostk::simulation::utility::ThreadPool;
+
+/// @brief Satellite states precomputed over an interval, in one of two representations.
+/// @details A tabulated ephemeris samples states on a uniform grid, in GCRF. A state query locates its grid segment
+///          by division, then interpolates position and velocity with a cubic Hermite polynomial, attitude by
+///          spherical linear interpolation (SLERP) and angular velocity linearly: a few dozen flops, whatever the
+///          cost of the profile the table was sampled from. Generated ephemerides are checked against their profile
+///          at the midpoint of every segment, where interpolation errors peak, and refined by halving their step
+///          until within the requested tolerances.
+///
+///          A Chebyshev ephemeris instead stores polynomial coefficients over segments spanning many table steps
+///          (see ChebyshevTable), an order of magnitude less memory for smooth trajectories, for large fleets over
+///          long intervals.
+///
+/// @code{.cpp}
+///     const Ephemeris ephemeris = Ephemeris::Generate(profile, interval, Duration::Minutes(1.0));
+///     const TrajectoryState state = ephemeris.getStateAt(instant);
+/// @endcode
+class Ephemeris
+{
+   public:
+    /// @brief Ephemeris representation.
+    enum class Type
+    {
+        Tabulated,  ///< Uniformly sampled states, interpolated
+        Chebyshev   ///< Chebyshev polynomial segments
+    };
+
+    /// @brief Construct an ephemeris from a state table.
+    ///
+    /// @code{.cpp}
+    ///     Ephemeris ephemeris(stateTable);
+    /// @endcode
+    ///
+    /// @param [in] aStateTable A state table of at least two states, at uniformly spaced increasing instants.
+    Ephemeris(const StateTable& aStateTable);
+
+    /// @brief Construct an ephemeris from a Chebyshev table.
+    ///
+    /// @code{.cpp}
+    ///     Ephemeris ephemeris(chebyshevTable);
+    /// @endcode
+    ///
+    /// @param [in] aChebyshevTable A Chebyshev table.
+    Ephemeris(const ChebyshevTable& aChebyshevTable);
+
+    /// @brief Output stream operator.
+    ///
+    /// @code{.cpp}
+    ///     std::cout << ephemeris;
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream.
+    /// @param [in] anEphemeris An ephemeris.
+    /// @return A reference to the output stream.
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const Ephemeris& anEphemeris);
+
+    /// @brief Check if the ephemeris is defined.
+    ///
+    /// @code{.cpp}
+    ///     bool defined = ephemeris.isDefined();
+    /// @endcode
+    ///
+    /// @return True if the ephemeris is defined.
+    bool isDefined() const;
+
+    /// @brief Get the representation of the ephemeris.
+    ///
+    /// @code{.cpp}
+    ///     Ephemeris::Type type = ephemeris.getType();
+    /// @endcode
+    ///
+    /// @return The ephemeris type.
+    Type getType() const;
+
+    /// @brief Check if the ephemeris covers an instant.
+    ///
+    /// @code{.cpp}
+    ///     bool covers = ephemeris.contains(instant);
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant.
+    /// @return True if the instant is within the interval of the ephemeris.
+    bool contains(const Instant& anInstant) const;
+
+    /// @brief Get the interval covered by the ephemeris.
+    ///
+    /// @code{.cpp}
+    ///     Interval interval = ephemeris.getInterval();
+    /// @endcode
+    ///
+    /// @return The closed interval between the first and last states.
+    Interval getInterval() const;
+
+    /// @brief Get the step between states, or the segment duration of a Chebyshev ephemeris.
+    ///
+    /// @code{.cpp}
+    ///     Duration step = ephemeris.getStep();
+    /// @endcode
+    ///
+    /// @return The step.
+    Duration getStep() const;
+
+    /// @brief Access the state table.
+    ///
+    /// @code{.cpp}
+    ///     const StateTable& stateTable = ephemeris.accessStateTable();
+    /// @endcode
+    ///
+    /// @return A reference to the state table.
+    const StateTable& accessStateTable() const;
+
+    /// @brief Access the Chebyshev table of a Chebyshev ephemeris.
+    ///
+    /// @code{.cpp}
+    ///     const ChebyshevTable& chebyshevTable = ephemeris.accessChebyshevTable();
+    /// @endcode
+    ///
+    /// @return A reference to the Chebyshev table.
+    const ChebyshevTable& accessChebyshevTable() const;
+
+    /// @brief Get the interpolated (or evaluated) state at an instant.
+    ///
+    /// @code{.cpp}
+    ///     TrajectoryState state = ephemeris.getStateAt(instant);
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant, within the interval of the ephemeris.
+    /// @return The state (in GCRF) at the instant.
+    TrajectoryState getStateAt(const Instant& anInstant) const;
+
+    /// @brief Print the ephemeris to an output stream.
+    ///
+    /// @code{.cpp}
+    ///     ephemeris.print(std::cout, true);
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream.
+    /// @param [in] displayDecorators If true, display decorators.
+    void print(std::ostream& anOutputStream, bool displayDecorators = true) const;
+
+    /// @brief Construct an undefined ephemeris.
+    ///
+    /// @code{.cpp}
+    ///     Ephemeris ephemeris = Ephemeris::Undefined();
+    /// @endcode
+    ///
+    /// @return An undefined ephemeris.
+    static Ephemeris Undefined();
+
+    /// @brief Get the string representation of an ephemeris type.
+    ///
+    /// @code{.cpp}
+    ///     String string = Ephemeris::StringFromType(Ephemeris::Type::Chebyshev);
+    /// @endcode
+    ///
+    /// @param [in] aType An ephemeris type.
+    /// @return The string representation.
+    static String StringFromType(const Type& aType);
+
+    /// @brief Generate an ephemeris by sampling a profile over an interval.
+    /// @details The step is first shortened so that it divides the interval evenly. Profile states are sampled in
+    ///          parallel. If interpolation errors at segment midpoints exceed a tolerance, the midpoint samples are
+    ///          merged into the table, halving its step, until errors are within tolerances.
+    ///
+    /// @code{.cpp}
+    ///     Ephemeris ephemeris = Ephemeris::Generate(profile, interval, Duration::Minutes(1.0));
+    /// @endcode
+    ///
+    /// @param [in] aProfile A flight profile.
+    /// @param [in] anInterval An interval to sample the profile over.
+    /// @param [in] aStep A maximum step between samples.
+    /// @param [in] aPositionTolerance A maximum position interpolation error.
+    /// @param [in] anAttitudeTolerance A maximum attitude interpolation error.
+    /// @param [in] aThreadCount A sampling thread count, 0 for the hardware concurrency.
+    /// @return An ephemeris.
+    static Ephemeris Generate(
+        const Profile& aProfile,
+        const Interval& anInterval,
+        const Duration& aStep,
+        const Length& aPositionTolerance = DEFAULT_EPHEMERIS_POSITION_TOLERANCE,
+        const Angle& anAttitudeTolerance = DEFAULT_EPHEMERIS_ATTITUDE_TOLERANCE,
+        const Size aThreadCount = DEFAULT_EPHEMERIS_THREAD_COUNT
+    );
+
+    /// @brief Generate an ephemeris by sampling a profile over an interval, on an existing thread pool.
+    /// @details Allows generating many ephemerides (e.g. one per configured satellite) without spawning threads for
+    ///          each.
+    ///
+    /// @code{.cpp}
+    ///     ThreadPool threadPool(8);
+    ///     Ephemeris ephemeris = Ephemeris::Generate(profile, interval, step, positionTolerance, attitudeTolerance,
+    ///                                               threadPool);
+    /// @endcode
+    ///
+    /// @param [in] aProfile A flight profile.
+    /// @param [in] anInterval An interval to sample the profile over.
+    /// @param [in] aStep A maximum step between samples.
+    /// @param [in] aPositionTolerance A maximum position interpolation error.
+    /// @param [in] anAttitudeTolerance A maximum attitude interpolation error.
+    /// @param [in] aThreadPool A thread pool to sample on.
+    /// @return An ephemeris.
+    static Ephemeris Generate(
+        const Profile& aProfile,
+        const Interval& anInterval,
+        const Duration& aStep,
+        const Length& aPositionTolerance,
+        const Angle& anAttitudeTolerance,
+        ThreadPool& aThreadPool
+    );
+
+    /// @brief Fit a Chebyshev ephemeris to a profile over an interval.
+    /// @details The segment duration is first shortened so that it divides the interval evenly. Each segment is
+    ///          fitted by interpolation at its Chebyshev nodes, with profile states sampled in parallel. Errors are
+    ///          checked halfway between nodes and at segment ends; if they exceed a tolerance, segments are halved
+    ///          and fitted again, until errors are within tolerances.
+    ///
+    /// @code{.cpp}
+    ///     Ephemeris ephemeris = Ephemeris::Fit(profile, interval, Duration::Minutes(30.0), 12);
+    /// @endcode
+    ///
+    /// @param [in] aProfile A flight profile.
+    /// @param [in] anInterval An interval to fit the profile over.
+    /// @param [in] aSegmentDuration A maximum segment duration.
+    /// @param [in] aDegree A polynomial degree.
+    /// @param [in] aPositionTolerance A maximum position error.
+    /// @param [in] anAttitudeTolerance A maximum attitude error.
+    /// @param [in] aThreadCount A sampling thread count, 0 for the hardware concurrency.
+    /// @return A Chebyshev ephemeris.
+    static Ephemeris Fit(
+        const Profile& aProfile,
+        const Interval& anInterval,
+        const Duration& aSegmentDuration,
+        const Size aDegree = DEFAULT_EPHEMERIS_DEGREE,
+        const Length& aPositionTolerance = DEFAULT_EPHEMERIS_POSITION_TOLERANCE,
+        const Angle& anAttitudeTolerance = DEFAULT_EPHEMERIS_ATTITUDE_TOLERANCE,
+        const Size aThreadCount = DEFAULT_EPHEMERIS_THREAD_COUNT
+    );
+
+    /// @brief Fit a Chebyshev ephemeris to a profile over an interval, on an existing thread pool.
+    /// @details Allows fitting many ephemerides (e.g. one per configured satellite) without spawning threads for
+    ///          each.
+    ///
+    /// @code{.cpp}
+    ///     ThreadPool threadPool(8);
+    ///     Ephemeris ephemeris = Ephemeris::Fit(profile, interval, segmentDuration, 12, positionTolerance,
+    ///                                          attitudeTolerance, threadPool);
+    /// @endcode
+    ///
+    /// @param [in] aProfile A flight profile.
+    /// @param [in] anInterval An interval to fit the profile over.
+    /// @param [in] aSegmentDuration A maximum segment duration.
+    /// @param [in] aDegree A polynomial degree.
+    /// @param [in] aPositionTolerance A maximum position error.
+    /// @param [in] anAttitudeTolerance A maximum attitude error.
+    /// @param [in] aThreadPool A thread pool to sample on.
+    /// @return A Chebyshev ephemeris.
+    static Ephemeris Fit(
+        const Profile& aProfile,
+        const Interval& anInterval,
+        const Duration& aSegmentDuration,
+        const Size aDegree,
+        const Length& aPositionTolerance,
+        const Angle& anAttitudeTolerance,
+        ThreadPool& aThreadPool
+    );
+
+   private:
+    Type type_;
+    StateTable stateTable_;
+    ChebyshevTable chebyshevTable_;
+    Real stepSeconds_;
+};
+
+/// @brief The configuration of a precomputed satellite ephemeris.
+/// @details An undefined interval (the default) leaves the satellite evaluating its profile directly. For a
+///          Chebyshev ephemeris, the step is the maximum segment duration.
+///
+/// @code{.cpp}
+///     const EphemerisConfiguration ephemerisConfiguration = {interval, Duration::Seconds(30.0)};
+/// @endcode
+struct EphemerisConfiguration
+{
+    const Interval interval = Interval::Undefined();                        ///< The sampled interval.
+    const Duration step = DEFAULT_EPHEMERIS_STEP;                           ///< The maximum step.
+    const Length positionTolerance = DEFAULT_EPHEMERIS_POSITION_TOLERANCE;  ///< The position tolerance.
+    const Angle attitudeTolerance = DEFAULT_EPHEMERIS_ATTITUDE_TOLERANCE;   ///< The attitude tolerance.
+    const Size threadCount = DEFAULT_EPHEMERIS_THREAD_COUNT;                ///< The sampling thread count.
+    const Ephemeris::Type type = DEFAULT_EPHEMERIS_TYPE;                    ///< The representation.
+    const Size degree = DEFAULT_EPHEMERIS_DEGREE;                           ///< The Chebyshev degree.
+};
+
+}  // namespace satellite
+}  // namespace simulation
+}  // namespace ostk
+
+#endif
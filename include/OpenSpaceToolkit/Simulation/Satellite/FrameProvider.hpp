@@ -0,0 +1,125 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Simulation_Satellite_FrameProvider__
+#define __OpenSpaceToolkit_Simulation_Satellite_FrameProvider__
+
+#include <OpenSpaceToolkit/Simulation/Satellite/Ephemeris.hpp>
+#include <OpenSpaceToolkit/Simulation/Utility/Memo.hpp>
+
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/Weak.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/Profile.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace satellite
+{
+
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+using ostk::core::type::Weak;
+
+using ostk::physics::coordinate::Transform;
+using ostk::physics::time::Instant;
+
+using ostk::astrodynamics::flight::Profile;
+using TrajectoryState = ostk::astrodynamics::trajectory::State;
+
+using ostk::simulation::utility::Memo;
+
+/// @brief Provider of the transforms from GCRF to the frame of a satellite.
+/// @details Transforms are evaluated from the satellite state: from the ephemeris where it covers, from the profile
+///          otherwise. The transforms at the last few instants are memoized, and shared by the copies of the
+///          provider. States evaluated elsewhere (e.g. by the simulator, when updating satellite states) can be
+///          memoized directly, so that resolving the frame at their instant does not evaluate the profile again.
+///
+/// @code{.cpp}
+///     const Shared<const FrameProvider> providerSPtr = std::make_shared<const FrameProvider>(profileSPtr);
+///     providerSPtr->memoizeState(state);
+/// @endcode
+class FrameProvider : public ostk::physics::coordinate::frame::Provider
+{
+   public:
+    /// @brief Constructor.
+    /// @details The profile and the ephemeris are referred to weakly.
+    ///
+    /// @code{.cpp}
+    ///     const FrameProvider provider(profileSPtr, 8, ephemerisSPtr);
+    /// @endcode
+    ///
+    /// @param [in] aProfileSPtr A shared pointer to the flight profile.
+    /// @param [in] aMemoCapacity A number of instants to memoize transforms at (default: 8).
+    /// @param [in] anEphemerisSPtr A shared pointer to an ephemeris of the profile, used where it covers.
+    FrameProvider(
+        const Shared<const Profile>& aProfileSPtr,
+        const Size aMemoCapacity = 8,
+        const Shared<const Ephemeris>& anEphemerisSPtr = nullptr
+    );
+
+    /// @brief Destructor.
+    virtual ~FrameProvider() override;
+
+    /// @brief Clone the provider.
+    /// @details The clone shares the memoized transforms.
+    ///
+    /// @return A pointer to the cloned provider.
+    virtual FrameProvider* clone() const override;
+
+    /// @brief Check if the provider is defined.
+    ///
+    /// @return True if the profile is still alive.
+    virtual bool isDefined() const override;
+
+    /// @brief Get the transform from GCRF to the satellite frame at an instant.
+    ///
+    /// @code{.cpp}
+    ///     const Transform transform = provider.getTransformAt(instant);
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant.
+    /// @return The transform.
+    virtual Transform getTransformAt(const Instant& anInstant) const override;
+
+    /// @brief Memoize the transform at the instant of a satellite state evaluated elsewhere.
+    /// @details Replaces the transform memoized at that instant, if any.
+    ///
+    /// @code{.cpp}
+    ///     provider.memoizeState(satellite.getStateAt(instant));
+    /// @endcode
+    ///
+    /// @param [in] aState A satellite state, at a defined instant.
+    void memoizeState(const TrajectoryState& aState) const;
+
+    /// @brief Compute the transform from GCRF to the satellite frame from a satellite state.
+    ///
+    /// @code{.cpp}
+    ///     const Transform transform = FrameProvider::TransformFromState(state);
+    /// @endcode
+    ///
+    /// @param [in] aState A satellite state.
+    /// @return The transform.
+    static Transform TransformFromState(const TrajectoryState& aState);
+
+   private:
+    Weak<const Profile> profileWPtr_;
+    Weak<const Ephemeris> ephemerisWPtr_;
+
+    Shared<Memo<Instant, Transform>> memoSPtr_;
+
+    Transform evaluateTransformAt(const Instant& anInstant) const;
+};
+
+}  // namespace satellite
+}  // namespace simulation
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,151 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Simulation_Satellite_TransformTree__
+#define __OpenSpaceToolkit_Simulation_Satellite_TransformTree__
+
+#include <mutex>
+#include <unordered_map>
+
+#include <OpenSpaceToolkit/Simulation/Component.hpp>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace satellite
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::time::Instant;
+
+using ostk::simulation::Component;
+
+/// @brief The frames of a component subtree, flattened for evaluation of their transforms to GCRF at one instant.
+/// @details The frames of a root component (typically a satellite) and of all its descendants are stored
+///          contiguously, in preorder, so that each frame comes after its parent. Frames statically mounted on
+///          the frame of their parent component (see Component::GenerateFrame) keep their mounting transform,
+///          evaluated once at construction.
+///
+///          At a new instant, the transform of the root frame to GCRF is evaluated once, then composed with the
+///          mounting transforms top-down, in a single pass over the array. Later queries at that instant are a
+///          lookup. Frames not statically mounted on their parent are evaluated from the frame graph instead.
+///
+///          Components added after construction are not part of the tree. Concurrent queries are safe, and
+///          serialized.
+///
+/// @code{.cpp}
+///     const TransformTree transformTree(satellite);
+///     const Transform transform = transformTree.getTransformToGCRF(camera.accessFrame(), instant);
+/// @endcode
+class TransformTree
+{
+   public:
+    /// @brief Constructor.
+    ///
+    /// @code{.cpp}
+    ///     const TransformTree transformTree(satellite);
+    /// @endcode
+    ///
+    /// @param [in] aRootComponent A root component, with a frame.
+    TransformTree(const Component& aRootComponent);
+
+    /// @brief Copy constructor.
+    /// @details The evaluated transforms are not copied.
+    ///
+    /// @code{.cpp}
+    ///     const TransformTree copy(transformTree);
+    /// @endcode
+    ///
+    /// @param [in] aTransformTree A transform tree.
+    TransformTree(const TransformTree& aTransformTree);
+
+    /// @brief Check if a frame is part of the tree.
+    ///
+    /// @code{.cpp}
+    ///     bool contains = transformTree.contains(camera.accessFrame());
+    /// @endcode
+    ///
+    /// @param [in] aFrameSPtr A shared pointer to a frame.
+    /// @return True if the frame is part of the tree.
+    bool contains(const Shared<const Frame>& aFrameSPtr) const;
+
+    /// @brief Get the number of frames in the tree.
+    ///
+    /// @code{.cpp}
+    ///     Size size = transformTree.getSize();
+    /// @endcode
+    ///
+    /// @return The number of frames, root frame included.
+    Size getSize() const;
+
+    /// @brief Get the number of frames statically mounted on their parent.
+    ///
+    /// @code{.cpp}
+    ///     Size mountedFrameCount = transformTree.getMountedFrameCount();
+    /// @endcode
+    ///
+    /// @return The number of frames evaluated by composition.
+    Size getMountedFrameCount() const;
+
+    /// @brief Get the frames of the tree.
+    ///
+    /// @code{.cpp}
+    ///     Array<Shared<const Frame>> frames = transformTree.getFrames();
+    /// @endcode
+    ///
+    /// @return The frames, in preorder from the root frame.
+    Array<Shared<const Frame>> getFrames() const;
+
+    /// @brief Get the transform from a frame of the tree to GCRF.
+    ///
+    /// @code{.cpp}
+    ///     const Transform transform = transformTree.getTransformToGCRF(camera.accessFrame(), instant);
+    /// @endcode
+    ///
+    /// @param [in] aFrameSPtr A shared pointer to a frame of the tree.
+    /// @param [in] anInstant An instant.
+    /// @return The transform to GCRF.
+    Transform getTransformToGCRF(const Shared<const Frame>& aFrameSPtr, const Instant& anInstant) const;
+
+   private:
+    struct Node
+    {
+        Shared<const Frame> frameSPtr;
+        Index parentIndex;
+        Transform mountTransform;  ///< Undefined if the frame is not statically mounted on its parent.
+    };
+
+    Array<Node> nodes_;
+    std::unordered_map<const Frame*, Index> indexMap_;
+
+    mutable Instant instant_;
+    mutable Array<Transform> transforms_;
+    mutable std::mutex mutex_;
+
+    void addNodes(const Component& aComponent, const Index aParentIndex);
+
+    Index indexOf(const Shared<const Frame>& aFrameSPtr) const;
+
+    void evaluate(const Instant& anInstant) const;
+};
+
+}  // namespace satellite
+}  // namespace simulation
+}  // namespace ostk
+
+#endif
@@ -3,16 +3,42 @@
 #ifndef __OpenSpaceToolkit_Simulation_Simulator__
 #define __OpenSpaceToolkit_Simulation_Simulator__
 
+#include <functional>
+#include <set>
+#include <unordered_map>
+
+#include <OpenSpaceToolkit/Simulation/Component/State.hpp>
+#include <OpenSpaceToolkit/Simulation/Event/Behavior.hpp>
+#include <OpenSpaceToolkit/Simulation/Event/Detector.hpp>
+#include <OpenSpaceToolkit/Simulation/Event/Scheduler.hpp>
 #include <OpenSpaceToolkit/Simulation/Satellite.hpp>
+#include <OpenSpaceToolkit/Simulation/Satellite/TransformTree.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator/Checkpoint.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator/FrameRegistry.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator/History.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator/Pacer.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator/Partition.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator/StateCache.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator/StateTable.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator/TimeRange.hpp>
+#include <OpenSpaceToolkit/Simulation/Utility/CopyOnWrite.hpp>
+#include <OpenSpaceToolkit/Simulation/Utility/Delegate.hpp>
+#include <OpenSpaceToolkit/Simulation/Utility/DelegateList.hpp>
+#include <OpenSpaceToolkit/Simulation/Utility/SymbolIndex.hpp>
+#include <OpenSpaceToolkit/Simulation/Utility/ThreadPool.hpp>
 
 #include <OpenSpaceToolkit/Core/Container/Array.hpp>
 #include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
 #include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
+#include <OpenSpaceToolkit/Core/Type/Weak.hpp>
 
 #include <OpenSpaceToolkit/Physics/Environment.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
 
 namespace ostk
 {
@@ -20,33 +46,70 @@ namespace simulation
 {
 
 #define DEFAULT_SATELLITES Array<SatelliteConfiguration>::Empty()
+#define DEFAULT_THREAD_COUNT 0
 
 using ostk::core::container::Array;
 using ostk::core::container::Map;
+using ostk::core::type::Index;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
+using ostk::core::type::Weak;
 
 using ostk::physics::Environment;
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::environment::object::Celestial;
+using ObjectGeometry = ostk::physics::environment::object::Geometry;
 using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
 
+using ostk::simulation::component::State;
+using ostk::simulation::event::Behavior;
+using ostk::simulation::event::Detector;
+using ostk::simulation::event::Scheduler;
 using ostk::simulation::Satellite;
+using ostk::simulation::satellite::TransformTree;
+using ostk::simulation::simulator::Checkpoint;
+using ostk::simulation::simulator::FrameRegistry;
+using ostk::simulation::simulator::History;
+using ostk::simulation::simulator::Pacer;
+#if defined(__linux__)
+using ostk::simulation::simulator::Partition;
+#endif
+using ostk::simulation::simulator::StateCache;
+using ostk::simulation::simulator::StateTable;
+using ostk::simulation::simulator::TimeRange;
+using ostk::simulation::utility::CopyOnWrite;
+using ostk::simulation::utility::Delegate;
+using ostk::simulation::utility::DelegateList;
+using ostk::simulation::utility::Symbol;
+using ostk::simulation::utility::SymbolIndex;
+using ostk::simulation::utility::ThreadPool;
 
 struct SimulatorConfiguration;
 
 /// @brief The top-level simulation manager.
 /// @details The Simulator holds an Environment and a collection of Satellites, providing
-///          methods to advance the simulation in time and manage satellites.
+///          methods to advance the simulation in time and manage satellites. Time-tagged events can be
+///          scheduled, and the simulation advanced directly from event to event.
 ///
 /// @code{.cpp}
 ///     Simulator simulator(environment, satelliteArray);
 ///     simulator.setInstant(instant);
 ///     simulator.stepForward(Duration::Minutes(5.0));
 ///     const Satellite& sat = simulator.accessSatelliteWithName("sat-1");
+///     simulator.scheduleEvent(instant + Duration::Hours(1.0), [](Simulator& aSimulator) { ... });
+///     simulator.run(instant + Duration::Days(30.0));
 /// @endcode
 class Simulator
 {
    public:
+    typedef Delegate<void(const Simulator&, const Instant&)> StepObserver;
+    typedef Delegate<void(const Simulator&, const Satellite&, const TrajectoryState&)> SatelliteObserver;
+    typedef SymbolIndex<Shared<Satellite>>::Handle SatelliteHandle;
+
     /// @brief Construct a simulator.
     ///
     /// @code{.cpp}
@@ -97,6 +160,8 @@ class Simulator
     const Environment& accessEnvironment() const;
 
     /// @brief Access the satellite map.
+    /// @details Satellites may be modified through the map: those still shared with a fork are copied first (see
+    ///          fork).
     ///
     /// @code{.cpp}
     ///     const Map<String, Shared<Satellite>>& satellites = simulator.accessSatelliteMap();
@@ -115,6 +180,28 @@ class Simulator
     /// @return A reference to the satellite.
     const Satellite& accessSatelliteWithName(const String& aSatelliteName) const;
 
+    /// @brief Get a handle on a satellite, to access it repeatedly without lookup.
+    /// @details Satellites are looked up by name through a hash index of interned names. A handle skips the lookup
+    ///          until satellites are added or removed, then falls back to a lookup by interned name.
+    ///
+    /// @code{.cpp}
+    ///     const Simulator::SatelliteHandle handle = simulator.getSatelliteHandle("sat-1");
+    /// @endcode
+    ///
+    /// @param [in] aSatelliteName A satellite name.
+    /// @return A satellite handle.
+    SatelliteHandle getSatelliteHandle(const String& aSatelliteName) const;
+
+    /// @brief Access a satellite by handle.
+    ///
+    /// @code{.cpp}
+    ///     const Satellite& satellite = simulator.accessSatellite(handle);
+    /// @endcode
+    ///
+    /// @param [in] aSatelliteHandle A satellite handle.
+    /// @return A reference to the satellite.
+    const Satellite& accessSatellite(const SatelliteHandle& aSatelliteHandle) const;
+
     /// @brief Get the current simulation instant.
     ///
     /// @code{.cpp}
@@ -124,6 +211,219 @@ class Simulator
     /// @return The current instant.
     Instant getInstant() const;
 
+    /// @brief Access the event scheduler.
+    ///
+    /// @code{.cpp}
+    ///     const Scheduler& scheduler = simulator.accessScheduler();
+    /// @endcode
+    ///
+    /// @return A reference to the event scheduler.
+    const Scheduler& accessScheduler() const;
+
+    /// @brief Get the state of a component.
+    /// @details Components whose state has never been set are in the default state.
+    ///
+    /// @code{.cpp}
+    ///     State state = simulator.getComponentStateWithId(componentId);
+    /// @endcode
+    ///
+    /// @param [in] aComponentId A component identifier.
+    /// @return The component state.
+    State getComponentStateWithId(const String& aComponentId) const;
+
+    /// @brief Evaluate the states of all satellites over a time grid.
+    /// @details Satellites are evaluated in a single pass over the grid, without moving the simulation
+    ///          instant. The returned tables store states contiguously, in GCRF.
+    ///
+    ///          With a thread count set (see setThreadCount), the grid is split into contiguous time shards,
+    ///          evaluated concurrently and merged back in time order.
+    ///
+    /// @code{.cpp}
+    ///     const Map<String, StateTable> stateTables = simulator.evaluate(interval.generateGrid(step));
+    ///     const MatrixXd& positions = stateTables.at("sat-1").accessPositions();
+    /// @endcode
+    ///
+    /// @param [in] anInstantArray An array of instants.
+    /// @return A map of satellite names to state tables.
+    Map<String, StateTable> evaluate(const Array<Instant>& anInstantArray) const;
+
+    /// @brief Get a lazy range of satellite states over the grid of an interval.
+    /// @details The range samples a snapshot of the simulator, evaluated chunk by chunk as it is iterated (see
+    ///          TimeRange). The simulation instant does not move.
+    ///
+    /// @code{.cpp}
+    ///     for (const TimeRange::View& view : simulator.range(interval, Duration::Seconds(10.0)))
+    ///     {
+    ///         const TrajectoryState state = view.getSatelliteStateWithName("sat-1");
+    ///     }
+    /// @endcode
+    ///
+    /// @param [in] anInterval An interval.
+    /// @param [in] aStep A step, strictly positive.
+    /// @param [in] aChunkSize A number of instants evaluated at once, strictly positive.
+    /// @param [in] prefetch If true, evaluate the next chunk in the background.
+    /// @return A time range.
+    TimeRange range(
+        const Interval& anInterval, const Duration& aStep, const Size& aChunkSize = 64, const bool& prefetch = true
+    ) const;
+
+    /// @brief Compute the crossings of a detector over an interval.
+    /// @details Crossings are computed as by Detector::computeCrossings. With a thread count set (see
+    ///          setThreadCount), the interval is split into time shards aligned on the sampling grid, searched
+    ///          concurrently and merged back in time order: the crossings are the same as a serial search.
+    ///
+    /// @code{.cpp}
+    ///     const Array<Detector::Crossing> crossings =
+    ///         simulator.computeCrossings(detector, interval, Duration::Minutes(1.0));
+    /// @endcode
+    ///
+    /// @param [in] aDetector A detector.
+    /// @param [in] anInterval An interval.
+    /// @param [in] aStep A coarse sampling step, strictly positive.
+    /// @param [in] aTolerance A time tolerance on crossing instants, strictly positive.
+    /// @return The chronologically ordered crossings.
+    Array<Detector::Crossing> computeCrossings(
+        const Detector& aDetector,
+        const Interval& anInterval,
+        const Duration& aStep,
+        const Duration& aTolerance = DEFAULT_EVENT_TOLERANCE
+    ) const;
+
+    /// @brief Get the thread count used to update satellite states when the simulation instant changes.
+    ///
+    /// @code{.cpp}
+    ///     Size threadCount = simulator.getThreadCount();
+    /// @endcode
+    ///
+    /// @return The thread count, 0 if the update phase is disabled.
+    Size getThreadCount() const;
+
+#if defined(__linux__)
+
+    /// @brief Get the worker process count used to update satellite states when the simulation instant changes.
+    ///
+    /// @code{.cpp}
+    ///     Size processCount = simulator.getProcessCount();
+    /// @endcode
+    ///
+    /// @return The worker process count, 0 if satellites are not partitioned.
+    Size getProcessCount() const;
+
+#endif
+
+    /// @brief Access the history of recently visited instants.
+    ///
+    /// @code{.cpp}
+    ///     const Array<Instant> instants = simulator.accessHistory().getInstants();
+    /// @endcode
+    ///
+    /// @return A reference to the history.
+    const History& accessHistory() const;
+
+    /// @brief Access the registry of the frames of the satellites and components of the simulator.
+    /// @details Forks share the registry, as they share satellites.
+    ///
+    /// @code{.cpp}
+    ///     bool hasFrame = simulator.accessFrameRegistry()->hasFrameWithName("Satellite [1]");
+    /// @endcode
+    ///
+    /// @return A shared pointer to the frame registry.
+    const Shared<FrameRegistry>& accessFrameRegistry() const;
+
+    /// @brief Access the cache of values evaluated lazily at the current simulation instant.
+    ///
+    /// @code{.cpp}
+    ///     bool isDirty = simulator.accessStateCache().isSatelliteDirty("sat-1");
+    /// @endcode
+    ///
+    /// @return A reference to the state cache.
+    const StateCache& accessStateCache() const;
+
+    /// @brief Get the state of a satellite at the current simulation instant.
+    /// @details If the update phase is enabled, the state stored at the last instant change is returned.
+    ///          Otherwise, the state is evaluated when first queried at the instant, and reused by subsequent
+    ///          queries (see StateCache).
+    ///
+    /// @code{.cpp}
+    ///     TrajectoryState state = simulator.getSatelliteStateWithName("sat-1");
+    /// @endcode
+    ///
+    /// @param [in] aSatelliteName A satellite name.
+    /// @return The satellite state (in GCRF) at the current instant.
+    TrajectoryState getSatelliteStateWithName(const String& aSatelliteName) const;
+
+    /// @brief Get a component geometry in GCRF at the current simulation instant.
+    /// @details The geometry is transformed when first queried at the instant, and reused by subsequent queries
+    ///          (see StateCache). The transform of its frame is resolved as in getTransformToGCRF, through the
+    ///          transform tree of its satellite.
+    ///
+    /// @code{.cpp}
+    ///     const ObjectGeometry fov = simulator.getGeometryInGCRF(camera.accessGeometryWithName("FOV"));
+    /// @endcode
+    ///
+    /// @param [in] aGeometry A component geometry.
+    /// @return The geometry, in GCRF.
+    ObjectGeometry getGeometryInGCRF(const component::Geometry& aGeometry) const;
+
+    /// @brief Get the geometry of a celestial object in GCRF at the current simulation instant.
+    /// @details The geometry is transformed when first queried at the instant, and reused by subsequent queries
+    ///          (see StateCache), e.g. when checking several sensors against the same target. Only celestial
+    ///          objects of the simulator environment are cached, other objects are transformed on every query.
+    ///
+    /// @code{.cpp}
+    ///     const Shared<const Celestial> earthSPtr =
+    ///         simulator.accessEnvironment().accessCelestialObjectWithName("Earth");
+    ///     const ObjectGeometry earth = simulator.getCelestialGeometryInGCRF(*earthSPtr);
+    /// @endcode
+    ///
+    /// @param [in] aCelestialObject A celestial object.
+    /// @return The geometry, in GCRF.
+    ObjectGeometry getCelestialGeometryInGCRF(const Celestial& aCelestialObject) const;
+
+    /// @brief Get the transform from a frame to GCRF at the current simulation instant.
+    /// @details The transform is evaluated when first queried at the instant, and reused by subsequent queries
+    ///          (see StateCache). Frames of satellites and of their components, as of when satellites were added,
+    ///          are evaluated from the transform tree of their satellite: one evaluation of the satellite frame
+    ///          per instant, composed with the static mounting transforms of its components (see TransformTree).
+    ///
+    /// @code{.cpp}
+    ///     const Transform transform = simulator.getTransformToGCRF(satellite.accessFrame());
+    /// @endcode
+    ///
+    /// @param [in] aFrameSPtr A shared pointer to a frame.
+    /// @return The transform to GCRF.
+    Transform getTransformToGCRF(const Shared<const Frame>& aFrameSPtr) const;
+
+    /// @brief Fork the simulation into an independent branch.
+    /// @details The fork starts from the same instant, component states and pending events, and then evolves
+    ///          independently. Forking copies no satellite: satellite component trees, and the satellite and
+    ///          component state maps, are shared until a branch modifies them. A branch copies a shared tree the
+    ///          first time it hands it out to be modified (accessSatelliteMap), and the fork also the first time
+    ///          it hands it out at all (accessSatelliteWithName, accessSatellite, satellite observers), binding its
+    ///          components and geometries to the fork, so that they query the fork (Component::getState, geometry
+    ///          predicates at the current instant). Propagating, partitioning and recording satellite states never
+    ///          copy a tree. Profiles, frames and geometry shapes stay shared between branches, as does the thread
+    ///          pool. Running behaviors stay with this simulator: their pending resumptions are not part of the fork.
+    ///
+    /// @code{.cpp}
+    ///     Shared<Simulator> branchSPtr = simulator.fork();
+    ///     branchSPtr->setComponentStateWithId(componentId, State(State::Status::Busy));
+    ///     branchSPtr->stepForward(Duration::Minutes(5.0));
+    /// @endcode
+    ///
+    /// @return A shared pointer to the forked simulator.
+    Shared<Simulator> fork() const;
+
+    /// @brief Create a checkpoint of the simulation.
+    /// @details The checkpoint records the simulation instant, the satellite states and the component states.
+    ///
+    /// @code{.cpp}
+    ///     simulator.createCheckpoint().save(File::Path(Path::Parse("/tmp/checkpoint.bin")));
+    /// @endcode
+    ///
+    /// @return A checkpoint.
+    Checkpoint createCheckpoint() const;
+
     /// @brief Print the simulator to an output stream.
     ///
     /// @code{.cpp}
@@ -135,6 +435,10 @@ class Simulator
     void print(std::ostream& anOutputStream, bool displayDecorators = true) const;
 
     /// @brief Set the simulation instant.
+    /// @details The states at the current instant are first recorded into the history, if enabled. If the history
+    ///          holds the new instant, the satellite states and the component states are restored from it: changes
+    ///          made to component states since that instant was recorded are reverted. Otherwise, satellite states
+    ///          are updated from their profiles and component states are kept.
     ///
     /// @code{.cpp}
     ///     simulator.setInstant(instant);
@@ -152,6 +456,346 @@ class Simulator
     /// @param [in] aDuration A duration.
     void stepForward(const Duration& aDuration);
 
+    /// @brief Move the simulation back by a duration.
+    /// @details Instants held in the history are restored from it rather than evaluated again (see
+    ///          setHistoryMemoryBudget). Events are not replayed.
+    ///
+    /// @code{.cpp}
+    ///     simulator.stepBackward(Duration::Minutes(5.0));
+    /// @endcode
+    ///
+    /// @param [in] aDuration A duration.
+    void stepBackward(const Duration& aDuration);
+
+    /// @brief Advance the simulation by the largest step over which no monitored predicate changes.
+    /// @details The step is the shortest safe step of all detectors, bounded by a minimum and a maximum step.
+    ///          Sweeping an interval with adaptive steps only refines the sampling close to predicate boundaries.
+    ///
+    /// @code{.cpp}
+    ///     while (simulator.getInstant() < endInstant)
+    ///     {
+    ///         simulator.stepForwardAdaptively(detectors, Duration::Seconds(1.0), Duration::Minutes(10.0));
+    ///     }
+    /// @endcode
+    ///
+    /// @param [in] aDetectorArray An array of monitored detectors.
+    /// @param [in] aMinimumStep A minimum step, strictly positive.
+    /// @param [in] aMaximumStep A maximum step, not shorter than the minimum step.
+    /// @return The step taken.
+    Duration stepForwardAdaptively(
+        const Array<Detector>& aDetectorArray, const Duration& aMinimumStep, const Duration& aMaximumStep
+    );
+
+    /// @brief Set the thread count used to update satellite states when the simulation instant changes.
+    /// @details When strictly positive, every change of the simulation instant evaluates the states of all
+    ///          satellites concurrently and stores them for subsequent queries. A thread count of 0 disables
+    ///          the update phase, satellite states are then evaluated on demand.
+    ///
+    ///          The same threads split time grids and intervals into shards, for evaluate, computeCrossings and
+    ///          scheduleCrossings. Event execution stays sequential.
+    ///
+    /// @code{.cpp}
+    ///     simulator.setThreadCount(std::thread::hardware_concurrency());
+    /// @endcode
+    ///
+    /// @param [in] aThreadCount A thread count (including the calling thread).
+    void setThreadCount(const Size& aThreadCount);
+
+#if defined(__linux__)
+
+    /// @brief Set the worker process count used to update satellite states when the simulation instant changes.
+    /// @details When strictly positive, satellites are partitioned over local worker processes (see Partition):
+    ///          every change of the simulation instant evaluates the states of all satellites across the workers,
+    ///          which write them (in GCRF) to shared memory, where subsequent queries read them in place. This
+    ///          takes precedence over the update threads (see setThreadCount), which are still used by evaluate and
+    ///          computeCrossings. A process count of 0 stops the workers.
+    ///
+    ///          Workers are forked again when satellites are added or removed, so satellites should be set up
+    ///          before partitioning. The update threads are stopped while workers are forked, and no other thread
+    ///          pool may be running at that time, including one shared with a fork of this simulator: partitioning
+    ///          is then disabled, and an error is thrown. Only available on Linux.
+    ///
+    /// @code{.cpp}
+    ///     simulator.setProcessCount(4);
+    /// @endcode
+    ///
+    /// @param [in] aProcessCount A worker process count.
+    void setProcessCount(const Size& aProcessCount);
+
+#endif
+
+    /// @brief Set the memory budget of the history of recently visited instants.
+    /// @details When strictly positive, satellite states are evaluated on every change of the simulation instant
+    ///          (serially, unless an update thread count is set), and the satellite and component states at the
+    ///          instant being left are recorded. Moving back to a recorded instant restores these states from memory
+    ///          instead of evaluating them: component state changes made since are reverted. Recorded satellite
+    ///          states are expressed in GCRF. The oldest instants are evicted first once the budget is reached.
+    ///
+    ///          The history is cleared when satellites are added or removed, or when a checkpoint is restored. A
+    ///          zero budget disables the history.
+    ///
+    /// @code{.cpp}
+    ///     simulator.setHistoryMemoryBudget(16 * 1024 * 1024);
+    ///     simulator.stepForward(Duration::Minutes(5.0));
+    ///     simulator.stepBackward(Duration::Minutes(5.0)); // Memory read
+    /// @endcode
+    ///
+    /// @param [in] aMemoryBudget A memory budget [bytes].
+    void setHistoryMemoryBudget(const Size& aMemoryBudget);
+
+    /// @brief Add an observer called before every change of the simulation instant.
+    /// @details Step observers are called on every change of the simulation instant (setInstant, stepForward, run
+    ///          and their variants), with the new instant. Observers are called in subscription order, through a
+    ///          single indirect call each: the delegate overloads never allocate, the function overloads allocate
+    ///          once, when subscribing. Observers may not be added or removed from within an observer, and are
+    ///          inherited by forks.
+    ///
+    /// @code{.cpp}
+    ///     const Index observerId = simulator.addPreStepObserver(
+    ///         Simulator::StepObserver::FromMethod<Recorder, &Recorder::onPreStep>(&recorder)
+    ///     );
+    /// @endcode
+    ///
+    /// @param [in] anObserver A step observer, whose target must outlive the subscription.
+    /// @return The observer identifier.
+    Index addPreStepObserver(const StepObserver& anObserver);
+
+    /// @brief Add an observer called before every change of the simulation instant.
+    ///
+    /// @code{.cpp}
+    ///     simulator.addPreStepObserver([](const Simulator& aSimulator, const Instant& anInstant) { ... });
+    /// @endcode
+    ///
+    /// @param [in] anObserver A step observer function.
+    /// @return The observer identifier.
+    Index addPreStepObserver(const std::function<void(const Simulator&, const Instant&)>& anObserver);
+
+    /// @brief Add an observer called after every change of the simulation instant.
+    /// @details Post-step observers are called once satellite states are updated and satellite observers are
+    ///          called (see addPreStepObserver).
+    ///
+    /// @code{.cpp}
+    ///     const Index observerId = simulator.addPostStepObserver(
+    ///         Simulator::StepObserver::FromMethod<Recorder, &Recorder::onPostStep>(&recorder)
+    ///     );
+    /// @endcode
+    ///
+    /// @param [in] anObserver A step observer, whose target must outlive the subscription.
+    /// @return The observer identifier.
+    Index addPostStepObserver(const StepObserver& anObserver);
+
+    /// @brief Add an observer called after every change of the simulation instant.
+    ///
+    /// @code{.cpp}
+    ///     simulator.addPostStepObserver([](const Simulator& aSimulator, const Instant& anInstant) { ... });
+    /// @endcode
+    ///
+    /// @param [in] anObserver A step observer function.
+    /// @return The observer identifier.
+    Index addPostStepObserver(const std::function<void(const Simulator&, const Instant&)>& anObserver);
+
+    /// @brief Add an observer called with every satellite state, after every change of the simulation instant.
+    /// @details Satellites are traversed once per step for all satellite observers, in name order, reusing the
+    ///          states evaluated by the update phase when enabled (see setThreadCount), or the state cache
+    ///          otherwise (see getSatelliteStateWithName). Satellites without a state at the simulation instant (see
+    ///          Satellite::hasStateAt) are observed with an undefined state; errors evaluating a state propagate.
+    ///
+    /// @code{.cpp}
+    ///     const Index observerId = simulator.addSatelliteObserver(
+    ///         Simulator::SatelliteObserver::FromMethod<Recorder, &Recorder::onSatellite>(&recorder)
+    ///     );
+    /// @endcode
+    ///
+    /// @param [in] anObserver A satellite observer, whose target must outlive the subscription.
+    /// @return The observer identifier.
+    Index addSatelliteObserver(const SatelliteObserver& anObserver);
+
+    /// @brief Add an observer called with every satellite state, after every change of the simulation instant.
+    ///
+    /// @code{.cpp}
+    ///     simulator.addSatelliteObserver(
+    ///         [](const Simulator& aSimulator, const Satellite& aSatellite, const TrajectoryState& aState) { ... }
+    ///     );
+    /// @endcode
+    ///
+    /// @param [in] anObserver A satellite observer function.
+    /// @return The observer identifier.
+    Index addSatelliteObserver(
+        const std::function<void(const Simulator&, const Satellite&, const TrajectoryState&)>& anObserver
+    );
+
+    /// @brief Remove an observer.
+    ///
+    /// @code{.cpp}
+    ///     simulator.removeObserver(observerId);
+    /// @endcode
+    ///
+    /// @param [in] anObserverId An observer identifier.
+    void removeObserver(const Index& anObserverId);
+
+    /// @brief Set the state of a component.
+    ///
+    /// @code{.cpp}
+    ///     simulator.setComponentStateWithId(componentId, State(State::Status::Idle));
+    /// @endcode
+    ///
+    /// @param [in] aComponentId A component identifier.
+    /// @param [in] aState A component state.
+    void setComponentStateWithId(const String& aComponentId, const State& aState);
+
+    /// @brief Schedule an event.
+    /// @details When the event fires, the simulation instant is set to the event instant and the callback is
+    ///          called with this simulator.
+    ///
+    /// @code{.cpp}
+    ///     const Index eventId = simulator.scheduleEvent(instant, [](Simulator& aSimulator) { ... });
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant, not earlier than the simulation instant.
+    /// @param [in] aCallback A callback.
+    /// @return The event identifier.
+    Index scheduleEvent(const Instant& anInstant, const Scheduler::Callback& aCallback);
+
+    /// @brief Schedule a component state change.
+    ///
+    /// @code{.cpp}
+    ///     simulator.scheduleComponentStateChange(instant, componentId, State(State::Status::Busy));
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant, not earlier than the simulation instant.
+    /// @param [in] aComponentId A component identifier.
+    /// @param [in] aState The component state to set.
+    /// @return The event identifier.
+    Index scheduleComponentStateChange(const Instant& anInstant, const String& aComponentId, const State& aState);
+
+    /// @brief Detect the crossings of a geometric predicate over an interval, and schedule an event at each.
+    /// @details Crossings are detected as by computeCrossings.
+    ///
+    /// @code{.cpp}
+    ///     simulator.scheduleCrossings(
+    ///         detector, interval, Duration::Minutes(1.0),
+    ///         [](Simulator& aSimulator, const Detector::Crossing& aCrossing) { ... }
+    ///     );
+    /// @endcode
+    ///
+    /// @param [in] aDetector A detector.
+    /// @param [in] anInterval An interval, not starting earlier than the simulation instant.
+    /// @param [in] aStep A coarse sampling step.
+    /// @param [in] aCallback A callback, called with the crossing.
+    /// @return The event identifiers.
+    Array<Index> scheduleCrossings(
+        const Detector& aDetector,
+        const Interval& anInterval,
+        const Duration& aStep,
+        const std::function<void(Simulator&, const Detector::Crossing&)>& aCallback
+    );
+
+    /// @brief Cancel a pending event.
+    ///
+    /// @code{.cpp}
+    ///     simulator.cancelEvent(eventId);
+    /// @endcode
+    ///
+    /// @param [in] anEventId An event identifier.
+    void cancelEvent(const Index& anEventId);
+
+    /// @brief Start a behavior.
+    /// @details The behavior runs until its first suspension, then is resumed by events as its waits complete (see
+    ///          Behavior). The simulator owns the behavior until it completes or is cancelled. Exceptions thrown by
+    ///          the behavior are rethrown by the call that resumed it (this call, or run).
+    ///
+    ///          Behaviors require C++20 coroutines: without them, Behavior is only declared, and no behavior can be
+    ///          started.
+    ///
+    /// @code{.cpp}
+    ///     const Index behaviorId = simulator.startBehavior(downlink(simulator, detector, interval));
+    /// @endcode
+    ///
+    /// @param [in] aBehavior A behavior, not yet started.
+    /// @return The behavior identifier.
+    Index startBehavior(Behavior&& aBehavior);
+
+    /// @brief Start a behavior attached to a component (or a satellite).
+    /// @details The behavior is cancelled when the satellite holding the component is removed.
+    ///
+    /// @code{.cpp}
+    ///     const Index behaviorId = simulator.startBehavior(
+    ///         slew(simulator, "LoftSat-1"), simulator.accessSatelliteWithName("LoftSat-1")
+    ///     );
+    /// @endcode
+    ///
+    /// @param [in] aBehavior A behavior, not yet started.
+    /// @param [in] aComponent A component the behavior is attached to.
+    /// @return The behavior identifier.
+    Index startBehavior(Behavior&& aBehavior, const Component& aComponent);
+
+    /// @brief Cancel a running behavior, and its pending resumption.
+    ///
+    /// @code{.cpp}
+    ///     simulator.cancelBehavior(behaviorId);
+    /// @endcode
+    ///
+    /// @param [in] aBehaviorId A behavior identifier.
+    void cancelBehavior(const Index& aBehaviorId);
+
+    /// @brief Get the number of running behaviors.
+    ///
+    /// @code{.cpp}
+    ///     Size behaviorCount = simulator.getBehaviorCount();
+    /// @endcode
+    ///
+    /// @return The number of running behaviors.
+    Size getBehaviorCount() const;
+
+    /// @brief Advance the simulation from event to event, up to a given instant.
+    /// @details Pending events up to (and including) the instant are fired in chronological order. Events
+    ///          scheduled by callbacks are fired as well if they fall within the run. Events left behind by a
+    ///          manual change of the simulation instant are fired at the current instant. The simulation instant
+    ///          is finally set to the given instant.
+    ///
+    /// @code{.cpp}
+    ///     simulator.run(instant + Duration::Days(30.0));
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant, not earlier than the simulation instant.
+    void run(const Instant& anInstant);
+
+    /// @brief Advance the simulation up to a given instant, paced by the wall clock.
+    /// @details The simulation runs frame by frame (see Pacer), firing pending events as run does. The frame
+    ///          callback is called after each frame, with its timing, before waiting for the frame deadline: frames
+    ///          overrun as soon as the computation and the callback no longer fit in the frame period.
+    ///
+    /// @code{.cpp}
+    ///     const Pacer::Report report = simulator.runPaced(
+    ///         instant + Duration::Hours(1.0),
+    ///         Pacer(10.0, Duration::Milliseconds(100.0)),
+    ///         [](Simulator& aSimulator, const Pacer::Frame& aFrame) { ... }
+    ///     );
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant, not earlier than the simulation instant.
+    /// @param [in] aPacer A pacer.
+    /// @param [in] aFrameCallback A function called after each frame (optional).
+    /// @return The timing statistics of the run.
+    Pacer::Report runPaced(
+        const Instant& anInstant,
+        const Pacer& aPacer,
+        const std::function<void(Simulator&, const Pacer::Frame&)>& aFrameCallback = {}
+    );
+
+    /// @brief Restore the simulation from a checkpoint.
+    /// @details The simulator must hold the same satellites and component trees as the checkpoint, typically by
+    ///          being configured identically. The simulation instant and the component states are restored, and
+    ///          the recorded satellite states are reused instead of being evaluated again. Pending events and
+    ///          running behaviors are not part of checkpoints, and are cancelled.
+    ///
+    /// @code{.cpp}
+    ///     simulator.restore(Checkpoint::Load(File::Path(Path::Parse("/tmp/checkpoint.bin"))));
+    /// @endcode
+    ///
+    /// @param [in] aCheckpoint A checkpoint.
+    void restore(const Checkpoint& aCheckpoint);
+
     /// @brief Add a satellite to the simulation.
     ///
     /// @code{.cpp}
@@ -161,6 +805,18 @@ class Simulator
     /// @param [in] aSatelliteSPtr A shared pointer to a satellite.
     void addSatellite(const Shared<Satellite>& aSatelliteSPtr);
 
+    /// @brief Add satellites to the simulation, in a single batch.
+    /// @details All satellites are validated before any is added. Caches are invalidated, and partition workers
+    ///          forked again, once for the whole batch. A satellite whose name is already used is not added, as
+    ///          with addSatellite.
+    ///
+    /// @code{.cpp}
+    ///     simulator.addSatellites({satellite1SPtr, satellite2SPtr});
+    /// @endcode
+    ///
+    /// @param [in] aSatelliteArray An array of shared pointers to satellites.
+    void addSatellites(const Array<Shared<Satellite>>& aSatelliteArray);
+
     /// @brief Remove a satellite by name.
     ///
     /// @code{.cpp}
@@ -170,6 +826,17 @@ class Simulator
     /// @param [in] aSatelliteName A satellite name.
     void removeSatelliteWithName(const String& aSatelliteName);
 
+    /// @brief Remove satellites by name, in a single batch.
+    /// @details All names are validated before any satellite is removed. Caches are invalidated, and partition
+    ///          workers forked again, once for the whole batch.
+    ///
+    /// @code{.cpp}
+    ///     simulator.removeSatellitesWithNames({"sat-1", "sat-2"});
+    /// @endcode
+    ///
+    /// @param [in] aSatelliteNameArray An array of satellite names.
+    void removeSatellitesWithNames(const Array<String>& aSatelliteNameArray);
+
     /// @brief Remove all satellites from the simulation.
     ///
     /// @code{.cpp}
@@ -187,6 +854,10 @@ class Simulator
     static Simulator Undefined();
 
     /// @brief Configure a simulator from a configuration.
+    /// @details Satellite and component frames are registered in the frame registry of the simulator, rather than
+    ///          globally: simulators may be configured and run concurrently, from several threads. Satellite
+    ///          ephemerides are all sampled on a single thread pool, sized by the largest configured ephemeris
+    ///          thread count.
     ///
     /// @code{.cpp}
     ///     Shared<Simulator> simulator = Simulator::Configure(simulatorConfiguration);
@@ -198,7 +869,68 @@ class Simulator
 
    private:
     Environment environment_;
-    Map<String, Shared<Satellite>> satelliteMap_;
+    mutable CopyOnWrite<Map<String, Shared<Satellite>>> satelliteMap_;  // Mutable to unshare satellites on access
+    mutable CopyOnWrite<SymbolIndex<Shared<Satellite>>> satelliteIndex_;
+    CopyOnWrite<std::unordered_map<const Frame*, Shared<const TransformTree>>> transformTreeIndex_;
+    CopyOnWrite<Map<String, TrajectoryState>> satelliteStateMap_;
+    CopyOnWrite<Map<String, State>> componentStateMap_;
+    Scheduler scheduler_;
+    Shared<ThreadPool> threadPoolSPtr_;
+    CopyOnWrite<History> history_;
+    mutable StateCache stateCache_;
+    Shared<FrameRegistry> frameRegistrySPtr_;
+#if defined(__linux__)
+    Size processCount_;
+    Shared<Partition> partitionSPtr_;
+    Shared<const Partition::View> partitionViewSPtr_;
+#endif
+    DelegateList<void(const Simulator&, const Instant&)> preStepObservers_;
+    DelegateList<void(const Simulator&, const Instant&)> postStepObservers_;
+    DelegateList<void(const Simulator&, const Satellite&, const TrajectoryState&)> satelliteObservers_;
+    Index nextObserverId_;
+    mutable std::set<String> sharedSatelliteNames_;  // Satellites whose component tree is shared with a fork
+    Weak<const Simulator> forkWPtr_;                 // This simulator, if it is a fork, to bind the trees it shares
+
+    friend class event::Behavior;
+
+    struct BehaviorEntry
+    {
+        Shared<Behavior> behaviorSPtr;
+        String ownerId;
+    };
+
+    Map<Index, BehaviorEntry> behaviorMap_;
+    Index nextBehaviorId_;
+
+    Index startBehaviorWithOwnerId(Behavior&& aBehavior, const String& anOwnerId);
+
+    Index scheduleBehaviorResumption(const Index& aBehaviorId, const Instant& anInstant);
+
+    void resumeBehavior(const Index& aBehaviorId);
+
+    void cancelBehaviorsOfSatellite(const Satellite& aSatellite);
+
+    void updateSatelliteStates();
+
+    void memoizeSatelliteFrames() const;
+
+    void indexTransformTree(const Satellite& aSatellite);
+
+    void unindexTransformTree(const Satellite& aSatellite);
+
+    const TransformTree* findTransformTree(const Shared<const Frame>& aFrameSPtr) const;
+
+    const Shared<Satellite>& findSatelliteWithName(const String& aSatelliteName) const;
+
+    const Shared<Satellite>& unshareSatelliteWithName(const String& aSatelliteName, const bool isModified) const;
+
+    void unshareSatellites(const bool isModified) const;
+
+    void clearHistory();
+
+    void resetPartition();
+
+    void notifySatelliteObservers() const;
 };
 
 /// @brief Configuration for constructing a Simulator.
@@ -206,6 +938,7 @@ struct SimulatorConfiguration
 {
     const Environment environment;                                        ///< The environment.
     const Array<SatelliteConfiguration> satellites = DEFAULT_SATELLITES;  ///< The satellite configurations.
+    const Size threadCount = DEFAULT_THREAD_COUNT;                        ///< The satellite state update thread count.
 };
 
 }  // namespace simulation
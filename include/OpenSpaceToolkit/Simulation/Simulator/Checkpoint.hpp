@@ -0,0 +1,188 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Simulation_Simulator_Checkpoint__
+#define __OpenSpaceToolkit_Simulation_Simulator_Checkpoint__
+
+#include <OpenSpaceToolkit/Simulation/Component/State.hpp>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace simulator
+{
+
+using ostk::core::container::Array;
+using ostk::core::filesystem::File;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+using ostk::physics::time::Instant;
+
+using ostk::simulation::component::State;
+
+using TrajectoryState = ostk::astrodynamics::trajectory::State;
+
+/// @brief A snapshot of the dynamic state of a simulation.
+/// @details A checkpoint records the simulation instant, the satellite states (in GCRF) and the component trees
+///          with their states. Profiles and geometries are part of the simulator configuration and are not
+///          recorded: a checkpoint restores into a simulator built from the same configuration, which is checked
+///          against the recorded satellites and component trees.
+///
+///          The binary format is little-endian. It starts with an 8-byte magic ("OSTKSIMC") and a 32-bit format
+///          version, followed by the instant (nanoseconds since J2000, 64-bit), the satellite count (64-bit) and,
+///          for each satellite, its identifier, name, state (13 doubles) and the depth-first records of its
+///          component tree, starting with the satellite itself. Strings are prefixed with their 64-bit byte size.
+///
+/// @code{.cpp}
+///     simulator.createCheckpoint().save(File::Path(Path::Parse("/tmp/checkpoint.bin")));
+///     simulator.restore(Checkpoint::Load(File::Path(Path::Parse("/tmp/checkpoint.bin"))));
+/// @endcode
+class Checkpoint
+{
+   public:
+    /// @brief A recorded component.
+    struct ComponentRecord
+    {
+        String id;    ///< The component identifier.
+        String name;  ///< The component name.
+        Size depth;   ///< The depth in the satellite component tree (0 for the satellite itself).
+        State state;  ///< The component state.
+    };
+
+    /// @brief A recorded satellite.
+    struct SatelliteRecord
+    {
+        String id;                                ///< The satellite identifier.
+        String name;                              ///< The satellite name.
+        TrajectoryState state;                    ///< The satellite state, in GCRF.
+        Array<ComponentRecord> componentRecords;  ///< The depth-first component records.
+    };
+
+    /// @brief Construct a checkpoint.
+    ///
+    /// @code{.cpp}
+    ///     Checkpoint checkpoint(instant, satelliteRecords);
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant.
+    /// @param [in] aSatelliteRecordArray An array of satellite records.
+    Checkpoint(const Instant& anInstant, const Array<SatelliteRecord>& aSatelliteRecordArray);
+
+    /// @brief Output stream operator.
+    ///
+    /// @code{.cpp}
+    ///     std::cout << checkpoint;
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream.
+    /// @param [in] aCheckpoint A checkpoint.
+    /// @return A reference to the output stream.
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const Checkpoint& aCheckpoint);
+
+    /// @brief Check if the checkpoint is defined.
+    ///
+    /// @code{.cpp}
+    ///     bool defined = checkpoint.isDefined();
+    /// @endcode
+    ///
+    /// @return True if the checkpoint is defined.
+    bool isDefined() const;
+
+    /// @brief Get the checkpoint instant.
+    ///
+    /// @code{.cpp}
+    ///     Instant instant = checkpoint.getInstant();
+    /// @endcode
+    ///
+    /// @return The checkpoint instant.
+    Instant getInstant() const;
+
+    /// @brief Access the satellite records.
+    ///
+    /// @code{.cpp}
+    ///     const Array<Checkpoint::SatelliteRecord>& satelliteRecords = checkpoint.accessSatelliteRecords();
+    /// @endcode
+    ///
+    /// @return A reference to the satellite records.
+    const Array<SatelliteRecord>& accessSatelliteRecords() const;
+
+    /// @brief Serialize the checkpoint to bytes.
+    ///
+    /// @code{.cpp}
+    ///     const String bytes = checkpoint.toBytes();
+    /// @endcode
+    ///
+    /// @return The binary representation of the checkpoint.
+    String toBytes() const;
+
+    /// @brief Save the checkpoint to a file.
+    ///
+    /// @code{.cpp}
+    ///     checkpoint.save(File::Path(Path::Parse("/tmp/checkpoint.bin")));
+    /// @endcode
+    ///
+    /// @param [in] aFile A file, overwritten if it exists.
+    void save(const File& aFile) const;
+
+    /// @brief Print the checkpoint to an output stream.
+    ///
+    /// @code{.cpp}
+    ///     checkpoint.print(std::cout, true);
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream.
+    /// @param [in] displayDecorators If true, display decorators.
+    void print(std::ostream& anOutputStream, bool displayDecorators = true) const;
+
+    /// @brief Construct an undefined checkpoint.
+    ///
+    /// @code{.cpp}
+    ///     Checkpoint checkpoint = Checkpoint::Undefined();
+    /// @endcode
+    ///
+    /// @return An undefined checkpoint.
+    static Checkpoint Undefined();
+
+    /// @brief Deserialize a checkpoint from bytes.
+    ///
+    /// @code{.cpp}
+    ///     Checkpoint checkpoint = Checkpoint::FromBytes(bytes);
+    /// @endcode
+    ///
+    /// @param [in] aByteString A binary representation of a checkpoint.
+    /// @return A checkpoint.
+    static Checkpoint FromBytes(const String& aByteString);
+
+    /// @brief Load a checkpoint from a file.
+    /// @details The file is memory-mapped and decoded in place.
+    ///
+    /// @code{.cpp}
+    ///     Checkpoint checkpoint = Checkpoint::Load(File::Path(Path::Parse("/tmp/checkpoint.bin")));
+    /// @endcode
+    ///
+    /// @param [in] aFile A checkpoint file.
+    /// @return A checkpoint.
+    static Checkpoint Load(const File& aFile);
+
+   private:
+    Instant instant_;
+    Array<SatelliteRecord> satelliteRecords_;
+
+    static Checkpoint Decode(const char* aBuffer, const std::size_t& aSize);
+};
+
+}  // namespace simulator
+}  // namespace simulation
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,173 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Simulation_Simulator_Ensemble__
+#define __OpenSpaceToolkit_Simulation_Simulator_Ensemble__
+
+#include <cstdint>
+#include <functional>
+
+#include <OpenSpaceToolkit/Simulation/Simulator.hpp>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace simulator
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+using ostk::simulation::Simulator;
+using ostk::simulation::SimulatorConfiguration;
+
+/// @brief A Monte Carlo ensemble of simulations.
+/// @details Each replica is configured from a perturbation of a base configuration, evaluated into an array of
+///          scalar outputs (e.g. event times in seconds, undefined if the event did not occur), then discarded.
+///          Replicas run concurrently on a thread pool, in batches, and their outputs are reduced in replica order,
+///          so only one batch of outputs is held in memory at a time.
+///
+///          Each replica receives its own seed, derived from the ensemble seed and the replica index with
+///          SplitMix64: results are deterministic for a given seed, regardless of the thread count.
+///
+///          The perturbation and evaluation functions are called concurrently and must be thread-safe; so must
+///          the environment, whose celestial objects are evaluated from several replicas at once.
+///
+/// @code{.cpp}
+///     Ensemble ensemble(
+///         baseConfiguration,
+///         [](const SimulatorConfiguration& aConfiguration, const Index&, const std::uint64_t& aSeed) { ... },
+///         [](Simulator& aSimulator) -> Array<Real> { ... },
+///         1000,
+///         42,
+///         8
+///     );
+///     const Array<Ensemble::Statistics> statistics = ensemble.run();
+/// @endcode
+class Ensemble
+{
+   public:
+    /// @brief Statistics of an output, over the replicas where it is defined.
+    struct Statistics
+    {
+        Size count;              ///< The number of replicas where the output is defined.
+        Real mean;               ///< The mean (undefined if count is 0).
+        Real standardDeviation;  ///< The sample standard deviation (undefined if count is less than 2).
+        Real minimum;            ///< The minimum (undefined if count is 0).
+        Real maximum;            ///< The maximum (undefined if count is 0).
+    };
+
+    typedef std::function<SimulatorConfiguration(const SimulatorConfiguration&, const Index&, const std::uint64_t&)>
+        Perturbation;
+    typedef std::function<Array<Real>(Simulator&)> Evaluation;
+    typedef std::function<void(const Index&, const Array<Real>&)> Reduction;
+
+    /// @brief Construct an ensemble.
+    ///
+    /// @code{.cpp}
+    ///     Ensemble ensemble(baseConfiguration, perturbation, evaluation, 1000, 42, 8);
+    /// @endcode
+    ///
+    /// @param [in] aBaseConfiguration A base simulator configuration.
+    /// @param [in] aPerturbation A function returning the configuration of a replica, from the base configuration,
+    ///             the replica index and the replica seed.
+    /// @param [in] anEvaluation A function running a configured replica and returning its outputs.
+    /// @param [in] aReplicaCount A replica count.
+    /// @param [in] aSeed An ensemble seed.
+    /// @param [in] aThreadCount A thread count (including the calling thread), strictly positive.
+    Ensemble(
+        const SimulatorConfiguration& aBaseConfiguration,
+        const Perturbation& aPerturbation,
+        const Evaluation& anEvaluation,
+        const Size& aReplicaCount,
+        const std::uint64_t& aSeed,
+        const Size& aThreadCount = 1
+    );
+
+    /// @brief Get the replica count.
+    ///
+    /// @code{.cpp}
+    ///     Size replicaCount = ensemble.getReplicaCount();
+    /// @endcode
+    ///
+    /// @return The replica count.
+    Size getReplicaCount() const;
+
+    /// @brief Get the ensemble seed.
+    ///
+    /// @code{.cpp}
+    ///     std::uint64_t seed = ensemble.getSeed();
+    /// @endcode
+    ///
+    /// @return The ensemble seed.
+    std::uint64_t getSeed() const;
+
+    /// @brief Get the thread count.
+    ///
+    /// @code{.cpp}
+    ///     Size threadCount = ensemble.getThreadCount();
+    /// @endcode
+    ///
+    /// @return The thread count.
+    Size getThreadCount() const;
+
+    /// @brief Get the seed of a replica.
+    ///
+    /// @code{.cpp}
+    ///     std::uint64_t replicaSeed = ensemble.getReplicaSeed(0);
+    /// @endcode
+    ///
+    /// @param [in] aReplicaIndex A replica index.
+    /// @return The replica seed.
+    std::uint64_t getReplicaSeed(const Index& aReplicaIndex) const;
+
+    /// @brief Run the ensemble and compute output statistics.
+    /// @details All replicas must return the same number of outputs. The optional reduction is called on the
+    ///          calling thread with each replica output, in replica order.
+    ///
+    /// @code{.cpp}
+    ///     Array<Real> eventTimes = Array<Real>::Empty();
+    ///     const Array<Ensemble::Statistics> statistics = ensemble.run(
+    ///         [&eventTimes](const Index&, const Array<Real>& anOutputArray)
+    ///         {
+    ///             eventTimes.add(anOutputArray.accessFirst());
+    ///         }
+    ///     );
+    /// @endcode
+    ///
+    /// @param [in] aReduction A function called with each replica index and outputs (optional).
+    /// @return The statistics of each output.
+    Array<Statistics> run(const Reduction& aReduction = {}) const;
+
+    /// @brief Derive a replica seed from an ensemble seed, with SplitMix64.
+    ///
+    /// @code{.cpp}
+    ///     std::uint64_t replicaSeed = Ensemble::GenerateSeed(42, 0);
+    /// @endcode
+    ///
+    /// @param [in] aSeed An ensemble seed.
+    /// @param [in] aReplicaIndex A replica index.
+    /// @return The replica seed.
+    static std::uint64_t GenerateSeed(const std::uint64_t& aSeed, const Index& aReplicaIndex);
+
+   private:
+    SimulatorConfiguration baseConfiguration_;
+    Perturbation perturbation_;
+    Evaluation evaluation_;
+    Size replicaCount_;
+    std::uint64_t seed_;
+    Size threadCount_;
+};
+
+}  // namespace simulator
+}  // namespace simulation
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,172 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Simulation_Simulator_FrameRegistry__
+#define __OpenSpaceToolkit_Simulation_Simulator_FrameRegistry__
+
+#include <mutex>
+
+#include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+#include <OpenSpaceToolkit/Core/Type/Weak.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace simulator
+{
+
+using ostk::core::container::Map;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+using ostk::core::type::Weak;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::frame::Provider;
+
+/// @brief A registry of the frames of a simulator, by name.
+/// @details Frames are constructed outside the global frame registry of the physics library, so that simulators
+///          holding frames of the same name (e.g. replicas of an ensemble, configured from the same satellite
+///          identifiers) neither replace each other's frames nor contend for a global lock.
+///
+///          The registry refers to its frames weakly: frames are owned by the satellites and components they are
+///          generated for, and are released with them. Constructing a frame under the name of a live one replaces
+///          it in the registry. Concurrent use is safe.
+///
+/// @code{.cpp}
+///     FrameRegistry frameRegistry;
+///     const Shared<const Frame> frameSPtr = frameRegistry.constructFrame("Component [1]", false, parent, provider);
+///     bool hasFrame = frameRegistry.hasFrameWithName("Component [1]");
+/// @endcode
+class FrameRegistry
+{
+   public:
+    /// @brief Constructor.
+    ///
+    /// @code{.cpp}
+    ///     FrameRegistry frameRegistry;
+    /// @endcode
+    FrameRegistry();
+
+    /// @brief Output stream operator.
+    ///
+    /// @code{.cpp}
+    ///     std::cout << frameRegistry;
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream.
+    /// @param [in] aFrameRegistry A frame registry.
+    /// @return A reference to the output stream.
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const FrameRegistry& aFrameRegistry);
+
+    /// @brief Check if a live frame is registered under a name.
+    ///
+    /// @code{.cpp}
+    ///     bool hasFrame = frameRegistry.hasFrameWithName("Satellite [1]");
+    /// @endcode
+    ///
+    /// @param [in] aFrameName A frame name.
+    /// @return True if a live frame is registered under the name.
+    bool hasFrameWithName(const String& aFrameName) const;
+
+    /// @brief Get the number of live registered frames.
+    ///
+    /// @code{.cpp}
+    ///     Size size = frameRegistry.getSize();
+    /// @endcode
+    ///
+    /// @return The number of live frames.
+    Size getSize() const;
+
+    /// @brief Access the frame registered under a name.
+    ///
+    /// @code{.cpp}
+    ///     const Shared<const Frame> frameSPtr = frameRegistry.accessFrameWithName("Satellite [1]");
+    /// @endcode
+    ///
+    /// @param [in] aFrameName A frame name.
+    /// @return A shared pointer to the frame.
+    Shared<const Frame> accessFrameWithName(const String& aFrameName) const;
+
+    /// @brief Construct a frame and register it, replacing any frame registered under its name.
+    ///
+    /// @code{.cpp}
+    ///     const Shared<const Frame> frameSPtr = frameRegistry.constructFrame(name, false, parent, provider);
+    /// @endcode
+    ///
+    /// @param [in] aFrameName A frame name.
+    /// @param [in] isQuasiInertial True if the frame is quasi-inertial.
+    /// @param [in] aParentFrameSPtr A shared pointer to the parent frame.
+    /// @param [in] aProviderSPtr A shared pointer to the provider of transforms from the parent frame.
+    /// @return A shared pointer to the frame.
+    Shared<const Frame> constructFrame(
+        const String& aFrameName,
+        const bool isQuasiInertial,
+        const Shared<const Frame>& aParentFrameSPtr,
+        const Shared<const Provider>& aProviderSPtr
+    );
+
+    /// @brief Remove the frame registered under a name, if any.
+    /// @details The frame itself lives on with its owners.
+    ///
+    /// @code{.cpp}
+    ///     frameRegistry.removeFrameWithName("Component [1]");
+    /// @endcode
+    ///
+    /// @param [in] aFrameName A frame name.
+    void removeFrameWithName(const String& aFrameName);
+
+    /// @brief Remove all frames.
+    ///
+    /// @code{.cpp}
+    ///     frameRegistry.clear();
+    /// @endcode
+    void clear();
+
+    /// @brief Print the frame registry to an output stream.
+    ///
+    /// @code{.cpp}
+    ///     frameRegistry.print(std::cout, true);
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream.
+    /// @param [in] displayDecorators If true, display decorators.
+    void print(std::ostream& anOutputStream, bool displayDecorators = true) const;
+
+    /// @brief Construct a frame outside of any registry.
+    /// @details Unlike Frame::Construct, the frame is not registered globally: it cannot be found by name, and
+    ///          frames of the same name may coexist.
+    ///
+    /// @code{.cpp}
+    ///     const Shared<const Frame> frameSPtr = FrameRegistry::ConstructFrame(name, false, parent, provider);
+    /// @endcode
+    ///
+    /// @param [in] aFrameName A frame name.
+    /// @param [in] isQuasiInertial True if the frame is quasi-inertial.
+    /// @param [in] aParentFrameSPtr A shared pointer to the parent frame.
+    /// @param [in] aProviderSPtr A shared pointer to the provider of transforms from the parent frame.
+    /// @return A shared pointer to the frame.
+    static Shared<const Frame> ConstructFrame(
+        const String& aFrameName,
+        const bool isQuasiInertial,
+        const Shared<const Frame>& aParentFrameSPtr,
+        const Shared<const Provider>& aProviderSPtr
+    );
+
+   private:
+    Map<String, Weak<const Frame>> frameMap_;
+    Size pruneSize_;
+    mutable std::mutex mutex_;
+};
+
+}  // namespace simulator
+}  // namespace simulation
+}  // namespace ostk
+
+#endif
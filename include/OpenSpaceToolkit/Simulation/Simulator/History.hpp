@@ -0,0 +1,246 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Simulation_Simulator_History__
+#define __OpenSpaceToolkit_Simulation_Simulator_History__
+
+#include <OpenSpaceToolkit/Simulation/Component/State.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator/StateTable.hpp>
+#include <OpenSpaceToolkit/Simulation/Utility/CopyOnWrite.hpp>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace simulator
+{
+
+using ostk::core::container::Array;
+using ostk::core::container::Map;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+using ostk::physics::time::Instant;
+
+using ostk::simulation::component::State;
+using ostk::simulation::utility::CopyOnWrite;
+
+using TrajectoryState = ostk::astrodynamics::trajectory::State;
+
+/// @brief A bounded history of simulation states, by instant.
+/// @details Each entry holds the satellite states at an instant, packed in a state table (in GCRF), and the
+///          component states. Component state maps are shared with the simulator and between entries until
+///          modified, so that entries recorded while component states are unchanged cost no copy.
+///
+///          The history is bounded by a memory budget: once reached, recording an instant evicts the oldest
+///          entries first. Entry sizes are estimated conservatively (see EstimateEntrySize). A zero budget
+///          disables the history.
+///
+///          Entries are indexed by instant, and by recording order for eviction: lookups, recording and eviction
+///          take logarithmic time in the number of entries.
+///
+/// @code{.cpp}
+///     History history(1024 * 1024);
+///     history.record(instant, satelliteStateMap, componentStateMap);
+///     const Map<String, TrajectoryState> satelliteStates = history.getSatelliteStatesAt(instant);
+/// @endcode
+class History
+{
+   public:
+    /// @brief Constructor.
+    ///
+    /// @code{.cpp}
+    ///     History history(1024 * 1024);
+    /// @endcode
+    ///
+    /// @param [in] aMemoryBudget A memory budget [bytes], zero to disable the history.
+    History(const Size& aMemoryBudget);
+
+    /// @brief Output stream operator.
+    ///
+    /// @code{.cpp}
+    ///     std::cout << history;
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream.
+    /// @param [in] aHistory A history.
+    /// @return A reference to the output stream.
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const History& aHistory);
+
+    /// @brief Check if the history is enabled.
+    ///
+    /// @code{.cpp}
+    ///     bool enabled = history.isEnabled();
+    /// @endcode
+    ///
+    /// @return True if the memory budget is not zero.
+    bool isEnabled() const;
+
+    /// @brief Check if the history is empty.
+    ///
+    /// @code{.cpp}
+    ///     bool empty = history.isEmpty();
+    /// @endcode
+    ///
+    /// @return True if the history holds no entry.
+    bool isEmpty() const;
+
+    /// @brief Check if the history holds an entry at an instant.
+    ///
+    /// @code{.cpp}
+    ///     bool recorded = history.hasInstant(instant);
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant.
+    /// @return True if the history holds an entry at the instant.
+    bool hasInstant(const Instant& anInstant) const;
+
+    /// @brief Get the number of entries.
+    ///
+    /// @code{.cpp}
+    ///     Size size = history.getSize();
+    /// @endcode
+    ///
+    /// @return The number of entries.
+    Size getSize() const;
+
+    /// @brief Get the memory budget.
+    ///
+    /// @code{.cpp}
+    ///     Size memoryBudget = history.getMemoryBudget();
+    /// @endcode
+    ///
+    /// @return The memory budget [bytes].
+    Size getMemoryBudget() const;
+
+    /// @brief Get the estimated memory usage of the entries.
+    ///
+    /// @code{.cpp}
+    ///     Size memoryUsage = history.getMemoryUsage();
+    /// @endcode
+    ///
+    /// @return The estimated memory usage [bytes], not exceeding the memory budget.
+    Size getMemoryUsage() const;
+
+    /// @brief Get the recorded instants, from oldest to most recently recorded.
+    ///
+    /// @code{.cpp}
+    ///     Array<Instant> instants = history.getInstants();
+    /// @endcode
+    ///
+    /// @return An array of instants.
+    Array<Instant> getInstants() const;
+
+    /// @brief Get the satellite states recorded at an instant.
+    ///
+    /// @code{.cpp}
+    ///     Map<String, TrajectoryState> satelliteStates = history.getSatelliteStatesAt(instant);
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant.
+    /// @return The satellite states (in GCRF), by satellite name.
+    Map<String, TrajectoryState> getSatelliteStatesAt(const Instant& anInstant) const;
+
+    /// @brief Access the component states recorded at an instant.
+    ///
+    /// @code{.cpp}
+    ///     const CopyOnWrite<Map<String, State>>& componentStates = history.accessComponentStatesAt(instant);
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant.
+    /// @return A reference to the component states, by component identifier.
+    const CopyOnWrite<Map<String, State>>& accessComponentStatesAt(const Instant& anInstant) const;
+
+    /// @brief Print the history to an output stream.
+    ///
+    /// @code{.cpp}
+    ///     history.print(std::cout, true);
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream.
+    /// @param [in] displayDecorators If true, display decorators.
+    void print(std::ostream& anOutputStream, bool displayDecorators = true) const;
+
+    /// @brief Set the memory budget, evicting the oldest entries beyond it.
+    ///
+    /// @code{.cpp}
+    ///     history.setMemoryBudget(1024 * 1024);
+    /// @endcode
+    ///
+    /// @param [in] aMemoryBudget A memory budget [bytes], zero to disable the history.
+    void setMemoryBudget(const Size& aMemoryBudget);
+
+    /// @brief Record the states at an instant.
+    /// @details An entry already recorded at the instant is replaced. Satellite states that are undefined or not at
+    ///          the instant are not recorded. Nothing is recorded if the entry alone exceeds the memory budget.
+    ///
+    /// @code{.cpp}
+    ///     history.record(instant, satelliteStateMap, componentStateMap);
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant.
+    /// @param [in] aSatelliteStateMap Satellite states, by satellite name.
+    /// @param [in] aComponentStateMap Component states, by component identifier.
+    void record(
+        const Instant& anInstant,
+        const Map<String, TrajectoryState>& aSatelliteStateMap,
+        const CopyOnWrite<Map<String, State>>& aComponentStateMap
+    );
+
+    /// @brief Remove all entries.
+    ///
+    /// @code{.cpp}
+    ///     history.clear();
+    /// @endcode
+    void clear();
+
+    /// @brief Estimate the memory size of an entry.
+    ///
+    /// @code{.cpp}
+    ///     Size entrySize = History::EstimateEntrySize(satelliteCount, componentCount);
+    /// @endcode
+    ///
+    /// @param [in] aSatelliteCount A number of satellites.
+    /// @param [in] aComponentCount A number of components.
+    /// @return The estimated entry size [bytes].
+    static Size EstimateEntrySize(const Size& aSatelliteCount, const Size& aComponentCount);
+
+   private:
+    struct Entry
+    {
+        Instant instant;
+        Array<String> satelliteNames;
+        StateTable stateTable;
+        CopyOnWrite<Map<String, State>> componentStateMap;
+        Size size;
+        Index order;
+    };
+
+    Size memoryBudget_;
+    Size memoryUsage_;
+    Map<Instant, Shared<const Entry>> entryMap_;
+    Map<Index, Instant> orderMap_;
+    Index nextOrder_;
+
+    const Entry& accessEntryAt(const Instant& anInstant) const;
+
+    void evict(const Size& aMemoryBudget);
+};
+
+}  // namespace simulator
+}  // namespace simulation
+}  // namespace ostk
+
+#endif
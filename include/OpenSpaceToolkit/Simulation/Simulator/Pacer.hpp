@@ -0,0 +1,221 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Simulation_Simulator_Pacer__
+#define __OpenSpaceToolkit_Simulation_Simulator_Pacer__
+
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace simulator
+{
+
+using ostk::core::type::Index;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+
+/// @brief Wall-clock pacing of a simulation run.
+/// @details A paced run advances the simulation in frames of fixed wall-clock period: each frame advances the
+///          simulation by the frame period scaled by the time ratio (1 for real time, 10 for ten times faster than
+///          real time), then waits for the frame deadline. A frame overruns when its computation ends after its
+///          deadline, and the catch-up policy decides how the following frames recover.
+///
+///          An unpaced run (as fast as possible) advances the simulation by a fixed step per frame, without waiting.
+///
+/// @code{.cpp}
+///     const Pacer pacer(10.0, Duration::Milliseconds(100.0), Pacer::CatchUpPolicy::Skip);
+///     const Pacer::Report report = simulator.runPaced(endInstant, pacer);
+/// @endcode
+class Pacer
+{
+   public:
+    /// @brief Recovery policy after an overrun.
+    enum class CatchUpPolicy
+    {
+        Skip,    ///< Restart the frame schedule from the overrun: the simulation falls behind the wall clock.
+        Burst,   ///< Keep the frame schedule: late frames run back to back, without waiting, until back on time.
+        Stretch  ///< Restart the frame schedule, and lengthen the next step by the lag: frames stay in real time.
+    };
+
+    /// @brief Timing of a frame.
+    struct Frame
+    {
+        Index index;               ///< The frame index.
+        Instant instant;           ///< The simulation instant at the end of the frame.
+        Duration computeDuration;  ///< The wall-clock computation duration.
+        Duration lag;              ///< The wall-clock delay past the frame deadline (zero if on time).
+        bool isOverrun;            ///< True if the frame ended past its deadline.
+    };
+
+    /// @brief Timing statistics of a paced run.
+    struct Report
+    {
+        Size frameCount;                  ///< The number of frames.
+        Size overrunCount;                ///< The number of overrun frames.
+        Duration meanComputeDuration;     ///< The mean wall-clock computation duration per frame.
+        Duration maximumComputeDuration;  ///< The maximum wall-clock computation duration of a frame.
+        Duration maximumLag;              ///< The maximum delay past a frame deadline.
+        Duration wallClockDuration;       ///< The wall-clock duration of the run.
+        Real achievedTimeRatio;           ///< The simulated duration over the wall-clock duration.
+    };
+
+    /// @brief Construct a paced pacer.
+    ///
+    /// @code{.cpp}
+    ///     Pacer pacer(1.0, Duration::Milliseconds(100.0)); // Real time, at 10 frames per second
+    /// @endcode
+    ///
+    /// @param [in] aTimeRatio A ratio of simulated time to wall-clock time, strictly positive.
+    /// @param [in] aFramePeriod A wall-clock frame period, strictly positive.
+    /// @param [in] aCatchUpPolicy A catch-up policy.
+    Pacer(
+        const Real& aTimeRatio,
+        const Duration& aFramePeriod,
+        const CatchUpPolicy& aCatchUpPolicy = CatchUpPolicy::Skip
+    );
+
+    /// @brief Output stream operator.
+    ///
+    /// @code{.cpp}
+    ///     std::cout << pacer;
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream.
+    /// @param [in] aPacer A pacer.
+    /// @return A reference to the output stream.
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const Pacer& aPacer);
+
+    /// @brief Check if the pacer is defined.
+    ///
+    /// @code{.cpp}
+    ///     bool defined = pacer.isDefined();
+    /// @endcode
+    ///
+    /// @return True if the pacer is defined.
+    bool isDefined() const;
+
+    /// @brief Check if the pacer follows the wall clock.
+    ///
+    /// @code{.cpp}
+    ///     bool paced = pacer.isPaced();
+    /// @endcode
+    ///
+    /// @return True if the pacer follows the wall clock, false if it runs as fast as possible.
+    bool isPaced() const;
+
+    /// @brief Get the time ratio.
+    ///
+    /// @code{.cpp}
+    ///     Real timeRatio = pacer.getTimeRatio();
+    /// @endcode
+    ///
+    /// @return The time ratio (undefined if not paced).
+    Real getTimeRatio() const;
+
+    /// @brief Get the wall-clock frame period.
+    ///
+    /// @code{.cpp}
+    ///     Duration framePeriod = pacer.getFramePeriod();
+    /// @endcode
+    ///
+    /// @return The frame period (zero if not paced).
+    Duration getFramePeriod() const;
+
+    /// @brief Get the simulation step of a frame.
+    ///
+    /// @code{.cpp}
+    ///     Duration step = pacer.getStep();
+    /// @endcode
+    ///
+    /// @return The simulation step.
+    Duration getStep() const;
+
+    /// @brief Get the catch-up policy.
+    ///
+    /// @code{.cpp}
+    ///     Pacer::CatchUpPolicy catchUpPolicy = pacer.getCatchUpPolicy();
+    /// @endcode
+    ///
+    /// @return The catch-up policy.
+    CatchUpPolicy getCatchUpPolicy() const;
+
+    /// @brief Print the pacer to an output stream.
+    ///
+    /// @code{.cpp}
+    ///     pacer.print(std::cout, true);
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream.
+    /// @param [in] displayDecorators If true, display decorators.
+    void print(std::ostream& anOutputStream, bool displayDecorators = true) const;
+
+    /// @brief Construct an undefined pacer.
+    ///
+    /// @code{.cpp}
+    ///     Pacer pacer = Pacer::Undefined();
+    /// @endcode
+    ///
+    /// @return An undefined pacer.
+    static Pacer Undefined();
+
+    /// @brief Construct a real-time pacer.
+    ///
+    /// @code{.cpp}
+    ///     Pacer pacer = Pacer::RealTime(Duration::Milliseconds(100.0));
+    /// @endcode
+    ///
+    /// @param [in] aFramePeriod A wall-clock frame period, strictly positive.
+    /// @return A real-time pacer.
+    static Pacer RealTime(const Duration& aFramePeriod);
+
+    /// @brief Construct a pacer running as fast as possible.
+    ///
+    /// @code{.cpp}
+    ///     Pacer pacer = Pacer::AsFastAsPossible(Duration::Seconds(10.0));
+    /// @endcode
+    ///
+    /// @param [in] aStep A simulation step per frame, strictly positive.
+    /// @return An unpaced pacer.
+    static Pacer AsFastAsPossible(const Duration& aStep);
+
+    /// @brief Convert a catch-up policy to a string.
+    ///
+    /// @code{.cpp}
+    ///     String policyString = Pacer::StringFromCatchUpPolicy(Pacer::CatchUpPolicy::Skip); // "Skip"
+    /// @endcode
+    ///
+    /// @param [in] aCatchUpPolicy A catch-up policy.
+    /// @return The string representation.
+    static String StringFromCatchUpPolicy(const CatchUpPolicy& aCatchUpPolicy);
+
+   private:
+    Real timeRatio_;
+    Duration framePeriod_;
+    Duration step_;
+    CatchUpPolicy catchUpPolicy_;
+
+    Pacer(
+        const Real& aTimeRatio,
+        const Duration& aFramePeriod,
+        const Duration& aStep,
+        const CatchUpPolicy& aCatchUpPolicy
+    );
+};
+
+}  // namespace simulator
+}  // namespace simulation
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,223 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Simulation_Simulator_Partition__
+#define __OpenSpaceToolkit_Simulation_Simulator_Partition__
+
+#if defined(__linux__)
+
+#include <mutex>
+#include <vector>
+
+#include <sys/types.h>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+
+class Satellite;
+
+namespace simulator
+{
+
+using ostk::core::container::Array;
+using ostk::core::container::Map;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+using ostk::physics::time::Instant;
+
+using TrajectoryState = ostk::astrodynamics::trajectory::State;
+
+/// @brief A partition of satellites over local worker processes.
+/// @details The partition forks worker processes, each owning a contiguous slice of the satellites. Workers
+///          inherit the satellites from the coordinating process (copy-on-write), so that nothing is serialized.
+///          Each worker is handed its own slice only, and never touches the other satellites, whose pages thus
+///          stay shared with the coordinator: per-evaluation memory is spread over the processes.
+///
+///          Coordinator and workers communicate through an anonymous shared memory mapping: the coordinator
+///          publishes the instant and wakes the workers through process-shared semaphores, workers write the
+///          states of their satellites (in GCRF) in place, and the coordinator reads them directly from the
+///          mapping (see View). No external service, file or socket is involved.
+///
+///          A forked process only runs the forking thread, and would deadlock on any lock held by another thread
+///          at the time of the fork. Workers are therefore forked before any thread pool starts: construction
+///          throws while thread pool workers are running (see ThreadPool::GetWorkerCount). Worker processes exit
+///          when the partition is destroyed. A worker exiting unexpectedly makes every subsequent evaluation throw.
+///
+///          Only available on Linux.
+///
+/// @code{.cpp}
+///     Partition partition(satellites, 8);
+///     const Partition::View view = partition.getStatesAt(instant);
+///     const TrajectoryState state = view.getSatelliteStateWithName("LoftSat-1");
+/// @endcode
+class Partition
+{
+   public:
+    /// @brief Satellite states evaluated by the workers, read in place from the shared memory mapping.
+    /// @details A view references its partition, and is cheap to copy. States are decoded on demand from the
+    ///          worker records, which are only valid until the partition is evaluated again: the view is then
+    ///          stale, and provides no state. A view must not outlive its partition.
+    class View
+    {
+       public:
+        /// @brief Get the instant the states were evaluated at.
+        ///
+        /// @code{.cpp}
+        ///     Instant instant = view.getInstant();
+        /// @endcode
+        ///
+        /// @return The instant.
+        Instant getInstant() const;
+
+        /// @brief Check if the view is current, i.e. its partition has not been evaluated again since.
+        ///
+        /// @code{.cpp}
+        ///     bool isCurrent = view.isCurrent();
+        /// @endcode
+        ///
+        /// @return True if the view is current.
+        bool isCurrent() const;
+
+        /// @brief Get the state of a satellite, decoded from its record.
+        ///
+        /// @code{.cpp}
+        ///     TrajectoryState state = view.getSatelliteStateWithName("LoftSat-1");
+        /// @endcode
+        ///
+        /// @param [in] aSatelliteName A satellite name.
+        /// @return The satellite state (in GCRF), undefined if its evaluation failed or the view is stale.
+        TrajectoryState getSatelliteStateWithName(const String& aSatelliteName) const;
+
+        /// @brief Get the states of all satellites, decoded from their records.
+        /// @details Satellites whose evaluation failed are left out of the map.
+        ///
+        /// @code{.cpp}
+        ///     const Map<String, TrajectoryState> states = view.getSatelliteStates();
+        /// @endcode
+        ///
+        /// @return The satellite states (in GCRF), by satellite name. Empty if the view is stale.
+        Map<String, TrajectoryState> getSatelliteStates() const;
+
+       private:
+        friend class Partition;
+
+        const Partition* partitionPtr_;
+        Instant instant_;
+        Index evaluationIndex_;
+
+        View(const Partition& aPartition, const Instant& anInstant, const Index& anEvaluationIndex);
+    };
+
+    /// @brief Constructor, forking the worker processes.
+    ///
+    /// @code{.cpp}
+    ///     Partition partition(satellites, 8);
+    /// @endcode
+    ///
+    /// @param [in] aSatelliteArray An array of satellites.
+    /// @param [in] aProcessCount A worker process count, strictly positive.
+    Partition(const Array<Shared<const Satellite>>& aSatelliteArray, const Size& aProcessCount);
+
+    Partition(const Partition& aPartition) = delete;
+
+    Partition& operator=(const Partition& aPartition) = delete;
+
+    /// @brief Destructor, stopping and reaping the worker processes.
+    ~Partition();
+
+    /// @brief Output stream operator.
+    ///
+    /// @code{.cpp}
+    ///     std::cout << partition;
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream.
+    /// @param [in] aPartition A partition.
+    /// @return A reference to the output stream.
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const Partition& aPartition);
+
+    /// @brief Get the worker process count.
+    ///
+    /// @code{.cpp}
+    ///     Size processCount = partition.getProcessCount();
+    /// @endcode
+    ///
+    /// @return The worker process count.
+    Size getProcessCount() const;
+
+    /// @brief Get the satellite count.
+    ///
+    /// @code{.cpp}
+    ///     Size satelliteCount = partition.getSatelliteCount();
+    /// @endcode
+    ///
+    /// @return The satellite count.
+    Size getSatelliteCount() const;
+
+    /// @brief Evaluate the states of all satellites at an instant, across the worker processes.
+    /// @details Blocks until all workers are done. States are not copied: the returned view reads them from the
+    ///          worker records, until the next evaluation. Concurrent calls are serialized.
+    ///
+    /// @code{.cpp}
+    ///     const Partition::View view = partition.getStatesAt(instant);
+    /// @endcode
+    ///
+    /// @param [in] anInstant An instant.
+    /// @return A view of the satellite states.
+    View getStatesAt(const Instant& anInstant);
+
+    /// @brief Print the partition to an output stream.
+    ///
+    /// @code{.cpp}
+    ///     partition.print(std::cout, true);
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream.
+    /// @param [in] displayDecorators If true, display decorators.
+    void print(std::ostream& anOutputStream, bool displayDecorators = true) const;
+
+   private:
+    Array<Shared<const Satellite>> satellites_;
+    Map<String, Index> satelliteIndexMap_;
+    Size processCount_;
+
+    void* memoryPtr_;
+    Size memorySize_;
+
+    std::vector<pid_t> workerPids_;
+    bool hasFailed_;
+    Index evaluationIndex_;
+
+    mutable std::mutex mutex_;
+
+    TrajectoryState decodeStateRecord(const Index& aSatelliteIndex, const Instant& anInstant) const;
+
+    void post(const int& aCommand);
+
+    void waitForWorkers();
+
+    void stop();
+};
+
+}  // namespace simulator
+}  // namespace simulation
+}  // namespace ostk
+
+#endif
+
+#endif
@@ -0,0 +1,298 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Simulation_Simulator_StateCache__
+#define __OpenSpaceToolkit_Simulation_Simulator_StateCache__
+
+#include <functional>
+#include <mutex>
+#include <utility>
+
+#include <OpenSpaceToolkit/Simulation/Component/Geometry.hpp>
+
+#include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+#include <OpenSpaceToolkit/Core/Type/Weak.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Celestial.hpp>
+#include <OpenSpaceToolkit/Physics/Environment/Object/Geometry.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace simulator
+{
+
+using ostk::core::container::Map;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+using ostk::core::type::Weak;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::environment::object::Celestial;
+using ObjectGeometry = ostk::physics::environment::object::Geometry;
+
+using ostk::simulation::component::Geometry;
+
+using TrajectoryState = ostk::astrodynamics::trajectory::State;
+
+/// @brief A cache of values evaluated lazily at the current simulation instant.
+/// @details The cache holds satellite states, GCRF geometries of components and celestial objects, and frame
+///          transforms to GCRF. Each entry is stamped with the generation it was evaluated at: changing the
+///          simulation instant starts a new generation (see invalidate), which marks every entry dirty at once
+///          without touching them. A dirty entry is evaluated again when a query first touches it, then reused
+///          by all queries until the next generation. The cache is thus sized by what is queried at one instant.
+///
+///          Lookups are counted as hits (clean entry) or misses (evaluation), across all entry kinds. Failed
+///          evaluations are not cached, so that the error surfaces to every caller. Concurrent queries are safe:
+///          two callers missing the same entry may both evaluate it.
+///
+/// @code{.cpp}
+///     StateCache stateCache;
+///     const TrajectoryState state = stateCache.getSatelliteState("sat-1", [&]() { return evaluate(); });
+///     stateCache.invalidate();
+/// @endcode
+class StateCache
+{
+   public:
+    /// @brief Constructor.
+    ///
+    /// @code{.cpp}
+    ///     StateCache stateCache;
+    /// @endcode
+    StateCache();
+
+    /// @brief Copy constructor.
+    ///
+    /// @code{.cpp}
+    ///     StateCache copy(stateCache);
+    /// @endcode
+    ///
+    /// @param [in] aStateCache A state cache.
+    StateCache(const StateCache& aStateCache);
+
+    /// @brief Copy assignment operator.
+    ///
+    /// @code{.cpp}
+    ///     stateCache = otherStateCache;
+    /// @endcode
+    ///
+    /// @param [in] aStateCache A state cache.
+    /// @return A reference to this state cache.
+    StateCache& operator=(const StateCache& aStateCache);
+
+    /// @brief Output stream operator.
+    ///
+    /// @code{.cpp}
+    ///     std::cout << stateCache;
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream.
+    /// @param [in] aStateCache A state cache.
+    /// @return A reference to the output stream.
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const StateCache& aStateCache);
+
+    /// @brief Check if the state of a satellite is dirty, i.e. not evaluated in the current generation.
+    ///
+    /// @code{.cpp}
+    ///     bool isDirty = stateCache.isSatelliteDirty("sat-1");
+    /// @endcode
+    ///
+    /// @param [in] aSatelliteName A satellite name.
+    /// @return True if the satellite state is dirty.
+    bool isSatelliteDirty(const String& aSatelliteName) const;
+
+    /// @brief Check if the GCRF geometry of a component geometry is dirty.
+    ///
+    /// @code{.cpp}
+    ///     bool isDirty = stateCache.isGeometryDirty(camera.accessGeometryWithName("FOV"));
+    /// @endcode
+    ///
+    /// @param [in] aGeometry A component geometry.
+    /// @return True if the GCRF geometry is dirty.
+    bool isGeometryDirty(const Geometry& aGeometry) const;
+
+    /// @brief Check if the transform from a frame to GCRF is dirty.
+    ///
+    /// @code{.cpp}
+    ///     bool isDirty = stateCache.isTransformDirty(satellite.accessFrame());
+    /// @endcode
+    ///
+    /// @param [in] aFrameSPtr A shared pointer to a frame.
+    /// @return True if the transform is dirty.
+    bool isTransformDirty(const Shared<const Frame>& aFrameSPtr) const;
+
+    /// @brief Get the current generation.
+    ///
+    /// @code{.cpp}
+    ///     Index generation = stateCache.getGeneration();
+    /// @endcode
+    ///
+    /// @return The current generation.
+    Index getGeneration() const;
+
+    /// @brief Get the number of entries evaluated in the current generation.
+    ///
+    /// @code{.cpp}
+    ///     Size size = stateCache.getSize();
+    /// @endcode
+    ///
+    /// @return The number of clean entries, satellite states and geometries.
+    Size getSize() const;
+
+    /// @brief Get the number of lookups answered from a clean entry, since the last counter reset.
+    ///
+    /// @code{.cpp}
+    ///     Size hitCount = stateCache.getHitCount();
+    /// @endcode
+    ///
+    /// @return The hit count.
+    Size getHitCount() const;
+
+    /// @brief Get the number of lookups that required an evaluation, since the last counter reset.
+    ///
+    /// @code{.cpp}
+    ///     Size missCount = stateCache.getMissCount();
+    /// @endcode
+    ///
+    /// @return The miss count.
+    Size getMissCount() const;
+
+    /// @brief Get the state of a satellite, evaluating it if dirty.
+    ///
+    /// @code{.cpp}
+    ///     const TrajectoryState state = stateCache.getSatelliteState("sat-1", [&]() { return evaluate(); });
+    /// @endcode
+    ///
+    /// @param [in] aSatelliteName A satellite name.
+    /// @param [in] anEvaluator An evaluator of the satellite state, called if the entry is dirty.
+    /// @return The satellite state.
+    TrajectoryState getSatelliteState(
+        const String& aSatelliteName, const std::function<TrajectoryState()>& anEvaluator
+    );
+
+    /// @brief Get the GCRF geometry of a component geometry, evaluating it if dirty.
+    /// @details Entries are keyed by component address and geometry name, so that copies of a geometry share
+    ///          their entry. The cache must be cleared when components are destroyed.
+    ///
+    /// @code{.cpp}
+    ///     const ObjectGeometry geometry = stateCache.getGeometry(fov, [&]() { return evaluate(); });
+    /// @endcode
+    ///
+    /// @param [in] aGeometry A component geometry.
+    /// @param [in] anEvaluator An evaluator of the GCRF geometry, called if the entry is dirty.
+    /// @return The GCRF geometry.
+    ObjectGeometry getGeometry(const Geometry& aGeometry, const std::function<ObjectGeometry()>& anEvaluator);
+
+    /// @brief Get the GCRF geometry of a celestial object, evaluating it if dirty.
+    /// @details Entries are keyed by celestial object identity, so that distinct objects sharing a name do not
+    ///          share their entry. An entry keeps track of its object, and is dirty for any other object later
+    ///          allocated at the same address.
+    ///
+    /// @code{.cpp}
+    ///     const ObjectGeometry geometry = stateCache.getCelestialGeometry(earthSPtr, [&]() { return evaluate(); });
+    /// @endcode
+    ///
+    /// @param [in] aCelestialObjectSPtr A shared pointer to a celestial object.
+    /// @param [in] anEvaluator An evaluator of the GCRF geometry, called if the entry is dirty.
+    /// @return The GCRF geometry.
+    ObjectGeometry getCelestialGeometry(
+        const Shared<const Celestial>& aCelestialObjectSPtr, const std::function<ObjectGeometry()>& anEvaluator
+    );
+
+    /// @brief Get the transform from a frame to GCRF, evaluating it if dirty.
+    /// @details Entries are keyed by frame address, so that lookups do not compare frame names. An entry keeps
+    ///          track of its frame, and is dirty for any other frame later allocated at the same address.
+    ///
+    /// @code{.cpp}
+    ///     const Transform transform = stateCache.getTransform(frameSPtr, [&]() { return evaluate(); });
+    /// @endcode
+    ///
+    /// @param [in] aFrameSPtr A shared pointer to a frame.
+    /// @param [in] anEvaluator An evaluator of the transform, called if the entry is dirty.
+    /// @return The transform to GCRF.
+    Transform getTransform(const Shared<const Frame>& aFrameSPtr, const std::function<Transform()>& anEvaluator);
+
+    /// @brief Print the state cache to an output stream.
+    ///
+    /// @code{.cpp}
+    ///     stateCache.print(std::cout, true);
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream.
+    /// @param [in] displayDecorators If true, display decorators.
+    void print(std::ostream& anOutputStream, bool displayDecorators = true) const;
+
+    /// @brief Start a new generation, marking every entry dirty.
+    /// @details Constant time: entries are kept, and overwritten when evaluated again.
+    ///
+    /// @code{.cpp}
+    ///     stateCache.invalidate();
+    /// @endcode
+    void invalidate();
+
+    /// @brief Remove all entries, and start a new generation.
+    ///
+    /// @code{.cpp}
+    ///     stateCache.clear();
+    /// @endcode
+    void clear();
+
+    /// @brief Reset the hit and miss counters.
+    ///
+    /// @code{.cpp}
+    ///     stateCache.resetCounters();
+    /// @endcode
+    void resetCounters();
+
+   private:
+    template <typename Value>
+    struct Entry
+    {
+        Index generation;
+        Value value;
+        Weak<const void> ownerWPtr;
+    };
+
+    Index generation_;
+    Map<String, Entry<TrajectoryState>> satelliteEntries_;
+    Map<std::pair<const Component*, String>, Entry<ObjectGeometry>> geometryEntries_;
+    Map<const Celestial*, Entry<ObjectGeometry>> celestialGeometryEntries_;
+    Map<const Frame*, Entry<Transform>> transformEntries_;
+    Size hitCount_;
+    Size missCount_;
+
+    mutable std::mutex mutex_;
+
+    template <typename Value>
+    bool isClean(const Entry<Value>& anEntry, const Shared<const void>& anOwnerSPtr) const;
+
+    template <typename Key, typename Value>
+    bool isDirty(
+        const Map<Key, Entry<Value>>& anEntryMap, const Key& aKey, const Shared<const void>& anOwnerSPtr = nullptr
+    ) const;
+
+    template <typename Key, typename Value>
+    Value get(
+        Map<Key, Entry<Value>>& anEntryMap,
+        const Key& aKey,
+        const std::function<Value()>& anEvaluator,
+        const Shared<const void>& anOwnerSPtr = nullptr
+    );
+};
+
+}  // namespace simulator
+}  // namespace simulation
+}  // namespace ostk
+
+#endif
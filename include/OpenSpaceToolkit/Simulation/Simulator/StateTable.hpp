@@ -0,0 +1,199 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Simulation_Simulator_StateTable__
+#define __OpenSpaceToolkit_Simulation_Simulator_StateTable__
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace simulator
+{
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::MatrixXd;
+
+using ostk::physics::time::Instant;
+
+using TrajectoryState = ostk::astrodynamics::trajectory::State;
+
+/// @brief A contiguous table of satellite states sampled over a time grid.
+/// @details States are expressed in GCRF and stored column-wise: column i of every matrix
+///          corresponds to the i-th instant. Positions are in meters, velocities in meters per second,
+///          attitudes are quaternions in XYZS format and angular velocities are in radians per second.
+///
+/// @code{.cpp}
+///     const StateTable stateTable = StateTable::FromStates(stateArray);
+///     const MatrixXd& positions = stateTable.accessPositions(); // 3 x N
+/// @endcode
+class StateTable
+{
+   public:
+    /// @brief Construct a state table.
+    ///
+    /// @code{.cpp}
+    ///     StateTable stateTable(instants, positions, velocities, attitudes, angularVelocities);
+    /// @endcode
+    ///
+    /// @param [in] anInstantArray An array of instants.
+    /// @param [in] aPositionMatrix A 3 x N matrix of positions [m].
+    /// @param [in] aVelocityMatrix A 3 x N matrix of velocities [m/s].
+    /// @param [in] anAttitudeMatrix A 4 x N matrix of attitude quaternions (XYZS).
+    /// @param [in] anAngularVelocityMatrix A 3 x N matrix of angular velocities [rad/s].
+    StateTable(
+        const Array<Instant>& anInstantArray,
+        const MatrixXd& aPositionMatrix,
+        const MatrixXd& aVelocityMatrix,
+        const MatrixXd& anAttitudeMatrix,
+        const MatrixXd& anAngularVelocityMatrix
+    );
+
+    /// @brief Output stream operator.
+    ///
+    /// @code{.cpp}
+    ///     std::cout << stateTable;
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream.
+    /// @param [in] aStateTable A state table.
+    /// @return A reference to the output stream.
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const StateTable& aStateTable);
+
+    /// @brief Check if the state table is defined.
+    ///
+    /// @code{.cpp}
+    ///     bool defined = stateTable.isDefined();
+    /// @endcode
+    ///
+    /// @return True if the state table is defined.
+    bool isDefined() const;
+
+    /// @brief Get the number of sampled instants.
+    ///
+    /// @code{.cpp}
+    ///     Size size = stateTable.getSize();
+    /// @endcode
+    ///
+    /// @return The number of sampled instants.
+    Size getSize() const;
+
+    /// @brief Access the sampled instants.
+    ///
+    /// @code{.cpp}
+    ///     const Array<Instant>& instants = stateTable.accessInstants();
+    /// @endcode
+    ///
+    /// @return A reference to the array of instants.
+    const Array<Instant>& accessInstants() const;
+
+    /// @brief Access the positions.
+    ///
+    /// @code{.cpp}
+    ///     const MatrixXd& positions = stateTable.accessPositions();
+    /// @endcode
+    ///
+    /// @return A reference to the 3 x N matrix of positions [m].
+    const MatrixXd& accessPositions() const;
+
+    /// @brief Access the velocities.
+    ///
+    /// @code{.cpp}
+    ///     const MatrixXd& velocities = stateTable.accessVelocities();
+    /// @endcode
+    ///
+    /// @return A reference to the 3 x N matrix of velocities [m/s].
+    const MatrixXd& accessVelocities() const;
+
+    /// @brief Access the attitudes.
+    ///
+    /// @code{.cpp}
+    ///     const MatrixXd& attitudes = stateTable.accessAttitudes();
+    /// @endcode
+    ///
+    /// @return A reference to the 4 x N matrix of attitude quaternions (XYZS).
+    const MatrixXd& accessAttitudes() const;
+
+    /// @brief Access the angular velocities.
+    ///
+    /// @code{.cpp}
+    ///     const MatrixXd& angularVelocities = stateTable.accessAngularVelocities();
+    /// @endcode
+    ///
+    /// @return A reference to the 3 x N matrix of angular velocities [rad/s].
+    const MatrixXd& accessAngularVelocities() const;
+
+    /// @brief Get the state at a given index.
+    ///
+    /// @code{.cpp}
+    ///     TrajectoryState state = stateTable.getStateAt(0);
+    /// @endcode
+    ///
+    /// @param [in] anIndex An index.
+    /// @return The state (in GCRF) at the index.
+    TrajectoryState getStateAt(const Index& anIndex) const;
+
+    /// @brief Print the state table to an output stream.
+    ///
+    /// @code{.cpp}
+    ///     stateTable.print(std::cout, true);
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream.
+    /// @param [in] displayDecorators If true, display decorators.
+    void print(std::ostream& anOutputStream, bool displayDecorators = true) const;
+
+    /// @brief Construct an undefined state table.
+    ///
+    /// @code{.cpp}
+    ///     StateTable stateTable = StateTable::Undefined();
+    /// @endcode
+    ///
+    /// @return An undefined state table.
+    static StateTable Undefined();
+
+    /// @brief Construct a state table from an array of states.
+    ///
+    /// @code{.cpp}
+    ///     StateTable stateTable = StateTable::FromStates(stateArray);
+    /// @endcode
+    ///
+    /// @param [in] aStateArray An array of states.
+    /// @return A state table, with states converted to GCRF.
+    static StateTable FromStates(const Array<TrajectoryState>& aStateArray);
+
+    /// @brief Concatenate state tables, in order.
+    ///
+    /// @code{.cpp}
+    ///     StateTable stateTable = StateTable::Concatenate({firstStateTable, secondStateTable});
+    /// @endcode
+    ///
+    /// @param [in] aStateTableArray An array of state tables. Undefined state tables are skipped.
+    /// @return A state table holding the columns of all state tables, in order.
+    static StateTable Concatenate(const Array<StateTable>& aStateTableArray);
+
+   private:
+    Array<Instant> instants_;
+    MatrixXd positions_;
+    MatrixXd velocities_;
+    MatrixXd attitudes_;
+    MatrixXd angularVelocities_;
+};
+
+}  // namespace simulator
+}  // namespace simulation
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,295 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Simulation_Simulator_TimeRange__
+#define __OpenSpaceToolkit_Simulation_Simulator_TimeRange__
+
+#include <cstddef>
+#include <iterator>
+
+#include <OpenSpaceToolkit/Simulation/Simulator/StateTable.hpp>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory/State.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+
+class Simulator;
+
+namespace simulator
+{
+
+using ostk::core::container::Array;
+using ostk::core::container::Map;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+
+using TrajectoryState = ostk::astrodynamics::trajectory::State;
+
+/// @brief A lazy range of satellite states over a time grid.
+/// @details The range samples a snapshot of a simulator (see Simulator::fork) over the grid of an interval: from its
+///          start by a fixed step, up to and including its end. Nothing is evaluated until the range is iterated.
+///          Iterating evaluates the grid chunk by chunk (see Simulator::evaluate) and yields one view per instant.
+///
+///          With prefetch enabled, the next chunk is evaluated in the background while the current one is consumed,
+///          so that downstream processing overlaps with evaluation. Stopping early discards the remaining chunks,
+///          after at most one prefetched chunk completes. Evaluation errors are thrown when their chunk is reached.
+///
+/// @code{.cpp}
+///     for (const TimeRange::View& view : simulator.range(interval, Duration::Seconds(10.0)))
+///     {
+///         const TrajectoryState state = view.getSatelliteStateWithName("LoftSat-1");
+///     }
+/// @endcode
+class TimeRange
+{
+   private:
+    struct Chunk;
+    class Cursor;
+
+   public:
+    /// @brief Satellite states at an instant of the range.
+    /// @details A view references the chunk it belongs to, and is cheap to copy. States are read on demand from
+    ///          the chunk state tables, which remain available as long as the view is.
+    class View
+    {
+       public:
+        /// @brief Get the instant.
+        ///
+        /// @code{.cpp}
+        ///     Instant instant = view.getInstant();
+        /// @endcode
+        ///
+        /// @return The instant.
+        Instant getInstant() const;
+
+        /// @brief Get the column of the instant in the state tables.
+        ///
+        /// @code{.cpp}
+        ///     Index index = view.getIndex();
+        /// @endcode
+        ///
+        /// @return The column index.
+        Index getIndex() const;
+
+        /// @brief Access the state tables of the chunk, by satellite name.
+        /// @details The states at the view instant are found in column getIndex() of every table.
+        ///
+        /// @code{.cpp}
+        ///     const Map<String, StateTable>& stateTableMap = view.accessStateTableMap();
+        /// @endcode
+        ///
+        /// @return A reference to the state tables.
+        const Map<String, StateTable>& accessStateTableMap() const;
+
+        /// @brief Get the state of a satellite.
+        ///
+        /// @code{.cpp}
+        ///     TrajectoryState state = view.getSatelliteStateWithName("LoftSat-1");
+        /// @endcode
+        ///
+        /// @param [in] aSatelliteName A satellite name.
+        /// @return The satellite state.
+        TrajectoryState getSatelliteStateWithName(const String& aSatelliteName) const;
+
+       private:
+        friend class TimeRange;
+
+        Shared<const Chunk> chunkSPtr_;
+        Index index_;
+
+        View(const Shared<const Chunk>& aChunkSPtr, const Index& anIndex);
+    };
+
+    /// @brief Single-pass iterator over the views of a range.
+    /// @details Copies of an iterator share their position, as for std::istream_iterator.
+    class Iterator
+    {
+       public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef View value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const View* pointer;
+        typedef const View& reference;
+
+        /// @brief Construct an end iterator.
+        Iterator();
+
+        const View& operator*() const;
+
+        const View* operator->() const;
+
+        Iterator& operator++();
+
+        Iterator operator++(int);
+
+        bool operator==(const Iterator& anIterator) const;
+
+        bool operator!=(const Iterator& anIterator) const;
+
+       private:
+        friend class TimeRange;
+
+        Shared<Cursor> cursorSPtr_;
+
+        Iterator(const Shared<Cursor>& aCursorSPtr);
+
+        bool isEnd() const;
+    };
+
+    /// @brief Construct a time range.
+    ///
+    /// @code{.cpp}
+    ///     TimeRange range(simulator, Interval::Closed(startInstant, endInstant), Duration::Seconds(10.0));
+    /// @endcode
+    ///
+    /// @param [in] aSimulator A defined simulator, of which a snapshot is taken.
+    /// @param [in] anInterval An interval.
+    /// @param [in] aStep A step, strictly positive.
+    /// @param [in] aChunkSize A number of instants evaluated at once, strictly positive.
+    /// @param [in] prefetch If true, evaluate the next chunk in the background.
+    TimeRange(
+        const Simulator& aSimulator,
+        const Interval& anInterval,
+        const Duration& aStep,
+        const Size& aChunkSize = 64,
+        const bool& prefetch = true
+    );
+
+    /// @brief Output stream operator.
+    ///
+    /// @code{.cpp}
+    ///     std::cout << range;
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream.
+    /// @param [in] aTimeRange A time range.
+    /// @return A reference to the output stream.
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const TimeRange& aTimeRange);
+
+    /// @brief Get the interval.
+    ///
+    /// @code{.cpp}
+    ///     Interval interval = range.getInterval();
+    /// @endcode
+    ///
+    /// @return The interval.
+    Interval getInterval() const;
+
+    /// @brief Get the step.
+    ///
+    /// @code{.cpp}
+    ///     Duration step = range.getStep();
+    /// @endcode
+    ///
+    /// @return The step.
+    Duration getStep() const;
+
+    /// @brief Get the number of instants.
+    ///
+    /// @code{.cpp}
+    ///     Size size = range.getSize();
+    /// @endcode
+    ///
+    /// @return The number of instants.
+    Size getSize() const;
+
+    /// @brief Get the chunk size.
+    ///
+    /// @code{.cpp}
+    ///     Size chunkSize = range.getChunkSize();
+    /// @endcode
+    ///
+    /// @return The number of instants evaluated at once.
+    Size getChunkSize() const;
+
+    /// @brief Check if the next chunk is evaluated in the background.
+    ///
+    /// @code{.cpp}
+    ///     bool prefetching = range.isPrefetching();
+    /// @endcode
+    ///
+    /// @return True if prefetching.
+    bool isPrefetching() const;
+
+    /// @brief Get an instant of the grid.
+    ///
+    /// @code{.cpp}
+    ///     Instant instant = range.getInstantAt(0); // Interval start
+    /// @endcode
+    ///
+    /// @param [in] anIndex An instant index, lower than the range size.
+    /// @return The instant.
+    Instant getInstantAt(const Index& anIndex) const;
+
+    /// @brief Get an iterator to the first view, starting the evaluation.
+    /// @details Every call starts an independent pass over the range.
+    ///
+    /// @code{.cpp}
+    ///     TimeRange::Iterator iterator = range.begin();
+    /// @endcode
+    ///
+    /// @return An iterator.
+    Iterator begin() const;
+
+    /// @brief Get the end iterator.
+    ///
+    /// @code{.cpp}
+    ///     TimeRange::Iterator iterator = range.end();
+    /// @endcode
+    ///
+    /// @return An end iterator.
+    Iterator end() const;
+
+    /// @brief Print the time range to an output stream.
+    ///
+    /// @code{.cpp}
+    ///     range.print(std::cout, true);
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream.
+    /// @param [in] displayDecorators If true, display decorators.
+    void print(std::ostream& anOutputStream, bool displayDecorators = true) const;
+
+   private:
+    struct Chunk
+    {
+        Array<Instant> instants;
+        Map<String, StateTable> stateTableMap;
+    };
+
+    Shared<const Simulator> simulatorSPtr_;
+    Interval interval_;
+    Duration step_;
+    Size size_;
+    Size chunkSize_;
+    bool prefetch_;
+
+    Size getChunkCount() const;
+
+    Shared<const Chunk> evaluateChunk(const Index& aChunkIndex) const;
+};
+
+}  // namespace simulator
+}  // namespace simulation
+}  // namespace ostk
+
+#endif
@@ -10,6 +10,8 @@
 #include <OpenSpaceToolkit/Core/Type/String.hpp>
 #include <OpenSpaceToolkit/Core/Type/Unique.hpp>
 
+#include <OpenSpaceToolkit/Simulation/Utility/SymbolIndex.hpp>
+
 namespace ostk
 {
 namespace simulation
@@ -29,7 +31,9 @@ using ostk::core::type::String;
 using ostk::core::type::Unique;
 
 /// @brief A container that holds and manages a collection of components.
-/// @details Provides lookup by identifier, name, tag, and hierarchical path.
+/// @details Provides lookup by identifier, name, tag, and hierarchical path. Components are iterated by ascending
+///          name, and looked up by name through a hash index of interned names. Repeated lookups of a same
+///          component can go through a handle instead (see getComponentHandle).
 ///
 /// @code{.cpp}
 ///     ComponentHolder holder(componentArray);
@@ -39,6 +43,8 @@ using ostk::core::type::Unique;
 class ComponentHolder
 {
    public:
+    typedef SymbolIndex<Shared<Component>>::Handle ComponentHandle;
+
     /// @brief Construct a component holder.
     ///
     /// @code{.cpp}
@@ -119,6 +125,27 @@ class ComponentHolder
     /// @return A reference to the component.
     const Component& accessComponentWithName(const String& aComponentName) const;
 
+    /// @brief Get a handle on a component, to access it repeatedly without lookup.
+    /// @details The handle remains valid across modifications of the holder, at the cost of a lookup.
+    ///
+    /// @code{.cpp}
+    ///     const ComponentHandle handle = holder.getComponentHandle("sensor");
+    /// @endcode
+    ///
+    /// @param [in] aComponentName A component name.
+    /// @return A component handle.
+    ComponentHandle getComponentHandle(const String& aComponentName) const;
+
+    /// @brief Access a component by handle.
+    ///
+    /// @code{.cpp}
+    ///     const Component& sensor = holder.accessComponent(handle);
+    /// @endcode
+    ///
+    /// @param [in] aComponentHandle A component handle.
+    /// @return A reference to the component.
+    const Component& accessComponent(const ComponentHandle& aComponentHandle) const;
+
     /// @brief Access all components matching a tag.
     ///
     /// @code{.cpp}
@@ -150,6 +177,7 @@ class ComponentHolder
 
    private:
     Map<String, Shared<Component>> componentMap_;
+    SymbolIndex<Shared<Component>> componentIndex_;
 };
 
 /// @brief Split a hierarchical component path into its first segment and the remainder.
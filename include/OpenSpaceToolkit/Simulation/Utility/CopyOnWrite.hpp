@@ -0,0 +1,107 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Simulation_Utility_CopyOnWrite__
+#define __OpenSpaceToolkit_Simulation_Utility_CopyOnWrite__
+
+#include <memory>
+
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace utility
+{
+
+using ostk::core::type::Shared;
+
+/// @brief A value shared between copies until one of them is modified.
+/// @details Copying is constant time: copies share the same underlying value. The value is cloned on the first
+///          modification of a copy that is still shared, so unmodified copies never pay for it. Distinct copies may
+///          be used from distinct threads, a given copy may not be modified concurrently.
+///
+/// @code{.cpp}
+///     CopyOnWrite<Map<String, State>> stateMap;
+///     CopyOnWrite<Map<String, State>> stateMapCopy = stateMap; // Shares the map
+///     stateMapCopy.edit().insert({"id", state}); // Clones the map
+/// @endcode
+template <class T>
+class CopyOnWrite
+{
+   public:
+    /// @brief Construct from a value.
+    ///
+    /// @code{.cpp}
+    ///     CopyOnWrite<Map<String, State>> stateMap(Map<String, State>());
+    /// @endcode
+    ///
+    /// @param [in] aValue A value (default: default-constructed value).
+    CopyOnWrite(const T& aValue = T())
+        : valueSPtr_(std::make_shared<T>(aValue))
+    {
+    }
+
+    /// @brief Check if the value is shared with another copy.
+    ///
+    /// @code{.cpp}
+    ///     bool shared = stateMap.isShared();
+    /// @endcode
+    ///
+    /// @return True if the value is shared with another copy.
+    bool isShared() const
+    {
+        return valueSPtr_.use_count() > 1;
+    }
+
+    /// @brief Access the value.
+    ///
+    /// @code{.cpp}
+    ///     const Map<String, State>& map = stateMap.access();
+    /// @endcode
+    ///
+    /// @return A reference to the value.
+    const T& access() const
+    {
+        return *valueSPtr_;
+    }
+
+    /// @brief Access the value for modification, cloning it first if it is shared.
+    /// @details The reference is invalidated by the next copy of this object.
+    ///
+    /// @code{.cpp}
+    ///     stateMap.edit().insert({"id", state});
+    /// @endcode
+    ///
+    /// @return A reference to the unshared value.
+    T& edit()
+    {
+        if (this->isShared())
+        {
+            valueSPtr_ = std::make_shared<T>(*valueSPtr_);
+        }
+
+        return *valueSPtr_;
+    }
+
+    /// @brief Replace the value, without cloning the current one.
+    ///
+    /// @code{.cpp}
+    ///     stateMap.assign({});
+    /// @endcode
+    ///
+    /// @param [in] aValue A value.
+    void assign(const T& aValue)
+    {
+        valueSPtr_ = std::make_shared<T>(aValue);
+    }
+
+   private:
+    Shared<T> valueSPtr_;
+};
+
+}  // namespace utility
+}  // namespace simulation
+}  // namespace ostk
+
+#endif
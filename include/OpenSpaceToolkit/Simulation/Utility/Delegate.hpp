@@ -0,0 +1,162 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Simulation_Utility_Delegate__
+#define __OpenSpaceToolkit_Simulation_Utility_Delegate__
+
+#include <utility>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace utility
+{
+
+template <class Signature>
+class Delegate;
+
+/// @brief A non-owning reference to a callable, invoked through a single indirect call.
+/// @details A delegate holds an object pointer and a function pointer: it is trivially copyable, never allocates,
+///          and calling it costs one indirect call. The referenced object must outlive the delegate.
+///
+/// @code{.cpp}
+///     Recorder recorder;
+///     const auto delegate = Delegate<void(const Instant&)>::FromMethod<Recorder, &Recorder::record>(&recorder);
+///     delegate(instant);
+/// @endcode
+template <class Result, class... Arguments>
+class Delegate<Result(Arguments...)>
+{
+   public:
+    /// @brief Construct an undefined delegate.
+    ///
+    /// @code{.cpp}
+    ///     Delegate<void(const Instant&)> delegate;
+    /// @endcode
+    Delegate()
+        : objectPtr_(nullptr),
+          stubPtr_(nullptr)
+    {
+    }
+
+    /// @brief Check if the delegate is defined.
+    ///
+    /// @code{.cpp}
+    ///     bool defined = delegate.isDefined();
+    /// @endcode
+    ///
+    /// @return True if the delegate is defined.
+    bool isDefined() const
+    {
+        return stubPtr_ != nullptr;
+    }
+
+    /// @brief Call the referenced callable.
+    ///
+    /// @code{.cpp}
+    ///     delegate(instant);
+    /// @endcode
+    ///
+    /// @param [in] anArgumentList Arguments.
+    /// @return The callable result.
+    Result operator()(Arguments... anArgumentList) const
+    {
+        if (stubPtr_ == nullptr)
+        {
+            throw ostk::core::error::runtime::Undefined("Delegate");
+        }
+
+        return stubPtr_(objectPtr_, std::forward<Arguments>(anArgumentList)...);
+    }
+
+    /// @brief Construct a delegate to a free function.
+    ///
+    /// @code{.cpp}
+    ///     Delegate<void(const Instant&)> delegate = Delegate<void(const Instant&)>::FromFunction<&record>();
+    /// @endcode
+    ///
+    /// @return A delegate.
+    template <Result (*Function)(Arguments...)>
+    static Delegate FromFunction()
+    {
+        return {
+            nullptr,
+            [](void*, Arguments... anArgumentList) -> Result
+            {
+                return Function(std::forward<Arguments>(anArgumentList)...);
+            }
+        };
+    }
+
+    /// @brief Construct a delegate to a member function.
+    ///
+    /// @code{.cpp}
+    ///     Delegate<void(const Instant&)> delegate =
+    ///         Delegate<void(const Instant&)>::FromMethod<Recorder, &Recorder::record>(&recorder);
+    /// @endcode
+    ///
+    /// @param [in] anObjectPtr A pointer to an object, which must outlive the delegate.
+    /// @return A delegate.
+    template <class Type, Result (Type::*Method)(Arguments...)>
+    static Delegate FromMethod(Type* anObjectPtr)
+    {
+        if (anObjectPtr == nullptr)
+        {
+            throw ostk::core::error::runtime::Undefined("Object");
+        }
+
+        return {
+            anObjectPtr,
+            [](void* aPtr, Arguments... anArgumentList) -> Result
+            {
+                return (static_cast<Type*>(aPtr)->*Method)(std::forward<Arguments>(anArgumentList)...);
+            }
+        };
+    }
+
+    /// @brief Construct a delegate to a callable object (e.g. a lambda).
+    ///
+    /// @code{.cpp}
+    ///     auto record = [&instants](const Instant& anInstant) { instants.add(anInstant); };
+    ///     Delegate<void(const Instant&)> delegate = Delegate<void(const Instant&)>::FromCallable(&record);
+    /// @endcode
+    ///
+    /// @param [in] aCallablePtr A pointer to a callable object, which must outlive the delegate.
+    /// @return A delegate.
+    template <class Callable>
+    static Delegate FromCallable(Callable* aCallablePtr)
+    {
+        if (aCallablePtr == nullptr)
+        {
+            throw ostk::core::error::runtime::Undefined("Callable");
+        }
+
+        return {
+            const_cast<void*>(static_cast<const void*>(aCallablePtr)),
+            [](void* aPtr, Arguments... anArgumentList) -> Result
+            {
+                return (*static_cast<Callable*>(aPtr))(std::forward<Arguments>(anArgumentList)...);
+            }
+        };
+    }
+
+   private:
+    typedef Result (*Stub)(void*, Arguments...);
+
+    void* objectPtr_;
+    Stub stubPtr_;
+
+    Delegate(void* anObjectPtr, Stub aStubPtr)
+        : objectPtr_(anObjectPtr),
+          stubPtr_(aStubPtr)
+    {
+    }
+};
+
+}  // namespace utility
+}  // namespace simulation
+}  // namespace ostk
+
+#endif
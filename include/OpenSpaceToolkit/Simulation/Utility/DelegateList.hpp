@@ -0,0 +1,222 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Simulation_Utility_DelegateList__
+#define __OpenSpaceToolkit_Simulation_Utility_DelegateList__
+
+#include <algorithm>
+#include <vector>
+
+#include <OpenSpaceToolkit/Simulation/Utility/Delegate.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace utility
+{
+
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+template <class Signature>
+class DelegateList;
+
+/// @brief A list of identified delegates, invoked in subscription order.
+/// @details Delegates are stored contiguously: invoking the list walks an array and performs one indirect call
+///          per delegate, without allocating. A delegate may come with an owner, kept alive as long as the delegate
+///          is listed. Delegates may not be added or removed while the list is being invoked.
+///
+/// @code{.cpp}
+///     DelegateList<void(const Instant&)> delegateList;
+///     delegateList.add(0, delegate);
+///     delegateList.invoke(instant);
+///     delegateList.remove(0);
+/// @endcode
+template <class... Arguments>
+class DelegateList<void(Arguments...)>
+{
+   public:
+    /// @brief Construct an empty delegate list.
+    ///
+    /// @code{.cpp}
+    ///     DelegateList<void(const Instant&)> delegateList;
+    /// @endcode
+    DelegateList()
+        : entries_(),
+          invocationDepth_(0)
+    {
+    }
+
+    /// @brief Copy constructor.
+    ///
+    /// @param [in] aDelegateList A delegate list.
+    DelegateList(const DelegateList& aDelegateList)
+        : entries_(aDelegateList.entries_),
+          invocationDepth_(0)
+    {
+    }
+
+    /// @brief Copy assignment operator.
+    ///
+    /// @param [in] aDelegateList A delegate list.
+    /// @return A reference to the delegate list.
+    DelegateList& operator=(const DelegateList& aDelegateList)
+    {
+        this->ensureNotInvoking();
+
+        entries_ = aDelegateList.entries_;
+
+        return *this;
+    }
+
+    /// @brief Check if the list is empty.
+    ///
+    /// @code{.cpp}
+    ///     bool empty = delegateList.isEmpty();
+    /// @endcode
+    ///
+    /// @return True if the list is empty.
+    bool isEmpty() const
+    {
+        return entries_.empty();
+    }
+
+    /// @brief Get the number of delegates.
+    ///
+    /// @code{.cpp}
+    ///     Size size = delegateList.getSize();
+    /// @endcode
+    ///
+    /// @return The number of delegates.
+    Size getSize() const
+    {
+        return entries_.size();
+    }
+
+    /// @brief Add a delegate.
+    ///
+    /// @code{.cpp}
+    ///     delegateList.add(id, delegate);
+    /// @endcode
+    ///
+    /// @param [in] anId A delegate identifier.
+    /// @param [in] aDelegate A defined delegate.
+    /// @param [in] anOwnerSPtr An owner kept alive while the delegate is listed (optional).
+    void add(
+        const Index& anId,
+        const Delegate<void(Arguments...)>& aDelegate,
+        const Shared<const void>& anOwnerSPtr = nullptr
+    )
+    {
+        if (!aDelegate.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Delegate");
+        }
+
+        this->ensureNotInvoking();
+
+        entries_.push_back({anId, aDelegate, anOwnerSPtr});
+    }
+
+    /// @brief Remove a delegate.
+    ///
+    /// @code{.cpp}
+    ///     bool removed = delegateList.remove(id);
+    /// @endcode
+    ///
+    /// @param [in] anId A delegate identifier.
+    /// @return True if a delegate was removed.
+    bool remove(const Index& anId)
+    {
+        this->ensureNotInvoking();
+
+        const auto entryIt = std::find_if(
+            entries_.begin(),
+            entries_.end(),
+            [&anId](const Entry& anEntry)
+            {
+                return anEntry.id == anId;
+            }
+        );
+
+        if (entryIt == entries_.end())
+        {
+            return false;
+        }
+
+        entries_.erase(entryIt);
+
+        return true;
+    }
+
+    /// @brief Invoke all delegates, in subscription order.
+    ///
+    /// @code{.cpp}
+    ///     delegateList.invoke(instant);
+    /// @endcode
+    ///
+    /// @param [in] anArgumentList Arguments.
+    void invoke(Arguments... anArgumentList) const
+    {
+        if (entries_.empty())
+        {
+            return;
+        }
+
+        const InvocationGuard guard(invocationDepth_);
+
+        for (const Entry& entry : entries_)
+        {
+            entry.delegate(anArgumentList...);
+        }
+    }
+
+   private:
+    struct Entry
+    {
+        Index id;
+        Delegate<void(Arguments...)> delegate;
+        Shared<const void> ownerSPtr;
+    };
+
+    class InvocationGuard
+    {
+       public:
+        InvocationGuard(Size& anInvocationDepth)
+            : invocationDepth_(anInvocationDepth)
+        {
+            invocationDepth_ += 1;
+        }
+
+        ~InvocationGuard()
+        {
+            invocationDepth_ -= 1;
+        }
+
+       private:
+        Size& invocationDepth_;
+    };
+
+    std::vector<Entry> entries_;
+    mutable Size invocationDepth_;
+
+    void ensureNotInvoking() const
+    {
+        if (invocationDepth_ > 0)
+        {
+            throw ostk::core::error::RuntimeError("Cannot modify delegates while they are being invoked.");
+        }
+    }
+};
+
+}  // namespace utility
+}  // namespace simulation
+}  // namespace ostk
+
+#endif
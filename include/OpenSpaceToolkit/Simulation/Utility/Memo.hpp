@@ -0,0 +1,188 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Simulation_Utility_Memo__
+#define __OpenSpaceToolkit_Simulation_Utility_Memo__
+
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace utility
+{
+
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+/// @brief A memo of the values of a function at its last few keys.
+/// @details Holds up to a fixed number of entries, searched linearly by key equality: the memo is meant for a
+///          handful of keys queried repeatedly (e.g. the instants of the current simulation step), not as a
+///          general cache. When full, the oldest entry is replaced. Concurrent queries are safe: values are
+///          evaluated without holding the lock, so two callers missing the same key may both evaluate it, the
+///          last one updating the entry of the first.
+///
+/// @code{.cpp}
+///     Memo<Instant, Transform> memo(8);
+///     const Transform transform = memo.get(instant, [&]() { return evaluate(instant); });
+/// @endcode
+template <class Key, class Value>
+class Memo
+{
+   public:
+    /// @brief Constructor.
+    ///
+    /// @code{.cpp}
+    ///     Memo<Instant, Transform> memo(8);
+    /// @endcode
+    ///
+    /// @param [in] aCapacity A maximum number of entries, strictly positive.
+    Memo(const Size aCapacity)
+        : capacity_(aCapacity),
+          entries_(),
+          nextIndex_(0),
+          mutex_()
+    {
+        if (aCapacity == 0)
+        {
+            throw ostk::core::error::runtime::Wrong("Capacity");
+        }
+
+        entries_.reserve(aCapacity);
+    }
+
+    /// @brief Get the maximum number of entries.
+    ///
+    /// @return The capacity.
+    Size getCapacity() const
+    {
+        return this->capacity_;
+    }
+
+    /// @brief Get the number of entries.
+    ///
+    /// @return The number of entries.
+    Size getSize() const
+    {
+        const std::lock_guard<std::mutex> lock(this->mutex_);
+
+        return this->entries_.size();
+    }
+
+    /// @brief Get the value at a key, evaluating it if it is not memoized.
+    /// @details Failed evaluations are not memoized.
+    ///
+    /// @code{.cpp}
+    ///     const Transform transform = memo.get(instant, [&]() { return evaluate(instant); });
+    /// @endcode
+    ///
+    /// @param [in] aKey A key.
+    /// @param [in] anEvaluator An evaluator of the value, called if the key is not memoized.
+    /// @return The value.
+    Value get(const Key& aKey, const std::function<Value()>& anEvaluator)
+    {
+        {
+            const std::lock_guard<std::mutex> lock(this->mutex_);
+
+            for (const auto& entry : this->entries_)
+            {
+                if (entry.key == aKey)
+                {
+                    return entry.value;
+                }
+            }
+        }
+
+        const Value value = anEvaluator();
+
+        const std::lock_guard<std::mutex> lock(this->mutex_);
+
+        this->assign(aKey, value);
+
+        return value;
+    }
+
+    /// @brief Set the value at a key, evaluated elsewhere.
+    /// @details Replaces the value memoized at the key, if any.
+    ///
+    /// @code{.cpp}
+    ///     memo.set(instant, transform);
+    /// @endcode
+    ///
+    /// @param [in] aKey A key.
+    /// @param [in] aValue A value.
+    void set(const Key& aKey, const Value& aValue)
+    {
+        const std::lock_guard<std::mutex> lock(this->mutex_);
+
+        this->assign(aKey, aValue);
+    }
+
+    /// @brief Remove all entries.
+    ///
+    /// @code{.cpp}
+    ///     memo.clear();
+    /// @endcode
+    void clear()
+    {
+        const std::lock_guard<std::mutex> lock(this->mutex_);
+
+        this->entries_.clear();
+        this->nextIndex_ = 0;
+    }
+
+   private:
+    struct Entry
+    {
+        Key key;
+        Value value;
+    };
+
+    Size capacity_;
+    std::vector<Entry> entries_;
+    Index nextIndex_;
+
+    mutable std::mutex mutex_;
+
+    // Another caller may have stored the key since it was looked up: its entry is updated, rather than duplicated
+
+    void assign(const Key& aKey, const Value& aValue)
+    {
+        for (auto& entry : this->entries_)
+        {
+            if (entry.key == aKey)
+            {
+                entry.value = aValue;
+
+                return;
+            }
+        }
+
+        this->insert(aKey, aValue);
+    }
+
+    void insert(const Key& aKey, const Value& aValue)
+    {
+        if (this->entries_.size() < this->capacity_)
+        {
+            this->entries_.push_back({aKey, aValue});
+        }
+        else
+        {
+            this->entries_[this->nextIndex_] = {aKey, aValue};
+            this->nextIndex_ = (this->nextIndex_ + 1) % this->capacity_;
+        }
+    }
+};
+
+}  // namespace utility
+}  // namespace simulation
+}  // namespace ostk
+
+#endif
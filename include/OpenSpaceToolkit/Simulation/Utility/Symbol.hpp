@@ -0,0 +1,164 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Simulation_Utility_Symbol__
+#define __OpenSpaceToolkit_Simulation_Utility_Symbol__
+
+#include <functional>
+
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace utility
+{
+
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+/// @brief An interned name.
+/// @details Symbols of equal names share a single record, holding the name and its precomputed hash. Comparing
+///          symbols thus compares addresses, and hashing them reads the stored hash, instead of going through the
+///          characters of the name. Records are reference counted: a record is released with the last symbol
+///          referring to it, so that names of removed objects do not accumulate over the process lifetime.
+///
+///          Interning and releasing a record take a process-wide lock, copying a symbol does not: symbols are meant
+///          to be created once (e.g. when an object is added to a container) and copied. Lookups by name go through
+///          the name directly (see Symbol::Hash), so that unknown names are never interned.
+///
+/// @code{.cpp}
+///     const Symbol symbol("sat-1");
+///     bool isEqual = (symbol == Symbol("sat-1")); // True
+/// @endcode
+class Symbol
+{
+   public:
+    /// @brief Construct a symbol, interning its name.
+    ///
+    /// @code{.cpp}
+    ///     const Symbol symbol("sat-1");
+    /// @endcode
+    ///
+    /// @param [in] aName A name.
+    explicit Symbol(const String& aName);
+
+    /// @brief Equal to operator.
+    ///
+    /// @code{.cpp}
+    ///     bool isEqual = (symbol == otherSymbol);
+    /// @endcode
+    ///
+    /// @param [in] aSymbol A symbol.
+    /// @return True if both symbols have the same name.
+    bool operator==(const Symbol& aSymbol) const;
+
+    /// @brief Not equal to operator.
+    ///
+    /// @code{.cpp}
+    ///     bool isNotEqual = (symbol != otherSymbol);
+    /// @endcode
+    ///
+    /// @param [in] aSymbol A symbol.
+    /// @return True if the symbols have different names.
+    bool operator!=(const Symbol& aSymbol) const;
+
+    /// @brief Output stream operator.
+    ///
+    /// @code{.cpp}
+    ///     std::cout << symbol;
+    /// @endcode
+    ///
+    /// @param [in] anOutputStream An output stream.
+    /// @param [in] aSymbol A symbol.
+    /// @return A reference to the output stream.
+    friend std::ostream& operator<<(std::ostream& anOutputStream, const Symbol& aSymbol);
+
+    /// @brief Check if the symbol is defined.
+    ///
+    /// @code{.cpp}
+    ///     bool isDefined = symbol.isDefined();
+    /// @endcode
+    ///
+    /// @return True if the symbol is defined.
+    bool isDefined() const;
+
+    /// @brief Access the name.
+    ///
+    /// @code{.cpp}
+    ///     const String& name = symbol.accessName();
+    /// @endcode
+    ///
+    /// @return A reference to the interned name.
+    const String& accessName() const;
+
+    /// @brief Get the precomputed hash of the name.
+    ///
+    /// @code{.cpp}
+    ///     Size hash = symbol.getHash();
+    /// @endcode
+    ///
+    /// @return The hash, equal to Symbol::Hash(symbol.accessName()).
+    Size getHash() const;
+
+    /// @brief Construct an undefined symbol.
+    ///
+    /// @code{.cpp}
+    ///     const Symbol symbol = Symbol::Undefined();
+    /// @endcode
+    ///
+    /// @return An undefined symbol.
+    static Symbol Undefined();
+
+    /// @brief Hash a name, the way symbols hash theirs.
+    /// @details Allows looking up a symbol-keyed container by name, without interning the name.
+    ///
+    /// @code{.cpp}
+    ///     Size hash = Symbol::Hash("sat-1");
+    /// @endcode
+    ///
+    /// @param [in] aName A name.
+    /// @return The hash of the name.
+    static Size Hash(const String& aName);
+
+    /// @brief Get the number of names currently interned.
+    /// @details Names are released with the last symbol referring to them.
+    ///
+    /// @code{.cpp}
+    ///     Size count = Symbol::GetInternedCount();
+    /// @endcode
+    ///
+    /// @return The number of interned names.
+    static Size GetInternedCount();
+
+   private:
+    struct Record
+    {
+        String name;
+        Size hash;
+    };
+
+    Shared<const Record> recordSPtr_;
+
+    Symbol();
+
+    static Shared<const Record> Intern(const String& aName);
+};
+
+}  // namespace utility
+}  // namespace simulation
+}  // namespace ostk
+
+template <>
+struct std::hash<ostk::simulation::utility::Symbol>
+{
+    std::size_t operator()(const ostk::simulation::utility::Symbol& aSymbol) const
+    {
+        return aSymbol.getHash();
+    }
+};
+
+#endif
@@ -0,0 +1,413 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Simulation_Utility_SymbolIndex__
+#define __OpenSpaceToolkit_Simulation_Utility_SymbolIndex__
+
+#include <atomic>
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <OpenSpaceToolkit/Simulation/Utility/Symbol.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace utility
+{
+
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+/// @brief A flat hash index of values keyed by symbol.
+/// @details Values are stored inline in a single array of slots, probed linearly from the precomputed hash of their
+///          symbol: a lookup by symbol compares symbol addresses only, and a lookup by name hashes the name once and
+///          compares the characters of candidates whose hash matches. The index does not define an iteration
+///          order: containers keep their ordered map for deterministic iteration, and the index for lookups.
+///
+///          A handle records where a value was found. Resolving it returns that value directly, without lookup, as
+///          long as the index was not modified since; it falls back to a lookup by symbol otherwise. Indexes are
+///          stamped with a process-wide counter on each modification and copy, so a handle is never resolved
+///          directly against storage other than the one it was taken from.
+///
+///          Values must be default constructible, empty slots holding a default value.
+///
+/// @code{.cpp}
+///     SymbolIndex<Shared<Satellite>> index;
+///     index.insert(Symbol("sat-1"), satelliteSPtr);
+///     const SymbolIndex<Shared<Satellite>>::Handle handle = index.getHandle(Symbol("sat-1"));
+///     const Shared<Satellite>* satelliteSPtrPtr = index.resolve(handle);
+/// @endcode
+template <class Value>
+class SymbolIndex
+{
+   public:
+    /// @brief A cached lookup result.
+    struct Handle
+    {
+        Symbol symbol;
+        const Value* valuePtr;
+        Index stamp;
+
+        /// @brief Check if the handle is defined.
+        ///
+        /// @return True if the handle was taken from a value present in its index.
+        bool isDefined() const
+        {
+            return this->valuePtr != nullptr;
+        }
+    };
+
+    /// @brief Constructor.
+    ///
+    /// @code{.cpp}
+    ///     SymbolIndex<Integer> index;
+    /// @endcode
+    SymbolIndex()
+        : slots_(),
+          size_(0),
+          stamp_(SymbolIndex::NextStamp())
+    {
+    }
+
+    /// @brief Copy constructor.
+    ///
+    /// @code{.cpp}
+    ///     SymbolIndex<Integer> copy(index);
+    /// @endcode
+    ///
+    /// @param [in] aSymbolIndex A symbol index.
+    SymbolIndex(const SymbolIndex& aSymbolIndex)
+        : slots_(aSymbolIndex.slots_),
+          size_(aSymbolIndex.size_),
+          stamp_(SymbolIndex::NextStamp())
+    {
+    }
+
+    /// @brief Copy assignment operator.
+    ///
+    /// @code{.cpp}
+    ///     index = otherIndex;
+    /// @endcode
+    ///
+    /// @param [in] aSymbolIndex A symbol index.
+    /// @return A reference to this symbol index.
+    SymbolIndex& operator=(const SymbolIndex& aSymbolIndex)
+    {
+        if (this != &aSymbolIndex)
+        {
+            this->slots_ = aSymbolIndex.slots_;
+            this->size_ = aSymbolIndex.size_;
+            this->stamp_ = SymbolIndex::NextStamp();
+        }
+
+        return *this;
+    }
+
+    /// @brief Check if the index is empty.
+    ///
+    /// @return True if the index holds no value.
+    bool isEmpty() const
+    {
+        return this->size_ == 0;
+    }
+
+    /// @brief Get the number of values.
+    ///
+    /// @return The number of values.
+    Size getSize() const
+    {
+        return this->size_;
+    }
+
+    /// @brief Find the value of a symbol.
+    ///
+    /// @code{.cpp}
+    ///     const Integer* valuePtr = index.find(symbol);
+    /// @endcode
+    ///
+    /// @param [in] aSymbol A symbol.
+    /// @return A pointer to the value, or nullptr if absent. Invalidated by the next modification.
+    const Value* find(const Symbol& aSymbol) const
+    {
+        const Index index = this->locate(aSymbol);
+
+        return (index < this->slots_.size()) ? &this->slots_[index].value : nullptr;
+    }
+
+    /// @brief Find the value of a name, without interning it.
+    ///
+    /// @code{.cpp}
+    ///     const Integer* valuePtr = index.find("sat-1");
+    /// @endcode
+    ///
+    /// @param [in] aName A name.
+    /// @return A pointer to the value, or nullptr if absent. Invalidated by the next modification.
+    const Value* find(const String& aName) const
+    {
+        const Index index = this->locate(aName);
+
+        return (index < this->slots_.size()) ? &this->slots_[index].value : nullptr;
+    }
+
+    /// @brief Get a handle on the value of a symbol.
+    ///
+    /// @code{.cpp}
+    ///     const SymbolIndex<Integer>::Handle handle = index.getHandle(symbol);
+    /// @endcode
+    ///
+    /// @param [in] aSymbol A symbol.
+    /// @return A handle, undefined if the symbol is absent.
+    Handle getHandle(const Symbol& aSymbol) const
+    {
+        return {aSymbol, this->find(aSymbol), this->stamp_};
+    }
+
+    /// @brief Get a handle on the value of a name, without interning it.
+    /// @details The handle refers to the symbol held by the index, if any.
+    ///
+    /// @code{.cpp}
+    ///     const SymbolIndex<Integer>::Handle handle = index.getHandle("sat-1");
+    /// @endcode
+    ///
+    /// @param [in] aName A name.
+    /// @return A handle, undefined if the name is absent.
+    Handle getHandle(const String& aName) const
+    {
+        const Index index = this->locate(aName);
+
+        if (index >= this->slots_.size())
+        {
+            return {Symbol::Undefined(), nullptr, this->stamp_};
+        }
+
+        return {this->slots_[index].symbol, &this->slots_[index].value, this->stamp_};
+    }
+
+    /// @brief Resolve a handle to its value.
+    ///
+    /// @code{.cpp}
+    ///     const Integer* valuePtr = index.resolve(handle);
+    /// @endcode
+    ///
+    /// @param [in] aHandle A handle.
+    /// @return A pointer to the value, or nullptr if its symbol is no longer present.
+    const Value* resolve(const Handle& aHandle) const
+    {
+        if ((aHandle.stamp == this->stamp_) && aHandle.isDefined())
+        {
+            return aHandle.valuePtr;
+        }
+
+        return this->find(aHandle.symbol);
+    }
+
+    /// @brief Insert a value, unless its symbol is already present.
+    ///
+    /// @code{.cpp}
+    ///     bool isInserted = index.insert(symbol, 1);
+    /// @endcode
+    ///
+    /// @param [in] aSymbol A symbol.
+    /// @param [in] aValue A value.
+    /// @return True if the value was inserted.
+    bool insert(const Symbol& aSymbol, const Value& aValue)
+    {
+        if (!aSymbol.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Symbol");
+        }
+
+        if (this->find(aSymbol) != nullptr)
+        {
+            return false;
+        }
+
+        this->reserve(this->size_ + 1);
+
+        const Index mask = this->slots_.size() - 1;
+
+        Index index = aSymbol.getHash() & mask;
+
+        while (this->slots_[index].symbol.isDefined())
+        {
+            index = (index + 1) & mask;
+        }
+
+        this->slots_[index] = {aSymbol, aValue};
+        this->size_ += 1;
+        this->stamp_ = SymbolIndex::NextStamp();
+
+        return true;
+    }
+
+    /// @brief Erase the value of a symbol.
+    /// @details The following slots of the probe sequence are shifted back, so that lookups never need tombstones.
+    ///
+    /// @code{.cpp}
+    ///     bool isErased = index.erase(symbol);
+    /// @endcode
+    ///
+    /// @param [in] aSymbol A symbol.
+    /// @return True if a value was erased.
+    bool erase(const Symbol& aSymbol)
+    {
+        Index emptyIndex = this->locate(aSymbol);
+
+        if (emptyIndex >= this->slots_.size())
+        {
+            return false;
+        }
+
+        const Index mask = this->slots_.size() - 1;
+
+        for (Index index = (emptyIndex + 1) & mask; this->slots_[index].symbol.isDefined(); index = (index + 1) & mask)
+        {
+            // A slot may move back to the empty slot only if that does not place it before its home slot
+
+            const Index homeIndex = this->slots_[index].symbol.getHash() & mask;
+
+            if (((index - homeIndex) & mask) >= ((index - emptyIndex) & mask))
+            {
+                this->slots_[emptyIndex] = std::move(this->slots_[index]);
+                emptyIndex = index;
+            }
+        }
+
+        this->slots_[emptyIndex] = Slot();
+        this->size_ -= 1;
+        this->stamp_ = SymbolIndex::NextStamp();
+
+        return true;
+    }
+
+    /// @brief Reserve slots for a number of values, so that inserting up to that number does not rehash.
+    ///
+    /// @code{.cpp}
+    ///     index.reserve(1000);
+    /// @endcode
+    ///
+    /// @param [in] aSize A number of values.
+    void reserve(const Size aSize)
+    {
+        // Kept at most half full, so that probe sequences stay short
+
+        Size capacity = 8;
+
+        while (capacity < (2 * aSize))
+        {
+            capacity *= 2;
+        }
+
+        if (capacity <= this->slots_.size())
+        {
+            return;
+        }
+
+        std::vector<Slot> slots(capacity);
+
+        const Index mask = capacity - 1;
+
+        for (auto& slot : this->slots_)
+        {
+            if (slot.symbol.isDefined())
+            {
+                Index index = slot.symbol.getHash() & mask;
+
+                while (slots[index].symbol.isDefined())
+                {
+                    index = (index + 1) & mask;
+                }
+
+                slots[index] = std::move(slot);
+            }
+        }
+
+        this->slots_ = std::move(slots);
+        this->stamp_ = SymbolIndex::NextStamp();
+    }
+
+    /// @brief Remove all values.
+    ///
+    /// @code{.cpp}
+    ///     index.clear();
+    /// @endcode
+    void clear()
+    {
+        this->slots_.clear();
+        this->size_ = 0;
+        this->stamp_ = SymbolIndex::NextStamp();
+    }
+
+   private:
+    struct Slot
+    {
+        Symbol symbol = Symbol::Undefined();
+        Value value = Value();
+    };
+
+    std::vector<Slot> slots_;
+    Size size_;
+    Index stamp_;
+
+    Index locate(const Symbol& aSymbol) const
+    {
+        if (this->isEmpty() || (!aSymbol.isDefined()))
+        {
+            return this->slots_.size();
+        }
+
+        const Index mask = this->slots_.size() - 1;
+
+        for (Index index = aSymbol.getHash() & mask; this->slots_[index].symbol.isDefined(); index = (index + 1) & mask)
+        {
+            if (this->slots_[index].symbol == aSymbol)
+            {
+                return index;
+            }
+        }
+
+        return this->slots_.size();
+    }
+
+    Index locate(const String& aName) const
+    {
+        if (this->isEmpty() || aName.isEmpty())
+        {
+            return this->slots_.size();
+        }
+
+        const Size hash = Symbol::Hash(aName);
+        const Index mask = this->slots_.size() - 1;
+
+        for (Index index = hash & mask; this->slots_[index].symbol.isDefined(); index = (index + 1) & mask)
+        {
+            const Symbol& symbol = this->slots_[index].symbol;
+
+            if ((symbol.getHash() == hash) && (symbol.accessName() == aName))
+            {
+                return index;
+            }
+        }
+
+        return this->slots_.size();
+    }
+
+    static Index NextStamp()
+    {
+        static std::atomic<Index> stamp {0};
+
+        return ++stamp;
+    }
+};
+
+}  // namespace utility
+}  // namespace simulation
+}  // namespace ostk
+
+#endif
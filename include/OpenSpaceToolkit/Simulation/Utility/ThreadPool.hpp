@@ -0,0 +1,110 @@
+/// Apache License 2.0
+
+#ifndef __OpenSpaceToolkit_Simulation_Utilties_ThreadPool__
+#define __OpenSpaceToolkit_Simulation_Utilties_ThreadPool__
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace utility
+{
+
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+/// @brief A fixed-size pool of worker threads executing index-parallel loops.
+/// @details The calling thread takes part in every loop, so a pool of N threads spawns N - 1 workers.
+///          Loops submitted from within a running loop are executed serially on the calling thread.
+///
+/// @code{.cpp}
+///     ThreadPool threadPool(8);
+///     threadPool.parallelFor(satelliteCount, [&](const Index& anIndex) { ... });
+/// @endcode
+class ThreadPool
+{
+   public:
+    /// @brief Construct a thread pool.
+    ///
+    /// @code{.cpp}
+    ///     ThreadPool threadPool(8);
+    /// @endcode
+    ///
+    /// @param [in] aThreadCount A thread count (including the calling thread), strictly positive.
+    ThreadPool(const Size& aThreadCount);
+
+    ThreadPool(const ThreadPool& aThreadPool) = delete;
+
+    ThreadPool& operator=(const ThreadPool& aThreadPool) = delete;
+
+    /// @brief Destructor. Joins all workers.
+    ~ThreadPool();
+
+    /// @brief Get the thread count (including the calling thread).
+    ///
+    /// @code{.cpp}
+    ///     Size threadCount = threadPool.getThreadCount();
+    /// @endcode
+    ///
+    /// @return The thread count.
+    Size getThreadCount() const;
+
+    /// @brief Execute a function for every index in [0, aCount), distributing indices over the pool.
+    /// @details Blocks until all indices are processed. The first exception thrown by the function is
+    ///          rethrown on the calling thread, once remaining work has been abandoned.
+    ///
+    /// @code{.cpp}
+    ///     threadPool.parallelFor(10, [&](const Index& anIndex) { results[anIndex] = compute(anIndex); });
+    /// @endcode
+    ///
+    /// @param [in] aCount An index count.
+    /// @param [in] aFunction A function called once per index.
+    void parallelFor(const Size& aCount, const std::function<void(const Index&)>& aFunction);
+
+    /// @brief Get the number of worker threads running in the process, across all thread pools.
+    /// @details Processes must not be forked while workers are running, as they may hold locks (see Partition).
+    ///
+    /// @code{.cpp}
+    ///     Size workerCount = ThreadPool::GetWorkerCount();
+    /// @endcode
+    ///
+    /// @return The worker thread count.
+    static Size GetWorkerCount();
+
+   private:
+    std::vector<std::thread> workers_;
+
+    std::mutex submitMutex_;
+    std::mutex mutex_;
+    std::condition_variable workCondition_;
+    std::condition_variable doneCondition_;
+
+    const std::function<void(const Index&)>* functionPtr_;
+    Size count_;
+    std::atomic<Size> nextIndex_;
+    Size pendingWorkerCount_;
+    Size generation_;
+    bool stopping_;
+    std::exception_ptr exceptionPtr_;
+
+    void work();
+
+    void process();
+};
+
+}  // namespace utility
+}  // namespace simulation
+}  // namespace ostk
+
+#endif
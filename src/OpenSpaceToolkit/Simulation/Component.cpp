@@ -1,13 +1,14 @@
 /// Apache License 2.0
 
 #include <OpenSpaceToolkit/Simulation/Component.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator.hpp>
 #include <OpenSpaceToolkit/Simulation/Utility/Identifier.hpp>
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider.hpp>
-#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/Dynamic.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/Static.hpp>
 
 namespace ostk
 {
@@ -16,7 +17,7 @@ namespace simulation
 
 using ostk::physics::coordinate::frame::Provider;
 using ostk::physics::coordinate::Transform;
-using DynamicProvider = ostk::physics::coordinate::frame::provider::Dynamic;
+using StaticProvider = ostk::physics::coordinate::frame::provider::Static;
 
 using namespace ostk::simulation::utility;
 
@@ -127,6 +128,16 @@ Component::Type Component::getType() const
     return this->type_;
 }
 
+State Component::getState() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Component");
+    }
+
+    return this->accessSimulator().getComponentStateWithId(this->getId());
+}
+
 Array<String> Component::getTags() const
 {
     if (!this->isDefined())
@@ -209,7 +220,10 @@ Shared<Component> Component::Configure(
         Component::GenerateFrame(
             String::Format("Component [{}]", aComponentConfiguration.id),
             aComponentConfiguration.orientation,
-            aParentComponentSPtr->accessFrame()
+            aParentComponentSPtr->accessFrame(),
+            ((aParentComponentSPtr->simulatorSPtr_ != nullptr) && aParentComponentSPtr->simulatorSPtr_->isDefined())
+                ? aParentComponentSPtr->simulatorSPtr_->accessFrameRegistry()
+                : nullptr
         ),
         aParentComponentSPtr->simulatorSPtr_
     );
@@ -227,6 +241,32 @@ Shared<Component> Component::Configure(
     return componentSPtr;
 }
 
+void Component::bindSimulator(const Shared<const Simulator>& aSimulatorSPtr)
+{
+    // Binds a copied component tree (see ComponentHolder copy constructor): geometries and subcomponents are made to
+    // refer to the copies rather than to the original components. Geometry shapes stay shared with the originals.
+
+    this->simulatorSPtr_ = aSimulatorSPtr;
+
+    const Shared<const Component> componentSPtr = this->shared_from_this();
+
+    Array<Shared<Geometry>> geometries = Array<Shared<Geometry>>::Empty();
+    geometries.reserve(this->geometries_.getSize());
+
+    for (const auto& geometrySPtr : this->geometries_)
+    {
+        geometries.add(Shared<Geometry>(new Geometry(*geometrySPtr, componentSPtr)));
+    }
+
+    this->geometries_ = geometries;
+
+    for (const auto& subcomponentSPtr : this->accessComponents())
+    {
+        subcomponentSPtr->setParent(this->shared_from_this());
+        subcomponentSPtr->bindSimulator(aSimulatorSPtr);
+    }
+}
+
 String Component::StringFromType(const Component::Type& aType)
 {
     static const Map<Component::Type, String> typeStringMap = {
@@ -242,38 +282,29 @@ String Component::StringFromType(const Component::Type& aType)
 }
 
 Shared<const Frame> Component::GenerateFrame(
-    const String& aName, const Quaternion& aQuaternion, const Shared<const Frame>& aParentFrameSPtr
+    const String& aName,
+    const Quaternion& aQuaternion,
+    const Shared<const Frame>& aParentFrameSPtr,
+    const Shared<FrameRegistry>& aFrameRegistrySPtr
 )
 {
     using ostk::physics::time::Instant;
 
-    if (Frame::Exists(aName))
-    {
-        Frame::Destruct(aName);
-    }
-
     if (aParentFrameSPtr == nullptr)
     {
         throw ostk::core::error::runtime::Undefined("Frame");
     }
 
-    const Weak<const Frame> frameWPtr = aParentFrameSPtr;
+    // The mounting orientation is fixed: its transform is built once, and only restamped with the queried instant
+    // by the provider. The frame holds its parent, so that the parent cannot expire before it.
 
-    const Shared<const DynamicProvider> transformProviderSPtr = std::make_shared<const DynamicProvider>(
-        [frameWPtr, aQuaternion](const Instant& anInstant) -> Transform
-        {
-            if (Shared<const Frame> frameSPtr = frameWPtr.lock())
-            {
-                return Transform::Passive(anInstant, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, aQuaternion, {0.0, 0.0, 0.0});
-            }
-            else
-            {
-                throw ostk::core::error::RuntimeError("Cannot get pointer to Profile.");
-            }
-        }
+    const Shared<const StaticProvider> transformProviderSPtr = std::make_shared<const StaticProvider>(
+        Transform::Passive(Instant::J2000(), {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, aQuaternion, {0.0, 0.0, 0.0})
     );
 
-    return Frame::Construct(aName, false, aParentFrameSPtr, transformProviderSPtr);
+    return (aFrameRegistrySPtr != nullptr)
+             ? aFrameRegistrySPtr->constructFrame(aName, false, aParentFrameSPtr, transformProviderSPtr)
+             : FrameRegistry::ConstructFrame(aName, false, aParentFrameSPtr, transformProviderSPtr);
 }
 
 void Component::print(std::ostream& anOutputStream, bool displayDecorators) const
@@ -16,15 +16,22 @@ namespace component
 
 Geometry::Geometry(const String& aName, const Composite& aComposite, const Shared<const Component>& aComponentSPtr)
     : name_(aName),
-      geometry_(ObjectGeometry::Undefined()),
+      geometrySPtr_(std::make_shared<ObjectGeometry>(ObjectGeometry::Undefined())),
       componentPtr_(aComponentSPtr)
 {
     if (componentPtr_ != nullptr)
     {
-        geometry_ = ObjectGeometry(aComposite, componentPtr_->accessFrame());
+        geometrySPtr_ = std::make_shared<ObjectGeometry>(aComposite, componentPtr_->accessFrame());
     }
 }
 
+Geometry::Geometry(const Geometry& aGeometry, const Shared<const Component>& aComponentSPtr)
+    : name_(aGeometry.name_),
+      geometrySPtr_(aGeometry.geometrySPtr_),
+      componentPtr_(aComponentSPtr)
+{
+}
+
 bool Geometry::operator==(const Geometry& aGeometry) const
 {
     if ((!this->isDefined()) || (!aGeometry.isDefined()))
@@ -32,7 +39,7 @@ bool Geometry::operator==(const Geometry& aGeometry) const
         return false;
     }
 
-    return (this->name_ == aGeometry.name_) && (this->geometry_ == aGeometry.geometry_) &&
+    return (this->name_ == aGeometry.name_) && (*this->geometrySPtr_ == *aGeometry.geometrySPtr_) &&
            (this->componentPtr_ == aGeometry.componentPtr_);
 }
 
@@ -45,7 +52,7 @@ std::ostream& operator<<(std::ostream& anOutputStream, const Geometry& aGeometry
 
 bool Geometry::isDefined() const
 {
-    return (!this->name_.isEmpty()) && this->geometry_.isDefined() && (this->componentPtr_ != nullptr);
+    return (!this->name_.isEmpty()) && this->geometrySPtr_->isDefined() && (this->componentPtr_ != nullptr);
 }
 
 const Component& Geometry::accessComponent() const
@@ -73,58 +80,124 @@ void Geometry::print(std::ostream& anOutputStream, bool displayDecorators) const
     displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "Geometry") : void();
 
     ostk::core::utils::Print::Line(anOutputStream) << "Name:" << this->getName();
-    ostk::core::utils::Print::Line(anOutputStream) << "Geometry:" << geometry_;
+    ostk::core::utils::Print::Line(anOutputStream) << "Geometry:" << *geometrySPtr_;
     ostk::core::utils::Print::Line(anOutputStream) << "Component:" << this->accessComponent();
 }
 
 bool Geometry::intersects(const ObjectGeometry& aGeometry) const
 {
-    using ostk::physics::time::Instant;
+    if ((!this->isDefined()) || (!aGeometry.isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Geometry");
+    }
+
+    const Simulator& simulator = this->accessComponent().accessSimulator();
+    const Instant instant = simulator.getInstant();
+
+    if (!instant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    return simulator.getGeometryInGCRF(*this).intersects(aGeometry.in(Frame::GCRF(), instant));
+}
+
+bool Geometry::intersects(const Celestial& aCelestialObject) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Geometry");
+    }
+
+    // Both geometries are cached in GCRF by the simulator, for all queries at its current instant
+
+    const Simulator& simulator = this->accessComponent().accessSimulator();
 
+    return simulator.getGeometryInGCRF(*this).intersects(simulator.getCelestialGeometryInGCRF(aCelestialObject));
+}
+
+bool Geometry::intersects(const ObjectGeometry& aGeometry, const Instant& anInstant) const
+{
     if ((!this->isDefined()) || (!aGeometry.isDefined()))
     {
         throw ostk::core::error::runtime::Undefined("Geometry");
     }
 
-    const Instant instant = this->accessComponent().accessSimulator().getInstant();
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
 
     // TBM: Why GCRF?
-    return this->getGeometryIn(Frame::GCRF()).intersects(aGeometry.in(Frame::GCRF(), instant));
+    return this->getGeometryIn(Frame::GCRF(), anInstant).intersects(aGeometry.in(Frame::GCRF(), anInstant));
 }
 
-bool Geometry::intersects(const Celestial& aCelestialObject) const
+bool Geometry::intersects(const Celestial& aCelestialObject, const Instant& anInstant) const
 {
-    return this->intersects(aCelestialObject.accessGeometry());
+    return this->intersects(aCelestialObject.accessGeometry(), anInstant);
 }
 
 bool Geometry::contains(const ObjectGeometry& aGeometry) const
 {
-    using ostk::physics::time::Instant;
+    if ((!this->isDefined()) || (!aGeometry.isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Geometry");
+    }
+
+    const Simulator& simulator = this->accessComponent().accessSimulator();
+    const Instant instant = simulator.getInstant();
+
+    if (!instant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    return simulator.getGeometryInGCRF(*this).contains(aGeometry.in(Frame::GCRF(), instant));
+}
+
+bool Geometry::contains(const Celestial& aCelestialObject) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Geometry");
+    }
 
+    // Both geometries are cached in GCRF by the simulator, for all queries at its current instant
+
+    const Simulator& simulator = this->accessComponent().accessSimulator();
+
+    return simulator.getGeometryInGCRF(*this).contains(simulator.getCelestialGeometryInGCRF(aCelestialObject));
+}
+
+bool Geometry::contains(const ObjectGeometry& aGeometry, const Instant& anInstant) const
+{
     if ((!this->isDefined()) || (!aGeometry.isDefined()))
     {
         throw ostk::core::error::runtime::Undefined("Geometry");
     }
 
-    const Instant instant = this->accessComponent().accessSimulator().getInstant();
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
 
     // TBM: Why GCRF?
-    return this->getGeometryIn(Frame::GCRF()).contains(aGeometry.in(Frame::GCRF(), instant));
+    return this->getGeometryIn(Frame::GCRF(), anInstant).contains(aGeometry.in(Frame::GCRF(), anInstant));
 }
 
-bool Geometry::contains(const Celestial& aCelestialObject) const
+bool Geometry::contains(const Celestial& aCelestialObject, const Instant& anInstant) const
 {
-    return this->contains(aCelestialObject.accessGeometry());
+    return this->contains(aCelestialObject.accessGeometry(), anInstant);
 }
 
 const Composite& Geometry::accessComposite() const
 {
-    return this->geometry_.accessComposite();
+    return this->geometrySPtr_->accessComposite();
 }
 
 Shared<const Frame> Geometry::accessFrame() const
 {
-    return this->geometry_.accessFrame();
+    return this->geometrySPtr_->accessFrame();
 }
 
 ObjectGeometry Geometry::getGeometryIn(const Shared<const Frame>& aFrameSPtr) const
@@ -134,27 +207,79 @@ ObjectGeometry Geometry::getGeometryIn(const Shared<const Frame>& aFrameSPtr) co
         throw ostk::core::error::runtime::Undefined("Geometry");
     }
 
-    return this->geometry_.in(aFrameSPtr, this->accessComponent().accessSimulator().getInstant());
+    const Simulator& simulator = this->accessComponent().accessSimulator();
+
+    // GCRF geometries are cached by the simulator, for all queries at its current instant
+
+    if ((aFrameSPtr != nullptr) && (*aFrameSPtr == *Frame::GCRF()))
+    {
+        return simulator.getGeometryInGCRF(*this);
+    }
+
+    return this->getGeometryIn(aFrameSPtr, simulator.getInstant());
+}
+
+ObjectGeometry Geometry::getGeometryIn(const Shared<const Frame>& aFrameSPtr, const Instant& anInstant) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Geometry");
+    }
+
+    return this->geometrySPtr_->in(aFrameSPtr, anInstant);
 }
 
 ObjectGeometry Geometry::intersectionWith(const ObjectGeometry& aGeometry) const
 {
-    using ostk::physics::time::Instant;
+    if ((!this->isDefined()) || (!aGeometry.isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Geometry");
+    }
+
+    const Simulator& simulator = this->accessComponent().accessSimulator();
+    const Instant instant = simulator.getInstant();
+
+    if (!instant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    return simulator.getGeometryInGCRF(*this).intersectionWith(aGeometry.in(Frame::GCRF(), instant));
+}
+
+ObjectGeometry Geometry::intersectionWith(const Celestial& aCelestialObject) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Geometry");
+    }
 
+    // Both geometries are cached in GCRF by the simulator, for all queries at its current instant
+
+    const Simulator& simulator = this->accessComponent().accessSimulator();
+
+    return simulator.getGeometryInGCRF(*this).intersectionWith(simulator.getCelestialGeometryInGCRF(aCelestialObject));
+}
+
+ObjectGeometry Geometry::intersectionWith(const ObjectGeometry& aGeometry, const Instant& anInstant) const
+{
     if ((!this->isDefined()) || (!aGeometry.isDefined()))
     {
         throw ostk::core::error::runtime::Undefined("Geometry");
     }
 
-    const Instant instant = this->accessComponent().accessSimulator().getInstant();
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
 
     // TBM: Why GCRF?
-    return this->getGeometryIn(Frame::GCRF()).intersectionWith(aGeometry.in(Frame::GCRF(), instant));
+    return this->getGeometryIn(Frame::GCRF(), anInstant).intersectionWith(aGeometry.in(Frame::GCRF(), anInstant));
 }
 
-ObjectGeometry Geometry::intersectionWith(const Celestial& aCelestialObject) const
+ObjectGeometry Geometry::intersectionWith(const Celestial& aCelestialObject, const Instant& anInstant) const
 {
-    return this->intersectionWith(aCelestialObject.accessGeometry());
+    return this->intersectionWith(aCelestialObject.accessGeometry(), anInstant);
 }
 
 Geometry Geometry::Undefined()
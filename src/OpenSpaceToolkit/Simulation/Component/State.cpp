@@ -67,6 +67,16 @@ State::Status State::getStatus() const
     return status_;
 }
 
+bool State::isVerbose() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State");
+    }
+
+    return verbose_;
+}
+
 State State::Undefined()
 {
     return {State::Status::Undefined};
@@ -0,0 +1,230 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Event/Behavior.hpp>
+
+#if defined(__cpp_impl_coroutine)
+
+#include <utility>
+
+#include <OpenSpaceToolkit/Simulation/Simulator.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace event
+{
+
+Behavior Behavior::promise_type::get_return_object()
+{
+    return {Handle::from_promise(*this)};
+}
+
+std::suspend_always Behavior::promise_type::initial_suspend() noexcept
+{
+    return {};
+}
+
+std::suspend_always Behavior::promise_type::final_suspend() noexcept
+{
+    return {};
+}
+
+void Behavior::promise_type::return_void() {}
+
+void Behavior::promise_type::unhandled_exception()
+{
+    exceptionPtr = std::current_exception();
+}
+
+Behavior::WaitAwaiter::WaitAwaiter(const Instant& anInstant, const Duration& aDuration)
+    : instant_(anInstant),
+      duration_(aDuration)
+{
+}
+
+bool Behavior::WaitAwaiter::await_ready() const noexcept
+{
+    return false;
+}
+
+void Behavior::WaitAwaiter::await_suspend(Handle aHandle) const
+{
+    const Simulator& simulator = Behavior::AccessSimulator(aHandle);
+
+    Behavior::SuspendUntil(aHandle, instant_.isDefined() ? instant_ : (simulator.getInstant() + duration_));
+}
+
+void Behavior::WaitAwaiter::await_resume() const noexcept {}
+
+Behavior::CrossingAwaiter::CrossingAwaiter(
+    const Detector& aDetector, const Interval& anInterval, const Duration& aStep
+)
+    : detector_(aDetector),
+      interval_(anInterval),
+      step_(aStep),
+      crossing_({Instant::Undefined(), Detector::Crossing::Type::Entry})
+{
+}
+
+bool Behavior::CrossingAwaiter::await_ready() const noexcept
+{
+    return false;
+}
+
+void Behavior::CrossingAwaiter::await_suspend(Handle aHandle)
+{
+    const Instant instant = Behavior::AccessSimulator(aHandle).getInstant();
+
+    if (interval_.accessEnd() < instant)
+    {
+        throw ostk::core::error::RuntimeError(
+            "Cannot wait for a crossing until [{}], before simulation instant [{}].",
+            interval_.accessEnd().toString(),
+            instant.toString()
+        );
+    }
+
+    const Instant startInstant = (interval_.accessStart() < instant) ? instant : interval_.accessStart();
+
+    const Array<Detector::Crossing> crossings =
+        detector_.computeCrossings(Interval::Closed(startInstant, interval_.accessEnd()), step_);
+
+    if (!crossings.isEmpty())
+    {
+        crossing_ = crossings.accessFirst();
+    }
+
+    Behavior::SuspendUntil(aHandle, crossing_.instant.isDefined() ? crossing_.instant : interval_.accessEnd());
+}
+
+Detector::Crossing Behavior::CrossingAwaiter::await_resume() const noexcept
+{
+    return crossing_;
+}
+
+Behavior::Behavior(Behavior&& aBehavior) noexcept
+    : handle_(std::exchange(aBehavior.handle_, nullptr))
+{
+}
+
+Behavior::~Behavior()
+{
+    if (handle_)
+    {
+        handle_.destroy();
+    }
+}
+
+Behavior& Behavior::operator=(Behavior&& aBehavior) noexcept
+{
+    if (this != &aBehavior)
+    {
+        if (handle_)
+        {
+            handle_.destroy();
+        }
+
+        handle_ = std::exchange(aBehavior.handle_, nullptr);
+    }
+
+    return *this;
+}
+
+bool Behavior::isDefined() const
+{
+    return static_cast<bool>(handle_);
+}
+
+bool Behavior::isDone() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Behavior");
+    }
+
+    return handle_.done();
+}
+
+Behavior::WaitAwaiter Behavior::WaitFor(const Duration& aDuration)
+{
+    if (!aDuration.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Duration");
+    }
+
+    if (!aDuration.isPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Duration");
+    }
+
+    return {Instant::Undefined(), aDuration};
+}
+
+Behavior::WaitAwaiter Behavior::WaitUntil(const Instant& anInstant)
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    return {anInstant, Duration::Undefined()};
+}
+
+Behavior::CrossingAwaiter Behavior::WaitForCrossing(
+    const Detector& aDetector, const Interval& anInterval, const Duration& aStep
+)
+{
+    if (!aDetector.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Detector");
+    }
+
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    return {aDetector, anInterval, aStep};
+}
+
+Behavior::Behavior(const Handle& aHandle)
+    : handle_(aHandle)
+{
+}
+
+Behavior::promise_type& Behavior::accessPromise() const
+{
+    return handle_.promise();
+}
+
+void Behavior::resume()
+{
+    handle_.resume();
+}
+
+Simulator& Behavior::AccessSimulator(const Handle& aHandle)
+{
+    if (aHandle.promise().simulatorPtr == nullptr)
+    {
+        throw ostk::core::error::RuntimeError("Cannot suspend a Behavior not started by a Simulator.");
+    }
+
+    return *aHandle.promise().simulatorPtr;
+}
+
+void Behavior::SuspendUntil(const Handle& aHandle, const Instant& anInstant)
+{
+    promise_type& promise = aHandle.promise();
+
+    promise.eventId = Behavior::AccessSimulator(aHandle).scheduleBehaviorResumption(promise.id, anInstant);
+    promise.hasPendingEvent = true;
+}
+
+}  // namespace event
+}  // namespace simulation
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,655 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <OpenSpaceToolkit/Simulation/Event/Detector.hpp>
+
+#include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Ellipsoid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Pyramid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Sphere.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace event
+{
+
+using ostk::core::container::Map;
+using ostk::core::type::Index;
+
+using ostk::mathematics::geometry::d3::object::Composite;
+using ostk::mathematics::geometry::d3::object::Ellipsoid;
+using ostk::mathematics::geometry::d3::object::Point;
+using ostk::mathematics::geometry::d3::object::Pyramid;
+using ostk::mathematics::geometry::d3::object::Sphere;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+
+namespace
+{
+
+// Safety factor applied to the safe step, absorbing the variation of angular rates over the step
+constexpr double safeStepFactor = 0.5;
+
+// Duration over which angular and depth rates are estimated by finite differences
+const Duration rateProbeDuration = Duration::Seconds(1.0);
+
+/// Configuration of a field of view and a target, seen from the field of view apex.
+struct Configuration
+{
+    Vector3d boresight;          ///< Field of view axis.
+    Vector3d lineOfSight;        ///< Direction from the apex to the target center.
+    double innerHalfAngle;       ///< Half-angle of the cone inscribed in the field of view [rad].
+    double outerHalfAngle;       ///< Half-angle of the cone circumscribed to the field of view [rad].
+    double targetAngularRadius;  ///< Angular radius of the target bounding sphere [rad].
+    double baseDepth;            ///< Distance from the apex to the base plane of the field of view [m].
+    double targetDepth;          ///< Distance from the apex to the target center, along the base normal [m].
+    double targetRadius;         ///< Radius of the target bounding sphere [m].
+};
+
+double AngleBetween(const Vector3d& aFirstDirection, const Vector3d& aSecondDirection)
+{
+    return std::atan2(aFirstDirection.cross(aSecondDirection).norm(), aFirstDirection.dot(aSecondDirection));
+}
+
+bool ComputeBoundingSphere(const Composite& aComposite, Vector3d& aCenter, double& aRadius)
+{
+    if (aComposite.getObjectCount() != 1)
+    {
+        return false;
+    }
+
+    const auto& object = aComposite.accessObjectAt(0);
+
+    if (object.is<Ellipsoid>())
+    {
+        const Ellipsoid& ellipsoid = object.as<Ellipsoid>();
+
+        aCenter = ellipsoid.getCenter().asVector();
+        aRadius = std::max(
+            {ellipsoid.getFirstPrincipalSemiAxis(),
+             ellipsoid.getSecondPrincipalSemiAxis(),
+             ellipsoid.getThirdPrincipalSemiAxis()}
+        );
+
+        return true;
+    }
+
+    if (object.is<Sphere>())
+    {
+        const Sphere& sphere = object.as<Sphere>();
+
+        aCenter = sphere.getCenter().asVector();
+        aRadius = sphere.getRadius();
+
+        return true;
+    }
+
+    if (object.is<Point>())
+    {
+        aCenter = object.as<Point>().asVector();
+        aRadius = 0.0;
+
+        return true;
+    }
+
+    return false;
+}
+
+bool ComputeConfiguration(const Composite& aFieldOfView, const Composite& aTarget, Configuration& aConfiguration)
+{
+    if ((aFieldOfView.getObjectCount() != 1) || (!aFieldOfView.accessObjectAt(0).is<Pyramid>()))
+    {
+        return false;
+    }
+
+    const Pyramid& pyramid = aFieldOfView.accessObjectAt(0).as<Pyramid>();
+
+    const Vector3d apex = pyramid.accessApex().asVector();
+    const Array<Point> vertices = pyramid.accessBase().getVertices();
+
+    if (vertices.getSize() < 3)
+    {
+        return false;
+    }
+
+    // Edge directions of the pyramid, and a boresight strictly inside it (the pyramid being convex)
+
+    Array<Vector3d> edgeDirections = Array<Vector3d>::Empty();
+    edgeDirections.reserve(vertices.getSize());
+
+    Vector3d boresight = Vector3d::Zero();
+
+    for (const auto& vertex : vertices)
+    {
+        const Vector3d edgeDirection = (vertex.asVector() - apex).normalized();
+
+        edgeDirections.add(edgeDirection);
+        boresight += edgeDirection;
+    }
+
+    boresight.normalize();
+
+    // The circumscribed cone reaches the farthest edge, the inscribed cone the nearest face plane
+
+    double innerHalfAngle = std::numeric_limits<double>::max();
+    double outerHalfAngle = 0.0;
+
+    for (Index edgeIndex = 0; edgeIndex < edgeDirections.getSize(); ++edgeIndex)
+    {
+        const Vector3d& edgeDirection = edgeDirections[edgeIndex];
+        const Vector3d& nextEdgeDirection = edgeDirections[(edgeIndex + 1) % edgeDirections.getSize()];
+
+        const Vector3d faceNormal = edgeDirection.cross(nextEdgeDirection).normalized();
+
+        innerHalfAngle = std::min(innerHalfAngle, std::asin(std::min(1.0, std::abs(boresight.dot(faceNormal)))));
+        outerHalfAngle = std::max(outerHalfAngle, AngleBetween(boresight, edgeDirection));
+    }
+
+    // The base is planar: its normal, oriented away from the apex, bounds the field of view in depth
+
+    Vector3d baseNormal = (vertices[1].asVector() - vertices[0].asVector())
+                              .cross(vertices[2].asVector() - vertices[0].asVector())
+                              .normalized();
+
+    if (baseNormal.dot(boresight) < 0.0)
+    {
+        baseNormal = -baseNormal;
+    }
+
+    const double baseDepth = baseNormal.dot(vertices[0].asVector() - apex);
+
+    Vector3d targetCenter = Vector3d::Zero();
+    double targetRadius = 0.0;
+
+    if (!ComputeBoundingSphere(aTarget, targetCenter, targetRadius))
+    {
+        return false;
+    }
+
+    const Vector3d apexToTarget = targetCenter - apex;
+    const double targetDistance = apexToTarget.norm();
+
+    // The bounding sphere encloses the apex: no angular model applies
+
+    if (targetDistance <= targetRadius)
+    {
+        return false;
+    }
+
+    aConfiguration = {
+        boresight,
+        apexToTarget / targetDistance,
+        innerHalfAngle,
+        outerHalfAngle,
+        std::asin(targetRadius / targetDistance),
+        baseDepth,
+        baseNormal.dot(apexToTarget),
+        targetRadius
+    };
+
+    return true;
+}
+
+double ComputeTargetAngle(const Configuration& aConfiguration, const bool isContainment)
+{
+    // Intersection depends on the nearest point of the target, containment on the farthest one
+
+    const double offAxisAngle = AngleBetween(aConfiguration.boresight, aConfiguration.lineOfSight);
+
+    return isContainment ? (offAxisAngle + aConfiguration.targetAngularRadius)
+                         : (offAxisAngle - aConfiguration.targetAngularRadius);
+}
+
+double ComputeAngularMargin(const Configuration& aConfiguration, const bool isContainment)
+{
+    const double targetAngle = ComputeTargetAngle(aConfiguration, isContainment);
+
+    if (targetAngle < aConfiguration.innerHalfAngle)
+    {
+        return aConfiguration.innerHalfAngle - targetAngle;
+    }
+
+    if (targetAngle > aConfiguration.outerHalfAngle)
+    {
+        return targetAngle - aConfiguration.outerHalfAngle;
+    }
+
+    return 0.0;
+}
+
+double ComputeDepthMarginInside(const Configuration& aConfiguration)
+{
+    // Positive while the whole target lies on the apex side of the base plane
+
+    return aConfiguration.baseDepth - (aConfiguration.targetDepth + aConfiguration.targetRadius);
+}
+
+double ComputeDepthMarginOutside(const Configuration& aConfiguration, const bool isContainment)
+{
+    // Positive while the target lies beyond the base plane: entirely for intersection, partly for containment
+
+    const double targetDepth = isContainment ? (aConfiguration.targetDepth + aConfiguration.targetRadius)
+                                             : (aConfiguration.targetDepth - aConfiguration.targetRadius);
+
+    return targetDepth - aConfiguration.baseDepth;
+}
+
+double ComputeSafeStepInSeconds(const double aMargin, const double aRateBound)
+{
+    if (aMargin <= 0.0)
+    {
+        return 0.0;
+    }
+
+    if (aRateBound <= 0.0)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    return safeStepFactor * aMargin / aRateBound;
+}
+
+Array<Interval> WindowsFromCrossings(
+    const Interval& anInterval, const Array<Detector::Crossing>& aCrossingArray, const bool isInsideAtStart
+)
+{
+    Array<Interval> windows = Array<Interval>::Empty();
+
+    bool isInside = isInsideAtStart;
+    Instant windowStart = isInside ? anInterval.getStart() : Instant::Undefined();
+
+    for (const auto& crossing : aCrossingArray)
+    {
+        if (crossing.type == Detector::Crossing::Type::Entry)
+        {
+            windowStart = crossing.instant;
+        }
+        else
+        {
+            windows.add(Interval::Closed(windowStart, crossing.instant));
+        }
+
+        isInside = (crossing.type == Detector::Crossing::Type::Entry);
+    }
+
+    if (isInside)
+    {
+        windows.add(Interval::Closed(windowStart, anInterval.getEnd()));
+    }
+
+    return windows;
+}
+
+}  // namespace
+
+Detector::Detector(
+    const Shared<const Geometry>& aGeometrySPtr, const ObjectGeometry& aTargetGeometry, const Predicate& aPredicate
+)
+    : geometrySPtr_(aGeometrySPtr),
+      target_(aTargetGeometry),
+      predicate_(aPredicate)
+{
+}
+
+Detector::Detector(
+    const Shared<const Geometry>& aGeometrySPtr, const Celestial& aCelestialObject, const Predicate& aPredicate
+)
+    : Detector(aGeometrySPtr, aCelestialObject.accessGeometry(), aPredicate)
+{
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const Detector& aDetector)
+{
+    aDetector.print(anOutputStream, true);
+
+    return anOutputStream;
+}
+
+bool Detector::isDefined() const
+{
+    return (this->geometrySPtr_ != nullptr) && this->geometrySPtr_->isDefined() && this->target_.isDefined() &&
+           (this->predicate_ != Detector::Predicate::Undefined);
+}
+
+const Geometry& Detector::accessGeometry() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Detector");
+    }
+
+    return *(this->geometrySPtr_);
+}
+
+const ObjectGeometry& Detector::accessTarget() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Detector");
+    }
+
+    return this->target_;
+}
+
+Detector::Predicate Detector::getPredicate() const
+{
+    return this->predicate_;
+}
+
+bool Detector::evaluateAt(const Instant& anInstant) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Detector");
+    }
+
+    switch (this->predicate_)
+    {
+        case Detector::Predicate::Intersects:
+            return this->geometrySPtr_->intersects(this->target_, anInstant);
+
+        case Detector::Predicate::Contains:
+            return this->geometrySPtr_->contains(this->target_, anInstant);
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Predicate");
+    }
+}
+
+Array<Detector::Crossing> Detector::computeCrossings(
+    const Interval& anInterval, const Duration& aStep, const Duration& aTolerance
+) const
+{
+    bool startValue = false;
+
+    return this->findCrossings(anInterval, aStep, aStep, aTolerance, startValue);
+}
+
+Array<Detector::Crossing> Detector::computeCrossingsAdaptively(
+    const Interval& anInterval, const Duration& aMinimumStep, const Duration& aMaximumStep, const Duration& aTolerance
+) const
+{
+    bool startValue = false;
+
+    return this->findCrossings(anInterval, aMinimumStep, aMaximumStep, aTolerance, startValue);
+}
+
+Array<Interval> Detector::computeWindows(
+    const Interval& anInterval, const Duration& aStep, const Duration& aTolerance
+) const
+{
+    bool isInside = false;
+
+    const Array<Detector::Crossing> crossings = this->findCrossings(anInterval, aStep, aStep, aTolerance, isInside);
+
+    return WindowsFromCrossings(anInterval, crossings, isInside);
+}
+
+Array<Interval> Detector::computeWindowsAdaptively(
+    const Interval& anInterval, const Duration& aMinimumStep, const Duration& aMaximumStep, const Duration& aTolerance
+) const
+{
+    bool isInside = false;
+
+    const Array<Detector::Crossing> crossings =
+        this->findCrossings(anInterval, aMinimumStep, aMaximumStep, aTolerance, isInside);
+
+    return WindowsFromCrossings(anInterval, crossings, isInside);
+}
+
+Duration Detector::computeSafeStepAt(const Instant& anInstant) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Detector");
+    }
+
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    const Instant probeInstant = anInstant + rateProbeDuration;
+
+    Configuration configuration;
+    Configuration probeConfiguration;
+
+    const bool isSupported =
+        ComputeConfiguration(
+            this->geometrySPtr_->getGeometryIn(Frame::GCRF(), anInstant).accessComposite(),
+            this->target_.in(Frame::GCRF(), anInstant).accessComposite(),
+            configuration
+        ) &&
+        ComputeConfiguration(
+            this->geometrySPtr_->getGeometryIn(Frame::GCRF(), probeInstant).accessComposite(),
+            this->target_.in(Frame::GCRF(), probeInstant).accessComposite(),
+            probeConfiguration
+        );
+
+    if (!isSupported)
+    {
+        return Duration::Zero();
+    }
+
+    const bool isContainment = (this->predicate_ == Detector::Predicate::Contains);
+
+    const double targetAngle = ComputeTargetAngle(configuration, isContainment);
+
+    // The rate of the off-axis angle is bounded by the sum of the boresight and line of sight rates
+
+    const double angularRateBound =
+        (AngleBetween(configuration.boresight, probeConfiguration.boresight) +
+         AngleBetween(configuration.lineOfSight, probeConfiguration.lineOfSight) +
+         std::abs(probeConfiguration.targetAngularRadius - configuration.targetAngularRadius)) /
+        rateProbeDuration.inSeconds();
+
+    const double angularStep =
+        ComputeSafeStepInSeconds(ComputeAngularMargin(configuration, isContainment), angularRateBound);
+
+    // The field of view is bounded in depth by its base plane: the depth margins move at the range rate of the
+    // target along the base normal
+
+    const double depthMarginInside = ComputeDepthMarginInside(configuration);
+    const double depthMarginOutside = ComputeDepthMarginOutside(configuration, isContainment);
+
+    const double depthRateBound =
+        std::abs(ComputeDepthMarginInside(probeConfiguration) - depthMarginInside) / rateProbeDuration.inSeconds();
+
+    const double depthStepInside = ComputeSafeStepInSeconds(depthMarginInside, depthRateBound);
+    const double depthStepOutside = ComputeSafeStepInSeconds(depthMarginOutside, depthRateBound);
+
+    // The depth bounds are checked against the predicate itself, as some geometries are not bounded by the base
+    // plane: they only ever shorten the angular step
+
+    const bool value = this->evaluateAt(anInstant);
+
+    double safeStep = 0.0;
+
+    if (targetAngle > configuration.outerHalfAngle)
+    {
+        safeStep = value ? 0.0 : angularStep;
+    }
+    else if (targetAngle < configuration.innerHalfAngle)
+    {
+        if (!value)
+        {
+            // Outside through the base plane only: the minimum step applies unless the target lies beyond it
+
+            safeStep = std::min(angularStep, depthStepOutside);
+        }
+        else if (depthMarginInside > 0.0)
+        {
+            // Inside as long as both the angular and the depth margins hold
+
+            safeStep = std::min(angularStep, depthStepInside);
+        }
+        else if (depthMarginOutside > 0.0)
+        {
+            // Inside while beyond the base plane: the geometry is not bounded in depth
+
+            safeStep = angularStep;
+        }
+    }
+
+    if (safeStep <= 0.0)
+    {
+        return Duration::Zero();
+    }
+
+    if (std::isinf(safeStep))
+    {
+        return Duration::Undefined();
+    }
+
+    return Duration::Seconds(safeStep);
+}
+
+void Detector::print(std::ostream& anOutputStream, bool displayDecorators) const
+{
+    displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "Detector") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Geometry:" << (this->isDefined() ? this->geometrySPtr_->getName() : String("Undefined"));
+    ostk::core::utils::Print::Line(anOutputStream) << "Predicate:" << Detector::StringFromPredicate(this->predicate_);
+
+    displayDecorators ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+Detector Detector::Undefined()
+{
+    return {nullptr, ObjectGeometry::Undefined(), Detector::Predicate::Undefined};
+}
+
+String Detector::StringFromPredicate(const Detector::Predicate& aPredicate)
+{
+    static const Map<Detector::Predicate, String> predicateStringMap = {
+        {Detector::Predicate::Undefined, "Undefined"},
+        {Detector::Predicate::Intersects, "Intersects"},
+        {Detector::Predicate::Contains, "Contains"}
+    };
+
+    return predicateStringMap.at(aPredicate);
+}
+
+Array<Detector::Crossing> Detector::findCrossings(
+    const Interval& anInterval,
+    const Duration& aMinimumStep,
+    const Duration& aMaximumStep,
+    const Duration& aTolerance,
+    bool& aStartValue
+) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Detector");
+    }
+
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if ((!aMinimumStep.isDefined()) || (!aMinimumStep.isStrictlyPositive()))
+    {
+        throw ostk::core::error::runtime::Wrong("Step");
+    }
+
+    if ((!aMaximumStep.isDefined()) || (aMaximumStep < aMinimumStep))
+    {
+        throw ostk::core::error::runtime::Wrong("Maximum step");
+    }
+
+    if ((!aTolerance.isDefined()) || (!aTolerance.isStrictlyPositive()))
+    {
+        throw ostk::core::error::runtime::Wrong("Tolerance");
+    }
+
+    Array<Detector::Crossing> crossings = Array<Detector::Crossing>::Empty();
+
+    const Instant endInstant = anInterval.getEnd();
+
+    Instant previousInstant = anInterval.getStart();
+    bool previousValue = this->evaluateAt(previousInstant);
+
+    aStartValue = previousValue;
+
+    while (previousInstant < endInstant)
+    {
+        const Duration step = this->computeStepAt(previousInstant, aMinimumStep, aMaximumStep);
+        const Instant nextInstant = std::min(previousInstant + step, endInstant);
+        const bool nextValue = this->evaluateAt(nextInstant);
+
+        if (nextValue != previousValue)
+        {
+            crossings.add(this->refineCrossing(previousInstant, nextInstant, previousValue, aTolerance));
+        }
+
+        previousInstant = nextInstant;
+        previousValue = nextValue;
+    }
+
+    return crossings;
+}
+
+Duration Detector::computeStepAt(
+    const Instant& anInstant, const Duration& aMinimumStep, const Duration& aMaximumStep
+) const
+{
+    if (aMinimumStep == aMaximumStep)
+    {
+        return aMinimumStep;
+    }
+
+    const Duration safeStep = this->computeSafeStepAt(anInstant);
+
+    if (!safeStep.isDefined())
+    {
+        return aMaximumStep;
+    }
+
+    return std::clamp(safeStep, aMinimumStep, aMaximumStep);
+}
+
+Detector::Crossing Detector::refineCrossing(
+    const Instant& aLowerInstant, const Instant& anUpperInstant, const bool aLowerValue, const Duration& aTolerance
+) const
+{
+    // The predicate is boolean: bisection is the optimal bracketing scheme, as no derivative or
+    // interpolation information is available.
+
+    Instant lowerInstant = aLowerInstant;
+    Instant upperInstant = anUpperInstant;
+
+    while ((upperInstant - lowerInstant) > aTolerance)
+    {
+        const Instant midInstant = lowerInstant + ((upperInstant - lowerInstant) / 2.0);
+
+        if (this->evaluateAt(midInstant) == aLowerValue)
+        {
+            lowerInstant = midInstant;
+        }
+        else
+        {
+            upperInstant = midInstant;
+        }
+    }
+
+    return {upperInstant, aLowerValue ? Detector::Crossing::Type::Exit : Detector::Crossing::Type::Entry};
+}
+
+}  // namespace event
+}  // namespace simulation
+}  // namespace ostk
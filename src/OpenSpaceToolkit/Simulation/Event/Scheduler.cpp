@@ -0,0 +1,118 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Event/Scheduler.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace event
+{
+
+Scheduler::Scheduler()
+    : queue_(),
+      pendingEventIds_(),
+      nextEventId_(0)
+{
+}
+
+bool Scheduler::isEmpty() const
+{
+    return this->pendingEventIds_.empty();
+}
+
+Size Scheduler::getEventCount() const
+{
+    return this->pendingEventIds_.size();
+}
+
+Instant Scheduler::getNextInstant() const
+{
+    if (this->isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Event");
+    }
+
+    return this->queue_.top().instant;
+}
+
+Index Scheduler::schedule(const Instant& anInstant, const Callback& aCallback)
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!aCallback)
+    {
+        throw ostk::core::error::runtime::Undefined("Callback");
+    }
+
+    const Index eventId = this->nextEventId_++;
+
+    this->queue_.push({eventId, anInstant, aCallback});
+    this->pendingEventIds_.insert(eventId);
+
+    return eventId;
+}
+
+void Scheduler::cancel(const Index& anEventId)
+{
+    if (this->pendingEventIds_.erase(anEventId) == 0)
+    {
+        throw ostk::core::error::RuntimeError("No pending Event found with id [{}].", anEventId);
+    }
+
+    this->discardCancelledEvents();
+}
+
+Scheduler::Event Scheduler::pop()
+{
+    if (this->isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Event");
+    }
+
+    Event event = this->queue_.top();
+
+    this->queue_.pop();
+    this->pendingEventIds_.erase(event.id);
+
+    this->discardCancelledEvents();
+
+    return event;
+}
+
+void Scheduler::clear()
+{
+    this->queue_ = {};
+    this->pendingEventIds_.clear();
+}
+
+bool Scheduler::EventComparator::operator()(const Event& aFirstEvent, const Event& aSecondEvent) const
+{
+    // std::priority_queue pops the greatest element: order by decreasing instant, then by decreasing id
+
+    if (aFirstEvent.instant != aSecondEvent.instant)
+    {
+        return aFirstEvent.instant > aSecondEvent.instant;
+    }
+
+    return aFirstEvent.id > aSecondEvent.id;
+}
+
+void Scheduler::discardCancelledEvents()
+{
+    // Cancelled events are removed lazily, keeping the top of the queue pending at all times
+
+    while ((!this->queue_.empty()) && (this->pendingEventIds_.count(this->queue_.top().id) == 0))
+    {
+        this->queue_.pop();
+    }
+}
+
+}  // namespace event
+}  // namespace simulation
+}  // namespace ostk
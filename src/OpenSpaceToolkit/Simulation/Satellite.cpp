@@ -1,22 +1,28 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <thread>
+
 #include <OpenSpaceToolkit/Simulation/Satellite.hpp>
+#include <OpenSpaceToolkit/Simulation/Satellite/FrameProvider.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator.hpp>
 #include <OpenSpaceToolkit/Simulation/Utility/Identifier.hpp>
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
-#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider.hpp>
-#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/Dynamic.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/Profile/Model.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Flight/Profile/Model/Tabulated.hpp>
 
 namespace ostk
 {
 namespace simulation
 {
 
-using ostk::physics::coordinate::frame::Provider;
-using ostk::physics::coordinate::Transform;
-using DynamicProvider = ostk::physics::coordinate::frame::provider::Dynamic;
+using ProfileModel = ostk::astrodynamics::flight::profile::Model;
+using TabulatedProfileModel = ostk::astrodynamics::flight::profile::model::Tabulated;
+
+using ostk::simulation::satellite::FrameProvider;
 
 using namespace ostk::simulation::utility;
 
@@ -28,7 +34,8 @@ Satellite::Satellite(
     const Array<Shared<Component>>& aComponentArray,
     const Shared<const Frame>& aFrameSPtr,
     const Shared<const Profile>& aProfileSPtr,
-    const Shared<const Simulator>& aSimulatorSPtr
+    const Shared<const Simulator>& aSimulatorSPtr,
+    const Shared<const Ephemeris>& anEphemerisSPtr
 )
     : Component(
           anId,
@@ -41,13 +48,15 @@ Satellite::Satellite(
           aFrameSPtr,
           aSimulatorSPtr
       ),
-      profileSPtr_(aProfileSPtr)
+      profileSPtr_(aProfileSPtr),
+      ephemerisSPtr_(anEphemerisSPtr)
 {
 }
 
 Satellite::Satellite(const Satellite& aSatellite)
     : Component(aSatellite),
-      profileSPtr_(aSatellite.profileSPtr_)
+      profileSPtr_(aSatellite.profileSPtr_),
+      ephemerisSPtr_(aSatellite.ephemerisSPtr_)
 {
 }
 
@@ -80,6 +89,112 @@ const Shared<const Profile> Satellite::accessProfile() const
     return this->profileSPtr_;
 }
 
+const Shared<const Ephemeris> Satellite::accessEphemeris() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Satellite");
+    }
+
+    return this->ephemerisSPtr_;
+}
+
+bool Satellite::hasStateAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Satellite");
+    }
+
+    if ((this->ephemerisSPtr_ != nullptr) && this->ephemerisSPtr_->contains(anInstant))
+    {
+        return true;
+    }
+
+    if ((this->profileSPtr_ == nullptr) || (!this->profileSPtr_->isDefined()))
+    {
+        return false;
+    }
+
+    const ProfileModel& profileModel = this->profileSPtr_->accessModel();
+
+    return (!profileModel.is<TabulatedProfileModel>()) ||
+           profileModel.as<TabulatedProfileModel>().getInterval().contains(anInstant);
+}
+
+TrajectoryState Satellite::getStateAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Satellite");
+    }
+
+    if ((this->ephemerisSPtr_ != nullptr) && this->ephemerisSPtr_->contains(anInstant))
+    {
+        return this->ephemerisSPtr_->getStateAt(anInstant);
+    }
+
+    if (this->profileSPtr_ == nullptr)
+    {
+        throw ostk::core::error::runtime::Undefined("Profile");
+    }
+
+    return this->profileSPtr_->getStateAt(anInstant).inFrame(Frame::GCRF());
+}
+
+Array<TrajectoryState> Satellite::getStatesAt(const Array<Instant>& anInstantArray) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Satellite");
+    }
+
+    if (this->profileSPtr_ == nullptr)
+    {
+        throw ostk::core::error::runtime::Undefined("Profile");
+    }
+
+    if ((this->ephemerisSPtr_ != nullptr) &&
+        std::all_of(
+            anInstantArray.begin(),
+            anInstantArray.end(),
+            [this](const Instant& anInstant)
+            {
+                return anInstant.isDefined() && this->ephemerisSPtr_->contains(anInstant);
+            }
+        ))
+    {
+        Array<TrajectoryState> states = Array<TrajectoryState>::Empty();
+        states.reserve(anInstantArray.getSize());
+
+        for (const auto& instant : anInstantArray)
+        {
+            states.add(this->ephemerisSPtr_->getStateAt(instant));
+        }
+
+        return states;
+    }
+
+    Array<TrajectoryState> states = this->profileSPtr_->getStatesAt(anInstantArray);
+
+    for (auto& state : states)
+    {
+        state = state.inFrame(Frame::GCRF());
+    }
+
+    return states;
+}
+
 void Satellite::print(std::ostream& anOutputStream, bool displayDecorators) const
 {
     displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "Satellite") : void();
@@ -104,20 +219,77 @@ Satellite Satellite::Undefined()
 }
 
 Shared<Satellite> Satellite::Configure(
-    const SatelliteConfiguration& aSatelliteConfiguration, const Shared<const Simulator>& aSimulatorSPtr
+    const SatelliteConfiguration& aSatelliteConfiguration,
+    const Shared<const Simulator>& aSimulatorSPtr,
+    const Shared<ThreadPool>& aThreadPoolSPtr
 )
 {
     const Shared<const Profile> profileSPtr = std::make_shared<Profile>(aSatelliteConfiguration.profile);
 
+    const EphemerisConfiguration& ephemerisConfiguration = aSatelliteConfiguration.ephemeris;
+
+    Shared<const Ephemeris> ephemerisSPtr = nullptr;
+
+    // Sampling threads are only spawned if no pool is given
+
+    const auto accessThreadPool = [&aThreadPoolSPtr, &ephemerisConfiguration]() -> Shared<ThreadPool>
+    {
+        if (aThreadPoolSPtr != nullptr)
+        {
+            return aThreadPoolSPtr;
+        }
+
+        return std::make_shared<ThreadPool>(
+            (ephemerisConfiguration.threadCount == 0) ? std::max<Size>(1, std::thread::hardware_concurrency())
+                                                      : ephemerisConfiguration.threadCount
+        );
+    };
+
+    if (ephemerisConfiguration.interval.isDefined() && (ephemerisConfiguration.type == Ephemeris::Type::Chebyshev))
+    {
+        ephemerisSPtr = std::make_shared<const Ephemeris>(Ephemeris::Fit(
+            *profileSPtr,
+            ephemerisConfiguration.interval,
+            ephemerisConfiguration.step,
+            ephemerisConfiguration.degree,
+            ephemerisConfiguration.positionTolerance,
+            ephemerisConfiguration.attitudeTolerance,
+            *accessThreadPool()
+        ));
+    }
+    else if (ephemerisConfiguration.interval.isDefined())
+    {
+        ephemerisSPtr = std::make_shared<const Ephemeris>(Ephemeris::Generate(
+            *profileSPtr,
+            ephemerisConfiguration.interval,
+            ephemerisConfiguration.step,
+            ephemerisConfiguration.positionTolerance,
+            ephemerisConfiguration.attitudeTolerance,
+            *accessThreadPool()
+        ));
+    }
+
+    // Frames are registered with the simulator, if any, rather than globally
+
+    const Shared<FrameRegistry> frameRegistrySPtr =
+        ((aSimulatorSPtr != nullptr) && aSimulatorSPtr->isDefined()) ? aSimulatorSPtr->accessFrameRegistry() : nullptr;
+
     const Shared<Satellite> satelliteSPtr = std::make_shared<Satellite>(
         aSatelliteConfiguration.id,
         aSatelliteConfiguration.name,
         aSatelliteConfiguration.tags,
         Array<Shared<Geometry>>::Empty(),
         Array<Shared<Component>>::Empty(),
-        Satellite::GenerateFrame(String::Format("Satellite [{}]", aSatelliteConfiguration.id), profileSPtr),
+        Satellite::GenerateFrame(
+            String::Format("Satellite [{}]", aSatelliteConfiguration.id),
+            profileSPtr,
+            8,
+            ephemerisSPtr,
+            frameRegistrySPtr
+        ),
         profileSPtr,
-        aSimulatorSPtr
+        aSimulatorSPtr,
+        ephemerisSPtr
     );
 
     for (const auto& geometryConfiguration : aSatelliteConfiguration.geometries)
@@ -133,40 +305,20 @@ Shared<Satellite> Satellite::Configure(
     return satelliteSPtr;
 }
 
-Shared<const Frame> Satellite::GenerateFrame(const String& aName, const Shared<const Profile>& aProfileSPtr)
+Shared<const Frame> Satellite::GenerateFrame(
+    const String& aName,
+    const Shared<const Profile>& aProfileSPtr,
+    const Size aMemoCapacity,
+    const Shared<const Ephemeris>& anEphemerisSPtr,
+    const Shared<FrameRegistry>& aFrameRegistrySPtr
+)
 {
-    using ostk::physics::time::Instant;
-
-    if (Frame::Exists(aName))
-    {
-        Frame::Destruct(aName);
-    }
-
-    const Weak<const Profile> profileWPtr = aProfileSPtr;
-
-    const Shared<const DynamicProvider> transformProviderSPtr = std::make_shared<const DynamicProvider>(
-        [profileWPtr](const Instant& anInstant) -> Transform
-        {
-            if (Shared<const Profile> profileSPtr = profileWPtr.lock())
-            {
-                const auto& state = profileSPtr->getStateAt(anInstant).inFrame(Frame::GCRF());
-
-                return Transform::Passive(
-                    anInstant,
-                    -state.getPosition().getCoordinates(),
-                    -state.getVelocity().getCoordinates(),  // TBM: Random expression, didn't test this at all
-                    state.getAttitude(),
-                    -state.getAngularVelocity()  // TBM: Random expression, didn't test this at all
-                );
-            }
-            else
-            {
-                throw ostk::core::error::RuntimeError("Cannot get pointer to Profile.");
-            }
-        }
-    );
+    const Shared<const FrameProvider> transformProviderSPtr =
+        std::make_shared<const FrameProvider>(aProfileSPtr, aMemoCapacity, anEphemerisSPtr);
 
-    return Frame::Construct(aName, false, Frame::GCRF(), transformProviderSPtr);
+    return (aFrameRegistrySPtr != nullptr)
+             ? aFrameRegistrySPtr->constructFrame(aName, false, Frame::GCRF(), transformProviderSPtr)
+             : FrameRegistry::ConstructFrame(aName, false, Frame::GCRF(), transformProviderSPtr);
 }
 
 }  // namespace simulation
@@ -0,0 +1,244 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+
+#include <OpenSpaceToolkit/Simulation/Satellite/ChebyshevTable.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace satellite
+{
+
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::object::Vector3d;
+using ostk::mathematics::object::Vector4d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+
+namespace
+{
+
+// Fixed size, so that the recurrence runs on all components at once without allocating
+
+using Components = Eigen::Matrix<double, 10, 1>;
+
+}  // namespace
+
+const Size ChebyshevTable::ComponentCount = 10;
+
+ChebyshevTable::ChebyshevTable(
+    const Instant& aStartInstant,
+    const Duration& aSegmentDuration,
+    const Size aDegree,
+    const MatrixXd& aCoefficientMatrix
+)
+    : startInstant_(aStartInstant),
+      segmentSeconds_(Real::Undefined()),
+      degree_(aDegree),
+      segmentCount_(0),
+      coefficients_(aCoefficientMatrix)
+{
+    if (!startInstant_.isDefined())
+    {
+        return;
+    }
+
+    if (!aSegmentDuration.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Segment duration");
+    }
+
+    if (!aSegmentDuration.isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Segment duration", aSegmentDuration.toString());
+    }
+
+    const Size columnCount = degree_ + 1;
+
+    if ((Size(coefficients_.rows()) != ChebyshevTable::ComponentCount) || (coefficients_.cols() == 0) ||
+        ((Size(coefficients_.cols()) % columnCount) != 0))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Chebyshev coefficient matrix must be [{}] x (segment count * [{}]), got [{}] x [{}].",
+            ChebyshevTable::ComponentCount,
+            columnCount,
+            coefficients_.rows(),
+            coefficients_.cols()
+        );
+    }
+
+    segmentSeconds_ = aSegmentDuration.inSeconds();
+    segmentCount_ = Size(coefficients_.cols()) / columnCount;
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const ChebyshevTable& aChebyshevTable)
+{
+    aChebyshevTable.print(anOutputStream, true);
+
+    return anOutputStream;
+}
+
+bool ChebyshevTable::isDefined() const
+{
+    return this->segmentCount_ > 0;
+}
+
+Size ChebyshevTable::getDegree() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Chebyshev table");
+    }
+
+    return this->degree_;
+}
+
+Size ChebyshevTable::getSegmentCount() const
+{
+    return this->segmentCount_;
+}
+
+Duration ChebyshevTable::getSegmentDuration() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Chebyshev table");
+    }
+
+    return Duration::Seconds(this->segmentSeconds_);
+}
+
+Interval ChebyshevTable::getInterval() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Chebyshev table");
+    }
+
+    return Interval::Closed(
+        this->startInstant_, this->startInstant_ + Duration::Seconds(this->segmentSeconds_ * Real(this->segmentCount_))
+    );
+}
+
+const MatrixXd& ChebyshevTable::accessCoefficients() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Chebyshev table");
+    }
+
+    return this->coefficients_;
+}
+
+TrajectoryState ChebyshevTable::getStateAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Chebyshev table");
+    }
+
+    const Real elapsedSeconds = (anInstant - this->startInstant_).inSeconds();
+
+    if ((elapsedSeconds < 0.0) || (elapsedSeconds > (this->segmentSeconds_ * Real(this->segmentCount_))))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Instant [{}] is outside of Chebyshev table interval [{} - {}].",
+            anInstant.toString(),
+            this->getInterval().getStart().toString(),
+            this->getInterval().getEnd().toString()
+        );
+    }
+
+    // The last segment also holds the end of the interval
+
+    const Index segmentIndex =
+        std::min<Index>(Index(std::floor(elapsedSeconds / this->segmentSeconds_)), this->segmentCount_ - 1);
+
+    // Scaled to [-1, 1] over the segment
+
+    const double x =
+        (2.0 * (elapsedSeconds - (this->segmentSeconds_ * Real(segmentIndex))) / this->segmentSeconds_) - 1.0;
+
+    const Index firstColumn = segmentIndex * (this->degree_ + 1);
+
+    // Clenshaw recurrence b_k = c_k + 2 x b_k+1 - b_k+2, differentiated alongside for the velocity
+
+    Components b1 = Components::Zero();
+    Components b2 = Components::Zero();
+    Components d1 = Components::Zero();
+    Components d2 = Components::Zero();
+
+    for (Index degree = this->degree_; degree >= 1; --degree)
+    {
+        const Components b = this->coefficients_.col(firstColumn + degree) + (2.0 * x * b1) - b2;
+        const Components d = (2.0 * b1) + (2.0 * x * d1) - d2;
+
+        b2 = b1;
+        b1 = b;
+        d2 = d1;
+        d1 = d;
+    }
+
+    const Components value = this->coefficients_.col(firstColumn) + (x * b1) - b2;
+    const Components derivative = b1 + (x * d1) - d2;
+
+    const Vector3d position = value.segment<3>(0);
+    const Vector3d velocity = derivative.segment<3>(0) * (2.0 / this->segmentSeconds_);
+    const Vector4d attitude = value.segment<4>(3).normalized();
+    const Vector3d angularVelocity = value.segment<3>(7);
+
+    return {
+        anInstant,
+        Position::Meters(position, Frame::GCRF()),
+        Velocity::MetersPerSecond(velocity, Frame::GCRF()),
+        Quaternion::XYZS(attitude(0), attitude(1), attitude(2), attitude(3)),
+        angularVelocity,
+        Frame::GCRF()
+    };
+}
+
+void ChebyshevTable::print(std::ostream& anOutputStream, bool displayDecorators) const
+{
+    displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "Chebyshev Table") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Segment count:" << this->segmentCount_;
+
+    if (this->isDefined())
+    {
+        ostk::core::utils::Print::Line(anOutputStream) << "Start:" << this->getInterval().getStart().toString();
+        ostk::core::utils::Print::Line(anOutputStream) << "End:" << this->getInterval().getEnd().toString();
+        ostk::core::utils::Print::Line(anOutputStream) << "Segment duration:" << this->getSegmentDuration().toString();
+        ostk::core::utils::Print::Line(anOutputStream) << "Degree:" << this->degree_;
+    }
+
+    displayDecorators ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+ChebyshevTable ChebyshevTable::Undefined()
+{
+    return {Instant::Undefined(), Duration::Undefined(), 0, MatrixXd()};
+}
+
+}  // namespace satellite
+}  // namespace simulation
+}  // namespace ostk
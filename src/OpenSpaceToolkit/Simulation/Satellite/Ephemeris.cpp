@@ -0,0 +1,780 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#include <OpenSpaceToolkit/Simulation/Satellite/Ephemeris.hpp>
+#include <OpenSpaceToolkit/Simulation/Utility/ThreadPool.hpp>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace satellite
+{
+
+using ostk::core::container::Array;
+using ostk::core::container::Map;
+using ostk::core::type::Index;
+
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::object::MatrixXd;
+using ostk::mathematics::object::Vector3d;
+using ostk::mathematics::object::Vector4d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+
+using ostk::simulation::utility::ThreadPool;
+
+namespace
+{
+
+// Each refinement doubles the table size, so that this bounds it to about a thousand times the requested size
+
+const Size MaximumRefinementCount = 10;
+
+// Relative tolerance on the spacing of state table instants
+
+const Real StepTolerance = 1e-9;
+
+struct Sample
+{
+    Vector3d position;
+    Vector3d velocity;
+    Vector4d attitude;  // XYZS
+    Vector3d angularVelocity;
+};
+
+Sample SampleOf(const TrajectoryState& aState)
+{
+    const TrajectoryState state = aState.inFrame(Frame::GCRF());
+
+    const Quaternion attitude = state.getAttitude();
+
+    return {
+        state.getPosition().getCoordinates(),
+        state.getVelocity().getCoordinates(),
+        Vector4d(attitude.x(), attitude.y(), attitude.z(), attitude.s()),
+        state.getAngularVelocity()
+    };
+}
+
+// Interpolate between two samples a step apart, at a ratio in [0, 1] of the step
+
+Sample Interpolate(
+    const Sample& aFirstSample, const Sample& aSecondSample, const Real& aStepSeconds, const Real& aRatio
+)
+{
+    const double t = aRatio;
+    const double h = aStepSeconds;
+    const double t2 = t * t;
+    const double t3 = t2 * t;
+
+    // Cubic Hermite basis, and its derivative with respect to the ratio
+
+    const double h00 = (2.0 * t3) - (3.0 * t2) + 1.0;
+    const double h10 = t3 - (2.0 * t2) + t;
+    const double h01 = (-2.0 * t3) + (3.0 * t2);
+    const double h11 = t3 - t2;
+
+    const double dh00 = (6.0 * t2) - (6.0 * t);
+    const double dh10 = (3.0 * t2) - (4.0 * t) + 1.0;
+    const double dh01 = (-6.0 * t2) + (6.0 * t);
+    const double dh11 = (3.0 * t2) - (2.0 * t);
+
+    const Vector3d position = (h00 * aFirstSample.position) + ((h10 * h) * aFirstSample.velocity) +
+                              (h01 * aSecondSample.position) + ((h11 * h) * aSecondSample.velocity);
+
+    const Vector3d velocity = (((dh00 * aFirstSample.position) + (dh01 * aSecondSample.position)) / h) +
+                              (dh10 * aFirstSample.velocity) + (dh11 * aSecondSample.velocity);
+
+    // Spherical linear interpolation along the shortest arc, falling back to a normalized linear one for close
+    // attitudes, where both agree and the spherical weights lose precision
+
+    const Vector4d& firstAttitude = aFirstSample.attitude;
+    Vector4d secondAttitude = aSecondSample.attitude;
+
+    double cosine = firstAttitude.dot(secondAttitude);
+
+    if (cosine < 0.0)
+    {
+        secondAttitude = -secondAttitude;
+        cosine = -cosine;
+    }
+
+    Vector4d attitude;
+
+    if (cosine > 0.9995)
+    {
+        attitude = ((1.0 - t) * firstAttitude) + (t * secondAttitude);
+    }
+    else
+    {
+        const double angle = std::acos(cosine);
+        const double sine = std::sin(angle);
+
+        attitude = ((std::sin((1.0 - t) * angle) / sine) * firstAttitude) +
+                   ((std::sin(t * angle) / sine) * secondAttitude);
+    }
+
+    attitude.normalize();
+
+    const Vector3d angularVelocity = ((1.0 - t) * aFirstSample.angularVelocity) + (t * aSecondSample.angularVelocity);
+
+    return {position, velocity, attitude, angularVelocity};
+}
+
+Array<Sample> SampleProfile(const Profile& aProfile, const Array<Instant>& anInstantArray, ThreadPool& aThreadPool)
+{
+    Array<Sample> samples = Array<Sample>::Empty();
+    samples.resize(anInstantArray.getSize());
+
+    aThreadPool.parallelFor(
+        anInstantArray.getSize(),
+        [&aProfile, &anInstantArray, &samples](const Index& anIndex)
+        {
+            samples[anIndex] = SampleOf(aProfile.getStateAt(anInstantArray[anIndex]));
+        }
+    );
+
+    return samples;
+}
+
+// Instants at points of [-1, 1] scaled to each of consecutive segments
+
+Array<Instant> SegmentInstants(
+    const Instant& aStartInstant,
+    const Real& aSegmentSeconds,
+    const Size aSegmentCount,
+    const Array<double>& aPointArray
+)
+{
+    Array<Instant> instants = Array<Instant>::Empty();
+    instants.reserve(aSegmentCount * aPointArray.getSize());
+
+    for (Index segmentIndex = 0; segmentIndex < aSegmentCount; ++segmentIndex)
+    {
+        for (const double& point : aPointArray)
+        {
+            instants.add(
+                aStartInstant + Duration::Seconds(aSegmentSeconds * (Real(segmentIndex) + (0.5 * (point + 1.0))))
+            );
+        }
+    }
+
+    return instants;
+}
+
+}  // namespace
+
+Ephemeris::Ephemeris(const StateTable& aStateTable)
+    : type_(Ephemeris::Type::Tabulated),
+      stateTable_(aStateTable),
+      chebyshevTable_(ChebyshevTable::Undefined()),
+      stepSeconds_(Real::Undefined())
+{
+    if (!stateTable_.isDefined())
+    {
+        return;
+    }
+
+    const Array<Instant>& instants = stateTable_.accessInstants();
+
+    if (instants.getSize() < 2)
+    {
+        throw ostk::core::error::RuntimeError(
+            "Ephemeris requires at least [2] states, got [{}].", instants.getSize()
+        );
+    }
+
+    stepSeconds_ = (instants.accessLast() - instants.accessFirst()).inSeconds() / Real(instants.getSize() - 1);
+
+    if (stepSeconds_ <= 0.0)
+    {
+        throw ostk::core::error::RuntimeError("Ephemeris instants must be increasing.");
+    }
+
+    for (Index index = 1; index < instants.getSize(); ++index)
+    {
+        const Real stepSeconds = (instants[index] - instants[index - 1]).inSeconds();
+
+        if (std::abs(stepSeconds - stepSeconds_) > (StepTolerance * stepSeconds_))
+        {
+            throw ostk::core::error::RuntimeError(
+                "Ephemeris instants must be uniformly spaced, step [{}] differs from [{}] s.",
+                double(stepSeconds),
+                double(stepSeconds_)
+            );
+        }
+    }
+}
+
+Ephemeris::Ephemeris(const ChebyshevTable& aChebyshevTable)
+    : type_(Ephemeris::Type::Chebyshev),
+      stateTable_(StateTable::Undefined()),
+      chebyshevTable_(aChebyshevTable),
+      stepSeconds_(Real::Undefined())
+{
+    if (chebyshevTable_.isDefined())
+    {
+        stepSeconds_ = chebyshevTable_.getSegmentDuration().inSeconds();
+    }
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const Ephemeris& anEphemeris)
+{
+    anEphemeris.print(anOutputStream, true);
+
+    return anOutputStream;
+}
+
+bool Ephemeris::isDefined() const
+{
+    return (this->type_ == Ephemeris::Type::Chebyshev) ? this->chebyshevTable_.isDefined()
+                                                        : this->stateTable_.isDefined();
+}
+
+Ephemeris::Type Ephemeris::getType() const
+{
+    return this->type_;
+}
+
+bool Ephemeris::contains(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        return false;
+    }
+
+    const Interval interval = this->getInterval();
+
+    return (anInstant >= interval.getStart()) && (anInstant <= interval.getEnd());
+}
+
+Interval Ephemeris::getInterval() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ephemeris");
+    }
+
+    if (this->type_ == Ephemeris::Type::Chebyshev)
+    {
+        return this->chebyshevTable_.getInterval();
+    }
+
+    const Array<Instant>& instants = this->stateTable_.accessInstants();
+
+    return Interval::Closed(instants.accessFirst(), instants.accessLast());
+}
+
+Duration Ephemeris::getStep() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ephemeris");
+    }
+
+    return Duration::Seconds(this->stepSeconds_);
+}
+
+const StateTable& Ephemeris::accessStateTable() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ephemeris");
+    }
+
+    if (this->type_ != Ephemeris::Type::Tabulated)
+    {
+        throw ostk::core::error::RuntimeError(
+            "Ephemeris is of type [{}], not [{}].",
+            Ephemeris::StringFromType(this->type_),
+            Ephemeris::StringFromType(Ephemeris::Type::Tabulated)
+        );
+    }
+
+    return this->stateTable_;
+}
+
+const ChebyshevTable& Ephemeris::accessChebyshevTable() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ephemeris");
+    }
+
+    if (this->type_ != Ephemeris::Type::Chebyshev)
+    {
+        throw ostk::core::error::RuntimeError(
+            "Ephemeris is of type [{}], not [{}].",
+            Ephemeris::StringFromType(this->type_),
+            Ephemeris::StringFromType(Ephemeris::Type::Chebyshev)
+        );
+    }
+
+    return this->chebyshevTable_;
+}
+
+TrajectoryState Ephemeris::getStateAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ephemeris");
+    }
+
+    if (this->type_ == Ephemeris::Type::Chebyshev)
+    {
+        return this->chebyshevTable_.getStateAt(anInstant);
+    }
+
+    const Array<Instant>& instants = this->stateTable_.accessInstants();
+
+    const Real elapsedSeconds = (anInstant - instants.accessFirst()).inSeconds();
+    const Real lastSeconds = this->stepSeconds_ * Real(instants.getSize() - 1);
+
+    if ((elapsedSeconds < 0.0) || (elapsedSeconds > lastSeconds))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Instant [{}] is outside of ephemeris interval [{} - {}].",
+            anInstant.toString(),
+            instants.accessFirst().toString(),
+            instants.accessLast().toString()
+        );
+    }
+
+    // The last segment also holds the last instant
+
+    const Index index = std::min<Index>(Index(std::floor(elapsedSeconds / this->stepSeconds_)), instants.getSize() - 2);
+    const Real ratio = (elapsedSeconds - (this->stepSeconds_ * Real(index))) / this->stepSeconds_;
+
+    const MatrixXd& positions = this->stateTable_.accessPositions();
+    const MatrixXd& velocities = this->stateTable_.accessVelocities();
+    const MatrixXd& attitudes = this->stateTable_.accessAttitudes();
+    const MatrixXd& angularVelocities = this->stateTable_.accessAngularVelocities();
+
+    const auto sampleAt = [&](const Index& aColumn) -> Sample
+    {
+        return {
+            positions.col(aColumn),
+            velocities.col(aColumn),
+            attitudes.col(aColumn),
+            angularVelocities.col(aColumn),
+        };
+    };
+
+    const Sample sample = Interpolate(sampleAt(index), sampleAt(index + 1), this->stepSeconds_, ratio);
+
+    return {
+        anInstant,
+        Position::Meters(sample.position, Frame::GCRF()),
+        Velocity::MetersPerSecond(sample.velocity, Frame::GCRF()),
+        Quaternion::XYZS(sample.attitude(0), sample.attitude(1), sample.attitude(2), sample.attitude(3)),
+        sample.angularVelocity,
+        Frame::GCRF()
+    };
+}
+
+void Ephemeris::print(std::ostream& anOutputStream, bool displayDecorators) const
+{
+    displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "Ephemeris") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Type:" << Ephemeris::StringFromType(this->type_);
+
+    if (this->type_ == Ephemeris::Type::Chebyshev)
+    {
+        ostk::core::utils::Print::Line(anOutputStream) << "Segment count:" << this->chebyshevTable_.getSegmentCount();
+    }
+    else
+    {
+        ostk::core::utils::Print::Line(anOutputStream) << "Size:" << this->stateTable_.getSize();
+    }
+
+    if (this->isDefined())
+    {
+        ostk::core::utils::Print::Line(anOutputStream) << "Start:" << this->getInterval().getStart().toString();
+        ostk::core::utils::Print::Line(anOutputStream) << "End:" << this->getInterval().getEnd().toString();
+        ostk::core::utils::Print::Line(anOutputStream) << "Step:" << this->getStep().toString();
+    }
+
+    displayDecorators ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+Ephemeris Ephemeris::Undefined()
+{
+    return {StateTable::Undefined()};
+}
+
+String Ephemeris::StringFromType(const Type& aType)
+{
+    static const Map<Ephemeris::Type, String> typeStringMap = {
+        {Ephemeris::Type::Tabulated, "Tabulated"},
+        {Ephemeris::Type::Chebyshev, "Chebyshev"},
+    };
+
+    return typeStringMap.at(aType);
+}
+
+Ephemeris Ephemeris::Generate(
+    const Profile& aProfile,
+    const Interval& anInterval,
+    const Duration& aStep,
+    const Length& aPositionTolerance,
+    const Angle& anAttitudeTolerance,
+    const Size aThreadCount
+)
+{
+    ThreadPool threadPool(aThreadCount == 0 ? std::max<Size>(1, std::thread::hardware_concurrency()) : aThreadCount);
+
+    return Ephemeris::Generate(aProfile, anInterval, aStep, aPositionTolerance, anAttitudeTolerance, threadPool);
+}
+
+Ephemeris Ephemeris::Generate(
+    const Profile& aProfile,
+    const Interval& anInterval,
+    const Duration& aStep,
+    const Length& aPositionTolerance,
+    const Angle& anAttitudeTolerance,
+    ThreadPool& aThreadPool
+)
+{
+    if (!aProfile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Profile");
+    }
+
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if (!aStep.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Step");
+    }
+
+    if (!aPositionTolerance.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Position tolerance");
+    }
+
+    if (!anAttitudeTolerance.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Attitude tolerance");
+    }
+
+    if (!aStep.isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Step", aStep.toString());
+    }
+
+    const Instant startInstant = anInterval.getStart();
+    const Real durationSeconds = anInterval.getDuration().inSeconds();
+
+    if (durationSeconds <= 0.0)
+    {
+        throw ostk::core::error::RuntimeError(
+            "Interval [{} - {}] has no duration.", startInstant.toString(), anInterval.getEnd().toString()
+        );
+    }
+
+    const Real positionToleranceMeters = aPositionTolerance.inMeters();
+    const Real attitudeToleranceRadians = anAttitudeTolerance.inRadians();
+
+    Size segmentCount = std::max<Size>(1, Size(std::ceil(durationSeconds / aStep.inSeconds())));
+
+    Array<Instant> instants = Array<Instant>::Empty();
+    instants.reserve(segmentCount + 1);
+
+    for (Index index = 0; index <= segmentCount; ++index)
+    {
+        instants.add(startInstant + Duration::Seconds(durationSeconds * Real(index) / Real(segmentCount)));
+    }
+
+    Array<Sample> samples = SampleProfile(aProfile, instants, aThreadPool);
+
+    for (Index refinementIndex = 0; refinementIndex <= MaximumRefinementCount; ++refinementIndex)
+    {
+        const Real stepSeconds = durationSeconds / Real(segmentCount);
+
+        Array<Instant> midpointInstants = Array<Instant>::Empty();
+        midpointInstants.reserve(segmentCount);
+
+        for (Index index = 0; index < segmentCount; ++index)
+        {
+            midpointInstants.add(startInstant + Duration::Seconds(stepSeconds * (Real(index) + 0.5)));
+        }
+
+        const Array<Sample> midpointSamples = SampleProfile(aProfile, midpointInstants, aThreadPool);
+
+        bool isWithinTolerances = true;
+
+        for (Index index = 0; (index < segmentCount) && isWithinTolerances; ++index)
+        {
+            const Sample interpolatedSample = Interpolate(samples[index], samples[index + 1], stepSeconds, 0.5);
+
+            const double positionError = (interpolatedSample.position - midpointSamples[index].position).norm();
+            const double cosine = std::abs(interpolatedSample.attitude.dot(midpointSamples[index].attitude));
+            const double attitudeError = 2.0 * std::acos(std::min(1.0, cosine));
+
+            isWithinTolerances =
+                (positionError <= positionToleranceMeters) && (attitudeError <= attitudeToleranceRadians);
+        }
+
+        if (isWithinTolerances)
+        {
+            MatrixXd positions(3, segmentCount + 1);
+            MatrixXd velocities(3, segmentCount + 1);
+            MatrixXd attitudes(4, segmentCount + 1);
+            MatrixXd angularVelocities(3, segmentCount + 1);
+
+            for (Index index = 0; index <= segmentCount; ++index)
+            {
+                positions.col(index) = samples[index].position;
+                velocities.col(index) = samples[index].velocity;
+                attitudes.col(index) = samples[index].attitude;
+                angularVelocities.col(index) = samples[index].angularVelocity;
+            }
+
+            return {StateTable(instants, positions, velocities, attitudes, angularVelocities)};
+        }
+
+        // Merging the midpoints halves the step, reusing every sample evaluated so far
+
+        Array<Instant> refinedInstants = Array<Instant>::Empty();
+        Array<Sample> refinedSamples = Array<Sample>::Empty();
+
+        refinedInstants.reserve((2 * segmentCount) + 1);
+        refinedSamples.reserve((2 * segmentCount) + 1);
+
+        for (Index index = 0; index < segmentCount; ++index)
+        {
+            refinedInstants.add(instants[index]);
+            refinedInstants.add(midpointInstants[index]);
+            refinedSamples.add(samples[index]);
+            refinedSamples.add(midpointSamples[index]);
+        }
+
+        refinedInstants.add(instants.accessLast());
+        refinedSamples.add(samples.accessLast());
+
+        instants = refinedInstants;
+        samples = refinedSamples;
+        segmentCount *= 2;
+    }
+
+    throw ostk::core::error::RuntimeError(
+        "Ephemeris cannot meet tolerances within [{}] refinements of step [{}].",
+        MaximumRefinementCount,
+        aStep.toString()
+    );
+}
+
+Ephemeris Ephemeris::Fit(
+    const Profile& aProfile,
+    const Interval& anInterval,
+    const Duration& aSegmentDuration,
+    const Size aDegree,
+    const Length& aPositionTolerance,
+    const Angle& anAttitudeTolerance,
+    const Size aThreadCount
+)
+{
+    ThreadPool threadPool(aThreadCount == 0 ? std::max<Size>(1, std::thread::hardware_concurrency()) : aThreadCount);
+
+    return Ephemeris::Fit(
+        aProfile, anInterval, aSegmentDuration, aDegree, aPositionTolerance, anAttitudeTolerance, threadPool
+    );
+}
+
+Ephemeris Ephemeris::Fit(
+    const Profile& aProfile,
+    const Interval& anInterval,
+    const Duration& aSegmentDuration,
+    const Size aDegree,
+    const Length& aPositionTolerance,
+    const Angle& anAttitudeTolerance,
+    ThreadPool& aThreadPool
+)
+{
+    if (!aProfile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Profile");
+    }
+
+    if (!anInterval.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if (!aSegmentDuration.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Segment duration");
+    }
+
+    if (!aPositionTolerance.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Position tolerance");
+    }
+
+    if (!anAttitudeTolerance.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Attitude tolerance");
+    }
+
+    if (!aSegmentDuration.isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Segment duration", aSegmentDuration.toString());
+    }
+
+    if (aDegree == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Degree", aDegree);
+    }
+
+    const Instant startInstant = anInterval.getStart();
+    const Real durationSeconds = anInterval.getDuration().inSeconds();
+
+    if (durationSeconds <= 0.0)
+    {
+        throw ostk::core::error::RuntimeError(
+            "Interval [{} - {}] has no duration.", startInstant.toString(), anInterval.getEnd().toString()
+        );
+    }
+
+    const Real positionToleranceMeters = aPositionTolerance.inMeters();
+    const Real attitudeToleranceRadians = anAttitudeTolerance.inRadians();
+
+    const Size nodeCount = aDegree + 1;
+    const double pi = Real::Pi();
+
+    // Chebyshev nodes on [-1, 1] in increasing order, and the discrete cosine transform from values at the nodes to
+    // series coefficients
+
+    Array<double> nodes = Array<double>::Empty();
+    nodes.reserve(nodeCount);
+
+    MatrixXd transform(nodeCount, nodeCount);
+
+    for (Index nodeIndex = 0; nodeIndex < nodeCount; ++nodeIndex)
+    {
+        const double angle = pi * (Real(nodeCount - nodeIndex) - 0.5) / Real(nodeCount);
+
+        nodes.add(std::cos(angle));
+
+        for (Index degree = 0; degree < nodeCount; ++degree)
+        {
+            transform(nodeIndex, degree) = ((degree == 0) ? 1.0 : 2.0) * std::cos(Real(degree) * angle) / nodeCount;
+        }
+    }
+
+    // Errors peak halfway between nodes and at segment ends, which the extrema of the highest degree polynomial
+    // cover
+
+    Array<double> checkPoints = Array<double>::Empty();
+    checkPoints.reserve(nodeCount + 1);
+
+    for (Index pointIndex = 0; pointIndex <= nodeCount; ++pointIndex)
+    {
+        checkPoints.add(-std::cos(pi * Real(pointIndex) / Real(nodeCount)));
+    }
+
+    Size segmentCount = std::max<Size>(1, Size(std::ceil(durationSeconds / aSegmentDuration.inSeconds())));
+
+    for (Index refinementIndex = 0; refinementIndex <= MaximumRefinementCount; ++refinementIndex)
+    {
+        const Real segmentSeconds = durationSeconds / Real(segmentCount);
+
+        const Array<Sample> samples =
+            SampleProfile(aProfile, SegmentInstants(startInstant, segmentSeconds, segmentCount, nodes), aThreadPool);
+
+        MatrixXd coefficients(ChebyshevTable::ComponentCount, segmentCount * nodeCount);
+
+        aThreadPool.parallelFor(
+            segmentCount,
+            [&](const Index& aSegmentIndex)
+            {
+                // Quaternions are brought to the hemisphere of the first node, so that components are continuous
+
+                const Index firstIndex = aSegmentIndex * nodeCount;
+                const Vector4d& referenceAttitude = samples[firstIndex].attitude;
+
+                MatrixXd values(ChebyshevTable::ComponentCount, nodeCount);
+
+                for (Index nodeIndex = 0; nodeIndex < nodeCount; ++nodeIndex)
+                {
+                    const Sample& sample = samples[firstIndex + nodeIndex];
+
+                    values.col(nodeIndex).segment<3>(0) = sample.position;
+                    values.col(nodeIndex).segment<4>(3) =
+                        (sample.attitude.dot(referenceAttitude) < 0.0) ? Vector4d(-sample.attitude) : sample.attitude;
+                    values.col(nodeIndex).segment<3>(7) = sample.angularVelocity;
+                }
+
+                coefficients.middleCols(firstIndex, nodeCount) = values * transform;
+            }
+        );
+
+        const ChebyshevTable chebyshevTable(startInstant, Duration::Seconds(segmentSeconds), aDegree, coefficients);
+
+        const Array<Instant> checkInstants = SegmentInstants(startInstant, segmentSeconds, segmentCount, checkPoints);
+        const Array<Sample> checkSamples = SampleProfile(aProfile, checkInstants, aThreadPool);
+
+        bool isWithinTolerances = true;
+
+        for (Index index = 0; (index < checkInstants.getSize()) && isWithinTolerances; ++index)
+        {
+            const Sample fittedSample = SampleOf(chebyshevTable.getStateAt(checkInstants[index]));
+
+            const double positionError = (fittedSample.position - checkSamples[index].position).norm();
+            const double cosine = std::abs(fittedSample.attitude.dot(checkSamples[index].attitude));
+            const double attitudeError = 2.0 * std::acos(std::min(1.0, cosine));
+
+            isWithinTolerances =
+                (positionError <= positionToleranceMeters) && (attitudeError <= attitudeToleranceRadians);
+        }
+
+        if (isWithinTolerances)
+        {
+            return {chebyshevTable};
+        }
+
+        segmentCount *= 2;
+    }
+
+    throw ostk::core::error::RuntimeError(
+        "Ephemeris cannot meet tolerances within [{}] refinements of segment duration [{}].",
+        MaximumRefinementCount,
+        aSegmentDuration.toString()
+    );
+}
+
+}  // namespace satellite
+}  // namespace simulation
+}  // namespace ostk
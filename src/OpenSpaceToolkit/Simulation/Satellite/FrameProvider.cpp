@@ -0,0 +1,94 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Satellite/FrameProvider.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace satellite
+{
+
+using ostk::physics::coordinate::Frame;
+
+FrameProvider::FrameProvider(
+    const Shared<const Profile>& aProfileSPtr, const Size aMemoCapacity, const Shared<const Ephemeris>& anEphemerisSPtr
+)
+    : profileWPtr_(aProfileSPtr),
+      ephemerisWPtr_(anEphemerisSPtr),
+      memoSPtr_(std::make_shared<Memo<Instant, Transform>>(aMemoCapacity))
+{
+}
+
+FrameProvider::~FrameProvider() {}
+
+FrameProvider* FrameProvider::clone() const
+{
+    return new FrameProvider(*this);
+}
+
+bool FrameProvider::isDefined() const
+{
+    return !this->profileWPtr_.expired();
+}
+
+Transform FrameProvider::getTransformAt(const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        return this->evaluateTransformAt(anInstant);
+    }
+
+    return this->memoSPtr_->get(
+        anInstant,
+        [this, &anInstant]() -> Transform
+        {
+            return this->evaluateTransformAt(anInstant);
+        }
+    );
+}
+
+void FrameProvider::memoizeState(const TrajectoryState& aState) const
+{
+    if (!aState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State");
+    }
+
+    this->memoSPtr_->set(aState.getInstant(), FrameProvider::TransformFromState(aState.inFrame(Frame::GCRF())));
+}
+
+Transform FrameProvider::TransformFromState(const TrajectoryState& aState)
+{
+    return Transform::Passive(
+        aState.getInstant(),
+        -aState.getPosition().getCoordinates(),
+        -aState.getVelocity().getCoordinates(),  // TBM: Random expression, didn't test this at all
+        aState.getAttitude(),
+        -aState.getAngularVelocity()  // TBM: Random expression, didn't test this at all
+    );
+}
+
+Transform FrameProvider::evaluateTransformAt(const Instant& anInstant) const
+{
+    if (Shared<const Profile> profileSPtr = this->profileWPtr_.lock())
+    {
+        const Shared<const Ephemeris> ephemerisSPtr = this->ephemerisWPtr_.lock();
+
+        const TrajectoryState state = ((ephemerisSPtr != nullptr) && ephemerisSPtr->contains(anInstant))
+                                        ? ephemerisSPtr->getStateAt(anInstant)
+                                        : profileSPtr->getStateAt(anInstant).inFrame(Frame::GCRF());
+
+        return FrameProvider::TransformFromState(state);
+    }
+
+    throw ostk::core::error::RuntimeError("Cannot get pointer to Profile.");
+}
+
+}  // namespace satellite
+}  // namespace simulation
+}  // namespace ostk
@@ -0,0 +1,197 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Satellite/TransformTree.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/Static.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace satellite
+{
+
+using StaticProvider = ostk::physics::coordinate::frame::provider::Static;
+
+TransformTree::TransformTree(const Component& aRootComponent)
+    : nodes_(),
+      indexMap_(),
+      instant_(Instant::Undefined()),
+      transforms_(),
+      mutex_()
+{
+    if (!aRootComponent.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Component");
+    }
+
+    const Shared<const Frame>& frameSPtr = aRootComponent.accessFrame();
+
+    if ((frameSPtr == nullptr) || (!frameSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    this->nodes_.add({frameSPtr, 0, Transform::Undefined()});
+    this->indexMap_.insert({frameSPtr.get(), 0});
+
+    this->addNodes(aRootComponent, 0);
+
+    this->transforms_.reserve(this->nodes_.getSize());
+}
+
+TransformTree::TransformTree(const TransformTree& aTransformTree)
+    : nodes_(aTransformTree.nodes_),
+      indexMap_(aTransformTree.indexMap_),
+      instant_(Instant::Undefined()),
+      transforms_(),
+      mutex_()
+{
+    this->transforms_.reserve(this->nodes_.getSize());
+}
+
+bool TransformTree::contains(const Shared<const Frame>& aFrameSPtr) const
+{
+    return (aFrameSPtr != nullptr) && (this->indexMap_.find(aFrameSPtr.get()) != this->indexMap_.end());
+}
+
+Size TransformTree::getSize() const
+{
+    return this->nodes_.getSize();
+}
+
+Size TransformTree::getMountedFrameCount() const
+{
+    Size count = 0;
+
+    for (const auto& node : this->nodes_)
+    {
+        count += node.mountTransform.isDefined() ? 1 : 0;
+    }
+
+    return count;
+}
+
+Array<Shared<const Frame>> TransformTree::getFrames() const
+{
+    Array<Shared<const Frame>> frames = Array<Shared<const Frame>>::Empty();
+    frames.reserve(this->nodes_.getSize());
+
+    for (const auto& node : this->nodes_)
+    {
+        frames.add(node.frameSPtr);
+    }
+
+    return frames;
+}
+
+Transform TransformTree::getTransformToGCRF(const Shared<const Frame>& aFrameSPtr, const Instant& anInstant) const
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    const Index index = this->indexOf(aFrameSPtr);
+
+    const std::lock_guard<std::mutex> lock(this->mutex_);
+
+    if ((!this->instant_.isDefined()) || (this->instant_ != anInstant))
+    {
+        this->evaluate(anInstant);
+    }
+
+    return this->transforms_[index];
+}
+
+void TransformTree::addNodes(const Component& aComponent, const Index aParentIndex)
+{
+    // Copied, as adding nodes reallocates them
+
+    const Shared<const Frame> parentFrameSPtr = this->nodes_[aParentIndex].frameSPtr;
+
+    for (const auto& componentSPtr : aComponent.accessComponents())
+    {
+        const Shared<const Frame>& frameSPtr = componentSPtr->accessFrame();
+
+        // Frames shared with another component are evaluated once, from their first occurrence
+
+        if ((frameSPtr == nullptr) || (!frameSPtr->isDefined()) || this->contains(frameSPtr))
+        {
+            continue;
+        }
+
+        const Shared<const Frame> frameParentSPtr = frameSPtr->accessParent();
+        const Shared<const StaticProvider> staticProviderSPtr =
+            std::dynamic_pointer_cast<const StaticProvider>(frameSPtr->accessProvider());
+
+        const bool isMounted =
+            (frameParentSPtr != nullptr) && (*frameParentSPtr == *parentFrameSPtr) && (staticProviderSPtr != nullptr);
+
+        const Index index = this->nodes_.getSize();
+
+        this->nodes_.add(
+            {frameSPtr,
+             aParentIndex,
+             isMounted ? frameSPtr->getTransformTo(parentFrameSPtr, Instant::J2000()) : Transform::Undefined()}
+        );
+        this->indexMap_.insert({frameSPtr.get(), index});
+
+        this->addNodes(*componentSPtr, index);
+    }
+}
+
+Index TransformTree::indexOf(const Shared<const Frame>& aFrameSPtr) const
+{
+    if ((aFrameSPtr == nullptr) || (!aFrameSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    const auto indexIt = this->indexMap_.find(aFrameSPtr.get());
+
+    if (indexIt == this->indexMap_.end())
+    {
+        throw ostk::core::error::RuntimeError("Frame [{}] is not part of the transform tree.", aFrameSPtr->getName());
+    }
+
+    return indexIt->second;
+}
+
+void TransformTree::evaluate(const Instant& anInstant) const
+{
+    // Stale transforms are discarded first, so that a failed evaluation leaves no instant half evaluated
+
+    this->instant_ = Instant::Undefined();
+    this->transforms_.clear();
+
+    for (const auto& node : this->nodes_)
+    {
+        if (!node.mountTransform.isDefined())
+        {
+            this->transforms_.add(node.frameSPtr->getTransformTo(Frame::GCRF(), anInstant));
+
+            continue;
+        }
+
+        // Static mounting transforms are restamped to the instant, parents coming before their children
+
+        const Transform mountTransform = Transform::Passive(
+            anInstant,
+            node.mountTransform.accessTranslation(),
+            node.mountTransform.accessVelocity(),
+            node.mountTransform.accessOrientation(),
+            node.mountTransform.accessAngularVelocity()
+        );
+
+        this->transforms_.add(this->transforms_[node.parentIndex] * mountTransform);
+    }
+
+    this->instant_ = anInstant;
+}
+
+}  // namespace satellite
+}  // namespace simulation
+}  // namespace ostk
@@ -1,12 +1,25 @@
 /// Apache License 2.0
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <thread>
+
 #include <OpenSpaceToolkit/Simulation/Component.hpp>
 #include <OpenSpaceToolkit/Simulation/Component/Geometry.hpp>
+#include <OpenSpaceToolkit/Simulation/Satellite/FrameProvider.hpp>
 #include <OpenSpaceToolkit/Simulation/Simulator.hpp>
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utility.hpp>
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Composite.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
 #include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
 
 namespace ostk
@@ -16,18 +29,167 @@ namespace simulation
 
 using ostk::core::container::Array;
 using ostk::core::container::Map;
+using ostk::core::type::Index;
+using ostk::core::type::Real;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
+using ostk::mathematics::geometry::d3::object::Composite;
+using ostk::mathematics::geometry::d3::Transformation;
+using ostk::mathematics::object::Matrix4d;
+using ostk::mathematics::object::Vector3d;
+
 using ostk::physics::coordinate::Frame;
 
+using ostk::simulation::satellite::FrameProvider;
+
+namespace
+{
+
+// Satellite frames resolved at the current instant (by component and geometry queries) reuse the states evaluated
+// by the simulator, rather than evaluating the profiles again.
+void MemoizeSatelliteFrame(const Satellite& aSatellite, const TrajectoryState& aState)
+{
+    const Shared<const Frame>& frameSPtr = aSatellite.accessFrame();
+
+    if ((frameSPtr == nullptr) || (!frameSPtr->isDefined()) || (!aState.isDefined()))
+    {
+        return;
+    }
+
+    if (const Shared<const FrameProvider> frameProviderSPtr =
+            std::dynamic_pointer_cast<const FrameProvider>(frameSPtr->accessProvider()))
+    {
+        frameProviderSPtr->memoizeState(aState);
+    }
+}
+
+// Components are held at any depth: a behavior may be attached to a component of a component.
+bool HoldsComponentWithId(const Component& aComponent, const String& aComponentId)
+{
+    if (aComponent.getId() == aComponentId)
+    {
+        return true;
+    }
+
+    for (const auto& componentSPtr : aComponent.accessComponents())
+    {
+        if (HoldsComponentWithId(*componentSPtr, aComponentId))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void RecordComponentTree(
+    const Simulator& aSimulator,
+    const Component& aComponent,
+    const Size& aDepth,
+    Array<Checkpoint::ComponentRecord>& aComponentRecordArray
+)
+{
+    aComponentRecordArray.add(
+        {aComponent.getId(), aComponent.getName(), aDepth, aSimulator.getComponentStateWithId(aComponent.getId())}
+    );
+
+    for (const auto& componentSPtr : aComponent.accessComponents())
+    {
+        RecordComponentTree(aSimulator, *componentSPtr, aDepth + 1, aComponentRecordArray);
+    }
+}
+
+// Time shards are claimed dynamically by the pool threads: oversubscribing balances shards of uneven cost.
+const Size shardsPerThread = 4;
+
+Array<Interval> ShardInterval(const Interval& anInterval, const Duration& aStep, const Size& aShardCount)
+{
+    if ((aShardCount <= 1) || (!anInterval.isDefined()) || (!aStep.isDefined()) || (!aStep.isStrictlyPositive()))
+    {
+        return {anInterval};
+    }
+
+    const Instant& startInstant = anInterval.accessStart();
+    const Instant& endInstant = anInterval.accessEnd();
+
+    // Shard bounds lie on the sampling grid, so that shards sample the same instants as the whole interval
+
+    Size stepCount =
+        static_cast<Size>(std::ceil(anInterval.getDuration().inNanoseconds() / aStep.inNanoseconds()));
+
+    while ((stepCount > 0) && ((startInstant + aStep * Real(stepCount - 1)) >= endInstant))
+    {
+        stepCount -= 1;
+    }
+
+    while ((startInstant + aStep * Real(stepCount)) < endInstant)
+    {
+        stepCount += 1;
+    }
+
+    const Size shardCount = std::min(aShardCount, stepCount);
+
+    if (shardCount <= 1)
+    {
+        return {anInterval};
+    }
+
+    Array<Interval> shards = Array<Interval>::Empty();
+    shards.reserve(shardCount);
+
+    Instant shardStartInstant = startInstant;
+
+    for (Index shardIndex = 1; shardIndex <= shardCount; ++shardIndex)
+    {
+        const Instant shardEndInstant = (shardIndex == shardCount)
+                                          ? endInstant
+                                          : (startInstant + aStep * Real((shardIndex * stepCount) / shardCount));
+
+        shards.add(Interval::Closed(shardStartInstant, shardEndInstant));
+
+        shardStartInstant = shardEndInstant;
+    }
+
+    return shards;
+}
+
+}  // namespace
+
 Simulator::Simulator(const Environment& anEnvironment, const Array<Shared<Satellite>>& aSatelliteArray)
     : environment_(anEnvironment),
-      satelliteMap_()
+      satelliteMap_(),
+      satelliteIndex_(),
+      transformTreeIndex_(),
+      satelliteStateMap_(),
+      componentStateMap_(),
+      scheduler_(),
+      threadPoolSPtr_(nullptr),
+      history_(History(0)),
+      stateCache_(),
+      frameRegistrySPtr_(std::make_shared<FrameRegistry>()),
+#if defined(__linux__)
+      processCount_(0),
+      partitionSPtr_(nullptr),
+      partitionViewSPtr_(nullptr),
+#endif
+      preStepObservers_(),
+      postStepObservers_(),
+      satelliteObservers_(),
+      nextObserverId_(0),
+      sharedSatelliteNames_(),
+      forkWPtr_(),
+      behaviorMap_(),
+      nextBehaviorId_(0)
 {
+    this->satelliteIndex_.edit().reserve(aSatelliteArray.getSize());
+
     for (const auto& satelliteSPtr : aSatelliteArray)
     {
-        this->satelliteMap_.insert({satelliteSPtr->getName(), satelliteSPtr});
+        this->satelliteMap_.edit().insert({satelliteSPtr->getName(), satelliteSPtr});
+        this->satelliteIndex_.edit().insert(Symbol(satelliteSPtr->getName()), satelliteSPtr);
+        this->indexTransformTree(*satelliteSPtr);
     }
 }
 
@@ -55,7 +217,7 @@ bool Simulator::hasSatelliteWithName(const String& aSatelliteName) const
         throw ostk::core::error::runtime::Undefined("Simulator");
     }
 
-    return this->satelliteMap_.find(aSatelliteName) != this->satelliteMap_.end();
+    return this->satelliteIndex_.access().find(aSatelliteName) != nullptr;
 }
 
 const Environment& Simulator::accessEnvironment() const
@@ -75,10 +237,19 @@ const Map<String, Shared<Satellite>>& Simulator::accessSatelliteMap() const
         throw ostk::core::error::runtime::Undefined("Simulator");
     }
 
-    return this->satelliteMap_;
+    this->unshareSatellites(true);
+
+    return this->satelliteMap_.access();
 }
 
 const Satellite& Simulator::accessSatelliteWithName(const String& aSatelliteName) const
+{
+    this->findSatelliteWithName(aSatelliteName);  // Throws if no satellite is found
+
+    return *(this->unshareSatelliteWithName(aSatelliteName, false));
+}
+
+Simulator::SatelliteHandle Simulator::getSatelliteHandle(const String& aSatelliteName) const
 {
     if (aSatelliteName.isEmpty())
     {
@@ -90,14 +261,36 @@ const Satellite& Simulator::accessSatelliteWithName(const String& aSatelliteName
         throw ostk::core::error::runtime::Undefined("Simulator");
     }
 
-    const auto satelliteIt = this->satelliteMap_.find(aSatelliteName);
+    const SatelliteHandle satelliteHandle = this->satelliteIndex_.access().getHandle(aSatelliteName);
 
-    if (satelliteIt == this->satelliteMap_.end())
+    if (!satelliteHandle.isDefined())
     {
         throw ostk::core::error::RuntimeError("No Satellite found with name [{}].", aSatelliteName);
     }
 
-    return *(satelliteIt->second);
+    return satelliteHandle;
+}
+
+const Satellite& Simulator::accessSatellite(const SatelliteHandle& aSatelliteHandle) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    const Shared<Satellite>* satelliteSPtrPtr = this->satelliteIndex_.access().resolve(aSatelliteHandle);
+
+    if (satelliteSPtrPtr == nullptr)
+    {
+        throw ostk::core::error::RuntimeError("No Satellite found with name [{}].", aSatelliteHandle.symbol);
+    }
+
+    if (!this->sharedSatelliteNames_.empty())
+    {
+        return *(this->unshareSatelliteWithName((*satelliteSPtrPtr)->getName(), false));
+    }
+
+    return **satelliteSPtrPtr;
 }
 
 Instant Simulator::getInstant() const
@@ -110,91 +303,1855 @@ Instant Simulator::getInstant() const
     return this->environment_.getInstant();
 }
 
-void Simulator::print(std::ostream& anOutputStream, bool displayDecorators) const
+const Scheduler& Simulator::accessScheduler() const
 {
-    displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "Simulator") : void();
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
 
-    // environment_.print(anOutputStream, true) ;
+    return this->scheduler_;
+}
 
-    displayDecorators ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+State Simulator::getComponentStateWithId(const String& aComponentId) const
+{
+    if (aComponentId.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Component id");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    const auto componentStateIt = this->componentStateMap_.access().find(aComponentId);
+
+    if (componentStateIt == this->componentStateMap_.access().end())
+    {
+        return State();
+    }
+
+    return componentStateIt->second;
 }
 
-void Simulator::setInstant(const Instant& anInstant)
+Map<String, StateTable> Simulator::evaluate(const Array<Instant>& anInstantArray) const
 {
     if (!this->isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Simulator");
     }
 
-    this->environment_.setInstant(anInstant);
+    if (anInstantArray.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant array");
+    }
+
+    Map<String, StateTable> stateTableMap;
+
+    const Size shardCount =
+        (this->threadPoolSPtr_ != nullptr)
+            ? std::min(anInstantArray.getSize(), this->threadPoolSPtr_->getThreadCount() * shardsPerThread)
+            : 1;
+
+    if (shardCount <= 1)
+    {
+        for (const auto& satelliteMapIt : this->satelliteMap_.access())
+        {
+            stateTableMap.insert(
+                {satelliteMapIt.first, StateTable::FromStates(satelliteMapIt.second->getStatesAt(anInstantArray))}
+            );
+        }
+
+        return stateTableMap;
+    }
+
+    // The grid is split into contiguous time shards: every (satellite, shard) pair is evaluated independently,
+    // then the shards of each satellite are concatenated in time order.
+
+    Array<Array<Instant>> instantShards = Array<Array<Instant>>::Empty();
+    instantShards.reserve(shardCount);
+
+    for (Index shardIndex = 0; shardIndex < shardCount; ++shardIndex)
+    {
+        const Index startIndex = (shardIndex * anInstantArray.getSize()) / shardCount;
+        const Index endIndex = ((shardIndex + 1) * anInstantArray.getSize()) / shardCount;
+
+        Array<Instant> instants = Array<Instant>::Empty();
+        instants.reserve(endIndex - startIndex);
+
+        for (Index index = startIndex; index < endIndex; ++index)
+        {
+            instants.add(anInstantArray[index]);
+        }
+
+        instantShards.add(instants);
+    }
+
+    Array<Shared<const Satellite>> satellites = Array<Shared<const Satellite>>::Empty();
+    satellites.reserve(this->satelliteMap_.access().size());
+
+    for (const auto& satelliteMapIt : this->satelliteMap_.access())
+    {
+        satellites.add(satelliteMapIt.second);
+    }
+
+    Array<StateTable> stateTables(satellites.getSize() * shardCount, StateTable::Undefined());
+
+    this->threadPoolSPtr_->parallelFor(
+        stateTables.getSize(),
+        [&satellites, &instantShards, &stateTables, &shardCount](const Index& anIndex)
+        {
+            stateTables[anIndex] = StateTable::FromStates(
+                satellites[anIndex / shardCount]->getStatesAt(instantShards[anIndex % shardCount])
+            );
+        }
+    );
+
+    for (Index satelliteIndex = 0; satelliteIndex < satellites.getSize(); ++satelliteIndex)
+    {
+        Array<StateTable> satelliteStateTables = Array<StateTable>::Empty();
+        satelliteStateTables.reserve(shardCount);
+
+        for (Index shardIndex = 0; shardIndex < shardCount; ++shardIndex)
+        {
+            satelliteStateTables.add(stateTables[(satelliteIndex * shardCount) + shardIndex]);
+        }
+
+        stateTableMap.insert({satellites[satelliteIndex]->getName(), StateTable::Concatenate(satelliteStateTables)});
+    }
+
+    return stateTableMap;
 }
 
-void Simulator::stepForward(const Duration& aDuration)
+Array<Detector::Crossing> Simulator::computeCrossings(
+    const Detector& aDetector, const Interval& anInterval, const Duration& aStep, const Duration& aTolerance
+) const
 {
     if (!this->isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Simulator");
     }
 
-    this->setInstant(this->environment_.getInstant() + aDuration);
+    if (this->threadPoolSPtr_ == nullptr)
+    {
+        return aDetector.computeCrossings(anInterval, aStep, aTolerance);
+    }
+
+    const Array<Interval> shards =
+        ShardInterval(anInterval, aStep, this->threadPoolSPtr_->getThreadCount() * shardsPerThread);
+
+    Array<Array<Detector::Crossing>> shardCrossings(shards.getSize(), Array<Detector::Crossing>::Empty());
+
+    this->threadPoolSPtr_->parallelFor(
+        shards.getSize(),
+        [&aDetector, &aStep, &aTolerance, &shards, &shardCrossings](const Index& anIndex)
+        {
+            shardCrossings[anIndex] = aDetector.computeCrossings(shards[anIndex], aStep, aTolerance);
+        }
+    );
+
+    // A crossing is found by the shard whose samples bracket it: shards do not overlap, so merging them in order
+    // keeps the crossings in time order.
+
+    Array<Detector::Crossing> crossings = Array<Detector::Crossing>::Empty();
+
+    for (const auto& crossingsOfShard : shardCrossings)
+    {
+        for (const auto& crossing : crossingsOfShard)
+        {
+            crossings.add(crossing);
+        }
+    }
+
+    return crossings;
 }
 
-void Simulator::addSatellite(const Shared<Satellite>& aSatelliteSPtr)
+TimeRange Simulator::range(
+    const Interval& anInterval, const Duration& aStep, const Size& aChunkSize, const bool& prefetch
+) const
 {
-    if ((!aSatelliteSPtr) || (!aSatelliteSPtr->isDefined()))
+    if (!this->isDefined())
     {
-        throw ostk::core::error::runtime::Undefined("Satellite");
+        throw ostk::core::error::runtime::Undefined("Simulator");
     }
 
+    return TimeRange(*this, anInterval, aStep, aChunkSize, prefetch);
+}
+
+Size Simulator::getThreadCount() const
+{
     if (!this->isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Simulator");
     }
 
-    this->satelliteMap_.insert({aSatelliteSPtr->getName(), aSatelliteSPtr});
+    return (this->threadPoolSPtr_ != nullptr) ? this->threadPoolSPtr_->getThreadCount() : 0;
 }
 
-void Simulator::removeSatelliteWithName(const String& aSatelliteName)
+#if defined(__linux__)
+
+Size Simulator::getProcessCount() const
 {
     if (!this->isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Simulator");
     }
 
-    if (!this->hasSatelliteWithName(aSatelliteName))
+    return this->processCount_;
+}
+
+#endif
+
+const History& Simulator::accessHistory() const
+{
+    if (!this->isDefined())
     {
-        throw ostk::core::error::RuntimeError("No Satellite found with name [{}].", aSatelliteName);
+        throw ostk::core::error::runtime::Undefined("Simulator");
     }
 
-    this->satelliteMap_.erase(aSatelliteName);
+    return this->history_.access();
 }
 
-void Simulator::clearSatellites()
+const Shared<FrameRegistry>& Simulator::accessFrameRegistry() const
 {
     if (!this->isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Simulator");
     }
 
-    this->satelliteMap_.clear();
+    return this->frameRegistrySPtr_;
 }
 
-Simulator Simulator::Undefined()
+const StateCache& Simulator::accessStateCache() const
 {
-    return {Environment::Undefined(), {}};
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    return this->stateCache_;
 }
 
-Shared<Simulator> Simulator::Configure(const SimulatorConfiguration& aSimulatorConfiguration)
+TrajectoryState Simulator::getSatelliteStateWithName(const String& aSatelliteName) const
 {
-    const Shared<Simulator> simulatorSPtr =
-        std::make_shared<Simulator>(aSimulatorConfiguration.environment, Array<Shared<Satellite>>::Empty());
+    // States do not depend on the component tree, which is not unshared to evaluate them
 
-    for (const auto& satelliteConfiguration : aSimulatorConfiguration.satellites)
+    const Satellite& satellite = *(this->findSatelliteWithName(aSatelliteName));
+
+    const Instant instant = this->getInstant();
+
+    const auto satelliteStateIt = this->satelliteStateMap_.access().find(aSatelliteName);
+
+    if ((satelliteStateIt != this->satelliteStateMap_.access().end()) && satelliteStateIt->second.isDefined() &&
+        (satelliteStateIt->second.getInstant() == instant))
     {
-        simulatorSPtr->addSatellite(Satellite::Configure(satelliteConfiguration, simulatorSPtr));
+        return satelliteStateIt->second;
     }
 
-    return simulatorSPtr;
+#if defined(__linux__)
+    // Partitioned states are read in place, unless their evaluation failed or the partition evaluated another
+    // instant since (partitions are shared with forks)
+
+    if ((this->partitionViewSPtr_ != nullptr) && (this->partitionViewSPtr_->getInstant() == instant))
+    {
+        const TrajectoryState state = this->partitionViewSPtr_->getSatelliteStateWithName(aSatelliteName);
+
+        if (state.isDefined())
+        {
+            return state;
+        }
+    }
+#endif
+
+    return this->stateCache_.getSatelliteState(
+        aSatelliteName,
+        [&satellite, &instant]() -> TrajectoryState
+        {
+            const TrajectoryState state = satellite.getStateAt(instant);
+
+            MemoizeSatelliteFrame(satellite, state);
+
+            return state;
+        }
+    );
+}
+
+ObjectGeometry Simulator::getGeometryInGCRF(const component::Geometry& aGeometry) const
+{
+    if (!aGeometry.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Geometry");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    const Instant instant = this->getInstant();
+
+    if (!instant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    return this->stateCache_.getGeometry(
+        aGeometry,
+        [this, &aGeometry]() -> ObjectGeometry
+        {
+            // The transform of the geometry frame is resolved through the transform tree of its satellite (if
+            // any), rather than by walking the frame graph
+
+            const Transform transform = this->getTransformToGCRF(aGeometry.accessFrame());
+
+            Matrix4d matrix = Matrix4d::Identity();
+
+            matrix.block<3, 1>(0, 3) = transform.applyToPosition(Vector3d::Zero());
+
+            for (Index index = 0; index < 3; ++index)
+            {
+                matrix.block<3, 1>(0, index) = transform.applyToVector(Vector3d::Unit(index));
+            }
+
+            Composite composite = aGeometry.accessComposite();
+
+            composite.applyTransformation(Transformation(matrix));
+
+            return {composite, Frame::GCRF()};
+        }
+    );
+}
+
+ObjectGeometry Simulator::getCelestialGeometryInGCRF(const Celestial& aCelestialObject) const
+{
+    if (!aCelestialObject.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Celestial object");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    const Instant instant = this->getInstant();
+
+    if (!instant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    const auto evaluator = [&aCelestialObject, &instant]() -> ObjectGeometry
+    {
+        return aCelestialObject.accessGeometry().in(Frame::GCRF(), instant);
+    };
+
+    // Only objects owned by the environment are cached, as their lifetime is tracked through the shared pointer
+
+    for (const auto& objectSPtr : this->environment_.accessObjects())
+    {
+        if (objectSPtr.get() == &aCelestialObject)
+        {
+            return this->stateCache_.getCelestialGeometry(
+                std::static_pointer_cast<const Celestial>(objectSPtr), evaluator
+            );
+        }
+    }
+
+    return evaluator();
+}
+
+Transform Simulator::getTransformToGCRF(const Shared<const Frame>& aFrameSPtr) const
+{
+    if ((aFrameSPtr == nullptr) || (!aFrameSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    const Instant instant = this->getInstant();
+
+    if (!instant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    const TransformTree* transformTreePtr = this->findTransformTree(aFrameSPtr);
+
+    return this->stateCache_.getTransform(
+        aFrameSPtr,
+        [&aFrameSPtr, &instant, transformTreePtr]() -> Transform
+        {
+            if (transformTreePtr != nullptr)
+            {
+                return transformTreePtr->getTransformToGCRF(aFrameSPtr, instant);
+            }
+
+            return aFrameSPtr->getTransformTo(Frame::GCRF(), instant);
+        }
+    );
+}
+
+Shared<Simulator> Simulator::fork() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    // Satellite component trees are shared with the fork, and copied by either branch when it first needs them to
+    // itself (see unshareSatelliteWithName)
+
+    for (const auto& satelliteMapIt : this->satelliteMap_.access())
+    {
+        this->sharedSatelliteNames_.insert(satelliteMapIt.first);
+    }
+
+    const Shared<Simulator> simulatorSPtr = std::make_shared<Simulator>(*this);
+
+    simulatorSPtr->forkWPtr_ = simulatorSPtr;
+    simulatorSPtr->stateCache_.clear();
+
+    // Behaviors cannot be copied: they stay with this simulator, and their pending resumptions are cancelled in the
+    // fork
+
+#if defined(__cpp_impl_coroutine)
+    for (const auto& behaviorMapIt : this->behaviorMap_)
+    {
+        const Behavior::promise_type& promise = behaviorMapIt.second.behaviorSPtr->accessPromise();
+
+        if (promise.hasPendingEvent)
+        {
+            simulatorSPtr->scheduler_.cancel(promise.eventId);
+        }
+    }
+#endif
+
+    simulatorSPtr->behaviorMap_.clear();
+
+    return simulatorSPtr;
+}
+
+Checkpoint Simulator::createCheckpoint() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    const Instant instant = this->environment_.getInstant();
+
+    if (!instant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    Array<Checkpoint::SatelliteRecord> satelliteRecords = Array<Checkpoint::SatelliteRecord>::Empty();
+    satelliteRecords.reserve(this->satelliteMap_.access().size());
+
+    for (const auto& satelliteMapIt : this->satelliteMap_.access())
+    {
+        const Satellite& satellite = *(satelliteMapIt.second);
+
+        Array<Checkpoint::ComponentRecord> componentRecords = Array<Checkpoint::ComponentRecord>::Empty();
+
+        RecordComponentTree(*this, satellite, 0, componentRecords);
+
+        satelliteRecords.add(
+            {satellite.getId(),
+             satellite.getName(),
+             this->getSatelliteStateWithName(satellite.getName()),
+             componentRecords}
+        );
+    }
+
+    return {instant, satelliteRecords};
+}
+
+void Simulator::print(std::ostream& anOutputStream, bool displayDecorators) const
+{
+    displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "Simulator") : void();
+
+    // environment_.print(anOutputStream, true) ;
+
+    displayDecorators ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+void Simulator::setInstant(const Instant& anInstant)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    this->preStepObservers_.invoke(*this, anInstant);
+
+    const Instant previousInstant = this->environment_.getInstant();
+
+    if (this->history_.access().isEnabled() && previousInstant.isDefined())
+    {
+#if defined(__linux__)
+        // Partitioned states are read in place, and only copied when recorded
+
+        if (this->partitionViewSPtr_ != nullptr)
+        {
+            this->satelliteStateMap_.assign(this->partitionViewSPtr_->getSatelliteStates());
+        }
+#endif
+
+        this->history_.edit().record(previousInstant, this->satelliteStateMap_.access(), this->componentStateMap_);
+    }
+
+#if defined(__linux__)
+    this->partitionViewSPtr_ = nullptr;
+#endif
+
+    this->environment_.setInstant(anInstant);
+    this->stateCache_.invalidate();
+
+    if (this->history_.access().hasInstant(anInstant))
+    {
+        this->satelliteStateMap_.assign(this->history_.access().getSatelliteStatesAt(anInstant));
+        this->componentStateMap_ = this->history_.access().accessComponentStatesAt(anInstant);
+        this->memoizeSatelliteFrames();
+    }
+    else
+    {
+        this->updateSatelliteStates();
+    }
+
+    this->notifySatelliteObservers();
+
+    this->postStepObservers_.invoke(*this, anInstant);
+}
+
+void Simulator::stepForward(const Duration& aDuration)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    this->setInstant(this->environment_.getInstant() + aDuration);
+}
+
+void Simulator::stepBackward(const Duration& aDuration)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    this->setInstant(this->environment_.getInstant() - aDuration);
+}
+
+Duration Simulator::stepForwardAdaptively(
+    const Array<Detector>& aDetectorArray, const Duration& aMinimumStep, const Duration& aMaximumStep
+)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    if ((!aMinimumStep.isDefined()) || (!aMinimumStep.isStrictlyPositive()))
+    {
+        throw ostk::core::error::runtime::Wrong("Minimum step");
+    }
+
+    if ((!aMaximumStep.isDefined()) || (aMaximumStep < aMinimumStep))
+    {
+        throw ostk::core::error::runtime::Wrong("Maximum step");
+    }
+
+    const Instant instant = this->environment_.getInstant();
+
+    Duration step = aMaximumStep;
+
+    for (const auto& detector : aDetectorArray)
+    {
+        if (step == aMinimumStep)
+        {
+            break;
+        }
+
+        const Duration safeStep = detector.computeSafeStepAt(instant);
+
+        if (safeStep.isDefined())
+        {
+            step = std::max(std::min(step, safeStep), aMinimumStep);
+        }
+    }
+
+    this->stepForward(step);
+
+    return step;
+}
+
+void Simulator::setThreadCount(const Size& aThreadCount)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    if (aThreadCount == 0)
+    {
+        this->threadPoolSPtr_ = nullptr;
+        this->updateSatelliteStates();
+
+        return;
+    }
+
+    if ((this->threadPoolSPtr_ != nullptr) && (this->threadPoolSPtr_->getThreadCount() == aThreadCount))
+    {
+        return;
+    }
+
+    this->threadPoolSPtr_ = std::make_shared<ThreadPool>(aThreadCount);
+
+    this->updateSatelliteStates();
+}
+
+#if defined(__linux__)
+
+void Simulator::setProcessCount(const Size& aProcessCount)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    if (aProcessCount == this->processCount_)
+    {
+        return;
+    }
+
+    this->processCount_ = aProcessCount;
+
+    // Workers that cannot be forked leave partitioning disabled
+
+    try
+    {
+        this->resetPartition();
+    }
+    catch (...)
+    {
+        this->processCount_ = 0;
+        this->updateSatelliteStates();
+
+        throw;
+    }
+
+    this->updateSatelliteStates();
+}
+
+#endif
+
+void Simulator::setHistoryMemoryBudget(const Size& aMemoryBudget)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    const bool wasEnabled = this->history_.access().isEnabled();
+
+    this->history_.edit().setMemoryBudget(aMemoryBudget);
+
+    if (wasEnabled != this->history_.access().isEnabled())
+    {
+        this->updateSatelliteStates();
+    }
+}
+
+Index Simulator::addPreStepObserver(const StepObserver& anObserver)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    this->preStepObservers_.add(this->nextObserverId_, anObserver);
+
+    return this->nextObserverId_++;
+}
+
+Index Simulator::addPreStepObserver(const std::function<void(const Simulator&, const Instant&)>& anObserver)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    const auto observerSPtr = std::make_shared<const std::function<void(const Simulator&, const Instant&)>>(anObserver);
+
+    this->preStepObservers_.add(
+        this->nextObserverId_, StepObserver::FromCallable(observerSPtr.get()), observerSPtr
+    );
+
+    return this->nextObserverId_++;
+}
+
+Index Simulator::addPostStepObserver(const StepObserver& anObserver)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    this->postStepObservers_.add(this->nextObserverId_, anObserver);
+
+    return this->nextObserverId_++;
+}
+
+Index Simulator::addPostStepObserver(const std::function<void(const Simulator&, const Instant&)>& anObserver)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    const auto observerSPtr = std::make_shared<const std::function<void(const Simulator&, const Instant&)>>(anObserver);
+
+    this->postStepObservers_.add(
+        this->nextObserverId_, StepObserver::FromCallable(observerSPtr.get()), observerSPtr
+    );
+
+    return this->nextObserverId_++;
+}
+
+Index Simulator::addSatelliteObserver(const SatelliteObserver& anObserver)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    this->satelliteObservers_.add(this->nextObserverId_, anObserver);
+
+    return this->nextObserverId_++;
+}
+
+Index Simulator::addSatelliteObserver(
+    const std::function<void(const Simulator&, const Satellite&, const TrajectoryState&)>& anObserver
+)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    const auto observerSPtr =
+        std::make_shared<const std::function<void(const Simulator&, const Satellite&, const TrajectoryState&)>>(
+            anObserver
+        );
+
+    this->satelliteObservers_.add(
+        this->nextObserverId_, SatelliteObserver::FromCallable(observerSPtr.get()), observerSPtr
+    );
+
+    return this->nextObserverId_++;
+}
+
+void Simulator::removeObserver(const Index& anObserverId)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    if (this->preStepObservers_.remove(anObserverId) || this->postStepObservers_.remove(anObserverId) ||
+        this->satelliteObservers_.remove(anObserverId))
+    {
+        return;
+    }
+
+    throw ostk::core::error::RuntimeError("No observer with id [{}].", anObserverId);
+}
+
+void Simulator::setComponentStateWithId(const String& aComponentId, const State& aState)
+{
+    if (aComponentId.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Component id");
+    }
+
+    if (!aState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    this->componentStateMap_.edit().insert_or_assign(aComponentId, aState);
+}
+
+Index Simulator::scheduleEvent(const Instant& anInstant, const Scheduler::Callback& aCallback)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (anInstant < this->getInstant())
+    {
+        throw ostk::core::error::RuntimeError(
+            "Cannot schedule Event at [{}], before simulation instant [{}].",
+            anInstant.toString(),
+            this->getInstant().toString()
+        );
+    }
+
+    return this->scheduler_.schedule(anInstant, aCallback);
+}
+
+Index Simulator::scheduleComponentStateChange(
+    const Instant& anInstant, const String& aComponentId, const State& aState
+)
+{
+    if (aComponentId.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Component id");
+    }
+
+    if (!aState.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State");
+    }
+
+    return this->scheduleEvent(
+        anInstant,
+        [aComponentId, aState](Simulator& aSimulator)
+        {
+            aSimulator.setComponentStateWithId(aComponentId, aState);
+        }
+    );
+}
+
+Array<Index> Simulator::scheduleCrossings(
+    const Detector& aDetector,
+    const Interval& anInterval,
+    const Duration& aStep,
+    const std::function<void(Simulator&, const Detector::Crossing&)>& aCallback
+)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    if (!aCallback)
+    {
+        throw ostk::core::error::runtime::Undefined("Callback");
+    }
+
+    if (anInterval.isDefined() && (anInterval.getStart() < this->getInstant()))
+    {
+        throw ostk::core::error::RuntimeError(
+            "Cannot schedule Events from [{}], before simulation instant [{}].",
+            anInterval.getStart().toString(),
+            this->getInstant().toString()
+        );
+    }
+
+    Array<Index> eventIds = Array<Index>::Empty();
+
+    for (const auto& crossing : this->computeCrossings(aDetector, anInterval, aStep))
+    {
+        eventIds.add(this->scheduler_.schedule(
+            crossing.instant,
+            [crossing, aCallback](Simulator& aSimulator)
+            {
+                aCallback(aSimulator, crossing);
+            }
+        ));
+    }
+
+    return eventIds;
+}
+
+void Simulator::cancelEvent(const Index& anEventId)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    this->scheduler_.cancel(anEventId);
+}
+
+#if defined(__cpp_impl_coroutine)
+
+Index Simulator::startBehavior(Behavior&& aBehavior)
+{
+    return this->startBehaviorWithOwnerId(std::move(aBehavior), String::Empty());
+}
+
+Index Simulator::startBehavior(Behavior&& aBehavior, const Component& aComponent)
+{
+    if (!aComponent.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Component");
+    }
+
+    return this->startBehaviorWithOwnerId(std::move(aBehavior), aComponent.getId());
+}
+
+#endif
+
+void Simulator::cancelBehavior(const Index& aBehaviorId)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    const auto behaviorIt = this->behaviorMap_.find(aBehaviorId);
+
+    if (behaviorIt == this->behaviorMap_.end())
+    {
+        throw ostk::core::error::RuntimeError("No running Behavior found with id [{}].", aBehaviorId);
+    }
+
+#if defined(__cpp_impl_coroutine)
+    const Behavior::promise_type& promise = behaviorIt->second.behaviorSPtr->accessPromise();
+
+    if (promise.hasPendingEvent)
+    {
+        this->scheduler_.cancel(promise.eventId);
+    }
+#endif
+
+    this->behaviorMap_.erase(behaviorIt);
+}
+
+Size Simulator::getBehaviorCount() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    return this->behaviorMap_.size();
+}
+
+void Simulator::run(const Instant& anInstant)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (anInstant < this->getInstant())
+    {
+        throw ostk::core::error::RuntimeError(
+            "Cannot run until [{}], before simulation instant [{}].",
+            anInstant.toString(),
+            this->getInstant().toString()
+        );
+    }
+
+    while ((!this->scheduler_.isEmpty()) && (this->scheduler_.getNextInstant() <= anInstant))
+    {
+        const Scheduler::Event event = this->scheduler_.pop();
+
+        if (event.instant > this->getInstant())
+        {
+            this->setInstant(event.instant);
+        }
+
+        event.callback(*this);
+    }
+
+    if (anInstant != this->getInstant())
+    {
+        this->setInstant(anInstant);
+    }
+}
+
+Pacer::Report Simulator::runPaced(
+    const Instant& anInstant,
+    const Pacer& aPacer,
+    const std::function<void(Simulator&, const Pacer::Frame&)>& aFrameCallback
+)
+{
+    using Clock = std::chrono::steady_clock;
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    if (!aPacer.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Pacer");
+    }
+
+    if (anInstant < this->getInstant())
+    {
+        throw ostk::core::error::RuntimeError(
+            "Cannot run until [{}], before simulation instant [{}].",
+            anInstant.toString(),
+            this->getInstant().toString()
+        );
+    }
+
+    const auto durationFromClockDuration = [](const Clock::duration& aClockDuration) -> Duration
+    {
+        return Duration::Nanoseconds(
+            static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(aClockDuration).count())
+        );
+    };
+
+    const bool isPaced = aPacer.isPaced();
+    const Clock::duration framePeriod = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::nanoseconds(static_cast<std::int64_t>(aPacer.getFramePeriod().inNanoseconds()))
+    );
+
+    const Instant startInstant = this->getInstant();
+    const Clock::time_point startTime = Clock::now();
+
+    Clock::time_point deadline = startTime + framePeriod;
+    Duration step = aPacer.getStep();
+
+    Size frameCount = 0;
+    Size overrunCount = 0;
+    Clock::duration computeDurationSum = Clock::duration::zero();
+    Clock::duration maximumComputeDuration = Clock::duration::zero();
+    Clock::duration maximumLag = Clock::duration::zero();
+
+    while (this->getInstant() < anInstant)
+    {
+        const Clock::time_point frameStartTime = Clock::now();
+
+        this->run((step < (anInstant - this->getInstant())) ? (this->getInstant() + step) : anInstant);
+
+        const Clock::time_point frameEndTime = Clock::now();
+
+        const Clock::duration computeDuration = frameEndTime - frameStartTime;
+        const bool isOverrun = isPaced && (frameEndTime > deadline);
+        const Clock::duration lag = isOverrun ? (frameEndTime - deadline) : Clock::duration::zero();
+
+        computeDurationSum += computeDuration;
+        maximumComputeDuration = std::max(maximumComputeDuration, computeDuration);
+        maximumLag = std::max(maximumLag, lag);
+        overrunCount += isOverrun ? 1 : 0;
+
+        const Pacer::Frame frame = {
+            frameCount,
+            this->getInstant(),
+            durationFromClockDuration(computeDuration),
+            durationFromClockDuration(lag),
+            isOverrun,
+        };
+
+        frameCount += 1;
+
+        if (aFrameCallback)
+        {
+            aFrameCallback(*this, frame);
+        }
+
+        if (!isPaced)
+        {
+            continue;
+        }
+
+        step = aPacer.getStep();
+
+        if (!isOverrun)
+        {
+            std::this_thread::sleep_until(deadline);
+
+            deadline += framePeriod;
+
+            continue;
+        }
+
+        switch (aPacer.getCatchUpPolicy())
+        {
+            case Pacer::CatchUpPolicy::Skip:
+                deadline = frameEndTime + framePeriod;
+                break;
+
+            case Pacer::CatchUpPolicy::Burst:
+                deadline += framePeriod;
+                break;
+
+            case Pacer::CatchUpPolicy::Stretch:
+                deadline = frameEndTime + framePeriod;
+                step = step + (frame.lag * aPacer.getTimeRatio());
+                break;
+        }
+    }
+
+    const Duration wallClockDuration = durationFromClockDuration(Clock::now() - startTime);
+
+    return {
+        frameCount,
+        overrunCount,
+        (frameCount > 0) ? durationFromClockDuration(computeDurationSum / frameCount) : Duration::Zero(),
+        durationFromClockDuration(maximumComputeDuration),
+        durationFromClockDuration(maximumLag),
+        wallClockDuration,
+        wallClockDuration.isStrictlyPositive()
+            ? Real((this->getInstant() - startInstant).inSeconds() / wallClockDuration.inSeconds())
+            : Real::Undefined(),
+    };
+}
+
+void Simulator::restore(const Checkpoint& aCheckpoint)
+{
+    if (!aCheckpoint.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Checkpoint");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    const Array<Checkpoint::SatelliteRecord>& satelliteRecords = aCheckpoint.accessSatelliteRecords();
+
+    if (satelliteRecords.getSize() != this->satelliteMap_.access().size())
+    {
+        throw ostk::core::error::RuntimeError(
+            "Checkpoint satellite count [{}] does not match simulator satellite count [{}].",
+            satelliteRecords.getSize(),
+            this->satelliteMap_.access().size()
+        );
+    }
+
+    // The checkpoint is validated as a whole before any change, so that a mismatch leaves the simulator untouched
+
+    Map<String, State> componentStateMap = {};
+
+    for (const auto& satelliteRecord : satelliteRecords)
+    {
+        const auto satelliteMapIt = this->satelliteMap_.access().find(satelliteRecord.name);
+
+        if ((satelliteMapIt == this->satelliteMap_.access().end()) ||
+            (satelliteMapIt->second->getId() != satelliteRecord.id))
+        {
+            throw ostk::core::error::RuntimeError(
+                "Checkpoint satellite [{}] not found in simulator.", satelliteRecord.name
+            );
+        }
+
+        Array<Checkpoint::ComponentRecord> componentRecords = Array<Checkpoint::ComponentRecord>::Empty();
+
+        RecordComponentTree(*this, *(satelliteMapIt->second), 0, componentRecords);
+
+        const bool isMatching = std::equal(
+            componentRecords.begin(),
+            componentRecords.end(),
+            satelliteRecord.componentRecords.begin(),
+            satelliteRecord.componentRecords.end(),
+            [](const Checkpoint::ComponentRecord& aFirstRecord, const Checkpoint::ComponentRecord& aSecondRecord)
+            {
+                return (aFirstRecord.id == aSecondRecord.id) && (aFirstRecord.name == aSecondRecord.name) &&
+                       (aFirstRecord.depth == aSecondRecord.depth);
+            }
+        );
+
+        if (!isMatching)
+        {
+            throw ostk::core::error::RuntimeError(
+                "Checkpoint component tree of satellite [{}] does not match simulator.", satelliteRecord.name
+            );
+        }
+
+        for (const auto& componentRecord : satelliteRecord.componentRecords)
+        {
+            componentStateMap.insert_or_assign(componentRecord.id, componentRecord.state);
+        }
+    }
+
+    // Behaviors are not part of checkpoints either: with their resumptions cleared, they would never resume
+
+    this->scheduler_.clear();
+    this->behaviorMap_.clear();
+    this->componentStateMap_.assign(componentStateMap);
+
+    this->environment_.setInstant(aCheckpoint.getInstant());
+    this->stateCache_.invalidate();
+
+    this->clearHistory();
+
+    // Recorded states are reused whatever the update configuration: they are valid until the instant changes
+
+    Map<String, TrajectoryState> satelliteStateMap = {};
+
+    for (const auto& satelliteRecord : satelliteRecords)
+    {
+        satelliteStateMap.insert({satelliteRecord.name, satelliteRecord.state});
+    }
+
+    this->satelliteStateMap_.assign(satelliteStateMap);
+#if defined(__linux__)
+    this->partitionViewSPtr_ = nullptr;
+#endif
+    this->memoizeSatelliteFrames();
+}
+
+void Simulator::addSatellite(const Shared<Satellite>& aSatelliteSPtr)
+{
+    this->addSatellites({aSatelliteSPtr});
+}
+
+void Simulator::addSatellites(const Array<Shared<Satellite>>& aSatelliteArray)
+{
+    for (const auto& satelliteSPtr : aSatelliteArray)
+    {
+        if ((!satelliteSPtr) || (!satelliteSPtr->isDefined()))
+        {
+            throw ostk::core::error::runtime::Undefined("Satellite");
+        }
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    if (aSatelliteArray.isEmpty())
+    {
+        return;
+    }
+
+    // Inserting by ascending name lets each insertion start from the previous one, instead of searching from the
+    // root. The sort is stable, so that the first of several satellites with the same name is kept.
+
+    Array<Shared<Satellite>> satellites = aSatelliteArray;
+
+    std::stable_sort(
+        satellites.begin(),
+        satellites.end(),
+        [](const Shared<Satellite>& aFirstSatelliteSPtr, const Shared<Satellite>& aSecondSatelliteSPtr)
+        {
+            return aFirstSatelliteSPtr->getName() < aSecondSatelliteSPtr->getName();
+        }
+    );
+
+    Map<String, Shared<Satellite>>& satelliteMap = this->satelliteMap_.edit();
+    SymbolIndex<Shared<Satellite>>& satelliteIndex = this->satelliteIndex_.edit();
+    Map<String, TrajectoryState>& satelliteStateMap = this->satelliteStateMap_.edit();
+
+    satelliteIndex.reserve(satelliteIndex.getSize() + satellites.getSize());
+
+    auto hintIt = satelliteMap.begin();
+
+    for (const auto& satelliteSPtr : satellites)
+    {
+        const String name = satelliteSPtr->getName();
+
+        // Both keep the satellite already present under a name
+
+        const auto satelliteMapIt = satelliteMap.emplace_hint(hintIt, name, satelliteSPtr);
+
+        if (satelliteMapIt->second == satelliteSPtr)
+        {
+            this->indexTransformTree(*satelliteSPtr);
+        }
+
+        hintIt = std::next(satelliteMapIt);
+        satelliteIndex.insert(Symbol(name), satelliteSPtr);
+        satelliteStateMap.erase(name);
+    }
+
+    this->stateCache_.clear();
+    this->clearHistory();
+    this->resetPartition();
+}
+
+void Simulator::removeSatelliteWithName(const String& aSatelliteName)
+{
+    this->removeSatellitesWithNames({aSatelliteName});
+}
+
+void Simulator::removeSatellitesWithNames(const Array<String>& aSatelliteNameArray)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    for (const auto& satelliteName : aSatelliteNameArray)
+    {
+        if (!this->hasSatelliteWithName(satelliteName))
+        {
+            throw ostk::core::error::RuntimeError("No Satellite found with name [{}].", satelliteName);
+        }
+    }
+
+    if (aSatelliteNameArray.isEmpty())
+    {
+        return;
+    }
+
+    Map<String, Shared<Satellite>>& satelliteMap = this->satelliteMap_.edit();
+    SymbolIndex<Shared<Satellite>>& satelliteIndex = this->satelliteIndex_.edit();
+    Map<String, TrajectoryState>& satelliteStateMap = this->satelliteStateMap_.edit();
+
+    for (const auto& satelliteName : aSatelliteNameArray)
+    {
+        const auto satelliteMapIt = satelliteMap.find(satelliteName);
+
+        // Names listed more than once are removed on their first occurrence
+
+        if (satelliteMapIt == satelliteMap.end())
+        {
+            continue;
+        }
+
+        this->cancelBehaviorsOfSatellite(*satelliteMapIt->second);
+
+        this->unindexTransformTree(*satelliteMapIt->second);
+
+        satelliteMap.erase(satelliteMapIt);
+        satelliteIndex.erase(Symbol(satelliteName));
+        satelliteStateMap.erase(satelliteName);
+        this->sharedSatelliteNames_.erase(satelliteName);
+    }
+
+    this->stateCache_.clear();
+    this->clearHistory();
+    this->resetPartition();
+}
+
+void Simulator::clearSatellites()
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    for (const auto& satelliteMapIt : this->satelliteMap_.access())
+    {
+        this->cancelBehaviorsOfSatellite(*satelliteMapIt.second);
+    }
+
+    this->satelliteMap_.assign({});
+    this->satelliteIndex_.assign({});
+    this->sharedSatelliteNames_.clear();
+    this->transformTreeIndex_.assign({});
+    this->satelliteStateMap_.assign({});
+    this->stateCache_.clear();
+    this->clearHistory();
+    this->resetPartition();
+}
+
+Simulator Simulator::Undefined()
+{
+    return {Environment::Undefined(), {}};
+}
+
+Shared<Simulator> Simulator::Configure(const SimulatorConfiguration& aSimulatorConfiguration)
+{
+    const Shared<Simulator> simulatorSPtr =
+        std::make_shared<Simulator>(aSimulatorConfiguration.environment, Array<Shared<Satellite>>::Empty());
+
+    // Ephemerides are all sampled on a single pool, sized by the largest configured ephemeris thread count, rather
+    // than spawning threads per satellite
+
+    Size ephemerisThreadCount = 0;
+
+    for (const auto& satelliteConfiguration : aSimulatorConfiguration.satellites)
+    {
+        const EphemerisConfiguration& ephemerisConfiguration = satelliteConfiguration.ephemeris;
+
+        if (ephemerisConfiguration.interval.isDefined())
+        {
+            ephemerisThreadCount = std::max<Size>(
+                ephemerisThreadCount,
+                (ephemerisConfiguration.threadCount == 0) ? std::max<Size>(1, std::thread::hardware_concurrency())
+                                                          : ephemerisConfiguration.threadCount
+            );
+        }
+    }
+
+    const Shared<ThreadPool> ephemerisThreadPoolSPtr =
+        (ephemerisThreadCount > 0) ? std::make_shared<ThreadPool>(ephemerisThreadCount) : nullptr;
+
+    // Frames are registered in the frame registry of the simulator, then satellites are added in a single batch
+
+    Array<Shared<Satellite>> satellites = Array<Shared<Satellite>>::Empty();
+    satellites.reserve(aSimulatorConfiguration.satellites.getSize());
+
+    for (const auto& satelliteConfiguration : aSimulatorConfiguration.satellites)
+    {
+        satellites.add(Satellite::Configure(satelliteConfiguration, simulatorSPtr, ephemerisThreadPoolSPtr));
+    }
+
+    simulatorSPtr->addSatellites(satellites);
+
+    simulatorSPtr->setThreadCount(aSimulatorConfiguration.threadCount);
+
+    return simulatorSPtr;
+}
+
+#if defined(__cpp_impl_coroutine)
+
+Index Simulator::startBehaviorWithOwnerId(Behavior&& aBehavior, const String& anOwnerId)
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    if (!aBehavior.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Behavior");
+    }
+
+    Behavior::promise_type& promise = aBehavior.accessPromise();
+
+    if (aBehavior.isDone() || (promise.simulatorPtr != nullptr))
+    {
+        throw ostk::core::error::RuntimeError("Behavior already started.");
+    }
+
+    const Index behaviorId = this->nextBehaviorId_++;
+
+    promise.simulatorPtr = this;
+    promise.id = behaviorId;
+
+    this->behaviorMap_.insert({behaviorId, {std::make_shared<Behavior>(std::move(aBehavior)), anOwnerId}});
+
+    this->resumeBehavior(behaviorId);
+
+    return behaviorId;
+}
+
+Index Simulator::scheduleBehaviorResumption(const Index& aBehaviorId, const Instant& anInstant)
+{
+    return this->scheduleEvent(
+        anInstant,
+        [aBehaviorId](Simulator& aSimulator)
+        {
+            aSimulator.resumeBehavior(aBehaviorId);
+        }
+    );
+}
+
+void Simulator::resumeBehavior(const Index& aBehaviorId)
+{
+    const auto behaviorIt = this->behaviorMap_.find(aBehaviorId);
+
+    if (behaviorIt == this->behaviorMap_.end())
+    {
+        return;
+    }
+
+    // Keep the behavior alive while it runs, even if it cancels itself
+
+    const Shared<Behavior> behaviorSPtr = behaviorIt->second.behaviorSPtr;
+    Behavior::promise_type& promise = behaviorSPtr->accessPromise();
+
+    if (promise.simulatorPtr != this)
+    {
+        return;
+    }
+
+    promise.hasPendingEvent = false;
+
+    behaviorSPtr->resume();
+
+    if (behaviorSPtr->isDone())
+    {
+        this->behaviorMap_.erase(aBehaviorId);
+
+        if (promise.exceptionPtr != nullptr)
+        {
+            std::rethrow_exception(promise.exceptionPtr);
+        }
+    }
+}
+
+#endif
+
+void Simulator::cancelBehaviorsOfSatellite(const Satellite& aSatellite)
+{
+    Array<Index> behaviorIds = Array<Index>::Empty();
+
+    for (const auto& behaviorMapIt : this->behaviorMap_)
+    {
+        const String& ownerId = behaviorMapIt.second.ownerId;
+
+        if ((!ownerId.isEmpty()) && HoldsComponentWithId(aSatellite, ownerId))
+        {
+            behaviorIds.add(behaviorMapIt.first);
+        }
+    }
+
+    for (const auto& behaviorId : behaviorIds)
+    {
+        this->cancelBehavior(behaviorId);
+    }
+}
+
+void Simulator::updateSatelliteStates()
+{
+    this->satelliteStateMap_.assign({});
+#if defined(__linux__)
+    this->partitionViewSPtr_ = nullptr;
+#endif
+
+    bool storesSatelliteStates = (this->threadPoolSPtr_ != nullptr) || this->history_.access().isEnabled();
+
+#if defined(__linux__)
+    storesSatelliteStates = storesSatelliteStates || (this->partitionSPtr_ != nullptr);
+#endif
+
+    if ((!storesSatelliteStates) || this->satelliteMap_.access().empty())
+    {
+        return;
+    }
+
+    const Instant instant = this->environment_.getInstant();
+
+    if (!instant.isDefined())
+    {
+        return;
+    }
+
+#if defined(__linux__)
+    if (this->partitionSPtr_ != nullptr)
+    {
+        // Satellites left out by the workers (evaluation failure) are evaluated again on demand
+        this->partitionViewSPtr_ = std::make_shared<const Partition::View>(this->partitionSPtr_->getStatesAt(instant));
+        this->memoizeSatelliteFrames();
+
+        return;
+    }
+#endif
+
+    Array<Shared<const Satellite>> satellites = Array<Shared<const Satellite>>::Empty();
+    satellites.reserve(this->satelliteMap_.access().size());
+
+    for (const auto& satelliteMapIt : this->satelliteMap_.access())
+    {
+        satellites.add(satelliteMapIt.second);
+    }
+
+    Array<TrajectoryState> states(satellites.getSize(), TrajectoryState::Undefined());
+
+    // Each satellite profile is evaluated independently. Failures are not propagated: the state is left
+    // undefined and evaluated again on demand, so that the error surfaces to the caller querying it.
+
+    const auto evaluateState = [&satellites, &states, &instant](const Index& anIndex)
+    {
+        try
+        {
+            states[anIndex] = satellites[anIndex]->getStateAt(instant);
+        }
+        catch (const std::exception&)
+        {
+            states[anIndex] = TrajectoryState::Undefined();
+        }
+    };
+
+    if (this->threadPoolSPtr_ != nullptr)
+    {
+        this->threadPoolSPtr_->parallelFor(satellites.getSize(), evaluateState);
+    }
+    else
+    {
+        for (Index index = 0; index < satellites.getSize(); ++index)
+        {
+            evaluateState(index);
+        }
+    }
+
+    Map<String, TrajectoryState>& satelliteStateMap = this->satelliteStateMap_.edit();
+
+    for (Index index = 0; index < satellites.getSize(); ++index)
+    {
+        satelliteStateMap.insert({satellites[index]->getName(), states[index]});
+    }
+
+    this->memoizeSatelliteFrames();
+}
+
+void Simulator::memoizeSatelliteFrames() const
+{
+    const Map<String, Shared<Satellite>>& satelliteMap = this->satelliteMap_.access();
+
+#if defined(__linux__)
+    if (this->partitionViewSPtr_ != nullptr)
+    {
+        // Records are only decoded for satellites with a frame to memoize
+
+        for (const auto& satelliteMapIt : satelliteMap)
+        {
+            if (satelliteMapIt.second->accessFrame() != nullptr)
+            {
+                MemoizeSatelliteFrame(
+                    *satelliteMapIt.second,
+                    this->partitionViewSPtr_->getSatelliteStateWithName(satelliteMapIt.first)
+                );
+            }
+        }
+
+        return;
+    }
+#endif
+
+    for (const auto& satelliteStateIt : this->satelliteStateMap_.access())
+    {
+        const auto satelliteIt = satelliteMap.find(satelliteStateIt.first);
+
+        if (satelliteIt != satelliteMap.end())
+        {
+            MemoizeSatelliteFrame(*satelliteIt->second, satelliteStateIt.second);
+        }
+    }
+}
+
+void Simulator::indexTransformTree(const Satellite& aSatellite)
+{
+    const Shared<const Frame>& frameSPtr = aSatellite.accessFrame();
+
+    // Satellites without a frame have no frames to serve
+
+    if ((frameSPtr == nullptr) || (!frameSPtr->isDefined()))
+    {
+        return;
+    }
+
+    const Shared<const TransformTree> transformTreeSPtr = std::make_shared<const TransformTree>(aSatellite);
+
+    std::unordered_map<const Frame*, Shared<const TransformTree>>& transformTreeIndex =
+        this->transformTreeIndex_.edit();
+
+    for (const auto& treeFrameSPtr : transformTreeSPtr->getFrames())
+    {
+        transformTreeIndex.insert_or_assign(treeFrameSPtr.get(), transformTreeSPtr);
+    }
+}
+
+void Simulator::unindexTransformTree(const Satellite& aSatellite)
+{
+    const Shared<const Frame>& frameSPtr = aSatellite.accessFrame();
+
+    if (frameSPtr == nullptr)
+    {
+        return;
+    }
+
+    std::unordered_map<const Frame*, Shared<const TransformTree>>& transformTreeIndex =
+        this->transformTreeIndex_.edit();
+
+    const auto transformTreeIt = transformTreeIndex.find(frameSPtr.get());
+
+    if (transformTreeIt == transformTreeIndex.end())
+    {
+        return;
+    }
+
+    // Held, as erasing the frames of the tree releases it
+
+    const Shared<const TransformTree> transformTreeSPtr = transformTreeIt->second;
+
+    for (const auto& treeFrameSPtr : transformTreeSPtr->getFrames())
+    {
+        const auto treeFrameIt = transformTreeIndex.find(treeFrameSPtr.get());
+
+        if ((treeFrameIt != transformTreeIndex.end()) && (treeFrameIt->second == transformTreeSPtr))
+        {
+            transformTreeIndex.erase(treeFrameIt);
+        }
+    }
+}
+
+const TransformTree* Simulator::findTransformTree(const Shared<const Frame>& aFrameSPtr) const
+{
+    const std::unordered_map<const Frame*, Shared<const TransformTree>>& transformTreeIndex =
+        this->transformTreeIndex_.access();
+
+    const auto transformTreeIt = transformTreeIndex.find(aFrameSPtr.get());
+
+    return (transformTreeIt != transformTreeIndex.end()) ? transformTreeIt->second.get() : nullptr;
+}
+
+const Shared<Satellite>& Simulator::findSatelliteWithName(const String& aSatelliteName) const
+{
+    if (aSatelliteName.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Satellite name");
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Simulator");
+    }
+
+    const Shared<Satellite>* satelliteSPtrPtr = this->satelliteIndex_.access().find(aSatelliteName);
+
+    if (satelliteSPtrPtr == nullptr)
+    {
+        throw ostk::core::error::RuntimeError("No Satellite found with name [{}].", aSatelliteName);
+    }
+
+    return *satelliteSPtrPtr;
+}
+
+const Shared<Satellite>& Simulator::unshareSatelliteWithName(const String& aSatelliteName, const bool isModified) const
+{
+    const Shared<Satellite>& satelliteSPtr = *(this->satelliteIndex_.access().find(aSatelliteName));
+
+    if (this->sharedSatelliteNames_.find(aSatelliteName) == this->sharedSatelliteNames_.end())
+    {
+        return satelliteSPtr;
+    }
+
+    // A fork binds the trees it shares to itself, other simulators keep their binding. A tree already bound to this
+    // simulator is only copied to be modified.
+
+    const Shared<const Simulator> forkSPtr = this->forkWPtr_.lock();
+    const Shared<const Simulator> simulatorSPtr = (forkSPtr.get() == this) ? forkSPtr : satelliteSPtr->simulatorSPtr_;
+
+    if ((!isModified) && (satelliteSPtr->simulatorSPtr_ == simulatorSPtr))
+    {
+        return satelliteSPtr;
+    }
+
+    const Shared<Satellite> unsharedSatelliteSPtr = std::make_shared<Satellite>(*satelliteSPtr);
+
+    unsharedSatelliteSPtr->bindSimulator(simulatorSPtr);
+
+    SymbolIndex<Shared<Satellite>>& satelliteIndex = this->satelliteIndex_.edit();
+
+    this->satelliteMap_.edit().at(aSatelliteName) = unsharedSatelliteSPtr;
+    satelliteIndex.erase(Symbol(aSatelliteName));
+    satelliteIndex.insert(Symbol(aSatelliteName), unsharedSatelliteSPtr);
+
+    this->sharedSatelliteNames_.erase(aSatelliteName);
+
+    // Cached geometries are keyed by component, and the copy replaces the components of the tree
+
+    this->stateCache_.clear();
+
+    return *(satelliteIndex.find(aSatelliteName));
+}
+
+void Simulator::unshareSatellites(const bool isModified) const
+{
+    // Only a fork copies the trees it shares to hand them out read-only
+
+    if (this->sharedSatelliteNames_.empty() || ((!isModified) && (this->forkWPtr_.lock().get() != this)))
+    {
+        return;
+    }
+
+    const std::set<String> sharedSatelliteNames = this->sharedSatelliteNames_;
+
+    for (const auto& satelliteName : sharedSatelliteNames)
+    {
+        this->unshareSatelliteWithName(satelliteName, isModified);
+    }
+}
+
+void Simulator::clearHistory()
+{
+    if (!this->history_.access().isEmpty())
+    {
+        this->history_.assign(History(this->history_.access().getMemoryBudget()));
+    }
+}
+
+void Simulator::resetPartition()
+{
+#if defined(__linux__)
+    // Forks share the partition of their origin until their satellites change: workers hold the satellites
+    // they were forked with, so they are forked again for the current ones
+
+    this->partitionSPtr_ = nullptr;
+    this->partitionViewSPtr_ = nullptr;
+
+    if ((this->processCount_ == 0) || this->satelliteMap_.access().empty())
+    {
+        return;
+    }
+
+    Array<Shared<const Satellite>> satellites = Array<Shared<const Satellite>>::Empty();
+    satellites.reserve(this->satelliteMap_.access().size());
+
+    for (const auto& satelliteMapIt : this->satelliteMap_.access())
+    {
+        satellites.add(satelliteMapIt.second);
+    }
+
+    // Workers are forked before the update threads start again: a forked process only runs the forking thread, and
+    // would deadlock on locks held by the others
+
+    const Size threadCount = (this->threadPoolSPtr_ != nullptr) ? this->threadPoolSPtr_->getThreadCount() : 0;
+
+    this->threadPoolSPtr_ = nullptr;
+
+    try
+    {
+        this->partitionSPtr_ = std::make_shared<Partition>(satellites, this->processCount_);
+    }
+    catch (...)
+    {
+        this->threadPoolSPtr_ = (threadCount > 0) ? std::make_shared<ThreadPool>(threadCount) : nullptr;
+
+        throw;
+    }
+
+    this->threadPoolSPtr_ = (threadCount > 0) ? std::make_shared<ThreadPool>(threadCount) : nullptr;
+#endif
+}
+
+void Simulator::notifySatelliteObservers() const
+{
+    if (this->satelliteObservers_.isEmpty() || (!this->environment_.getInstant().isDefined()))
+    {
+        return;
+    }
+
+    const Instant instant = this->environment_.getInstant();
+
+    // States are read like getSatelliteStateWithName does: from the update phase if it evaluated them, else from the
+    // state cache. Satellites without a state at this instant are observed with an undefined state, while errors
+    // evaluating a state propagate. Observers are handed satellites bound to this simulator.
+
+    this->unshareSatellites(false);
+
+    for (const auto& satelliteMapIt : this->satelliteMap_.access())
+    {
+        const TrajectoryState state = satelliteMapIt.second->hasStateAt(instant)
+                                        ? this->getSatelliteStateWithName(satelliteMapIt.first)
+                                        : TrajectoryState::Undefined();
+
+        this->satelliteObservers_.invoke(*this, *satelliteMapIt.second, state);
+    }
 }
 
 }  // namespace simulation
@@ -0,0 +1,525 @@
+/// Apache License 2.0
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <OpenSpaceToolkit/Simulation/Simulator/Checkpoint.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace simulator
+{
+
+using ostk::core::type::Index;
+using ostk::core::type::Int64;
+
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::time::Duration;
+
+namespace
+{
+
+constexpr char checkpointMagic[8] = {'O', 'S', 'T', 'K', 'S', 'I', 'M', 'C'};
+constexpr std::uint32_t checkpointVersion = 1;
+
+constexpr Int64 nanosecondsPerSecond = 1000000000;
+
+class Encoder
+{
+   public:
+    Encoder(std::string& aBuffer)
+        : buffer_(aBuffer)
+    {
+    }
+
+    void writeBytes(const char* aByteArray, const std::size_t& aSize)
+    {
+        buffer_.append(aByteArray, aSize);
+    }
+
+    void writeUnsignedInteger(const std::uint64_t& aValue, const std::size_t& aByteCount)
+    {
+        for (std::size_t byteIndex = 0; byteIndex < aByteCount; ++byteIndex)
+        {
+            buffer_.push_back(static_cast<char>((aValue >> (8 * byteIndex)) & 0xFF));
+        }
+    }
+
+    void writeInteger(const Int64& aValue)
+    {
+        this->writeUnsignedInteger(static_cast<std::uint64_t>(aValue), 8);
+    }
+
+    void writeDouble(const double& aValue)
+    {
+        std::uint64_t bits = 0;
+        std::memcpy(&bits, &aValue, sizeof(bits));
+
+        this->writeUnsignedInteger(bits, 8);
+    }
+
+    void writeString(const String& aString)
+    {
+        this->writeUnsignedInteger(aString.size(), 8);
+        this->writeBytes(aString.data(), aString.size());
+    }
+
+   private:
+    std::string& buffer_;
+};
+
+class Decoder
+{
+   public:
+    Decoder(const char* aBuffer, const std::size_t& aSize)
+        : buffer_(aBuffer),
+          size_(aSize),
+          offset_(0)
+    {
+    }
+
+    bool isExhausted() const
+    {
+        return offset_ == size_;
+    }
+
+    const char* readBytes(const std::size_t& aSize)
+    {
+        if (aSize > (size_ - offset_))
+        {
+            throw ostk::core::error::RuntimeError("Checkpoint is truncated at byte [{}].", offset_);
+        }
+
+        const char* bytes = buffer_ + offset_;
+
+        offset_ += aSize;
+
+        return bytes;
+    }
+
+    std::uint64_t readUnsignedInteger(const std::size_t& aByteCount)
+    {
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(this->readBytes(aByteCount));
+
+        std::uint64_t value = 0;
+
+        for (std::size_t byteIndex = 0; byteIndex < aByteCount; ++byteIndex)
+        {
+            value |= (static_cast<std::uint64_t>(bytes[byteIndex]) << (8 * byteIndex));
+        }
+
+        return value;
+    }
+
+    Int64 readInteger()
+    {
+        return static_cast<Int64>(this->readUnsignedInteger(8));
+    }
+
+    double readDouble()
+    {
+        const std::uint64_t bits = this->readUnsignedInteger(8);
+
+        double value = 0.0;
+        std::memcpy(&value, &bits, sizeof(value));
+
+        return value;
+    }
+
+    String readString()
+    {
+        const std::uint64_t size = this->readUnsignedInteger(8);
+        const char* bytes = this->readBytes(size);
+
+        return String(bytes, size);
+    }
+
+   private:
+    const char* buffer_;
+    std::size_t size_;
+    std::size_t offset_;
+};
+
+// Instants are stored as an exact nanosecond count since J2000
+
+void WriteInstant(Encoder& anEncoder, const Instant& anInstant)
+{
+    const Duration sinceJ2000 = anInstant - Instant::J2000();
+
+    const Int64 seconds = static_cast<Int64>(std::floor(sinceJ2000.inSeconds()));
+    const Duration remainder = sinceJ2000 - Duration::Seconds(static_cast<double>(seconds));
+
+    const Int64 nanoseconds = static_cast<Int64>(std::llround(remainder.inNanoseconds()));
+
+    anEncoder.writeInteger((seconds * nanosecondsPerSecond) + nanoseconds);
+}
+
+Instant ReadInstant(Decoder& aDecoder)
+{
+    return Instant::J2000() + Duration(aDecoder.readInteger());
+}
+
+void WriteTrajectoryState(Encoder& anEncoder, const TrajectoryState& aState)
+{
+    const TrajectoryState state = aState.inFrame(Frame::GCRF());
+
+    const Vector3d position = state.getPosition().getCoordinates();
+    const Vector3d velocity = state.getVelocity().getCoordinates();
+    const Quaternion attitude = state.getAttitude();
+    const Vector3d angularVelocity = state.getAngularVelocity();
+
+    for (Index index = 0; index < 3; ++index)
+    {
+        anEncoder.writeDouble(position(index));
+    }
+
+    for (Index index = 0; index < 3; ++index)
+    {
+        anEncoder.writeDouble(velocity(index));
+    }
+
+    anEncoder.writeDouble(attitude.x());
+    anEncoder.writeDouble(attitude.y());
+    anEncoder.writeDouble(attitude.z());
+    anEncoder.writeDouble(attitude.s());
+
+    for (Index index = 0; index < 3; ++index)
+    {
+        anEncoder.writeDouble(angularVelocity(index));
+    }
+}
+
+TrajectoryState ReadTrajectoryState(Decoder& aDecoder, const Instant& anInstant)
+{
+    Vector3d position;
+    Vector3d velocity;
+    Vector3d angularVelocity;
+
+    for (Index index = 0; index < 3; ++index)
+    {
+        position(index) = aDecoder.readDouble();
+    }
+
+    for (Index index = 0; index < 3; ++index)
+    {
+        velocity(index) = aDecoder.readDouble();
+    }
+
+    const double x = aDecoder.readDouble();
+    const double y = aDecoder.readDouble();
+    const double z = aDecoder.readDouble();
+    const double s = aDecoder.readDouble();
+
+    for (Index index = 0; index < 3; ++index)
+    {
+        angularVelocity(index) = aDecoder.readDouble();
+    }
+
+    return {
+        anInstant,
+        Position::Meters(position, Frame::GCRF()),
+        Velocity::MetersPerSecond(velocity, Frame::GCRF()),
+        Quaternion::XYZS(x, y, z, s),
+        angularVelocity,
+        Frame::GCRF()
+    };
+}
+
+/// Read-only memory mapping of a file, released on destruction.
+class FileMapping
+{
+   public:
+    FileMapping(const String& aPath)
+        : data_(nullptr),
+          size_(0)
+    {
+        const int fileDescriptor = ::open(aPath.c_str(), O_RDONLY);
+
+        if (fileDescriptor < 0)
+        {
+            throw ostk::core::error::RuntimeError("Cannot open checkpoint file [{}].", aPath);
+        }
+
+        struct stat fileStatus;
+
+        if (::fstat(fileDescriptor, &fileStatus) != 0)
+        {
+            ::close(fileDescriptor);
+
+            throw ostk::core::error::RuntimeError("Cannot read checkpoint file [{}].", aPath);
+        }
+
+        size_ = static_cast<std::size_t>(fileStatus.st_size);
+
+        if (size_ > 0)
+        {
+            void* data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+            if (data == MAP_FAILED)
+            {
+                ::close(fileDescriptor);
+
+                throw ostk::core::error::RuntimeError("Cannot map checkpoint file [{}].", aPath);
+            }
+
+            data_ = static_cast<const char*>(data);
+        }
+
+        // The mapping stays valid once the file descriptor is closed
+
+        ::close(fileDescriptor);
+    }
+
+    FileMapping(const FileMapping&) = delete;
+    FileMapping& operator=(const FileMapping&) = delete;
+
+    ~FileMapping()
+    {
+        if (data_ != nullptr)
+        {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+    }
+
+    const char* data() const
+    {
+        return data_;
+    }
+
+    std::size_t size() const
+    {
+        return size_;
+    }
+
+   private:
+    const char* data_;
+    std::size_t size_;
+};
+
+}  // namespace
+
+Checkpoint::Checkpoint(const Instant& anInstant, const Array<SatelliteRecord>& aSatelliteRecordArray)
+    : instant_(anInstant),
+      satelliteRecords_(aSatelliteRecordArray)
+{
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const Checkpoint& aCheckpoint)
+{
+    aCheckpoint.print(anOutputStream, true);
+
+    return anOutputStream;
+}
+
+bool Checkpoint::isDefined() const
+{
+    return this->instant_.isDefined();
+}
+
+Instant Checkpoint::getInstant() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Checkpoint");
+    }
+
+    return this->instant_;
+}
+
+const Array<Checkpoint::SatelliteRecord>& Checkpoint::accessSatelliteRecords() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Checkpoint");
+    }
+
+    return this->satelliteRecords_;
+}
+
+String Checkpoint::toBytes() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Checkpoint");
+    }
+
+    std::string buffer;
+    Encoder encoder(buffer);
+
+    encoder.writeBytes(checkpointMagic, sizeof(checkpointMagic));
+    encoder.writeUnsignedInteger(checkpointVersion, 4);
+
+    WriteInstant(encoder, this->instant_);
+
+    encoder.writeUnsignedInteger(this->satelliteRecords_.getSize(), 8);
+
+    for (const auto& satelliteRecord : this->satelliteRecords_)
+    {
+        encoder.writeString(satelliteRecord.id);
+        encoder.writeString(satelliteRecord.name);
+
+        WriteTrajectoryState(encoder, satelliteRecord.state);
+
+        encoder.writeUnsignedInteger(satelliteRecord.componentRecords.getSize(), 8);
+
+        for (const auto& componentRecord : satelliteRecord.componentRecords)
+        {
+            encoder.writeString(componentRecord.id);
+            encoder.writeString(componentRecord.name);
+            encoder.writeUnsignedInteger(componentRecord.depth, 8);
+            encoder.writeUnsignedInteger(static_cast<std::uint64_t>(componentRecord.state.getStatus()), 1);
+            encoder.writeUnsignedInteger(componentRecord.state.isVerbose() ? 1 : 0, 1);
+        }
+    }
+
+    return buffer;
+}
+
+void Checkpoint::save(const File& aFile) const
+{
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    const String bytes = this->toBytes();
+
+    std::ofstream fileStream(aFile.getPath().toString(), std::ios::binary | std::ios::trunc);
+
+    if (!fileStream)
+    {
+        throw ostk::core::error::RuntimeError("Cannot open checkpoint file [{}].", aFile.getPath().toString());
+    }
+
+    fileStream.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+
+    if (!fileStream)
+    {
+        throw ostk::core::error::RuntimeError("Cannot write checkpoint file [{}].", aFile.getPath().toString());
+    }
+}
+
+void Checkpoint::print(std::ostream& anOutputStream, bool displayDecorators) const
+{
+    displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "Checkpoint") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream)
+        << "Instant:" << (this->isDefined() ? this->instant_.toString() : String("Undefined"));
+    ostk::core::utils::Print::Line(anOutputStream) << "Satellites:" << this->satelliteRecords_.getSize();
+
+    displayDecorators ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+Checkpoint Checkpoint::Undefined()
+{
+    return {Instant::Undefined(), Array<SatelliteRecord>::Empty()};
+}
+
+Checkpoint Checkpoint::FromBytes(const String& aByteString)
+{
+    return Checkpoint::Decode(aByteString.data(), aByteString.size());
+}
+
+Checkpoint Checkpoint::Load(const File& aFile)
+{
+    if (!aFile.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("File");
+    }
+
+    const FileMapping fileMapping(aFile.getPath().toString());
+
+    return Checkpoint::Decode(fileMapping.data(), fileMapping.size());
+}
+
+Checkpoint Checkpoint::Decode(const char* aBuffer, const std::size_t& aSize)
+{
+    Decoder decoder(aBuffer, aSize);
+
+    if (std::memcmp(decoder.readBytes(sizeof(checkpointMagic)), checkpointMagic, sizeof(checkpointMagic)) != 0)
+    {
+        throw ostk::core::error::RuntimeError("Invalid checkpoint magic.");
+    }
+
+    const std::uint64_t version = decoder.readUnsignedInteger(4);
+
+    if (version != checkpointVersion)
+    {
+        throw ostk::core::error::RuntimeError("Unsupported checkpoint version [{}].", version);
+    }
+
+    const Instant instant = ReadInstant(decoder);
+
+    const std::uint64_t satelliteCount = decoder.readUnsignedInteger(8);
+
+    Array<SatelliteRecord> satelliteRecords = Array<SatelliteRecord>::Empty();
+
+    for (std::uint64_t satelliteIndex = 0; satelliteIndex < satelliteCount; ++satelliteIndex)
+    {
+        const String satelliteId = decoder.readString();
+        const String satelliteName = decoder.readString();
+        const TrajectoryState satelliteState = ReadTrajectoryState(decoder, instant);
+
+        const std::uint64_t componentCount = decoder.readUnsignedInteger(8);
+
+        Array<ComponentRecord> componentRecords = Array<ComponentRecord>::Empty();
+
+        for (std::uint64_t componentIndex = 0; componentIndex < componentCount; ++componentIndex)
+        {
+            const String componentId = decoder.readString();
+            const String componentName = decoder.readString();
+            const Size depth = decoder.readUnsignedInteger(8);
+            const std::uint64_t status = decoder.readUnsignedInteger(1);
+            const bool isVerbose = (decoder.readUnsignedInteger(1) != 0);
+
+            if ((status == static_cast<std::uint64_t>(State::Status::Undefined)) ||
+                (status > static_cast<std::uint64_t>(State::Status::Error)))
+            {
+                throw ostk::core::error::RuntimeError("Invalid component status [{}].", status);
+            }
+
+            componentRecords.add(
+                {componentId, componentName, depth, State(static_cast<State::Status>(status), isVerbose)}
+            );
+        }
+
+        satelliteRecords.add({satelliteId, satelliteName, satelliteState, componentRecords});
+    }
+
+    if (!decoder.isExhausted())
+    {
+        throw ostk::core::error::RuntimeError("Checkpoint has trailing bytes.");
+    }
+
+    return {instant, satelliteRecords};
+}
+
+}  // namespace simulator
+}  // namespace simulation
+}  // namespace ostk
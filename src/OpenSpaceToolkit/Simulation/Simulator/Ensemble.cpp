@@ -0,0 +1,219 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <OpenSpaceToolkit/Simulation/Simulator/Ensemble.hpp>
+#include <OpenSpaceToolkit/Simulation/Utility/ThreadPool.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace simulator
+{
+
+using ostk::core::type::Shared;
+
+using ostk::simulation::utility::ThreadPool;
+
+namespace
+{
+
+// Replicas processed per thread and batch: bounds the outputs held in memory, while amortizing synchronization.
+const Size batchSizePerThread = 16;
+
+/// @brief Running statistics of an output (Welford's algorithm).
+struct Accumulator
+{
+    Size count = 0;
+    double mean = 0.0;
+    double squaredDeviationSum = 0.0;
+    double minimum = 0.0;
+    double maximum = 0.0;
+
+    void add(const Real& aValue)
+    {
+        if (!aValue.isDefined())
+        {
+            return;
+        }
+
+        const double value = aValue;
+
+        count += 1;
+
+        const double delta = value - mean;
+
+        mean += delta / static_cast<double>(count);
+        squaredDeviationSum += delta * (value - mean);
+
+        minimum = (count == 1) ? value : std::min(minimum, value);
+        maximum = (count == 1) ? value : std::max(maximum, value);
+    }
+
+    Ensemble::Statistics getStatistics() const
+    {
+        if (count == 0)
+        {
+            return {0, Real::Undefined(), Real::Undefined(), Real::Undefined(), Real::Undefined()};
+        }
+
+        const Real standardDeviation =
+            (count > 1) ? Real(std::sqrt(squaredDeviationSum / static_cast<double>(count - 1))) : Real::Undefined();
+
+        return {count, mean, standardDeviation, minimum, maximum};
+    }
+};
+
+}  // namespace
+
+Ensemble::Ensemble(
+    const SimulatorConfiguration& aBaseConfiguration,
+    const Perturbation& aPerturbation,
+    const Evaluation& anEvaluation,
+    const Size& aReplicaCount,
+    const std::uint64_t& aSeed,
+    const Size& aThreadCount
+)
+    : baseConfiguration_(aBaseConfiguration),
+      perturbation_(aPerturbation),
+      evaluation_(anEvaluation),
+      replicaCount_(aReplicaCount),
+      seed_(aSeed),
+      threadCount_(aThreadCount)
+{
+    if (!perturbation_)
+    {
+        throw ostk::core::error::runtime::Undefined("Perturbation");
+    }
+
+    if (!evaluation_)
+    {
+        throw ostk::core::error::runtime::Undefined("Evaluation");
+    }
+
+    if (threadCount_ == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Thread count", threadCount_);
+    }
+}
+
+Size Ensemble::getReplicaCount() const
+{
+    return replicaCount_;
+}
+
+std::uint64_t Ensemble::getSeed() const
+{
+    return seed_;
+}
+
+Size Ensemble::getThreadCount() const
+{
+    return threadCount_;
+}
+
+std::uint64_t Ensemble::getReplicaSeed(const Index& aReplicaIndex) const
+{
+    if (aReplicaIndex >= replicaCount_)
+    {
+        throw ostk::core::error::RuntimeError(
+            "Replica index [{}] out of range [0, {}).", aReplicaIndex, replicaCount_
+        );
+    }
+
+    return Ensemble::GenerateSeed(seed_, aReplicaIndex);
+}
+
+Array<Ensemble::Statistics> Ensemble::run(const Reduction& aReduction) const
+{
+    ThreadPool threadPool(threadCount_);
+
+    const Size batchSize = threadCount_ * batchSizePerThread;
+
+    Array<Array<Real>> outputs(std::min(batchSize, replicaCount_), Array<Real>::Empty());
+    std::vector<Accumulator> accumulators;
+    bool hasOutputCount = false;
+
+    for (Index batchStartIndex = 0; batchStartIndex < replicaCount_; batchStartIndex += batchSize)
+    {
+        const Size replicaCount = std::min(batchSize, replicaCount_ - batchStartIndex);
+
+        threadPool.parallelFor(
+            replicaCount,
+            [this, &outputs, batchStartIndex](const Index& anIndex)
+            {
+                const Index replicaIndex = batchStartIndex + anIndex;
+
+                const Shared<Simulator> simulatorSPtr = Simulator::Configure(
+                    perturbation_(baseConfiguration_, replicaIndex, Ensemble::GenerateSeed(seed_, replicaIndex))
+                );
+
+                outputs[anIndex] = evaluation_(*simulatorSPtr);
+            }
+        );
+
+        // Outputs are reduced in replica order, so that results do not depend on the thread count
+
+        for (Index index = 0; index < replicaCount; ++index)
+        {
+            const Array<Real>& output = outputs[index];
+
+            if (!hasOutputCount)
+            {
+                accumulators.resize(output.getSize());
+                hasOutputCount = true;
+            }
+
+            if (output.getSize() != accumulators.size())
+            {
+                throw ostk::core::error::RuntimeError(
+                    "Replica [{}] output count [{}] does not match [{}].",
+                    batchStartIndex + index,
+                    output.getSize(),
+                    accumulators.size()
+                );
+            }
+
+            for (Index outputIndex = 0; outputIndex < output.getSize(); ++outputIndex)
+            {
+                accumulators[outputIndex].add(output[outputIndex]);
+            }
+
+            if (aReduction)
+            {
+                aReduction(batchStartIndex + index, output);
+            }
+        }
+    }
+
+    Array<Statistics> statistics = Array<Statistics>::Empty();
+    statistics.reserve(accumulators.size());
+
+    for (const Accumulator& accumulator : accumulators)
+    {
+        statistics.add(accumulator.getStatistics());
+    }
+
+    return statistics;
+}
+
+std::uint64_t Ensemble::GenerateSeed(const std::uint64_t& aSeed, const Index& aReplicaIndex)
+{
+    // SplitMix64 output for the (aReplicaIndex + 1)-th element of the sequence seeded with aSeed
+
+    std::uint64_t value = aSeed + (static_cast<std::uint64_t>(aReplicaIndex) + 1) * 0x9E3779B97F4A7C15ULL;
+
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+
+    return value ^ (value >> 31);
+}
+
+}  // namespace simulator
+}  // namespace simulation
+}  // namespace ostk
@@ -0,0 +1,189 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <iterator>
+
+#include <OpenSpaceToolkit/Simulation/Simulator/FrameRegistry.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace simulator
+{
+
+namespace
+{
+
+// Frame constructors are protected, so that frames are normally constructed through the global registry
+
+class UnregisteredFrame : public Frame
+{
+   public:
+    UnregisteredFrame(
+        const String& aFrameName,
+        const bool isQuasiInertial,
+        const Shared<const Frame>& aParentFrameSPtr,
+        const Shared<const Provider>& aProviderSPtr
+    )
+        : Frame(aFrameName, isQuasiInertial, aParentFrameSPtr, aProviderSPtr)
+    {
+    }
+};
+
+// Entries of released frames are dropped once the registry has doubled since it was last pruned
+
+const Size minimumPruneSize = 64;
+
+}  // namespace
+
+FrameRegistry::FrameRegistry()
+    : frameMap_(),
+      pruneSize_(minimumPruneSize),
+      mutex_()
+{
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const FrameRegistry& aFrameRegistry)
+{
+    aFrameRegistry.print(anOutputStream, true);
+
+    return anOutputStream;
+}
+
+bool FrameRegistry::hasFrameWithName(const String& aFrameName) const
+{
+    if (aFrameName.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Frame name");
+    }
+
+    const std::lock_guard<std::mutex> lock(this->mutex_);
+
+    const auto frameMapIt = this->frameMap_.find(aFrameName);
+
+    return (frameMapIt != this->frameMap_.end()) && (!frameMapIt->second.expired());
+}
+
+Size FrameRegistry::getSize() const
+{
+    const std::lock_guard<std::mutex> lock(this->mutex_);
+
+    Size size = 0;
+
+    for (const auto& frameMapIt : this->frameMap_)
+    {
+        size += frameMapIt.second.expired() ? 0 : 1;
+    }
+
+    return size;
+}
+
+Shared<const Frame> FrameRegistry::accessFrameWithName(const String& aFrameName) const
+{
+    if (aFrameName.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Frame name");
+    }
+
+    const std::lock_guard<std::mutex> lock(this->mutex_);
+
+    const auto frameMapIt = this->frameMap_.find(aFrameName);
+
+    const Shared<const Frame> frameSPtr = (frameMapIt != this->frameMap_.end()) ? frameMapIt->second.lock() : nullptr;
+
+    if (frameSPtr == nullptr)
+    {
+        throw ostk::core::error::RuntimeError("No Frame found with name [{}].", aFrameName);
+    }
+
+    return frameSPtr;
+}
+
+Shared<const Frame> FrameRegistry::constructFrame(
+    const String& aFrameName,
+    const bool isQuasiInertial,
+    const Shared<const Frame>& aParentFrameSPtr,
+    const Shared<const Provider>& aProviderSPtr
+)
+{
+    const Shared<const Frame> frameSPtr =
+        FrameRegistry::ConstructFrame(aFrameName, isQuasiInertial, aParentFrameSPtr, aProviderSPtr);
+
+    const std::lock_guard<std::mutex> lock(this->mutex_);
+
+    this->frameMap_.insert_or_assign(aFrameName, frameSPtr);
+
+    if (this->frameMap_.size() >= this->pruneSize_)
+    {
+        for (auto frameMapIt = this->frameMap_.begin(); frameMapIt != this->frameMap_.end();)
+        {
+            frameMapIt = frameMapIt->second.expired() ? this->frameMap_.erase(frameMapIt) : std::next(frameMapIt);
+        }
+
+        this->pruneSize_ = std::max(minimumPruneSize, 2 * this->frameMap_.size());
+    }
+
+    return frameSPtr;
+}
+
+void FrameRegistry::removeFrameWithName(const String& aFrameName)
+{
+    if (aFrameName.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Frame name");
+    }
+
+    const std::lock_guard<std::mutex> lock(this->mutex_);
+
+    this->frameMap_.erase(aFrameName);
+}
+
+void FrameRegistry::clear()
+{
+    const std::lock_guard<std::mutex> lock(this->mutex_);
+
+    this->frameMap_.clear();
+    this->pruneSize_ = minimumPruneSize;
+}
+
+void FrameRegistry::print(std::ostream& anOutputStream, bool displayDecorators) const
+{
+    displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "Frame Registry") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Size:" << this->getSize();
+
+    displayDecorators ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+Shared<const Frame> FrameRegistry::ConstructFrame(
+    const String& aFrameName,
+    const bool isQuasiInertial,
+    const Shared<const Frame>& aParentFrameSPtr,
+    const Shared<const Provider>& aProviderSPtr
+)
+{
+    if (aFrameName.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Frame name");
+    }
+
+    if ((aParentFrameSPtr == nullptr) || (!aParentFrameSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Parent frame");
+    }
+
+    if (aProviderSPtr == nullptr)
+    {
+        throw ostk::core::error::runtime::Undefined("Provider");
+    }
+
+    return std::make_shared<const UnregisteredFrame>(aFrameName, isQuasiInertial, aParentFrameSPtr, aProviderSPtr);
+}
+
+}  // namespace simulator
+}  // namespace simulation
+}  // namespace ostk
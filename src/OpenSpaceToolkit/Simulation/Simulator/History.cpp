@@ -0,0 +1,227 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Simulator/History.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace simulator
+{
+
+History::History(const Size& aMemoryBudget)
+    : memoryBudget_(aMemoryBudget),
+      memoryUsage_(0),
+      entryMap_(),
+      orderMap_(),
+      nextOrder_(0)
+{
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const History& aHistory)
+{
+    aHistory.print(anOutputStream, true);
+
+    return anOutputStream;
+}
+
+bool History::isEnabled() const
+{
+    return this->memoryBudget_ > 0;
+}
+
+bool History::isEmpty() const
+{
+    return this->entryMap_.empty();
+}
+
+bool History::hasInstant(const Instant& anInstant) const
+{
+    return anInstant.isDefined() && (this->entryMap_.find(anInstant) != this->entryMap_.end());
+}
+
+Size History::getSize() const
+{
+    return this->entryMap_.size();
+}
+
+Size History::getMemoryBudget() const
+{
+    return this->memoryBudget_;
+}
+
+Size History::getMemoryUsage() const
+{
+    return this->memoryUsage_;
+}
+
+Array<Instant> History::getInstants() const
+{
+    Array<Instant> instants = Array<Instant>::Empty();
+    instants.reserve(this->orderMap_.size());
+
+    for (const auto& orderMapIt : this->orderMap_)
+    {
+        instants.add(orderMapIt.second);
+    }
+
+    return instants;
+}
+
+Map<String, TrajectoryState> History::getSatelliteStatesAt(const Instant& anInstant) const
+{
+    const Entry& entry = this->accessEntryAt(anInstant);
+
+    Map<String, TrajectoryState> satelliteStateMap;
+
+    for (Index index = 0; index < entry.satelliteNames.getSize(); ++index)
+    {
+        satelliteStateMap.insert({entry.satelliteNames[index], entry.stateTable.getStateAt(index)});
+    }
+
+    return satelliteStateMap;
+}
+
+const CopyOnWrite<Map<String, State>>& History::accessComponentStatesAt(const Instant& anInstant) const
+{
+    return this->accessEntryAt(anInstant).componentStateMap;
+}
+
+void History::print(std::ostream& anOutputStream, bool displayDecorators) const
+{
+    displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "History") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Size:" << this->getSize();
+    ostk::core::utils::Print::Line(anOutputStream) << "Memory budget [bytes]:" << this->memoryBudget_;
+    ostk::core::utils::Print::Line(anOutputStream) << "Memory usage [bytes]:" << this->memoryUsage_;
+
+    if (!this->isEmpty())
+    {
+        ostk::core::utils::Print::Line(anOutputStream)
+            << "Oldest instant:" << this->orderMap_.begin()->second.toString();
+        ostk::core::utils::Print::Line(anOutputStream)
+            << "Latest instant:" << this->orderMap_.rbegin()->second.toString();
+    }
+
+    displayDecorators ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+void History::setMemoryBudget(const Size& aMemoryBudget)
+{
+    this->memoryBudget_ = aMemoryBudget;
+
+    this->evict(this->memoryBudget_);
+}
+
+void History::record(
+    const Instant& anInstant,
+    const Map<String, TrajectoryState>& aSatelliteStateMap,
+    const CopyOnWrite<Map<String, State>>& aComponentStateMap
+)
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    const auto entryMapIt = this->entryMap_.find(anInstant);
+
+    if (entryMapIt != this->entryMap_.end())
+    {
+        this->memoryUsage_ -= entryMapIt->second->size;
+        this->orderMap_.erase(entryMapIt->second->order);
+        this->entryMap_.erase(entryMapIt);
+    }
+
+    Array<String> satelliteNames = Array<String>::Empty();
+    Array<TrajectoryState> satelliteStates = Array<TrajectoryState>::Empty();
+
+    satelliteNames.reserve(aSatelliteStateMap.size());
+    satelliteStates.reserve(aSatelliteStateMap.size());
+
+    for (const auto& satelliteStateMapIt : aSatelliteStateMap)
+    {
+        const TrajectoryState& state = satelliteStateMapIt.second;
+
+        if (state.isDefined() && (state.getInstant() == anInstant))
+        {
+            satelliteNames.add(satelliteStateMapIt.first);
+            satelliteStates.add(state);
+        }
+    }
+
+    const Size size = History::EstimateEntrySize(satelliteNames.getSize(), aComponentStateMap.access().size());
+
+    if (size > this->memoryBudget_)
+    {
+        return;
+    }
+
+    this->evict(this->memoryBudget_ - size);
+
+    const Index order = this->nextOrder_++;
+
+    this->entryMap_.insert({anInstant,
+                            std::make_shared<const Entry>(Entry {
+                                anInstant,
+                                satelliteNames,
+                                StateTable::FromStates(satelliteStates),
+                                aComponentStateMap,
+                                size,
+                                order
+                            })});
+    this->orderMap_.insert({order, anInstant});
+
+    this->memoryUsage_ += size;
+}
+
+void History::clear()
+{
+    this->entryMap_.clear();
+    this->orderMap_.clear();
+    this->memoryUsage_ = 0;
+}
+
+Size History::EstimateEntrySize(const Size& aSatelliteCount, const Size& aComponentCount)
+{
+    // Each satellite takes one state table column (13 reals and an instant) and a name. Component state maps are
+    // counted in full, although entries usually share them.
+
+    const Size satelliteSize = (13 * sizeof(double)) + sizeof(Instant) + sizeof(String);
+    const Size componentSize = sizeof(String) + sizeof(State) + (4 * sizeof(void*));
+
+    return sizeof(Entry) + (aSatelliteCount * satelliteSize) + (aComponentCount * componentSize);
+}
+
+const History::Entry& History::accessEntryAt(const Instant& anInstant) const
+{
+    const auto entryMapIt = anInstant.isDefined() ? this->entryMap_.find(anInstant) : this->entryMap_.end();
+
+    if (entryMapIt == this->entryMap_.end())
+    {
+        throw ostk::core::error::RuntimeError("No history entry at instant [{}].", anInstant.toString());
+    }
+
+    return *(entryMapIt->second);
+}
+
+void History::evict(const Size& aMemoryBudget)
+{
+    while ((!this->orderMap_.empty()) && (this->memoryUsage_ > aMemoryBudget))
+    {
+        const auto oldestIt = this->orderMap_.begin();
+        const auto entryMapIt = this->entryMap_.find(oldestIt->second);
+
+        this->memoryUsage_ -= entryMapIt->second->size;
+        this->entryMap_.erase(entryMapIt);
+        this->orderMap_.erase(oldestIt);
+    }
+}
+
+}  // namespace simulator
+}  // namespace simulation
+}  // namespace ostk
@@ -0,0 +1,182 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Simulator/Pacer.hpp>
+
+#include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace simulator
+{
+
+using ostk::core::container::Map;
+
+Pacer::Pacer(const Real& aTimeRatio, const Duration& aFramePeriod, const CatchUpPolicy& aCatchUpPolicy)
+    : timeRatio_(aTimeRatio),
+      framePeriod_(aFramePeriod),
+      step_(Duration::Undefined()),
+      catchUpPolicy_(aCatchUpPolicy)
+{
+    if (!timeRatio_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Time ratio");
+    }
+
+    if (!framePeriod_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Frame period");
+    }
+
+    if (!timeRatio_.isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Time ratio");
+    }
+
+    if (!framePeriod_.isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Frame period");
+    }
+
+    step_ = framePeriod_ * timeRatio_;
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const Pacer& aPacer)
+{
+    aPacer.print(anOutputStream, true);
+
+    return anOutputStream;
+}
+
+bool Pacer::isDefined() const
+{
+    return step_.isDefined();
+}
+
+bool Pacer::isPaced() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Pacer");
+    }
+
+    return timeRatio_.isDefined();
+}
+
+Real Pacer::getTimeRatio() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Pacer");
+    }
+
+    return timeRatio_;
+}
+
+Duration Pacer::getFramePeriod() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Pacer");
+    }
+
+    return framePeriod_;
+}
+
+Duration Pacer::getStep() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Pacer");
+    }
+
+    return step_;
+}
+
+Pacer::CatchUpPolicy Pacer::getCatchUpPolicy() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Pacer");
+    }
+
+    return catchUpPolicy_;
+}
+
+void Pacer::print(std::ostream& anOutputStream, bool displayDecorators) const
+{
+    displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "Pacer") : void();
+
+    if (!this->isDefined())
+    {
+        ostk::core::utils::Print::Line(anOutputStream) << "Undefined";
+    }
+    else if (!this->isPaced())
+    {
+        ostk::core::utils::Print::Line(anOutputStream) << "Time ratio:" << "As fast as possible";
+        ostk::core::utils::Print::Line(anOutputStream) << "Step:" << step_.toString();
+    }
+    else
+    {
+        ostk::core::utils::Print::Line(anOutputStream) << "Time ratio:" << timeRatio_;
+        ostk::core::utils::Print::Line(anOutputStream) << "Frame period:" << framePeriod_.toString();
+        ostk::core::utils::Print::Line(anOutputStream) << "Step:" << step_.toString();
+        ostk::core::utils::Print::Line(anOutputStream)
+            << "Catch-up policy:" << Pacer::StringFromCatchUpPolicy(catchUpPolicy_);
+    }
+
+    displayDecorators ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+Pacer Pacer::Undefined()
+{
+    return {Real::Undefined(), Duration::Undefined(), Duration::Undefined(), CatchUpPolicy::Skip};
+}
+
+Pacer Pacer::RealTime(const Duration& aFramePeriod)
+{
+    return {1.0, aFramePeriod, CatchUpPolicy::Skip};
+}
+
+Pacer Pacer::AsFastAsPossible(const Duration& aStep)
+{
+    if (!aStep.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Step");
+    }
+
+    if (!aStep.isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Step");
+    }
+
+    return {Real::Undefined(), Duration::Zero(), aStep, CatchUpPolicy::Skip};
+}
+
+String Pacer::StringFromCatchUpPolicy(const CatchUpPolicy& aCatchUpPolicy)
+{
+    static const Map<CatchUpPolicy, String> catchUpPolicyStringMap = {
+        {CatchUpPolicy::Skip, "Skip"},
+        {CatchUpPolicy::Burst, "Burst"},
+        {CatchUpPolicy::Stretch, "Stretch"},
+    };
+
+    return catchUpPolicyStringMap.at(aCatchUpPolicy);
+}
+
+Pacer::Pacer(
+    const Real& aTimeRatio, const Duration& aFramePeriod, const Duration& aStep, const CatchUpPolicy& aCatchUpPolicy
+)
+    : timeRatio_(aTimeRatio),
+      framePeriod_(aFramePeriod),
+      step_(aStep),
+      catchUpPolicy_(aCatchUpPolicy)
+{
+}
+
+}  // namespace simulator
+}  // namespace simulation
+}  // namespace ostk
@@ -0,0 +1,539 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Simulator/Partition.hpp>
+
+#if defined(__linux__)
+
+#include <cerrno>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+
+#include <semaphore.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <OpenSpaceToolkit/Simulation/Satellite.hpp>
+#include <OpenSpaceToolkit/Simulation/Utility/ThreadPool.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace simulator
+{
+
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::time::Duration;
+
+using ostk::simulation::utility::ThreadPool;
+
+namespace
+{
+
+constexpr int evaluateCommand = 1;
+constexpr int stopCommand = 2;
+
+// A state record holds the position, velocity, attitude (XYZS) and angular velocity, followed by a defined flag
+constexpr Size stateRecordSize = 14;
+
+constexpr std::int64_t nanosecondsPerSecond = 1000000000;
+
+// Period at which a coordinator waiting for its workers checks that they are still running
+constexpr long workerPollPeriodNanoseconds = 100000000;
+
+Size AlignUp(const Size& anOffset, const Size& anAlignment)
+{
+    return ((anOffset + anAlignment - 1) / anAlignment) * anAlignment;
+}
+
+// Instants are exchanged as an exact nanosecond count since J2000
+
+std::int64_t NanosecondsFromInstant(const Instant& anInstant)
+{
+    const Duration sinceJ2000 = anInstant - Instant::J2000();
+
+    const std::int64_t seconds = static_cast<std::int64_t>(std::floor(sinceJ2000.inSeconds()));
+    const Duration remainder = sinceJ2000 - Duration::Seconds(static_cast<double>(seconds));
+
+    return (seconds * nanosecondsPerSecond) + static_cast<std::int64_t>(std::llround(remainder.inNanoseconds()));
+}
+
+Instant InstantFromNanoseconds(const std::int64_t& aNanosecondCount)
+{
+    return Instant::J2000() + Duration(aNanosecondCount);
+}
+
+// The shared memory mapping holds the control block, one start semaphore per worker, then one state record per
+// satellite.
+
+struct Control
+{
+    std::int64_t instantNanoseconds;  ///< The instant to evaluate, in nanoseconds since J2000.
+    int command;                      ///< The command published to the workers.
+    sem_t doneSemaphore;              ///< Posted by every worker once its command is processed.
+};
+
+Size RecordsOffset(const Size& aProcessCount)
+{
+    return AlignUp(AlignUp(sizeof(Control), alignof(sem_t)) + (aProcessCount * sizeof(sem_t)), alignof(double));
+}
+
+Control& AccessControl(void* aMemoryPtr)
+{
+    return *static_cast<Control*>(aMemoryPtr);
+}
+
+sem_t& AccessStartSemaphore(void* aMemoryPtr, const Index& aWorkerIndex)
+{
+    return reinterpret_cast<sem_t*>(static_cast<char*>(aMemoryPtr) + AlignUp(sizeof(Control), alignof(sem_t)))
+        [aWorkerIndex];
+}
+
+double* AccessStateRecord(void* aMemoryPtr, const Size& aProcessCount, const Index& aSatelliteIndex)
+{
+    return reinterpret_cast<double*>(static_cast<char*>(aMemoryPtr) + RecordsOffset(aProcessCount)) +
+           (aSatelliteIndex * stateRecordSize);
+}
+
+[[noreturn]] void RunWorker(
+    const Array<Shared<const Satellite>>& aSatelliteSlice,
+    const Index& aFirstSatelliteIndex,
+    void* aMemoryPtr,
+    const Size& aProcessCount,
+    const Index& aWorkerIndex
+)
+{
+    // Runs in the forked worker: it must never return nor unwind into the coordinator code it was forked from, and
+    // only reads its own slice of satellites
+
+    Control& control = AccessControl(aMemoryPtr);
+    sem_t& startSemaphore = AccessStartSemaphore(aMemoryPtr, aWorkerIndex);
+
+    while (true)
+    {
+        if (::sem_wait(&startSemaphore) != 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            ::_exit(EXIT_FAILURE);
+        }
+
+        if (control.command == stopCommand)
+        {
+            ::_exit(EXIT_SUCCESS);
+        }
+
+        try
+        {
+            const Instant instant = InstantFromNanoseconds(control.instantNanoseconds);
+
+            for (Index sliceIndex = 0; sliceIndex < aSatelliteSlice.getSize(); ++sliceIndex)
+            {
+                double* record = AccessStateRecord(aMemoryPtr, aProcessCount, aFirstSatelliteIndex + sliceIndex);
+
+                record[13] = 0.0;
+
+                try
+                {
+                    const TrajectoryState state =
+                        aSatelliteSlice[sliceIndex]->getStateAt(instant).inFrame(Frame::GCRF());
+
+                    const Vector3d position = state.getPosition().getCoordinates();
+                    const Vector3d velocity = state.getVelocity().getCoordinates();
+                    const Quaternion attitude = state.getAttitude();
+                    const Vector3d angularVelocity = state.getAngularVelocity();
+
+                    record[0] = position.x();
+                    record[1] = position.y();
+                    record[2] = position.z();
+                    record[3] = velocity.x();
+                    record[4] = velocity.y();
+                    record[5] = velocity.z();
+                    record[6] = attitude.x();
+                    record[7] = attitude.y();
+                    record[8] = attitude.z();
+                    record[9] = attitude.s();
+                    record[10] = angularVelocity.x();
+                    record[11] = angularVelocity.y();
+                    record[12] = angularVelocity.z();
+                    record[13] = 1.0;
+                }
+                catch (const std::exception&)
+                {
+                    // Satellites without a state at this instant are left out
+                }
+            }
+        }
+        catch (...)
+        {
+            ::_exit(EXIT_FAILURE);
+        }
+
+        ::sem_post(&control.doneSemaphore);
+    }
+}
+
+}  // namespace
+
+Partition::View::View(const Partition& aPartition, const Instant& anInstant, const Index& anEvaluationIndex)
+    : partitionPtr_(&aPartition),
+      instant_(anInstant),
+      evaluationIndex_(anEvaluationIndex)
+{
+}
+
+Instant Partition::View::getInstant() const
+{
+    return instant_;
+}
+
+bool Partition::View::isCurrent() const
+{
+    const std::lock_guard<std::mutex> lock(partitionPtr_->mutex_);
+
+    return evaluationIndex_ == partitionPtr_->evaluationIndex_;
+}
+
+TrajectoryState Partition::View::getSatelliteStateWithName(const String& aSatelliteName) const
+{
+    const auto satelliteIndexIt = partitionPtr_->satelliteIndexMap_.find(aSatelliteName);
+
+    if (satelliteIndexIt == partitionPtr_->satelliteIndexMap_.end())
+    {
+        throw ostk::core::error::RuntimeError("No Satellite found with name [{}].", aSatelliteName);
+    }
+
+    // Records are read under the partition lock, so that a concurrent evaluation cannot overwrite them meanwhile
+
+    const std::lock_guard<std::mutex> lock(partitionPtr_->mutex_);
+
+    if (evaluationIndex_ != partitionPtr_->evaluationIndex_)
+    {
+        return TrajectoryState::Undefined();
+    }
+
+    return partitionPtr_->decodeStateRecord(satelliteIndexIt->second, instant_);
+}
+
+Map<String, TrajectoryState> Partition::View::getSatelliteStates() const
+{
+    const std::lock_guard<std::mutex> lock(partitionPtr_->mutex_);
+
+    Map<String, TrajectoryState> stateMap;
+
+    if (evaluationIndex_ != partitionPtr_->evaluationIndex_)
+    {
+        return stateMap;
+    }
+
+    for (const auto& satelliteIndexIt : partitionPtr_->satelliteIndexMap_)
+    {
+        const TrajectoryState state = partitionPtr_->decodeStateRecord(satelliteIndexIt.second, instant_);
+
+        if (state.isDefined())
+        {
+            stateMap.insert({satelliteIndexIt.first, state});
+        }
+    }
+
+    return stateMap;
+}
+
+Partition::Partition(const Array<Shared<const Satellite>>& aSatelliteArray, const Size& aProcessCount)
+    : satellites_(aSatelliteArray),
+      satelliteIndexMap_(),
+      processCount_(aProcessCount),
+      memoryPtr_(nullptr),
+      memorySize_(0),
+      workerPids_(),
+      hasFailed_(false),
+      evaluationIndex_(0),
+      mutex_()
+{
+    if (processCount_ == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Process count");
+    }
+
+    for (Index satelliteIndex = 0; satelliteIndex < satellites_.getSize(); ++satelliteIndex)
+    {
+        const Shared<const Satellite>& satelliteSPtr = satellites_[satelliteIndex];
+
+        if ((!satelliteSPtr) || (!satelliteSPtr->isDefined()))
+        {
+            throw ostk::core::error::runtime::Undefined("Satellite");
+        }
+
+        satelliteIndexMap_.insert({satelliteSPtr->getName(), satelliteIndex});
+    }
+
+    const Size threadPoolWorkerCount = ThreadPool::GetWorkerCount();
+
+    if (threadPoolWorkerCount > 0)
+    {
+        throw ostk::core::error::RuntimeError(
+            "Cannot fork partition worker processes while [{}] thread pool workers are running.",
+            threadPoolWorkerCount
+        );
+    }
+
+    memorySize_ = RecordsOffset(processCount_) + (satellites_.getSize() * stateRecordSize * sizeof(double));
+
+    // An anonymous shared mapping is inherited by the forked workers, and released with the last process using it
+
+    memoryPtr_ = ::mmap(nullptr, memorySize_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+
+    if (memoryPtr_ == MAP_FAILED)
+    {
+        memoryPtr_ = nullptr;
+
+        throw ostk::core::error::RuntimeError("Cannot map partition shared memory: [{}].", std::strerror(errno));
+    }
+
+    Control& control = AccessControl(memoryPtr_);
+
+    control.instantNanoseconds = 0;
+    control.command = 0;
+
+    ::sem_init(&control.doneSemaphore, 1, 0);
+
+    for (Index workerIndex = 0; workerIndex < processCount_; ++workerIndex)
+    {
+        ::sem_init(&AccessStartSemaphore(memoryPtr_, workerIndex), 1, 0);
+    }
+
+    workerPids_.reserve(processCount_);
+
+    for (Index workerIndex = 0; workerIndex < processCount_; ++workerIndex)
+    {
+        const Index startIndex = (workerIndex * satellites_.getSize()) / processCount_;
+        const Index endIndex = ((workerIndex + 1) * satellites_.getSize()) / processCount_;
+
+        Array<Shared<const Satellite>> satelliteSlice = Array<Shared<const Satellite>>::Empty();
+        satelliteSlice.reserve(endIndex - startIndex);
+
+        for (Index satelliteIndex = startIndex; satelliteIndex < endIndex; ++satelliteIndex)
+        {
+            satelliteSlice.add(satellites_[satelliteIndex]);
+        }
+
+        const pid_t pid = ::fork();
+
+        if (pid == 0)
+        {
+            RunWorker(satelliteSlice, startIndex, memoryPtr_, processCount_, workerIndex);
+        }
+
+        if (pid < 0)
+        {
+            const String message = std::strerror(errno);
+
+            this->stop();
+
+            throw ostk::core::error::RuntimeError("Cannot fork partition worker process: [{}].", message);
+        }
+
+        workerPids_.push_back(pid);
+    }
+}
+
+Partition::~Partition()
+{
+    this->stop();
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const Partition& aPartition)
+{
+    aPartition.print(anOutputStream, true);
+
+    return anOutputStream;
+}
+
+Size Partition::getProcessCount() const
+{
+    return processCount_;
+}
+
+Size Partition::getSatelliteCount() const
+{
+    return satellites_.getSize();
+}
+
+Partition::View Partition::getStatesAt(const Instant& anInstant)
+{
+    if (!anInstant.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Instant");
+    }
+
+    const std::lock_guard<std::mutex> lock(mutex_);
+
+    if (hasFailed_)
+    {
+        throw ostk::core::error::RuntimeError("Cannot evaluate a partition with a failed worker process.");
+    }
+
+    // Views of the previous evaluation are stale from now on, whatever the outcome of this one
+
+    evaluationIndex_ += 1;
+
+    AccessControl(memoryPtr_).instantNanoseconds = NanosecondsFromInstant(anInstant);
+
+    this->post(evaluateCommand);
+
+    this->waitForWorkers();
+
+    // Semaphores order memory: records written by the workers are visible once they are all done
+
+    return {*this, anInstant, evaluationIndex_};
+}
+
+void Partition::print(std::ostream& anOutputStream, bool displayDecorators) const
+{
+    displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "Partition") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Process count:" << processCount_;
+    ostk::core::utils::Print::Line(anOutputStream) << "Satellite count:" << satellites_.getSize();
+    ostk::core::utils::Print::Line(anOutputStream) << "Shared memory [bytes]:" << memorySize_;
+    ostk::core::utils::Print::Line(anOutputStream) << "Failed:" << (hasFailed_ ? "True" : "False");
+
+    displayDecorators ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+TrajectoryState Partition::decodeStateRecord(const Index& aSatelliteIndex, const Instant& anInstant) const
+{
+    const double* record = AccessStateRecord(memoryPtr_, processCount_, aSatelliteIndex);
+
+    if (record[13] == 0.0)
+    {
+        return TrajectoryState::Undefined();
+    }
+
+    return {
+        anInstant,
+        Position::Meters({record[0], record[1], record[2]}, Frame::GCRF()),
+        Velocity::MetersPerSecond({record[3], record[4], record[5]}, Frame::GCRF()),
+        Quaternion::XYZS(record[6], record[7], record[8], record[9]),
+        Vector3d(record[10], record[11], record[12]),
+        Frame::GCRF()
+    };
+}
+
+void Partition::post(const int& aCommand)
+{
+    AccessControl(memoryPtr_).command = aCommand;
+
+    for (Index workerIndex = 0; workerIndex < workerPids_.size(); ++workerIndex)
+    {
+        ::sem_post(&AccessStartSemaphore(memoryPtr_, workerIndex));
+    }
+}
+
+void Partition::waitForWorkers()
+{
+    Control& control = AccessControl(memoryPtr_);
+
+    Size pendingCount = workerPids_.size();
+
+    while (pendingCount > 0)
+    {
+        timespec deadline;
+        ::clock_gettime(CLOCK_REALTIME, &deadline);
+
+        deadline.tv_nsec += workerPollPeriodNanoseconds;
+
+        if (deadline.tv_nsec >= nanosecondsPerSecond)
+        {
+            deadline.tv_sec += 1;
+            deadline.tv_nsec -= nanosecondsPerSecond;
+        }
+
+        if (::sem_timedwait(&control.doneSemaphore, &deadline) == 0)
+        {
+            pendingCount -= 1;
+
+            continue;
+        }
+
+        if (errno == EINTR)
+        {
+            continue;
+        }
+
+        // Timed out: a worker that exited would never post, check that all workers are still running
+
+        for (pid_t& pid : workerPids_)
+        {
+            if ((pid > 0) && (::waitpid(pid, nullptr, WNOHANG) == pid))
+            {
+                const pid_t exitedPid = pid;
+
+                pid = 0;
+                hasFailed_ = true;
+
+                throw ostk::core::error::RuntimeError("Partition worker process [{}] exited.", exitedPid);
+            }
+        }
+    }
+}
+
+void Partition::stop()
+{
+    if (memoryPtr_ == nullptr)
+    {
+        return;
+    }
+
+    this->post(stopCommand);
+
+    for (const pid_t& pid : workerPids_)
+    {
+        if (pid > 0)
+        {
+            while ((::waitpid(pid, nullptr, 0) < 0) && (errno == EINTR))
+            {
+            }
+        }
+    }
+
+    workerPids_.clear();
+
+    ::sem_destroy(&AccessControl(memoryPtr_).doneSemaphore);
+
+    for (Index workerIndex = 0; workerIndex < processCount_; ++workerIndex)
+    {
+        ::sem_destroy(&AccessStartSemaphore(memoryPtr_, workerIndex));
+    }
+
+    ::munmap(memoryPtr_, memorySize_);
+
+    memoryPtr_ = nullptr;
+}
+
+}  // namespace simulator
+}  // namespace simulation
+}  // namespace ostk
+
+#endif
@@ -0,0 +1,271 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Simulator/StateCache.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace simulator
+{
+
+StateCache::StateCache()
+    : generation_(0),
+      satelliteEntries_(),
+      geometryEntries_(),
+      celestialGeometryEntries_(),
+      transformEntries_(),
+      hitCount_(0),
+      missCount_(0),
+      mutex_()
+{
+}
+
+StateCache::StateCache(const StateCache& aStateCache)
+    : generation_(0),
+      satelliteEntries_(),
+      geometryEntries_(),
+      celestialGeometryEntries_(),
+      transformEntries_(),
+      hitCount_(0),
+      missCount_(0),
+      mutex_()
+{
+    *this = aStateCache;
+}
+
+StateCache& StateCache::operator=(const StateCache& aStateCache)
+{
+    if (this != &aStateCache)
+    {
+        const std::scoped_lock lock(this->mutex_, aStateCache.mutex_);
+
+        this->generation_ = aStateCache.generation_;
+        this->satelliteEntries_ = aStateCache.satelliteEntries_;
+        this->geometryEntries_ = aStateCache.geometryEntries_;
+        this->celestialGeometryEntries_ = aStateCache.celestialGeometryEntries_;
+        this->transformEntries_ = aStateCache.transformEntries_;
+        this->hitCount_ = aStateCache.hitCount_;
+        this->missCount_ = aStateCache.missCount_;
+    }
+
+    return *this;
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const StateCache& aStateCache)
+{
+    aStateCache.print(anOutputStream, true);
+
+    return anOutputStream;
+}
+
+bool StateCache::isSatelliteDirty(const String& aSatelliteName) const
+{
+    return this->isDirty(this->satelliteEntries_, aSatelliteName);
+}
+
+bool StateCache::isGeometryDirty(const Geometry& aGeometry) const
+{
+    return this->isDirty(
+        this->geometryEntries_, std::pair<const Component*, String>(&aGeometry.accessComponent(), aGeometry.getName())
+    );
+}
+
+bool StateCache::isTransformDirty(const Shared<const Frame>& aFrameSPtr) const
+{
+    if ((aFrameSPtr == nullptr) || (!aFrameSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    return this->isDirty(this->transformEntries_, aFrameSPtr.get(), aFrameSPtr);
+}
+
+Index StateCache::getGeneration() const
+{
+    const std::lock_guard<std::mutex> lock(this->mutex_);
+
+    return this->generation_;
+}
+
+Size StateCache::getSize() const
+{
+    const std::lock_guard<std::mutex> lock(this->mutex_);
+
+    const auto countClean = [this](const auto& anEntryMap) -> Size
+    {
+        Size count = 0;
+
+        for (const auto& entryIt : anEntryMap)
+        {
+            count += (entryIt.second.generation == this->generation_) ? 1 : 0;
+        }
+
+        return count;
+    };
+
+    return countClean(this->satelliteEntries_) + countClean(this->geometryEntries_) +
+           countClean(this->celestialGeometryEntries_) + countClean(this->transformEntries_);
+}
+
+Size StateCache::getHitCount() const
+{
+    const std::lock_guard<std::mutex> lock(this->mutex_);
+
+    return this->hitCount_;
+}
+
+Size StateCache::getMissCount() const
+{
+    const std::lock_guard<std::mutex> lock(this->mutex_);
+
+    return this->missCount_;
+}
+
+TrajectoryState StateCache::getSatelliteState(
+    const String& aSatelliteName, const std::function<TrajectoryState()>& anEvaluator
+)
+{
+    return this->get(this->satelliteEntries_, aSatelliteName, anEvaluator);
+}
+
+ObjectGeometry StateCache::getGeometry(const Geometry& aGeometry, const std::function<ObjectGeometry()>& anEvaluator)
+{
+    return this->get(
+        this->geometryEntries_,
+        std::pair<const Component*, String>(&aGeometry.accessComponent(), aGeometry.getName()),
+        anEvaluator
+    );
+}
+
+ObjectGeometry StateCache::getCelestialGeometry(
+    const Shared<const Celestial>& aCelestialObjectSPtr, const std::function<ObjectGeometry()>& anEvaluator
+)
+{
+    if ((aCelestialObjectSPtr == nullptr) || (!aCelestialObjectSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Celestial object");
+    }
+
+    return this->get(this->celestialGeometryEntries_, aCelestialObjectSPtr.get(), anEvaluator, aCelestialObjectSPtr);
+}
+
+Transform StateCache::getTransform(const Shared<const Frame>& aFrameSPtr, const std::function<Transform()>& anEvaluator)
+{
+    if ((aFrameSPtr == nullptr) || (!aFrameSPtr->isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Frame");
+    }
+
+    return this->get(this->transformEntries_, aFrameSPtr.get(), anEvaluator, aFrameSPtr);
+}
+
+void StateCache::print(std::ostream& anOutputStream, bool displayDecorators) const
+{
+    displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "State Cache") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Generation:" << this->getGeneration();
+    ostk::core::utils::Print::Line(anOutputStream) << "Size:" << this->getSize();
+    ostk::core::utils::Print::Line(anOutputStream) << "Hits:" << this->getHitCount();
+    ostk::core::utils::Print::Line(anOutputStream) << "Misses:" << this->getMissCount();
+
+    displayDecorators ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+void StateCache::invalidate()
+{
+    const std::lock_guard<std::mutex> lock(this->mutex_);
+
+    this->generation_ += 1;
+}
+
+void StateCache::clear()
+{
+    const std::lock_guard<std::mutex> lock(this->mutex_);
+
+    this->satelliteEntries_.clear();
+    this->geometryEntries_.clear();
+    this->celestialGeometryEntries_.clear();
+    this->transformEntries_.clear();
+
+    this->generation_ += 1;
+}
+
+void StateCache::resetCounters()
+{
+    const std::lock_guard<std::mutex> lock(this->mutex_);
+
+    this->hitCount_ = 0;
+    this->missCount_ = 0;
+}
+
+template <typename Value>
+bool StateCache::isClean(const Entry<Value>& anEntry, const Shared<const void>& anOwnerSPtr) const
+{
+    // Owners are compared by control block: an expired owner never matches a new object allocated at its address
+
+    const bool isSameOwner =
+        (!anEntry.ownerWPtr.owner_before(anOwnerSPtr)) && (!anOwnerSPtr.owner_before(anEntry.ownerWPtr));
+
+    return (anEntry.generation == this->generation_) && isSameOwner;
+}
+
+template <typename Key, typename Value>
+bool StateCache::isDirty(
+    const Map<Key, Entry<Value>>& anEntryMap, const Key& aKey, const Shared<const void>& anOwnerSPtr
+) const
+{
+    const std::lock_guard<std::mutex> lock(this->mutex_);
+
+    const auto entryIt = anEntryMap.find(aKey);
+
+    return (entryIt == anEntryMap.end()) || (!this->isClean(entryIt->second, anOwnerSPtr));
+}
+
+template <typename Key, typename Value>
+Value StateCache::get(
+    Map<Key, Entry<Value>>& anEntryMap,
+    const Key& aKey,
+    const std::function<Value()>& anEvaluator,
+    const Shared<const void>& anOwnerSPtr
+)
+{
+    Index generation = 0;
+
+    {
+        const std::lock_guard<std::mutex> lock(this->mutex_);
+
+        const auto entryIt = anEntryMap.find(aKey);
+
+        if ((entryIt != anEntryMap.end()) && this->isClean(entryIt->second, anOwnerSPtr))
+        {
+            this->hitCount_ += 1;
+
+            return entryIt->second.value;
+        }
+
+        this->missCount_ += 1;
+
+        generation = this->generation_;
+    }
+
+    // Evaluated without holding the lock, so that queries on other entries are not serialized behind it
+
+    const Value value = anEvaluator();
+
+    const std::lock_guard<std::mutex> lock(this->mutex_);
+
+    if (generation == this->generation_)
+    {
+        anEntryMap.insert_or_assign(aKey, Entry<Value> {generation, value, anOwnerSPtr});
+    }
+
+    return value;
+}
+
+}  // namespace simulator
+}  // namespace simulation
+}  // namespace ostk
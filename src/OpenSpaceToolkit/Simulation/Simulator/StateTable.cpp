@@ -0,0 +1,251 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Simulator/StateTable.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace simulator
+{
+
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+
+StateTable::StateTable(
+    const Array<Instant>& anInstantArray,
+    const MatrixXd& aPositionMatrix,
+    const MatrixXd& aVelocityMatrix,
+    const MatrixXd& anAttitudeMatrix,
+    const MatrixXd& anAngularVelocityMatrix
+)
+    : instants_(anInstantArray),
+      positions_(aPositionMatrix),
+      velocities_(aVelocityMatrix),
+      attitudes_(anAttitudeMatrix),
+      angularVelocities_(anAngularVelocityMatrix)
+{
+    const Size size = instants_.getSize();
+
+    if ((positions_.rows() != 3) || (velocities_.rows() != 3) || (attitudes_.rows() != 4) ||
+        (angularVelocities_.rows() != 3))
+    {
+        throw ostk::core::error::RuntimeError("State table matrices have invalid row counts.");
+    }
+
+    if ((Size(positions_.cols()) != size) || (Size(velocities_.cols()) != size) ||
+        (Size(attitudes_.cols()) != size) || (Size(angularVelocities_.cols()) != size))
+    {
+        throw ostk::core::error::RuntimeError(
+            "State table matrices column counts do not match instant count [{}].", size
+        );
+    }
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const StateTable& aStateTable)
+{
+    aStateTable.print(anOutputStream, true);
+
+    return anOutputStream;
+}
+
+bool StateTable::isDefined() const
+{
+    return !this->instants_.isEmpty();
+}
+
+Size StateTable::getSize() const
+{
+    return this->instants_.getSize();
+}
+
+const Array<Instant>& StateTable::accessInstants() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State table");
+    }
+
+    return this->instants_;
+}
+
+const MatrixXd& StateTable::accessPositions() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State table");
+    }
+
+    return this->positions_;
+}
+
+const MatrixXd& StateTable::accessVelocities() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State table");
+    }
+
+    return this->velocities_;
+}
+
+const MatrixXd& StateTable::accessAttitudes() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State table");
+    }
+
+    return this->attitudes_;
+}
+
+const MatrixXd& StateTable::accessAngularVelocities() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State table");
+    }
+
+    return this->angularVelocities_;
+}
+
+TrajectoryState StateTable::getStateAt(const Index& anIndex) const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("State table");
+    }
+
+    if (anIndex >= this->getSize())
+    {
+        throw ostk::core::error::RuntimeError("Index [{}] out of bounds [{}].", anIndex, this->getSize());
+    }
+
+    const Vector3d position = this->positions_.col(anIndex);
+    const Vector3d velocity = this->velocities_.col(anIndex);
+    const Vector3d angularVelocity = this->angularVelocities_.col(anIndex);
+
+    return {
+        this->instants_[anIndex],
+        Position::Meters(position, Frame::GCRF()),
+        Velocity::MetersPerSecond(velocity, Frame::GCRF()),
+        Quaternion::XYZS(
+            this->attitudes_(0, anIndex),
+            this->attitudes_(1, anIndex),
+            this->attitudes_(2, anIndex),
+            this->attitudes_(3, anIndex)
+        ),
+        angularVelocity,
+        Frame::GCRF()
+    };
+}
+
+void StateTable::print(std::ostream& anOutputStream, bool displayDecorators) const
+{
+    displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "State Table") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Size:" << this->getSize();
+
+    if (this->isDefined())
+    {
+        ostk::core::utils::Print::Line(anOutputStream) << "Start:" << this->instants_.accessFirst().toString();
+        ostk::core::utils::Print::Line(anOutputStream) << "End:" << this->instants_.accessLast().toString();
+    }
+
+    displayDecorators ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+StateTable StateTable::Undefined()
+{
+    return {Array<Instant>::Empty(), MatrixXd(3, 0), MatrixXd(3, 0), MatrixXd(4, 0), MatrixXd(3, 0)};
+}
+
+StateTable StateTable::FromStates(const Array<TrajectoryState>& aStateArray)
+{
+    const Size size = aStateArray.getSize();
+
+    Array<Instant> instants = Array<Instant>::Empty();
+    instants.reserve(size);
+
+    MatrixXd positions(3, size);
+    MatrixXd velocities(3, size);
+    MatrixXd attitudes(4, size);
+    MatrixXd angularVelocities(3, size);
+
+    for (Index index = 0; index < size; ++index)
+    {
+        const TrajectoryState state = aStateArray[index].inFrame(Frame::GCRF());
+
+        const Quaternion attitude = state.getAttitude();
+
+        instants.add(state.getInstant());
+
+        positions.col(index) = state.getPosition().getCoordinates();
+        velocities.col(index) = state.getVelocity().getCoordinates();
+        attitudes.col(index) << attitude.x(), attitude.y(), attitude.z(), attitude.s();
+        angularVelocities.col(index) = state.getAngularVelocity();
+    }
+
+    return {instants, positions, velocities, attitudes, angularVelocities};
+}
+
+StateTable StateTable::Concatenate(const Array<StateTable>& aStateTableArray)
+{
+    Size size = 0;
+
+    for (const auto& stateTable : aStateTableArray)
+    {
+        size += stateTable.getSize();
+    }
+
+    Array<Instant> instants = Array<Instant>::Empty();
+    instants.reserve(size);
+
+    MatrixXd positions(3, size);
+    MatrixXd velocities(3, size);
+    MatrixXd attitudes(4, size);
+    MatrixXd angularVelocities(3, size);
+
+    Index offset = 0;
+
+    for (const auto& stateTable : aStateTableArray)
+    {
+        const Size count = stateTable.getSize();
+
+        if (count == 0)
+        {
+            continue;
+        }
+
+        for (const auto& instant : stateTable.instants_)
+        {
+            instants.add(instant);
+        }
+
+        positions.middleCols(offset, count) = stateTable.positions_;
+        velocities.middleCols(offset, count) = stateTable.velocities_;
+        attitudes.middleCols(offset, count) = stateTable.attitudes_;
+        angularVelocities.middleCols(offset, count) = stateTable.angularVelocities_;
+
+        offset += count;
+    }
+
+    return {instants, positions, velocities, attitudes, angularVelocities};
+}
+
+}  // namespace simulator
+}  // namespace simulation
+}  // namespace ostk
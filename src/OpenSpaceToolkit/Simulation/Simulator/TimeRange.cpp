@@ -0,0 +1,375 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+#include <future>
+
+#include <OpenSpaceToolkit/Simulation/Simulator.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator/TimeRange.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Real.hpp>
+#include <OpenSpaceToolkit/Core/Utility.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace simulator
+{
+
+using ostk::core::type::Real;
+
+/// @brief Position of an iteration pass, shared by the copies of an iterator.
+class TimeRange::Cursor
+{
+   public:
+    Cursor(const TimeRange& aTimeRange)
+        : timeRange_(aTimeRange),
+          position_(0),
+          chunkIndex_(0),
+          chunkSPtr_(nullptr),
+          nextChunkFuture_(),
+          view_(nullptr, 0)
+    {
+        if (timeRange_.size_ > 0)
+        {
+            this->loadChunk(0);
+            view_ = View(chunkSPtr_, 0);
+        }
+    }
+
+    ~Cursor()
+    {
+        // A pending prefetch references the time range: wait for it before tearing down
+
+        if (nextChunkFuture_.valid())
+        {
+            nextChunkFuture_.wait();
+        }
+    }
+
+    bool isExhausted() const
+    {
+        return position_ >= timeRange_.size_;
+    }
+
+    const View& accessView() const
+    {
+        if (this->isExhausted())
+        {
+            throw ostk::core::error::RuntimeError("Cannot dereference an exhausted time range iterator.");
+        }
+
+        return view_;
+    }
+
+    void advance()
+    {
+        if (this->isExhausted())
+        {
+            throw ostk::core::error::RuntimeError("Cannot advance an exhausted time range iterator.");
+        }
+
+        const Index nextPosition = position_ + 1;
+
+        if (nextPosition >= timeRange_.size_)
+        {
+            position_ = nextPosition;
+            chunkSPtr_ = nullptr;
+            view_ = View(nullptr, 0);
+
+            return;
+        }
+
+        if ((nextPosition % timeRange_.chunkSize_) == 0)
+        {
+            this->loadChunk(chunkIndex_ + 1);
+        }
+
+        position_ = nextPosition;
+        view_ = View(chunkSPtr_, position_ - (chunkIndex_ * timeRange_.chunkSize_));
+    }
+
+   private:
+    const TimeRange timeRange_;
+    Index position_;
+    Index chunkIndex_;
+    Shared<const Chunk> chunkSPtr_;
+    std::future<Shared<const Chunk>> nextChunkFuture_;
+    View view_;
+
+    void loadChunk(const Index& aChunkIndex)
+    {
+        chunkSPtr_ = nextChunkFuture_.valid() ? nextChunkFuture_.get() : timeRange_.evaluateChunk(aChunkIndex);
+        chunkIndex_ = aChunkIndex;
+
+        if (timeRange_.prefetch_ && ((aChunkIndex + 1) < timeRange_.getChunkCount()))
+        {
+            nextChunkFuture_ = std::async(
+                std::launch::async,
+                [this, aChunkIndex]()
+                {
+                    return timeRange_.evaluateChunk(aChunkIndex + 1);
+                }
+            );
+        }
+    }
+};
+
+TimeRange::View::View(const Shared<const Chunk>& aChunkSPtr, const Index& anIndex)
+    : chunkSPtr_(aChunkSPtr),
+      index_(anIndex)
+{
+}
+
+Instant TimeRange::View::getInstant() const
+{
+    return chunkSPtr_->instants[index_];
+}
+
+Index TimeRange::View::getIndex() const
+{
+    return index_;
+}
+
+const Map<String, StateTable>& TimeRange::View::accessStateTableMap() const
+{
+    return chunkSPtr_->stateTableMap;
+}
+
+TrajectoryState TimeRange::View::getSatelliteStateWithName(const String& aSatelliteName) const
+{
+    const auto stateTableIt = chunkSPtr_->stateTableMap.find(aSatelliteName);
+
+    if (stateTableIt == chunkSPtr_->stateTableMap.end())
+    {
+        throw ostk::core::error::RuntimeError("No Satellite with name [{}].", aSatelliteName);
+    }
+
+    return stateTableIt->second.getStateAt(index_);
+}
+
+TimeRange::Iterator::Iterator()
+    : cursorSPtr_(nullptr)
+{
+}
+
+TimeRange::Iterator::Iterator(const Shared<Cursor>& aCursorSPtr)
+    : cursorSPtr_(aCursorSPtr)
+{
+}
+
+const TimeRange::View& TimeRange::Iterator::operator*() const
+{
+    if (this->isEnd())
+    {
+        throw ostk::core::error::RuntimeError("Cannot dereference an end time range iterator.");
+    }
+
+    return cursorSPtr_->accessView();
+}
+
+const TimeRange::View* TimeRange::Iterator::operator->() const
+{
+    return &(**this);
+}
+
+TimeRange::Iterator& TimeRange::Iterator::operator++()
+{
+    if (this->isEnd())
+    {
+        throw ostk::core::error::RuntimeError("Cannot advance an end time range iterator.");
+    }
+
+    cursorSPtr_->advance();
+
+    return *this;
+}
+
+TimeRange::Iterator TimeRange::Iterator::operator++(int)
+{
+    const Iterator iterator = *this;
+
+    ++(*this);
+
+    return iterator;
+}
+
+bool TimeRange::Iterator::operator==(const Iterator& anIterator) const
+{
+    if (this->isEnd() || anIterator.isEnd())
+    {
+        return this->isEnd() && anIterator.isEnd();
+    }
+
+    return cursorSPtr_ == anIterator.cursorSPtr_;
+}
+
+bool TimeRange::Iterator::operator!=(const Iterator& anIterator) const
+{
+    return !((*this) == anIterator);
+}
+
+bool TimeRange::Iterator::isEnd() const
+{
+    return (cursorSPtr_ == nullptr) || cursorSPtr_->isExhausted();
+}
+
+TimeRange::TimeRange(
+    const Simulator& aSimulator,
+    const Interval& anInterval,
+    const Duration& aStep,
+    const Size& aChunkSize,
+    const bool& prefetch
+)
+    : simulatorSPtr_(aSimulator.fork()),
+      interval_(anInterval),
+      step_(aStep),
+      size_(0),
+      chunkSize_(aChunkSize),
+      prefetch_(prefetch)
+{
+    if (!interval_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Interval");
+    }
+
+    if (!step_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Step");
+    }
+
+    if (!step_.isStrictlyPositive())
+    {
+        throw ostk::core::error::runtime::Wrong("Step");
+    }
+
+    if (chunkSize_ == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Chunk size");
+    }
+
+    const Instant& startInstant = interval_.accessStart();
+    const Instant& endInstant = interval_.accessEnd();
+
+    // Index of the last grid instant not after the end, corrected for rounding
+
+    Size lastIndex =
+        static_cast<Size>(std::floor(interval_.getDuration().inNanoseconds() / step_.inNanoseconds()));
+
+    while ((lastIndex > 0) && ((startInstant + step_ * Real(lastIndex)) > endInstant))
+    {
+        lastIndex -= 1;
+    }
+
+    while ((startInstant + step_ * Real(lastIndex + 1)) <= endInstant)
+    {
+        lastIndex += 1;
+    }
+
+    size_ = ((startInstant + step_ * Real(lastIndex)) < endInstant) ? (lastIndex + 2) : (lastIndex + 1);
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const TimeRange& aTimeRange)
+{
+    aTimeRange.print(anOutputStream, true);
+
+    return anOutputStream;
+}
+
+Interval TimeRange::getInterval() const
+{
+    return interval_;
+}
+
+Duration TimeRange::getStep() const
+{
+    return step_;
+}
+
+Size TimeRange::getSize() const
+{
+    return size_;
+}
+
+Size TimeRange::getChunkSize() const
+{
+    return chunkSize_;
+}
+
+bool TimeRange::isPrefetching() const
+{
+    return prefetch_;
+}
+
+Instant TimeRange::getInstantAt(const Index& anIndex) const
+{
+    if (anIndex >= size_)
+    {
+        throw ostk::core::error::RuntimeError("Instant index [{}] out of range [{}].", anIndex, size_);
+    }
+
+    if (anIndex == (size_ - 1))
+    {
+        return interval_.accessEnd();
+    }
+
+    return interval_.accessStart() + step_ * Real(anIndex);
+}
+
+TimeRange::Iterator TimeRange::begin() const
+{
+    if (size_ == 0)
+    {
+        return this->end();
+    }
+
+    return Iterator(std::make_shared<Cursor>(*this));
+}
+
+TimeRange::Iterator TimeRange::end() const
+{
+    return Iterator();
+}
+
+void TimeRange::print(std::ostream& anOutputStream, bool displayDecorators) const
+{
+    displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "Time Range") : void();
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Start:" << interval_.accessStart().toString();
+    ostk::core::utils::Print::Line(anOutputStream) << "End:" << interval_.accessEnd().toString();
+    ostk::core::utils::Print::Line(anOutputStream) << "Step:" << step_.toString();
+    ostk::core::utils::Print::Line(anOutputStream) << "Size:" << size_;
+    ostk::core::utils::Print::Line(anOutputStream) << "Chunk size:" << chunkSize_;
+    ostk::core::utils::Print::Line(anOutputStream) << "Prefetch:" << (prefetch_ ? "True" : "False");
+
+    displayDecorators ? ostk::core::utils::Print::Footer(anOutputStream) : void();
+}
+
+Size TimeRange::getChunkCount() const
+{
+    return (size_ + chunkSize_ - 1) / chunkSize_;
+}
+
+Shared<const TimeRange::Chunk> TimeRange::evaluateChunk(const Index& aChunkIndex) const
+{
+    const Index offset = aChunkIndex * chunkSize_;
+    const Size count = std::min(chunkSize_, size_ - offset);
+
+    Array<Instant> instants = Array<Instant>::Empty();
+    instants.reserve(count);
+
+    for (Index index = offset; index < (offset + count); ++index)
+    {
+        instants.add(this->getInstantAt(index));
+    }
+
+    Map<String, StateTable> stateTableMap = simulatorSPtr_->evaluate(instants);
+
+    return std::make_shared<const Chunk>(Chunk {instants, stateTableMap});
+}
+
+}  // namespace simulator
+}  // namespace simulation
+}  // namespace ostk
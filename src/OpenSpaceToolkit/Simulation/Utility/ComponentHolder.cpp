@@ -15,20 +15,32 @@ namespace utility
 {
 
 ComponentHolder::ComponentHolder(const Array<Shared<Component>>& aComponentArray)
-    : componentMap_()
+    : componentMap_(),
+      componentIndex_()
 {
+    componentIndex_.reserve(aComponentArray.getSize());
+
     for (const auto& componentSPtr : aComponentArray)
     {
-        componentMap_.insert({componentSPtr->getName(), componentSPtr});
+        if (componentMap_.insert({componentSPtr->getName(), componentSPtr}).second)
+        {
+            componentIndex_.insert(Symbol(componentSPtr->getName()), componentSPtr);
+        }
     }
 }
 
 ComponentHolder::ComponentHolder(const ComponentHolder& aComponentHolder)
-    : componentMap_()
+    : componentMap_(),
+      componentIndex_()
 {
+    componentIndex_.reserve(aComponentHolder.componentMap_.size());
+
     for (const auto& componentMapIt : aComponentHolder.componentMap_)
     {
-        componentMap_.insert({componentMapIt.first, Shared<Component>(componentMapIt.second->clone())});
+        const Shared<Component> componentSPtr = Shared<Component>(componentMapIt.second->clone());
+
+        componentMap_.insert({componentMapIt.first, componentSPtr});
+        componentIndex_.insert(Symbol(componentMapIt.first), componentSPtr);
     }
 }
 
@@ -59,7 +71,7 @@ bool ComponentHolder::hasComponentWithName(const String& aComponentName) const
         throw ostk::core::error::runtime::Undefined("Component name");
     }
 
-    return componentMap_.find(aComponentName) != componentMap_.end();
+    return componentIndex_.find(aComponentName) != nullptr;
 }
 
 bool ComponentHolder::hasComponentAt(const String& aComponentPath) const
@@ -87,7 +99,10 @@ void ComponentHolder::addComponent(const Shared<Component>& aComponentSPtr)
         throw ostk::core::error::runtime::Undefined("Component");
     }
 
-    componentMap_.insert({aComponentSPtr->getName(), aComponentSPtr});
+    if (componentMap_.insert({aComponentSPtr->getName(), aComponentSPtr}).second)
+    {
+        componentIndex_.insert(Symbol(aComponentSPtr->getName()), aComponentSPtr);
+    }
 }
 
 Array<Shared<Component>> ComponentHolder::accessComponents() const
@@ -129,14 +144,43 @@ const Component& ComponentHolder::accessComponentWithName(const String& aCompone
         throw ostk::core::error::runtime::Undefined("Component name");
     }
 
-    const auto componentIt = componentMap_.find(aComponentName);
+    const Shared<Component>* componentSPtrPtr = componentIndex_.find(aComponentName);
 
-    if (componentIt == componentMap_.end())
+    if (componentSPtrPtr == nullptr)
     {
         throw ostk::core::error::RuntimeError("No Component found with name [{}].", aComponentName);
     }
 
-    return *(componentIt->second);
+    return **componentSPtrPtr;
+}
+
+ComponentHolder::ComponentHandle ComponentHolder::getComponentHandle(const String& aComponentName) const
+{
+    if (aComponentName.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Component name");
+    }
+
+    const ComponentHandle componentHandle = componentIndex_.getHandle(aComponentName);
+
+    if (!componentHandle.isDefined())
+    {
+        throw ostk::core::error::RuntimeError("No Component found with name [{}].", aComponentName);
+    }
+
+    return componentHandle;
+}
+
+const Component& ComponentHolder::accessComponent(const ComponentHandle& aComponentHandle) const
+{
+    const Shared<Component>* componentSPtrPtr = componentIndex_.resolve(aComponentHandle);
+
+    if (componentSPtrPtr == nullptr)
+    {
+        throw ostk::core::error::RuntimeError("No Component found with name [{}].", aComponentHandle.symbol);
+    }
+
+    return **componentSPtrPtr;
 }
 
 Array<Shared<const Component>> ComponentHolder::accessComponentsWithTag(const String& aComponentTag) const
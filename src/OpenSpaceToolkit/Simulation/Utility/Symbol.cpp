@@ -0,0 +1,159 @@
+/// Apache License 2.0
+
+#include <mutex>
+#include <unordered_map>
+
+#include <OpenSpaceToolkit/Simulation/Utility/Symbol.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Weak.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace utility
+{
+
+using ostk::core::type::Weak;
+
+namespace
+{
+
+struct SymbolRegistry
+{
+    std::mutex mutex;
+    std::unordered_map<std::string, Weak<const void>> records;
+};
+
+SymbolRegistry& AccessSymbolRegistry()
+{
+    // Never destroyed, so that symbols held by static objects can still be released at exit
+
+    static SymbolRegistry* registryPtr = new SymbolRegistry();
+
+    return *registryPtr;
+}
+
+}  // namespace
+
+Symbol::Symbol(const String& aName)
+    : recordSPtr_(Symbol::Intern(aName))
+{
+}
+
+bool Symbol::operator==(const Symbol& aSymbol) const
+{
+    return this->recordSPtr_ == aSymbol.recordSPtr_;
+}
+
+bool Symbol::operator!=(const Symbol& aSymbol) const
+{
+    return !((*this) == aSymbol);
+}
+
+std::ostream& operator<<(std::ostream& anOutputStream, const Symbol& aSymbol)
+{
+    anOutputStream << (aSymbol.isDefined() ? aSymbol.accessName() : String("Undefined"));
+
+    return anOutputStream;
+}
+
+bool Symbol::isDefined() const
+{
+    return this->recordSPtr_ != nullptr;
+}
+
+const String& Symbol::accessName() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Symbol");
+    }
+
+    return this->recordSPtr_->name;
+}
+
+Size Symbol::getHash() const
+{
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Symbol");
+    }
+
+    return this->recordSPtr_->hash;
+}
+
+Symbol Symbol::Undefined()
+{
+    return {};
+}
+
+Size Symbol::Hash(const String& aName)
+{
+    return std::hash<std::string> {}(aName);
+}
+
+Symbol::Symbol()
+    : recordSPtr_(nullptr)
+{
+}
+
+Shared<const Symbol::Record> Symbol::Intern(const String& aName)
+{
+    if (aName.isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Name");
+    }
+
+    SymbolRegistry& registry = AccessSymbolRegistry();
+
+    const std::lock_guard<std::mutex> lock(registry.mutex);
+
+    Weak<const void>& recordWPtr = registry.records[aName];
+
+    if (const Shared<const void> recordSPtr = recordWPtr.lock())
+    {
+        return std::static_pointer_cast<const Record>(recordSPtr);
+    }
+
+    // The last symbol referring to a record releases it from the registry, unless the name was interned again since
+
+    const Shared<const Record> recordSPtr(
+        new Record {aName, Symbol::Hash(aName)},
+        [](const Record* aRecordPtr)
+        {
+            SymbolRegistry& ownerRegistry = AccessSymbolRegistry();
+
+            {
+                const std::lock_guard<std::mutex> eraseLock(ownerRegistry.mutex);
+
+                const auto recordIt = ownerRegistry.records.find(aRecordPtr->name);
+
+                if ((recordIt != ownerRegistry.records.end()) && recordIt->second.expired())
+                {
+                    ownerRegistry.records.erase(recordIt);
+                }
+            }
+
+            delete aRecordPtr;
+        }
+    );
+
+    recordWPtr = recordSPtr;
+
+    return recordSPtr;
+}
+
+Size Symbol::GetInternedCount()
+{
+    SymbolRegistry& registry = AccessSymbolRegistry();
+
+    const std::lock_guard<std::mutex> lock(registry.mutex);
+
+    return registry.records.size();
+}
+
+}  // namespace utility
+}  // namespace simulation
+}  // namespace ostk
@@ -0,0 +1,207 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Utility/ThreadPool.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+namespace ostk
+{
+namespace simulation
+{
+namespace utility
+{
+
+namespace
+{
+
+thread_local bool isProcessing = false;
+
+std::atomic<Size> workerCount = 0;
+
+}
+
+ThreadPool::ThreadPool(const Size& aThreadCount)
+    : workers_(),
+      functionPtr_(nullptr),
+      count_(0),
+      nextIndex_(0),
+      pendingWorkerCount_(0),
+      generation_(0),
+      stopping_(false),
+      exceptionPtr_(nullptr)
+{
+    if (aThreadCount == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Thread count", aThreadCount);
+    }
+
+    workers_.reserve(aThreadCount - 1);
+
+    for (Index threadIndex = 1; threadIndex < aThreadCount; ++threadIndex)
+    {
+        workers_.emplace_back(&ThreadPool::work, this);
+
+        workerCount += 1;
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        stopping_ = true;
+    }
+
+    workCondition_.notify_all();
+
+    for (auto& worker : workers_)
+    {
+        worker.join();
+
+        workerCount -= 1;
+    }
+}
+
+Size ThreadPool::getThreadCount() const
+{
+    return workers_.size() + 1;
+}
+
+void ThreadPool::parallelFor(const Size& aCount, const std::function<void(const Index&)>& aFunction)
+{
+    if (aCount == 0)
+    {
+        return;
+    }
+
+    if (workers_.empty() || (aCount == 1) || isProcessing)
+    {
+        for (Index index = 0; index < aCount; ++index)
+        {
+            aFunction(index);
+        }
+
+        return;
+    }
+
+    std::lock_guard<std::mutex> submitLock(submitMutex_);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        functionPtr_ = &aFunction;
+        count_ = aCount;
+        nextIndex_.store(0);
+        pendingWorkerCount_ = workers_.size();
+        exceptionPtr_ = nullptr;
+
+        ++generation_;
+    }
+
+    workCondition_.notify_all();
+
+    this->process();
+
+    std::exception_ptr exceptionPtr = nullptr;
+
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        doneCondition_.wait(
+            lock,
+            [this]
+            {
+                return pendingWorkerCount_ == 0;
+            }
+        );
+
+        functionPtr_ = nullptr;
+
+        std::swap(exceptionPtr, exceptionPtr_);
+    }
+
+    if (exceptionPtr)
+    {
+        std::rethrow_exception(exceptionPtr);
+    }
+}
+
+Size ThreadPool::GetWorkerCount()
+{
+    return workerCount;
+}
+
+void ThreadPool::work()
+{
+    Size generation = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+
+            workCondition_.wait(
+                lock,
+                [this, &generation]
+                {
+                    return stopping_ || (generation_ != generation);
+                }
+            );
+
+            if (stopping_)
+            {
+                return;
+            }
+
+            generation = generation_;
+        }
+
+        this->process();
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            --pendingWorkerCount_;
+        }
+
+        doneCondition_.notify_all();
+    }
+}
+
+void ThreadPool::process()
+{
+    isProcessing = true;
+
+    while (true)
+    {
+        const Index index = nextIndex_.fetch_add(1);
+
+        if (index >= count_)
+        {
+            break;
+        }
+
+        try
+        {
+            (*functionPtr_)(index);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            if (!exceptionPtr_)
+            {
+                exceptionPtr_ = std::current_exception();
+            }
+
+            nextIndex_.store(count_);
+        }
+    }
+
+    isProcessing = false;
+}
+
+}  // namespace utility
+}  // namespace simulation
+}  // namespace ostk
@@ -0,0 +1,88 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <OpenSpaceToolkit/Simulation/Component.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator/FrameRegistry.hpp>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Shared;
+
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+
+using ostk::simulation::Component;
+using ostk::simulation::simulator::FrameRegistry;
+
+TEST(OpenSpaceToolkit_Simulation_Component, GenerateFrame)
+{
+    // Mounted a quarter turn about z from its parent, whatever the instant
+
+    {
+        const Quaternion quaternion = Quaternion::XYZS(0.0, 0.0, std::sin(M_PI / 4.0), std::cos(M_PI / 4.0));
+
+        const Shared<const Frame> frameSPtr =
+            Component::GenerateFrame("Component [GenerateFrame]", quaternion, Frame::GCRF());
+
+        const Vector3d reference =
+            Frame::GCRF()->getTransformTo(frameSPtr, Instant::J2000()).applyToVector(Vector3d::UnitX());
+
+        EXPECT_NEAR(0.0, reference.dot(Vector3d::UnitX()), 1e-12);
+        EXPECT_NEAR(1.0, std::abs(reference.y()), 1e-12);
+
+        const Array<Instant> instants = {
+            Instant::J2000() + Duration::Seconds(1.0),
+            Instant::J2000() + Duration::Days(1.0),
+        };
+
+        for (const auto& instant : instants)
+        {
+            const Transform transform = Frame::GCRF()->getTransformTo(frameSPtr, instant);
+
+            EXPECT_EQ(instant, transform.getInstant());
+            EXPECT_TRUE(transform.getTranslation().isZero());
+            EXPECT_TRUE(transform.getAngularVelocity().isZero());
+            EXPECT_TRUE(transform.applyToVector(Vector3d::UnitX()).isApprox(reference, 1e-12));
+        }
+
+        EXPECT_FALSE(Frame::Exists("Component [GenerateFrame]"));
+    }
+
+    // Registered in a frame registry, rather than globally
+
+    {
+        const Shared<FrameRegistry> frameRegistrySPtr = std::make_shared<FrameRegistry>();
+
+        const Shared<const Frame> frameSPtr = Component::GenerateFrame(
+            "Component [GenerateFrame]", Quaternion::Unit(), Frame::GCRF(), frameRegistrySPtr
+        );
+
+        EXPECT_EQ(frameSPtr, frameRegistrySPtr->accessFrameWithName("Component [GenerateFrame]"));
+        EXPECT_FALSE(Frame::Exists("Component [GenerateFrame]"));
+    }
+
+    {
+        EXPECT_THROW(
+            Component::GenerateFrame("Component [GenerateFrame]", Quaternion::Unit(), nullptr),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
@@ -0,0 +1,498 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Event/Behavior.hpp>
+
+#if defined(__cpp_impl_coroutine)
+
+#include <OpenSpaceToolkit/Simulation/Component.hpp>
+#include <OpenSpaceToolkit/Simulation/Component/Geometry.hpp>
+#include <OpenSpaceToolkit/Simulation/Component/State.hpp>
+#include <OpenSpaceToolkit/Simulation/Event/Detector.hpp>
+#include <OpenSpaceToolkit/Simulation/Satellite.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Composite.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Polygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Pyramid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/Profile.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+using ostk::mathematics::geometry::d3::object::Composite;
+using ostk::mathematics::geometry::d3::object::Point;
+using ostk::mathematics::geometry::d3::object::Polygon;
+using ostk::mathematics::geometry::d3::object::Pyramid;
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+
+using ostk::physics::Environment;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+using ostk::physics::time::Time;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::flight::Profile;
+using ostk::astrodynamics::trajectory::Orbit;
+
+using ostk::simulation::Component;
+using ostk::simulation::component::State;
+using ostk::simulation::event::Behavior;
+using ostk::simulation::event::Detector;
+using ostk::simulation::Simulator;
+using ostk::simulation::simulator::Checkpoint;
+
+namespace
+{
+
+// Coroutine parameters are passed by value, unless they outlive the behavior
+
+Behavior Record(Simulator& aSimulator, Array<Instant>& anInstantArray, const Array<Duration> aDurationArray)
+{
+    anInstantArray.add(aSimulator.getInstant());
+
+    for (const auto& duration : aDurationArray)
+    {
+        co_await Behavior::WaitFor(duration);
+
+        anInstantArray.add(aSimulator.getInstant());
+    }
+}
+
+Behavior RecordUntil(Simulator& aSimulator, Array<Instant>& anInstantArray, const Instant anInstant)
+{
+    co_await Behavior::WaitUntil(anInstant);
+
+    anInstantArray.add(aSimulator.getInstant());
+}
+
+Behavior RecordCrossing(
+    Simulator& aSimulator,
+    Array<Detector::Crossing>& aCrossingArray,
+    Array<Instant>& anInstantArray,
+    const Detector aDetector,
+    const Interval anInterval
+)
+{
+    const Detector::Crossing crossing =
+        co_await Behavior::WaitForCrossing(aDetector, anInterval, Duration::Minutes(1.0));
+
+    aCrossingArray.add(crossing);
+    anInstantArray.add(aSimulator.getInstant());
+}
+
+Behavior Operate(Simulator& aSimulator, const String aComponentId)
+{
+    aSimulator.setComponentStateWithId(aComponentId, State(State::Status::Busy));
+
+    co_await Behavior::WaitFor(Duration::Minutes(10.0));
+
+    aSimulator.setComponentStateWithId(aComponentId, State(State::Status::Idle));
+}
+
+Behavior Fail(const Duration aDuration)
+{
+    co_await Behavior::WaitFor(aDuration);
+
+    throw ostk::core::error::RuntimeError("Failure.");
+}
+
+}  // namespace
+
+class OpenSpaceToolkit_Simulation_Event_Behavior : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        const Orbit orbit = Orbit::SunSynchronous(
+            epoch_,                                              // Epoch
+            Length::Kilometers(500.0),                           // Altitude
+            Time(14, 0, 0),                                      // LTAN
+            environment_.accessCelestialObjectWithName("Earth")  // Celestial object
+        );
+
+        const Composite fieldOfView = {Pyramid {
+            Polygon {
+                {{{-0.1, -1.0}, {+0.1, -1.0}, {+0.1, +1.0}, {-0.1, +1.0}}},
+                Point {0.0, 0.0, 1.0},
+                {1.0, 0.0, 0.0},
+                {0.0, 1.0, 0.0}
+            },
+            Point {0.0, 0.0, 0.0}
+        }};
+
+        // The nadir-pointing camera always sees the Earth, the inertially-pointing camera (holding a lens) only over
+        // part of the orbit
+
+        this->simulatorSPtr_ = Simulator::Configure(
+            {environment_,
+             {{"1",
+               "LoftSat-1",
+               Profile::LocalOrbitalFramePointing(orbit, Orbit::FrameType::VVLH),
+               {{"2", "Camera", Component::Type::Sensor, {}, Quaternion::Unit(), {{"FOV", fieldOfView}}}}},
+              {"3",
+               "LoftSat-2",
+               Profile::InertialPointing(orbit, Quaternion::Unit()),
+               {{"4",
+                 "Camera",
+                 Component::Type::Sensor,
+                 {},
+                 Quaternion::Unit(),
+                 {{"FOV", fieldOfView}},
+                 {{"5", "Lens", Component::Type::Sensor}}}}}}}
+        );
+
+        this->simulatorSPtr_->setInstant(epoch_);
+
+        const Shared<const Celestial> earthSPtr = environment_.accessCelestialObjectWithName("Earth");
+
+        this->nadirDetector_ = {
+            this->simulatorSPtr_->accessSatelliteWithName("LoftSat-1")
+                .accessComponentWithName("Camera")
+                .getGeometries()
+                .accessFirst(),
+            *earthSPtr,
+            Detector::Predicate::Intersects
+        };
+        this->inertialDetector_ = {
+            this->simulatorSPtr_->accessSatelliteWithName("LoftSat-2")
+                .accessComponentWithName("Camera")
+                .getGeometries()
+                .accessFirst(),
+            *earthSPtr,
+            Detector::Predicate::Intersects
+        };
+    }
+
+    const Environment environment_ = Environment::Default();
+
+    const Instant epoch_ = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
+    Shared<Simulator> simulatorSPtr_ = nullptr;
+
+    Detector nadirDetector_ = Detector::Undefined();
+    Detector inertialDetector_ = Detector::Undefined();
+};
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Behavior, IsDefined)
+{
+    {
+        Array<Instant> instants = Array<Instant>::Empty();
+
+        Behavior behavior = Record(*simulatorSPtr_, instants, {});
+
+        EXPECT_TRUE(behavior.isDefined());
+        EXPECT_FALSE(behavior.isDone());
+
+        // Behaviors do not run until started
+
+        EXPECT_TRUE(instants.isEmpty());
+
+        const Behavior movedBehavior = std::move(behavior);
+
+        EXPECT_FALSE(behavior.isDefined());
+        EXPECT_TRUE(movedBehavior.isDefined());
+
+        EXPECT_THROW(behavior.isDone(), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Behavior, WaitFor)
+{
+    {
+        Array<Instant> instants = Array<Instant>::Empty();
+
+        simulatorSPtr_->startBehavior(
+            Record(*simulatorSPtr_, instants, {Duration::Minutes(5.0), Duration::Zero(), Duration::Minutes(10.0)})
+        );
+
+        // The behavior runs until its first suspension when started
+
+        EXPECT_EQ(Array<Instant>({epoch_}), instants);
+        EXPECT_EQ(1, simulatorSPtr_->getBehaviorCount());
+        EXPECT_EQ(1, simulatorSPtr_->accessScheduler().getEventCount());
+
+        simulatorSPtr_->run(epoch_ + Duration::Minutes(6.0));
+
+        EXPECT_EQ(
+            Array<Instant>({epoch_, epoch_ + Duration::Minutes(5.0), epoch_ + Duration::Minutes(5.0)}), instants
+        );
+
+        simulatorSPtr_->run(epoch_ + Duration::Hours(1.0));
+
+        EXPECT_EQ(4, instants.getSize());
+        EXPECT_EQ(epoch_ + Duration::Minutes(15.0), instants.accessLast());
+        EXPECT_EQ(0, simulatorSPtr_->getBehaviorCount());
+        EXPECT_TRUE(simulatorSPtr_->accessScheduler().isEmpty());
+    }
+
+    {
+        EXPECT_THROW(Behavior::WaitFor(Duration::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Behavior::WaitFor(-Duration::Minutes(1.0)), ostk::core::error::runtime::Wrong);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Behavior, WaitUntil)
+{
+    {
+        Array<Instant> instants = Array<Instant>::Empty();
+
+        simulatorSPtr_->startBehavior(RecordUntil(*simulatorSPtr_, instants, epoch_ + Duration::Minutes(30.0)));
+
+        EXPECT_TRUE(instants.isEmpty());
+
+        simulatorSPtr_->run(epoch_ + Duration::Hours(1.0));
+
+        EXPECT_EQ(Array<Instant>({epoch_ + Duration::Minutes(30.0)}), instants);
+    }
+
+    // Waiting until a past instant fails within the behavior
+
+    {
+        Array<Instant> instants = Array<Instant>::Empty();
+
+        EXPECT_THROW(
+            simulatorSPtr_->startBehavior(RecordUntil(*simulatorSPtr_, instants, epoch_)),
+            ostk::core::error::RuntimeError
+        );
+
+        EXPECT_EQ(0, simulatorSPtr_->getBehaviorCount());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Behavior, WaitForCrossing)
+{
+    {
+        const Interval interval = Interval::Closed(epoch_, epoch_ + Duration::Hours(2.0));
+
+        const Array<Detector::Crossing> expectedCrossings =
+            inertialDetector_.computeCrossings(interval, Duration::Minutes(1.0));
+
+        ASSERT_FALSE(expectedCrossings.isEmpty());
+
+        Array<Detector::Crossing> crossings = Array<Detector::Crossing>::Empty();
+        Array<Instant> instants = Array<Instant>::Empty();
+
+        simulatorSPtr_->startBehavior(
+            RecordCrossing(*simulatorSPtr_, crossings, instants, inertialDetector_, interval)
+        );
+
+        simulatorSPtr_->run(interval.getEnd());
+
+        ASSERT_EQ(1, crossings.getSize());
+        EXPECT_EQ(expectedCrossings.accessFirst().instant, crossings.accessFirst().instant);
+        EXPECT_EQ(expectedCrossings.accessFirst().type, crossings.accessFirst().type);
+        EXPECT_EQ(Array<Instant>({expectedCrossings.accessFirst().instant}), instants);
+    }
+
+    // Without crossing, the behavior resumes at the end of the interval
+
+    {
+        const Interval interval = Interval::Closed(
+            simulatorSPtr_->getInstant(), simulatorSPtr_->getInstant() + Duration::Minutes(10.0)
+        );
+
+        Array<Detector::Crossing> crossings = Array<Detector::Crossing>::Empty();
+        Array<Instant> instants = Array<Instant>::Empty();
+
+        simulatorSPtr_->startBehavior(RecordCrossing(*simulatorSPtr_, crossings, instants, nadirDetector_, interval));
+
+        simulatorSPtr_->run(interval.getEnd() + Duration::Minutes(1.0));
+
+        ASSERT_EQ(1, crossings.getSize());
+        EXPECT_FALSE(crossings.accessFirst().instant.isDefined());
+        EXPECT_EQ(Array<Instant>({interval.getEnd()}), instants);
+    }
+
+    {
+        EXPECT_THROW(
+            Behavior::WaitForCrossing(Detector::Undefined(), Interval::Closed(epoch_, epoch_), Duration::Minutes(1.0)),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            Behavior::WaitForCrossing(nadirDetector_, Interval::Undefined(), Duration::Minutes(1.0)),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Behavior, StartBehavior)
+{
+    {
+        simulatorSPtr_->startBehavior(Operate(*simulatorSPtr_, "2"));
+
+        EXPECT_EQ(State::Status::Busy, simulatorSPtr_->getComponentStateWithId("2").getStatus());
+
+        simulatorSPtr_->run(epoch_ + Duration::Hours(1.0));
+
+        EXPECT_EQ(State::Status::Idle, simulatorSPtr_->getComponentStateWithId("2").getStatus());
+    }
+
+    // Thousands of suspended behaviors only hold one pending event each
+
+    {
+        Array<Instant> instants = Array<Instant>::Empty();
+
+        for (Index index = 0; index < 1000; ++index)
+        {
+            simulatorSPtr_->startBehavior(Record(*simulatorSPtr_, instants, {Duration::Minutes(1.0 + index)}));
+        }
+
+        EXPECT_EQ(1000, simulatorSPtr_->getBehaviorCount());
+        EXPECT_EQ(1000, simulatorSPtr_->accessScheduler().getEventCount());
+
+        simulatorSPtr_->run(simulatorSPtr_->getInstant() + Duration::Days(1.0));
+
+        EXPECT_EQ(2000, instants.getSize());
+        EXPECT_EQ(0, simulatorSPtr_->getBehaviorCount());
+    }
+
+    // Exceptions are rethrown by the call resuming the behavior
+
+    {
+        simulatorSPtr_->startBehavior(Fail(Duration::Minutes(1.0)));
+
+        EXPECT_THROW(
+            simulatorSPtr_->run(simulatorSPtr_->getInstant() + Duration::Minutes(2.0)), ostk::core::error::RuntimeError
+        );
+
+        EXPECT_EQ(0, simulatorSPtr_->getBehaviorCount());
+    }
+
+    {
+        Behavior behavior = Fail(Duration::Minutes(1.0));
+        Behavior movedBehavior = std::move(behavior);
+
+        EXPECT_THROW(simulatorSPtr_->startBehavior(std::move(behavior)), ostk::core::error::runtime::Undefined);
+    }
+
+    {
+        EXPECT_THROW(
+            Simulator::Undefined().startBehavior(Fail(Duration::Minutes(1.0))), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            simulatorSPtr_->startBehavior(Fail(Duration::Minutes(1.0)), Component::Undefined()),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Behavior, CancelBehavior)
+{
+    {
+        Array<Instant> instants = Array<Instant>::Empty();
+
+        const Index behaviorId =
+            simulatorSPtr_->startBehavior(Record(*simulatorSPtr_, instants, {Duration::Minutes(5.0)}));
+
+        simulatorSPtr_->cancelBehavior(behaviorId);
+
+        EXPECT_EQ(0, simulatorSPtr_->getBehaviorCount());
+        EXPECT_TRUE(simulatorSPtr_->accessScheduler().isEmpty());
+
+        simulatorSPtr_->run(epoch_ + Duration::Hours(1.0));
+
+        EXPECT_EQ(1, instants.getSize());
+
+        EXPECT_THROW(simulatorSPtr_->cancelBehavior(behaviorId), ostk::core::error::RuntimeError);
+    }
+
+    // Behaviors attached to a satellite or to its components (at any depth) are cancelled with the satellite
+
+    {
+        Array<Instant> instants = Array<Instant>::Empty();
+
+        simulatorSPtr_->startBehavior(
+            Record(*simulatorSPtr_, instants, {Duration::Minutes(5.0)}),
+            simulatorSPtr_->accessSatelliteWithName("LoftSat-2")
+        );
+        simulatorSPtr_->startBehavior(
+            Record(*simulatorSPtr_, instants, {Duration::Minutes(5.0)}),
+            simulatorSPtr_->accessSatelliteWithName("LoftSat-2").accessComponentWithName("Camera")
+        );
+        simulatorSPtr_->startBehavior(
+            Record(*simulatorSPtr_, instants, {Duration::Minutes(5.0)}),
+            simulatorSPtr_->accessSatelliteWithName("LoftSat-2")
+                .accessComponentWithName("Camera")
+                .accessComponentWithName("Lens")
+        );
+        simulatorSPtr_->startBehavior(
+            Record(*simulatorSPtr_, instants, {Duration::Minutes(5.0)}),
+            simulatorSPtr_->accessSatelliteWithName("LoftSat-1")
+        );
+
+        EXPECT_EQ(4, simulatorSPtr_->getBehaviorCount());
+
+        simulatorSPtr_->removeSatelliteWithName("LoftSat-2");
+
+        EXPECT_EQ(1, simulatorSPtr_->getBehaviorCount());
+
+        simulatorSPtr_->clearSatellites();
+
+        EXPECT_EQ(0, simulatorSPtr_->getBehaviorCount());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Behavior, Restore)
+{
+    // Behaviors are not part of checkpoints, and are cancelled on restore
+
+    {
+        Array<Instant> instants = Array<Instant>::Empty();
+
+        const Checkpoint checkpoint = simulatorSPtr_->createCheckpoint();
+
+        simulatorSPtr_->startBehavior(Record(*simulatorSPtr_, instants, {Duration::Minutes(5.0)}));
+        simulatorSPtr_->startBehavior(
+            Record(*simulatorSPtr_, instants, {Duration::Minutes(5.0)}),
+            simulatorSPtr_->accessSatelliteWithName("LoftSat-1")
+        );
+
+        EXPECT_EQ(2, simulatorSPtr_->getBehaviorCount());
+
+        simulatorSPtr_->restore(checkpoint);
+
+        EXPECT_EQ(0, simulatorSPtr_->getBehaviorCount());
+        EXPECT_TRUE(simulatorSPtr_->accessScheduler().isEmpty());
+
+        simulatorSPtr_->run(epoch_ + Duration::Hours(1.0));
+
+        EXPECT_EQ(2, instants.getSize());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Behavior, Fork)
+{
+    {
+        Array<Instant> instants = Array<Instant>::Empty();
+
+        simulatorSPtr_->startBehavior(Record(*simulatorSPtr_, instants, {Duration::Minutes(5.0)}));
+
+        const Shared<Simulator> forkSPtr = simulatorSPtr_->fork();
+
+        EXPECT_EQ(0, forkSPtr->getBehaviorCount());
+        EXPECT_TRUE(forkSPtr->accessScheduler().isEmpty());
+        EXPECT_FALSE(simulatorSPtr_->accessScheduler().isEmpty());
+
+        forkSPtr->run(epoch_ + Duration::Hours(1.0));
+
+        EXPECT_EQ(1, instants.getSize());
+
+        simulatorSPtr_->run(epoch_ + Duration::Hours(1.0));
+
+        EXPECT_EQ(2, instants.getSize());
+    }
+}
+
+#endif
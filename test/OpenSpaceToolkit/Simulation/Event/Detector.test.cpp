@@ -0,0 +1,470 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Component.hpp>
+#include <OpenSpaceToolkit/Simulation/Component/Geometry.hpp>
+#include <OpenSpaceToolkit/Simulation/Event/Detector.hpp>
+#include <OpenSpaceToolkit/Simulation/Satellite.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Composite.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Polygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Pyramid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/Profile.hpp>
+#include <OpenSpaceToolkit/Astrodynamics/Trajectory.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+using ostk::mathematics::geometry::d3::object::Composite;
+using ostk::mathematics::geometry::d3::object::Point;
+using ostk::mathematics::geometry::d3::object::Polygon;
+using ostk::mathematics::geometry::d3::object::Pyramid;
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::Environment;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+using ostk::physics::time::Time;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::flight::Profile;
+using ostk::astrodynamics::Trajectory;
+using ostk::astrodynamics::trajectory::Orbit;
+
+using ObjectGeometry = ostk::physics::environment::object::Geometry;
+
+using ostk::simulation::Component;
+using ostk::simulation::component::Geometry;
+using ostk::simulation::event::Detector;
+using ostk::simulation::Simulator;
+
+class OpenSpaceToolkit_Simulation_Event_Detector : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        const Orbit orbit = Orbit::SunSynchronous(
+            epoch_,                                              // Epoch
+            Length::Kilometers(500.0),                           // Altitude
+            Time(14, 0, 0),                                      // LTAN
+            environment_.accessCelestialObjectWithName("Earth")  // Celestial object
+        );
+
+        const Composite fieldOfView = {Pyramid {
+            Polygon {
+                {{{-0.1, -1.0}, {+0.1, -1.0}, {+0.1, +1.0}, {-0.1, +1.0}}},
+                Point {0.0, 0.0, 1.0},
+                {1.0, 0.0, 0.0},
+                {0.0, 1.0, 0.0}
+            },
+            Point {0.0, 0.0, 0.0}
+        }};
+
+        // The nadir-pointing camera always sees the Earth, the inertially-pointing camera only over part of the orbit
+
+        this->simulatorSPtr_ = Simulator::Configure(
+            {environment_,
+             {{"1",
+               "LoftSat-1",
+               Profile::LocalOrbitalFramePointing(orbit, Orbit::FrameType::VVLH),
+               {{"2", "Camera", Component::Type::Sensor, {}, Quaternion::Unit(), {{"FOV", fieldOfView}}}}},
+              {"3",
+               "LoftSat-2",
+               Profile::InertialPointing(orbit, Quaternion::Unit()),
+               {{"4", "Camera", Component::Type::Sensor, {}, Quaternion::Unit(), {{"FOV", fieldOfView}}}}}}}
+        );
+
+        this->simulatorSPtr_->setInstant(epoch_);
+
+        this->nadirGeometrySPtr_ = this->simulatorSPtr_->accessSatelliteWithName("LoftSat-1")
+                                       .accessComponentWithName("Camera")
+                                       .getGeometries()
+                                       .accessFirst();
+        this->inertialGeometrySPtr_ = this->simulatorSPtr_->accessSatelliteWithName("LoftSat-2")
+                                          .accessComponentWithName("Camera")
+                                          .getGeometries()
+                                          .accessFirst();
+
+        const Shared<const Celestial> earthSPtr = environment_.accessCelestialObjectWithName("Earth");
+
+        this->nadirDetector_ = {this->nadirGeometrySPtr_, *earthSPtr, Detector::Predicate::Intersects};
+        this->inertialDetector_ = {this->inertialGeometrySPtr_, *earthSPtr, Detector::Predicate::Intersects};
+    }
+
+    const Environment environment_ = Environment::Default();
+
+    const Instant epoch_ = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
+    Shared<Simulator> simulatorSPtr_ = nullptr;
+    Shared<const Geometry> nadirGeometrySPtr_ = nullptr;
+    Shared<const Geometry> inertialGeometrySPtr_ = nullptr;
+
+    Detector nadirDetector_ = Detector::Undefined();
+    Detector inertialDetector_ = Detector::Undefined();
+};
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Detector, Constructor)
+{
+    {
+        const Shared<const Celestial> earthSPtr = environment_.accessCelestialObjectWithName("Earth");
+
+        EXPECT_NO_THROW(Detector(nadirGeometrySPtr_, *earthSPtr, Detector::Predicate::Intersects));
+        EXPECT_NO_THROW(Detector(nadirGeometrySPtr_, earthSPtr->accessGeometry(), Detector::Predicate::Contains));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Detector, StreamOperator)
+{
+    {
+        testing::internal::CaptureStdout();
+
+        EXPECT_NO_THROW(std::cout << nadirDetector_ << std::endl);
+
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Detector, IsDefined)
+{
+    {
+        EXPECT_TRUE(nadirDetector_.isDefined());
+    }
+
+    {
+        const Shared<const Celestial> earthSPtr = environment_.accessCelestialObjectWithName("Earth");
+
+        EXPECT_FALSE(Detector(nadirGeometrySPtr_, *earthSPtr, Detector::Predicate::Undefined).isDefined());
+        EXPECT_FALSE(Detector(nullptr, *earthSPtr, Detector::Predicate::Intersects).isDefined());
+        EXPECT_FALSE(Detector::Undefined().isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Detector, Accessors)
+{
+    {
+        const Shared<const Celestial> earthSPtr = environment_.accessCelestialObjectWithName("Earth");
+
+        EXPECT_EQ(*nadirGeometrySPtr_, nadirDetector_.accessGeometry());
+        EXPECT_EQ(earthSPtr->accessGeometry(), nadirDetector_.accessTarget());
+        EXPECT_EQ(Detector::Predicate::Intersects, nadirDetector_.getPredicate());
+    }
+
+    {
+        EXPECT_THROW(Detector::Undefined().accessGeometry(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Detector::Undefined().accessTarget(), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Detector, EvaluateAt)
+{
+    {
+        const Shared<const Celestial> earthSPtr = environment_.accessCelestialObjectWithName("Earth");
+
+        const Instant instant = epoch_ + Duration::Minutes(30.0);
+
+        EXPECT_TRUE(nadirDetector_.evaluateAt(instant));
+        EXPECT_EQ(inertialGeometrySPtr_->intersects(*earthSPtr, instant), inertialDetector_.evaluateAt(instant));
+
+        EXPECT_EQ(epoch_, simulatorSPtr_->getInstant());
+    }
+
+    {
+        EXPECT_THROW(Detector::Undefined().evaluateAt(epoch_), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Detector, ComputeCrossings)
+{
+    const Interval interval = Interval::Closed(epoch_, epoch_ + Duration::Hours(3.0));
+
+    {
+        EXPECT_TRUE(nadirDetector_.computeCrossings(interval, Duration::Minutes(5.0)).isEmpty());
+    }
+
+    {
+        const Duration tolerance = Duration::Milliseconds(10.0);
+
+        const Array<Detector::Crossing> crossings =
+            inertialDetector_.computeCrossings(interval, Duration::Minutes(1.0), tolerance);
+
+        EXPECT_LE(2, crossings.getSize());
+
+        for (Index index = 0; index < crossings.getSize(); ++index)
+        {
+            const Detector::Crossing& crossing = crossings[index];
+
+            const bool isEntry = (crossing.type == Detector::Crossing::Type::Entry);
+
+            EXPECT_TRUE(interval.contains(crossing.instant));
+
+            EXPECT_EQ(isEntry, inertialDetector_.evaluateAt(crossing.instant));
+            EXPECT_EQ(!isEntry, inertialDetector_.evaluateAt(crossing.instant - tolerance));
+
+            if (index > 0)
+            {
+                EXPECT_LT(crossings[index - 1].instant, crossing.instant);
+                EXPECT_NE(crossings[index - 1].type, crossing.type);
+            }
+        }
+
+        EXPECT_EQ(epoch_, simulatorSPtr_->getInstant());
+    }
+
+    {
+        EXPECT_THROW(
+            nadirDetector_.computeCrossings(Interval::Undefined(), Duration::Minutes(1.0)),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(nadirDetector_.computeCrossings(interval, Duration::Zero()), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(
+            nadirDetector_.computeCrossings(interval, Duration::Minutes(1.0), Duration::Zero()),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            Detector::Undefined().computeCrossings(interval, Duration::Minutes(1.0)),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Detector, ComputeWindows)
+{
+    const Interval interval = Interval::Closed(epoch_, epoch_ + Duration::Hours(3.0));
+
+    {
+        const Array<Interval> windows = nadirDetector_.computeWindows(interval, Duration::Minutes(5.0));
+
+        ASSERT_EQ(1, windows.getSize());
+        EXPECT_EQ(interval, windows.accessFirst());
+    }
+
+    {
+        const Array<Detector::Crossing> crossings =
+            inertialDetector_.computeCrossings(interval, Duration::Minutes(1.0));
+        const Array<Interval> windows = inertialDetector_.computeWindows(interval, Duration::Minutes(1.0));
+
+        ASSERT_FALSE(windows.isEmpty());
+
+        Size boundaryCount = 0;
+
+        for (const auto& window : windows)
+        {
+            EXPECT_TRUE(interval.contains(window.getStart()));
+            EXPECT_TRUE(interval.contains(window.getEnd()));
+            EXPECT_TRUE(inertialDetector_.evaluateAt(window.getStart()));
+
+            boundaryCount += (window.getStart() != interval.getStart()) ? 1 : 0;
+            boundaryCount += (window.getEnd() != interval.getEnd()) ? 1 : 0;
+        }
+
+        EXPECT_EQ(crossings.getSize(), boundaryCount);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Detector, ComputeCrossingsAdaptively)
+{
+    const Interval interval = Interval::Closed(epoch_, epoch_ + Duration::Hours(3.0));
+
+    const Duration minimumStep = Duration::Seconds(1.0);
+    const Duration maximumStep = Duration::Minutes(10.0);
+
+    {
+        EXPECT_TRUE(nadirDetector_.computeCrossingsAdaptively(interval, minimumStep, maximumStep).isEmpty());
+    }
+
+    {
+        const Duration tolerance = Duration::Milliseconds(10.0);
+
+        const Array<Detector::Crossing> referenceCrossings =
+            inertialDetector_.computeCrossings(interval, Duration::Seconds(10.0), tolerance);
+        const Array<Detector::Crossing> crossings =
+            inertialDetector_.computeCrossingsAdaptively(interval, minimumStep, maximumStep, tolerance);
+
+        ASSERT_EQ(referenceCrossings.getSize(), crossings.getSize());
+
+        for (Index index = 0; index < crossings.getSize(); ++index)
+        {
+            EXPECT_EQ(referenceCrossings[index].type, crossings[index].type);
+            EXPECT_GE(tolerance, (crossings[index].instant - referenceCrossings[index].instant).getAbsolute());
+        }
+
+        EXPECT_EQ(epoch_, simulatorSPtr_->getInstant());
+    }
+
+    {
+        EXPECT_THROW(
+            nadirDetector_.computeCrossingsAdaptively(interval, Duration::Zero(), maximumStep),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            nadirDetector_.computeCrossingsAdaptively(interval, maximumStep, minimumStep),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            Detector::Undefined().computeCrossingsAdaptively(interval, minimumStep, maximumStep),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Detector, ComputeWindowsAdaptively)
+{
+    const Interval interval = Interval::Closed(epoch_, epoch_ + Duration::Hours(3.0));
+
+    const Duration minimumStep = Duration::Seconds(1.0);
+    const Duration maximumStep = Duration::Minutes(10.0);
+
+    {
+        const Array<Interval> windows = nadirDetector_.computeWindowsAdaptively(interval, minimumStep, maximumStep);
+
+        ASSERT_EQ(1, windows.getSize());
+        EXPECT_EQ(interval, windows.accessFirst());
+    }
+
+    {
+        const Array<Interval> referenceWindows = inertialDetector_.computeWindows(interval, Duration::Seconds(10.0));
+        const Array<Interval> windows = inertialDetector_.computeWindowsAdaptively(interval, minimumStep, maximumStep);
+
+        EXPECT_EQ(referenceWindows.getSize(), windows.getSize());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Detector, ComputeSafeStepAt)
+{
+    {
+        const Duration safeStep = nadirDetector_.computeSafeStepAt(epoch_);
+
+        ASSERT_TRUE(safeStep.isDefined());
+        EXPECT_LT(Duration::Minutes(1.0), safeStep);
+    }
+
+    {
+        // No crossing may occur within a safe step
+
+        const Interval interval = Interval::Closed(epoch_, epoch_ + Duration::Hours(3.0));
+
+        for (const auto& crossing : inertialDetector_.computeCrossings(interval, Duration::Seconds(10.0)))
+        {
+            const Array<Instant> instants = {
+                crossing.instant - Duration::Minutes(20.0), crossing.instant - Duration::Minutes(5.0)
+            };
+
+            for (const auto& instant : instants)
+            {
+                const Duration safeStep = inertialDetector_.computeSafeStepAt(instant);
+
+                ASSERT_TRUE(safeStep.isDefined());
+                EXPECT_GE(crossing.instant - instant, safeStep);
+            }
+        }
+    }
+
+    {
+        // A point on the equator seen by an inertial observer, off the Earth rotation axis: it remains angularly
+        // inside the field of view, and crosses its base plane as its range oscillates over a day
+
+        const double equatorialRadius = 6378137.0;
+        const double depth = 3.0 * equatorialRadius;
+
+        const Composite fieldOfView = {Pyramid {
+            Polygon {
+                {{{-depth, -depth}, {+depth, -depth}, {+depth, +depth}, {-depth, +depth}}},
+                Point {depth, 0.0, 0.0},
+                {0.0, 1.0, 0.0},
+                {0.0, 0.0, 1.0}
+            },
+            Point {0.0, 0.0, 0.0}
+        }};
+
+        const Shared<Simulator> simulatorSPtr = Simulator::Configure(
+            {environment_,
+             {{"5",
+               "Observer",
+               Profile::InertialPointing(
+                   Trajectory::Position(Position::Meters({-depth, 0.0, 0.0}, Frame::GCRF())), Quaternion::Unit()
+               ),
+               {{"6", "Camera", Component::Type::Sensor, {}, Quaternion::Unit(), {{"FOV", fieldOfView}}}}}}}
+        );
+
+        simulatorSPtr->setInstant(epoch_);
+
+        const Detector detector = {
+            simulatorSPtr->accessSatelliteWithName("Observer")
+                .accessComponentWithName("Camera")
+                .getGeometries()
+                .accessFirst(),
+            ObjectGeometry {Composite {Point {equatorialRadius, 0.0, 0.0}}, Frame::ITRF()},
+            Detector::Predicate::Contains
+        };
+
+        const Interval interval = Interval::Closed(epoch_, epoch_ + Duration::Days(1.0));
+        const Duration tolerance = Duration::Milliseconds(10.0);
+
+        const Array<Detector::Crossing> referenceCrossings =
+            detector.computeCrossings(interval, Duration::Minutes(1.0), tolerance);
+
+        ASSERT_FALSE(referenceCrossings.isEmpty());
+
+        for (const auto& crossing : referenceCrossings)
+        {
+            const Array<Instant> instants = {
+                crossing.instant - Duration::Hours(2.0), crossing.instant - Duration::Minutes(10.0)
+            };
+
+            for (const auto& instant : instants)
+            {
+                const Duration safeStep = detector.computeSafeStepAt(instant);
+
+                ASSERT_TRUE(safeStep.isDefined());
+                EXPECT_LT(Duration::Zero(), safeStep);
+                EXPECT_GE(crossing.instant - instant, safeStep);
+            }
+        }
+
+        const Array<Detector::Crossing> crossings =
+            detector.computeCrossingsAdaptively(interval, Duration::Seconds(1.0), Duration::Hours(1.0), tolerance);
+
+        ASSERT_EQ(referenceCrossings.getSize(), crossings.getSize());
+
+        for (Index index = 0; index < crossings.getSize(); ++index)
+        {
+            EXPECT_EQ(referenceCrossings[index].type, crossings[index].type);
+            EXPECT_GE(tolerance, (crossings[index].instant - referenceCrossings[index].instant).getAbsolute());
+        }
+    }
+
+    {
+        EXPECT_THROW(nadirDetector_.computeSafeStepAt(Instant::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Detector::Undefined().computeSafeStepAt(epoch_), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Detector, Undefined)
+{
+    {
+        EXPECT_NO_THROW(Detector::Undefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Detector, StringFromPredicate)
+{
+    {
+        EXPECT_EQ("Undefined", Detector::StringFromPredicate(Detector::Predicate::Undefined));
+        EXPECT_EQ("Intersects", Detector::StringFromPredicate(Detector::Predicate::Intersects));
+        EXPECT_EQ("Contains", Detector::StringFromPredicate(Detector::Predicate::Contains));
+    }
+}
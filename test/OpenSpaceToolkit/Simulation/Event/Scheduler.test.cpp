@@ -0,0 +1,121 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Event/Scheduler.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Index;
+
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+
+using ostk::simulation::event::Scheduler;
+using ostk::simulation::Simulator;
+
+class OpenSpaceToolkit_Simulation_Event_Scheduler : public ::testing::Test
+{
+   protected:
+    const Instant instant_ = Instant::J2000();
+
+    const Scheduler::Callback callback_ = [](Simulator&) {};
+};
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Scheduler, Constructor)
+{
+    {
+        EXPECT_NO_THROW(Scheduler());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Scheduler, IsEmpty)
+{
+    {
+        Scheduler scheduler;
+
+        EXPECT_TRUE(scheduler.isEmpty());
+        EXPECT_EQ(0, scheduler.getEventCount());
+
+        scheduler.schedule(instant_, callback_);
+
+        EXPECT_FALSE(scheduler.isEmpty());
+        EXPECT_EQ(1, scheduler.getEventCount());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Scheduler, Schedule)
+{
+    {
+        Scheduler scheduler;
+
+        const Index firstEventId = scheduler.schedule(instant_ + Duration::Seconds(20.0), callback_);
+        const Index secondEventId = scheduler.schedule(instant_ + Duration::Seconds(10.0), callback_);
+        const Index thirdEventId = scheduler.schedule(instant_ + Duration::Seconds(20.0), callback_);
+
+        EXPECT_NE(firstEventId, secondEventId);
+        EXPECT_NE(firstEventId, thirdEventId);
+
+        EXPECT_EQ(instant_ + Duration::Seconds(10.0), scheduler.getNextInstant());
+
+        EXPECT_EQ(secondEventId, scheduler.pop().id);
+        EXPECT_EQ(firstEventId, scheduler.pop().id);
+        EXPECT_EQ(thirdEventId, scheduler.pop().id);
+
+        EXPECT_TRUE(scheduler.isEmpty());
+    }
+
+    {
+        Scheduler scheduler;
+
+        EXPECT_THROW(scheduler.schedule(Instant::Undefined(), callback_), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(scheduler.schedule(instant_, nullptr), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Scheduler, Cancel)
+{
+    {
+        Scheduler scheduler;
+
+        const Index firstEventId = scheduler.schedule(instant_, callback_);
+        const Index secondEventId = scheduler.schedule(instant_ + Duration::Seconds(10.0), callback_);
+
+        scheduler.cancel(firstEventId);
+
+        EXPECT_EQ(1, scheduler.getEventCount());
+        EXPECT_EQ(instant_ + Duration::Seconds(10.0), scheduler.getNextInstant());
+
+        EXPECT_THROW(scheduler.cancel(firstEventId), ostk::core::error::RuntimeError);
+
+        const Scheduler::Event event = scheduler.pop();
+
+        EXPECT_EQ(secondEventId, event.id);
+        EXPECT_EQ(instant_ + Duration::Seconds(10.0), event.instant);
+
+        EXPECT_TRUE(scheduler.isEmpty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Scheduler, Pop)
+{
+    {
+        Scheduler scheduler;
+
+        EXPECT_THROW(scheduler.pop(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(scheduler.getNextInstant(), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Event_Scheduler, Clear)
+{
+    {
+        Scheduler scheduler;
+
+        scheduler.schedule(instant_, callback_);
+        scheduler.schedule(instant_ + Duration::Seconds(10.0), callback_);
+
+        scheduler.clear();
+
+        EXPECT_TRUE(scheduler.isEmpty());
+    }
+}
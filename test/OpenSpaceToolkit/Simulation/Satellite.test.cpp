@@ -4,11 +4,16 @@
 #include <OpenSpaceToolkit/Simulation/Component/Geometry.hpp>
 #include <OpenSpaceToolkit/Simulation/Component/State.hpp>
 #include <OpenSpaceToolkit/Simulation/Satellite.hpp>
+#include <OpenSpaceToolkit/Simulation/Utility/ThreadPool.hpp>
 
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
 #include <OpenSpaceToolkit/Physics/Environment.hpp>
 #include <OpenSpaceToolkit/Physics/Environment/Object/Celestial/Earth.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
 #include <OpenSpaceToolkit/Physics/Time/Time.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Angle.hpp>
 #include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Flight/Profile.hpp>
@@ -19,11 +24,17 @@ using ostk::core::container::Array;
 using ostk::core::type::Shared;
 using ostk::core::type::String;
 
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
 using ostk::physics::Environment;
 using ostk::physics::environment::object::celestial::Earth;
+using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
 using ostk::physics::time::Scale;
 using ostk::physics::time::Time;
+using ostk::physics::unit::Angle;
 using ostk::physics::unit::Length;
 
 using ostk::astrodynamics::flight::Profile;
@@ -34,7 +45,9 @@ using ostk::simulation::component::Geometry;
 using ostk::simulation::component::GeometryConfiguration;
 using ostk::simulation::ComponentConfiguration;
 using ostk::simulation::Satellite;
+using ostk::simulation::satellite::Ephemeris;
 using ostk::simulation::SatelliteConfiguration;
+using ostk::simulation::utility::ThreadPool;
 
 class OpenSpaceToolkit_Simulation_Satellite : public ::testing::Test
 {
@@ -123,6 +136,94 @@ TEST_F(OpenSpaceToolkit_Simulation_Satellite, Configure)
     EXPECT_TRUE(satellite->isDefined());
 }
 
+TEST_F(OpenSpaceToolkit_Simulation_Satellite, ConfigureWithEphemeris)
+{
+    const Interval interval = Interval::Closed(Instant::J2000(), Instant::J2000() + Duration::Hours(1.0));
+
+    const SatelliteConfiguration satelliteConfiguration = {
+        "87da0b5f-9f65-4c5c-a660-bd254742960b",
+        "LoftSat-1",
+        profile_,
+        Array<ComponentConfiguration>::Empty(),
+        {"a", "b"},
+        Array<GeometryConfiguration>::Empty(),
+        {interval, Duration::Minutes(1.0)},
+    };
+
+    const Shared<Satellite> satellite = Satellite::Configure(satelliteConfiguration, nullptr);
+
+    ASSERT_NE(nullptr, satellite->accessEphemeris());
+    EXPECT_TRUE(satellite->accessEphemeris()->contains(interval.getStart()));
+
+    // States are interpolated within the ephemeris interval, and evaluated from the profile outside of it
+
+    const Array<Instant> instants = {
+        interval.getStart() + Duration::Seconds(90.0),
+        interval.getEnd() + Duration::Hours(1.0),
+    };
+
+    for (const auto& instant : instants)
+    {
+        const Vector3d position = satellite->getStateAt(instant).getPosition().getCoordinates();
+        const Vector3d referencePosition =
+            profile_.getStateAt(instant).inFrame(Frame::GCRF()).getPosition().getCoordinates();
+
+        EXPECT_GT(1e-1, (position - referencePosition).norm());
+    }
+
+    EXPECT_EQ(nullptr, satellite_.accessEphemeris());
+
+    // Sampled on a given thread pool
+
+    {
+        const Shared<ThreadPool> threadPoolSPtr = std::make_shared<ThreadPool>(2);
+
+        const Shared<Satellite> pooledSatellite = Satellite::Configure(satelliteConfiguration, nullptr, threadPoolSPtr);
+
+        ASSERT_NE(nullptr, pooledSatellite->accessEphemeris());
+        EXPECT_EQ(satellite->accessEphemeris()->getStep(), pooledSatellite->accessEphemeris()->getStep());
+        EXPECT_EQ(
+            satellite->getStateAt(instants[0]).getPosition().getCoordinates(),
+            pooledSatellite->getStateAt(instants[0]).getPosition().getCoordinates()
+        );
+    }
+
+    // Chebyshev segments
+
+    {
+        const SatelliteConfiguration chebyshevConfiguration = {
+            "87da0b5f-9f65-4c5c-a660-bd254742960b",
+            "LoftSat-1",
+            profile_,
+            Array<ComponentConfiguration>::Empty(),
+            {"a", "b"},
+            Array<GeometryConfiguration>::Empty(),
+            {
+                interval,
+                Duration::Minutes(30.0),
+                Length::Meters(1e-2),
+                Angle::Degrees(1e-3),
+                0,
+                Ephemeris::Type::Chebyshev,
+            },
+        };
+
+        const Shared<Satellite> chebyshevSatellite = Satellite::Configure(chebyshevConfiguration, nullptr);
+
+        ASSERT_NE(nullptr, chebyshevSatellite->accessEphemeris());
+        EXPECT_EQ(Ephemeris::Type::Chebyshev, chebyshevSatellite->accessEphemeris()->getType());
+
+        const Instant instant = interval.getStart() + Duration::Seconds(90.0);
+
+        EXPECT_GT(
+            1e-1,
+            (chebyshevSatellite->getStateAt(instant).getPosition().getCoordinates() -
+             profile_.getStateAt(instant).inFrame(Frame::GCRF()).getPosition().getCoordinates())
+                .norm()
+        );
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Simulation_Satellite, AccessProfile)
 {
     {
@@ -134,4 +235,93 @@ TEST_F(OpenSpaceToolkit_Simulation_Satellite, AccessProfile)
     }
 }
 
-// TEST_F (OpenSpaceToolkit_Simulation_Satellite, GenerateFrame)
+TEST_F(OpenSpaceToolkit_Simulation_Satellite, HasStateAt)
+{
+    // Profiles other than tabulated ones cover every instant
+
+    {
+        EXPECT_TRUE(satellite_.hasStateAt(Instant::J2000()));
+        EXPECT_TRUE(satellite_.hasStateAt(Instant::J2000() + Duration::Days(365.0)));
+    }
+
+    {
+        EXPECT_THROW(satellite_.hasStateAt(Instant::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Satellite::Undefined().hasStateAt(Instant::J2000()), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite, GetComponentHandle)
+{
+    {
+        Satellite satellite = satellite_;
+
+        const auto makeComponent = [](const String& aName) -> Shared<Component>
+        {
+            return std::make_shared<Component>(
+                aName,
+                aName,
+                Component::Type::Sensor,
+                Array<String>::Empty(),
+                Array<Shared<Geometry>>::Empty(),
+                Array<Shared<Component>>::Empty(),
+                nullptr,
+                Frame::GCRF(),
+                nullptr
+            );
+        };
+
+        satellite.addComponent(makeComponent("Camera"));
+
+        const Satellite::ComponentHandle handle = satellite.getComponentHandle("Camera");
+
+        EXPECT_TRUE(handle.isDefined());
+        EXPECT_EQ(&satellite.accessComponentWithName("Camera"), &satellite.accessComponent(handle));
+
+        // Handles remain valid across modifications
+
+        satellite.addComponent(makeComponent("Antenna"));
+
+        EXPECT_EQ(&satellite.accessComponentWithName("Camera"), &satellite.accessComponent(handle));
+
+        // Copies hold their own components
+
+        const Satellite satelliteCopy = satellite;
+
+        EXPECT_EQ(&satelliteCopy.accessComponentWithName("Camera"), &satelliteCopy.accessComponent(handle));
+        EXPECT_NE(&satellite.accessComponent(handle), &satelliteCopy.accessComponent(handle));
+    }
+
+    {
+        EXPECT_THROW(satellite_.getComponentHandle(""), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(satellite_.getComponentHandle("Camera"), ostk::core::error::RuntimeError);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite, GenerateFrame)
+{
+    {
+        const Shared<const Profile> profileSPtr = std::make_shared<const Profile>(profile_);
+
+        const Shared<const Frame> frameSPtr = Satellite::GenerateFrame("Satellite [GenerateFrame]", profileSPtr, 1);
+
+        const Instant instant = Instant::J2000();
+        const Instant otherInstant = instant + Duration::Minutes(10.0);
+
+        const auto position = [&frameSPtr](const Instant& anInstant)
+        {
+            return frameSPtr->getTransformTo(Frame::GCRF(), anInstant).applyToPosition(Vector3d::Zero());
+        };
+
+        const Vector3d reference =
+            profileSPtr->getStateAt(instant).inFrame(Frame::GCRF()).getPosition().getCoordinates();
+
+        // Memoized transforms match evaluated ones, also after being evicted by another instant
+
+        EXPECT_TRUE(position(instant).isApprox(reference, 1e-6));
+        EXPECT_TRUE(position(instant).isApprox(reference, 1e-6));
+        EXPECT_FALSE(position(otherInstant).isApprox(reference, 1e-6));
+        EXPECT_TRUE(position(instant).isApprox(reference, 1e-6));
+
+        EXPECT_FALSE(Frame::Exists("Satellite [GenerateFrame]"));
+    }
+}
@@ -0,0 +1,152 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Satellite/ChebyshevTable.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Object/Matrix.hpp>
+
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Size;
+
+using ostk::mathematics::object::MatrixXd;
+
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+
+using TrajectoryState = ostk::astrodynamics::trajectory::State;
+
+using ostk::simulation::satellite::ChebyshevTable;
+
+class OpenSpaceToolkit_Simulation_Satellite_ChebyshevTable : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        // Two segments of degree 2: x position 1 + 2 T1 + 3 T2 on the first, constant 2 on the second, identity
+        // attitude
+
+        coefficients_ = MatrixXd::Zero(ChebyshevTable::ComponentCount, 6);
+
+        coefficients_(0, 0) = 1.0;
+        coefficients_(0, 1) = 2.0;
+        coefficients_(0, 2) = 3.0;
+        coefficients_(0, 3) = 2.0;
+
+        coefficients_(6, 0) = 1.0;
+        coefficients_(6, 3) = 1.0;
+    }
+
+    MatrixXd coefficients_;
+    const Instant startInstant_ = Instant::J2000();
+    const Duration segmentDuration_ = Duration::Seconds(100.0);
+
+    ChebyshevTable chebyshevTable() const
+    {
+        return {startInstant_, segmentDuration_, 2, coefficients_};
+    }
+};
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_ChebyshevTable, Constructor)
+{
+    {
+        EXPECT_NO_THROW(chebyshevTable());
+    }
+
+    {
+        EXPECT_THROW(
+            ChebyshevTable(startInstant_, Duration::Undefined(), 2, coefficients_),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            ChebyshevTable(startInstant_, Duration::Zero(), 2, coefficients_), ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            ChebyshevTable(startInstant_, segmentDuration_, 3, coefficients_), ostk::core::error::RuntimeError
+        );
+        EXPECT_THROW(
+            ChebyshevTable(startInstant_, segmentDuration_, 2, MatrixXd::Zero(3, 6)), ostk::core::error::RuntimeError
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_ChebyshevTable, IsDefined)
+{
+    {
+        EXPECT_TRUE(chebyshevTable().isDefined());
+        EXPECT_FALSE(ChebyshevTable::Undefined().isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_ChebyshevTable, Getters)
+{
+    {
+        const ChebyshevTable table = chebyshevTable();
+
+        EXPECT_EQ(Size(2), table.getDegree());
+        EXPECT_EQ(Size(2), table.getSegmentCount());
+        EXPECT_EQ(segmentDuration_, table.getSegmentDuration());
+        EXPECT_EQ(startInstant_, table.getInterval().getStart());
+        EXPECT_EQ(startInstant_ + Duration::Seconds(200.0), table.getInterval().getEnd());
+        EXPECT_EQ(coefficients_, table.accessCoefficients());
+    }
+
+    {
+        EXPECT_EQ(Size(0), ChebyshevTable::Undefined().getSegmentCount());
+        EXPECT_THROW(ChebyshevTable::Undefined().getDegree(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(ChebyshevTable::Undefined().getSegmentDuration(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(ChebyshevTable::Undefined().getInterval(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(ChebyshevTable::Undefined().accessCoefficients(), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_ChebyshevTable, GetStateAt)
+{
+    const ChebyshevTable table = chebyshevTable();
+
+    // At x = 0.5: 1 + 2 x + 3 (2 x^2 - 1) = 0.5, and its derivative 2 + 12 x = 8 scales by 2 / 100 s
+
+    {
+        const TrajectoryState state = table.getStateAt(startInstant_ + Duration::Seconds(75.0));
+
+        EXPECT_NEAR(0.5, state.getPosition().getCoordinates().x(), 1e-12);
+        EXPECT_NEAR(0.16, state.getVelocity().getCoordinates().x(), 1e-12);
+        EXPECT_NEAR(1.0, state.getAttitude().s(), 1e-12);
+        EXPECT_TRUE(state.getAngularVelocity().isZero());
+    }
+
+    // Segment ends: x = -1 on the first segment, the last instant on the last segment
+
+    {
+        EXPECT_NEAR(2.0, table.getStateAt(startInstant_).getPosition().getCoordinates().x(), 1e-12);
+        EXPECT_NEAR(
+            2.0, table.getStateAt(startInstant_ + Duration::Seconds(150.0)).getPosition().getCoordinates().x(), 1e-12
+        );
+        EXPECT_NEAR(
+            2.0, table.getStateAt(startInstant_ + Duration::Seconds(200.0)).getPosition().getCoordinates().x(), 1e-12
+        );
+    }
+
+    {
+        EXPECT_THROW(table.getStateAt(Instant::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(table.getStateAt(startInstant_ - Duration::Seconds(1.0)), ostk::core::error::RuntimeError);
+        EXPECT_THROW(table.getStateAt(startInstant_ + Duration::Seconds(201.0)), ostk::core::error::RuntimeError);
+        EXPECT_THROW(ChebyshevTable::Undefined().getStateAt(startInstant_), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_ChebyshevTable, Print)
+{
+    {
+        testing::internal::CaptureStdout();
+
+        EXPECT_NO_THROW(chebyshevTable().print(std::cout, true));
+        EXPECT_NO_THROW(std::cout << chebyshevTable() << std::endl);
+        EXPECT_NO_THROW(std::cout << ChebyshevTable::Undefined() << std::endl);
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    }
+}
@@ -0,0 +1,419 @@
+/// Apache License 2.0
+
+#include <cmath>
+
+#include <OpenSpaceToolkit/Simulation/Satellite/ChebyshevTable.hpp>
+#include <OpenSpaceToolkit/Simulation/Satellite/Ephemeris.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator/StateTable.hpp>
+#include <OpenSpaceToolkit/Simulation/Utility/ThreadPool.hpp>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Environment.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Interval.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Time.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Angle.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/Profile.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Size;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::Environment;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Time;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::flight::Profile;
+using ostk::astrodynamics::trajectory::Orbit;
+
+using TrajectoryState = ostk::astrodynamics::trajectory::State;
+
+using ostk::simulation::satellite::ChebyshevTable;
+using ostk::simulation::satellite::Ephemeris;
+using ostk::simulation::simulator::StateTable;
+using ostk::simulation::utility::ThreadPool;
+
+class OpenSpaceToolkit_Simulation_Satellite_Ephemeris : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        const Environment environment = Environment::Default();
+        const Orbit orbit = Orbit::SunSynchronous(
+            Instant::J2000(),
+            Length::Kilometers(500.0),
+            Time::Noon(),
+            environment.accessCelestialObjectWithName("Earth")
+        );
+
+        profile_ = Profile::LocalOrbitalFramePointing(orbit, Orbit::FrameType::VVLH);
+    }
+
+    Profile profile_ = Profile::Undefined();
+    const Interval interval_ = Interval::Closed(Instant::J2000(), Instant::J2000() + Duration::Hours(1.0));
+
+    StateTable stateTableAt(const Array<Instant>& anInstantArray) const
+    {
+        Array<TrajectoryState> states = Array<TrajectoryState>::Empty();
+
+        for (const auto& instant : anInstantArray)
+        {
+            states.add(profile_.getStateAt(instant));
+        }
+
+        return StateTable::FromStates(states);
+    }
+};
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_Ephemeris, Constructor)
+{
+    {
+        EXPECT_NO_THROW(Ephemeris(stateTableAt(
+            {Instant::J2000(), Instant::J2000() + Duration::Seconds(10.0), Instant::J2000() + Duration::Seconds(20.0)}
+        )));
+        EXPECT_NO_THROW(Ephemeris(StateTable::Undefined()));
+        EXPECT_NO_THROW(Ephemeris(ChebyshevTable::Undefined()));
+    }
+
+    {
+        EXPECT_THROW(Ephemeris(stateTableAt({Instant::J2000()})), ostk::core::error::RuntimeError);
+        EXPECT_THROW(
+            Ephemeris(stateTableAt({
+                Instant::J2000(),
+                Instant::J2000() + Duration::Seconds(10.0),
+                Instant::J2000() + Duration::Seconds(30.0),
+            })),
+            ostk::core::error::RuntimeError
+        );
+        EXPECT_THROW(
+            Ephemeris(stateTableAt({Instant::J2000() + Duration::Seconds(10.0), Instant::J2000()})),
+            ostk::core::error::RuntimeError
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_Ephemeris, IsDefined)
+{
+    {
+        EXPECT_TRUE(Ephemeris::Generate(profile_, interval_, Duration::Minutes(1.0)).isDefined());
+        EXPECT_FALSE(Ephemeris::Undefined().isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_Ephemeris, GetType)
+{
+    {
+        EXPECT_EQ(
+            Ephemeris::Type::Tabulated, Ephemeris::Generate(profile_, interval_, Duration::Minutes(1.0)).getType()
+        );
+        EXPECT_EQ(Ephemeris::Type::Chebyshev, Ephemeris::Fit(profile_, interval_, Duration::Minutes(30.0)).getType());
+        EXPECT_EQ(Ephemeris::Type::Tabulated, Ephemeris::Undefined().getType());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_Ephemeris, Contains)
+{
+    {
+        const Ephemeris ephemeris = Ephemeris::Generate(profile_, interval_, Duration::Minutes(1.0));
+
+        EXPECT_TRUE(ephemeris.contains(interval_.getStart()));
+        EXPECT_TRUE(ephemeris.contains(interval_.getStart() + Duration::Minutes(30.0)));
+        EXPECT_TRUE(ephemeris.contains(interval_.getEnd()));
+        EXPECT_FALSE(ephemeris.contains(interval_.getEnd() + Duration::Seconds(1.0)));
+        EXPECT_FALSE(Ephemeris::Undefined().contains(interval_.getStart()));
+    }
+
+    {
+        EXPECT_THROW(Ephemeris::Undefined().contains(Instant::Undefined()), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_Ephemeris, GetInterval)
+{
+    {
+        const Ephemeris ephemeris = Ephemeris::Generate(profile_, interval_, Duration::Minutes(1.0));
+
+        EXPECT_EQ(interval_.getStart(), ephemeris.getInterval().getStart());
+        EXPECT_EQ(interval_.getEnd(), ephemeris.getInterval().getEnd());
+    }
+
+    {
+        EXPECT_THROW(Ephemeris::Undefined().getInterval(), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_Ephemeris, GetStep)
+{
+    // The step divides the interval evenly, and is refined as needed to meet tolerances
+
+    {
+        const Ephemeris ephemeris = Ephemeris::Generate(profile_, interval_, Duration::Seconds(70.0));
+
+        EXPECT_GE(Duration::Seconds(70.0), ephemeris.getStep());
+        EXPECT_EQ(
+            ephemeris.accessStateTable().getSize() - 1, Size(std::round(3600.0 / ephemeris.getStep().inSeconds()))
+        );
+    }
+
+    {
+        EXPECT_THROW(Ephemeris::Undefined().getStep(), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_Ephemeris, GetStateAt)
+{
+    {
+        const Ephemeris ephemeris = Ephemeris::Generate(
+            profile_, interval_, Duration::Minutes(1.0), Length::Meters(1e-2), Angle::Degrees(1e-3), 2
+        );
+
+        for (const auto& instant : interval_.generateGrid(Duration::Seconds(17.0)))
+        {
+            const TrajectoryState state = ephemeris.getStateAt(instant);
+            const TrajectoryState referenceState = profile_.getStateAt(instant).inFrame(Frame::GCRF());
+
+            EXPECT_EQ(instant, state.getInstant());
+            EXPECT_GT(
+                1e-1, (state.getPosition().getCoordinates() - referenceState.getPosition().getCoordinates()).norm()
+            );
+            EXPECT_GT(
+                1e-3, (state.getVelocity().getCoordinates() - referenceState.getVelocity().getCoordinates()).norm()
+            );
+            EXPECT_GT(
+                1e-6, 1.0 - std::abs(state.getAttitude().toNormalized().dotProduct(referenceState.getAttitude()))
+            );
+        }
+    }
+
+    {
+        const Ephemeris ephemeris = Ephemeris::Generate(profile_, interval_, Duration::Minutes(1.0));
+
+        EXPECT_THROW(ephemeris.getStateAt(Instant::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(
+            ephemeris.getStateAt(interval_.getEnd() + Duration::Seconds(1.0)), ostk::core::error::RuntimeError
+        );
+        EXPECT_THROW(Ephemeris::Undefined().getStateAt(interval_.getStart()), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_Ephemeris, Generate)
+{
+    {
+        EXPECT_THROW(
+            Ephemeris::Generate(Profile::Undefined(), interval_, Duration::Minutes(1.0)),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            Ephemeris::Generate(profile_, Interval::Undefined(), Duration::Minutes(1.0)),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            Ephemeris::Generate(profile_, interval_, Duration::Undefined()), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(Ephemeris::Generate(profile_, interval_, Duration::Zero()), ostk::core::error::runtime::Wrong);
+    }
+
+    // Sampling on a shared thread pool, reused across ephemerides
+
+    {
+        ThreadPool threadPool(2);
+
+        for (Size index = 0; index < 2; ++index)
+        {
+            const Ephemeris ephemeris = Ephemeris::Generate(
+                profile_,
+                interval_,
+                Duration::Minutes(1.0),
+                DEFAULT_EPHEMERIS_POSITION_TOLERANCE,
+                DEFAULT_EPHEMERIS_ATTITUDE_TOLERANCE,
+                threadPool
+            );
+            const Ephemeris referenceEphemeris = Ephemeris::Generate(profile_, interval_, Duration::Minutes(1.0));
+
+            EXPECT_EQ(referenceEphemeris.getStep(), ephemeris.getStep());
+            EXPECT_EQ(
+                referenceEphemeris.getStateAt(interval_.getEnd()).getPosition().getCoordinates(),
+                ephemeris.getStateAt(interval_.getEnd()).getPosition().getCoordinates()
+            );
+        }
+    }
+
+    // Tolerances that cannot be met
+
+    {
+        EXPECT_THROW(
+            Ephemeris::Generate(
+                profile_,
+                Interval::Closed(Instant::J2000(), Instant::J2000() + Duration::Minutes(1.0)),
+                Duration::Minutes(1.0),
+                Length::Meters(0.0)
+            ),
+            ostk::core::error::RuntimeError
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_Ephemeris, AccessChebyshevTable)
+{
+    {
+        const Ephemeris ephemeris = Ephemeris::Fit(profile_, interval_, Duration::Minutes(30.0));
+
+        EXPECT_TRUE(ephemeris.accessChebyshevTable().isDefined());
+        EXPECT_THROW(ephemeris.accessStateTable(), ostk::core::error::RuntimeError);
+    }
+
+    {
+        EXPECT_THROW(
+            Ephemeris::Generate(profile_, interval_, Duration::Minutes(1.0)).accessChebyshevTable(),
+            ostk::core::error::RuntimeError
+        );
+        EXPECT_THROW(Ephemeris::Undefined().accessChebyshevTable(), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_Ephemeris, Fit)
+{
+    {
+        const Ephemeris ephemeris = Ephemeris::Fit(
+            profile_, interval_, Duration::Minutes(25.0), 12, Length::Meters(1e-2), Angle::Degrees(1e-3), 2
+        );
+
+        EXPECT_TRUE(ephemeris.isDefined());
+        EXPECT_GE(Duration::Minutes(25.0), ephemeris.getStep());
+        EXPECT_EQ(interval_.getStart(), ephemeris.getInterval().getStart());
+        EXPECT_EQ(interval_.getEnd(), ephemeris.getInterval().getEnd());
+        EXPECT_TRUE(ephemeris.contains(interval_.getEnd()));
+        EXPECT_FALSE(ephemeris.contains(interval_.getEnd() + Duration::Seconds(1.0)));
+
+        for (const auto& instant : interval_.generateGrid(Duration::Seconds(17.0)))
+        {
+            const TrajectoryState state = ephemeris.getStateAt(instant);
+            const TrajectoryState referenceState = profile_.getStateAt(instant).inFrame(Frame::GCRF());
+
+            EXPECT_EQ(instant, state.getInstant());
+            EXPECT_GT(
+                1e-1, (state.getPosition().getCoordinates() - referenceState.getPosition().getCoordinates()).norm()
+            );
+            EXPECT_GT(
+                1e-3, (state.getVelocity().getCoordinates() - referenceState.getVelocity().getCoordinates()).norm()
+            );
+            EXPECT_GT(
+                1e-6, 1.0 - std::abs(state.getAttitude().toNormalized().dotProduct(referenceState.getAttitude()))
+            );
+        }
+    }
+
+    // Fewer values stored than a table meeting the same tolerances (13 values per state)
+
+    {
+        const Ephemeris chebyshevEphemeris = Ephemeris::Fit(profile_, interval_, Duration::Minutes(30.0));
+        const Ephemeris tabulatedEphemeris = Ephemeris::Generate(profile_, interval_, Duration::Minutes(1.0));
+
+        EXPECT_GT(
+            Size(13 * tabulatedEphemeris.accessStateTable().getSize()),
+            Size(5 * chebyshevEphemeris.accessChebyshevTable().accessCoefficients().size())
+        );
+    }
+
+    // At least 10 times fewer values than a table meeting the same tolerances, over a few orbits with hour-long
+    // segments: the table step is shortened to seconds to meet the position tolerance, while one segment spans
+    // most of an orbit
+
+    {
+        const Interval interval = Interval::Closed(Instant::J2000(), Instant::J2000() + Duration::Hours(6.0));
+
+        const Ephemeris chebyshevEphemeris = Ephemeris::Fit(profile_, interval, Duration::Hours(1.0));
+        const Ephemeris tabulatedEphemeris = Ephemeris::Generate(profile_, interval, Duration::Minutes(1.0));
+
+        EXPECT_GE(
+            Size(13 * tabulatedEphemeris.accessStateTable().getSize()),
+            Size(10 * chebyshevEphemeris.accessChebyshevTable().accessCoefficients().size())
+        );
+    }
+
+    {
+        EXPECT_THROW(
+            Ephemeris::Fit(Profile::Undefined(), interval_, Duration::Minutes(30.0)),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            Ephemeris::Fit(profile_, Interval::Undefined(), Duration::Minutes(30.0)),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(Ephemeris::Fit(profile_, interval_, Duration::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Ephemeris::Fit(profile_, interval_, Duration::Zero()), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(
+            Ephemeris::Fit(profile_, interval_, Duration::Minutes(30.0), 0), ostk::core::error::runtime::Wrong
+        );
+    }
+
+    // Fitting on a shared thread pool, reused across ephemerides
+
+    {
+        ThreadPool threadPool(2);
+
+        for (Size index = 0; index < 2; ++index)
+        {
+            const Ephemeris ephemeris = Ephemeris::Fit(
+                profile_,
+                interval_,
+                Duration::Minutes(30.0),
+                DEFAULT_EPHEMERIS_DEGREE,
+                DEFAULT_EPHEMERIS_POSITION_TOLERANCE,
+                DEFAULT_EPHEMERIS_ATTITUDE_TOLERANCE,
+                threadPool
+            );
+            const Ephemeris referenceEphemeris = Ephemeris::Fit(profile_, interval_, Duration::Minutes(30.0));
+
+            EXPECT_EQ(referenceEphemeris.getStep(), ephemeris.getStep());
+            EXPECT_EQ(
+                referenceEphemeris.accessChebyshevTable().accessCoefficients(),
+                ephemeris.accessChebyshevTable().accessCoefficients()
+            );
+        }
+    }
+
+    // Tolerances that cannot be met
+
+    {
+        EXPECT_THROW(
+            Ephemeris::Fit(profile_, interval_, Duration::Minutes(30.0), 12, Length::Meters(0.0)),
+            ostk::core::error::RuntimeError
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_Ephemeris, StringFromType)
+{
+    {
+        EXPECT_EQ("Tabulated", Ephemeris::StringFromType(Ephemeris::Type::Tabulated));
+        EXPECT_EQ("Chebyshev", Ephemeris::StringFromType(Ephemeris::Type::Chebyshev));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_Ephemeris, Print)
+{
+    {
+        const Ephemeris ephemeris = Ephemeris::Generate(profile_, interval_, Duration::Minutes(1.0));
+
+        testing::internal::CaptureStdout();
+
+        EXPECT_NO_THROW(ephemeris.print(std::cout, true));
+        EXPECT_NO_THROW(std::cout << ephemeris << std::endl);
+        EXPECT_NO_THROW(std::cout << Ephemeris::Fit(profile_, interval_, Duration::Minutes(30.0)) << std::endl);
+        EXPECT_NO_THROW(std::cout << Ephemeris::Undefined() << std::endl);
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    }
+}
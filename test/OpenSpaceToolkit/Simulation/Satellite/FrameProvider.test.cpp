@@ -0,0 +1,179 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Satellite/FrameProvider.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Type/Unique.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+#include <OpenSpaceToolkit/Physics/Environment.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Time.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/Profile.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Shared;
+using ostk::core::type::Unique;
+
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::Environment;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Time;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::flight::Profile;
+using ostk::astrodynamics::trajectory::Orbit;
+
+using TrajectoryState = ostk::astrodynamics::trajectory::State;
+
+using ostk::simulation::satellite::FrameProvider;
+
+class OpenSpaceToolkit_Simulation_Satellite_FrameProvider : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        const Environment environment = Environment::Default();
+        const Orbit orbit = Orbit::SunSynchronous(
+            Instant::J2000(),
+            Length::Kilometers(500.0),
+            Time::Noon(),
+            environment.accessCelestialObjectWithName("Earth")
+        );
+
+        profileSPtr_ =
+            std::make_shared<const Profile>(Profile::LocalOrbitalFramePointing(orbit, Orbit::FrameType::VVLH));
+    }
+
+    Shared<const Profile> profileSPtr_ = nullptr;
+
+    // A state away from the profile, to tell memoized transforms apart from evaluated ones
+
+    const TrajectoryState state_ = {
+        Instant::J2000(),
+        Position::Meters({7000e3, 0.0, 0.0}, Frame::GCRF()),
+        Velocity::MetersPerSecond({0.0, 7.5e3, 0.0}, Frame::GCRF()),
+        Quaternion::Unit(),
+        Vector3d::Zero(),
+        Frame::GCRF()
+    };
+};
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_FrameProvider, Constructor)
+{
+    {
+        EXPECT_NO_THROW(FrameProvider frameProvider(profileSPtr_));
+        EXPECT_NO_THROW(FrameProvider frameProvider(profileSPtr_, 1));
+    }
+
+    {
+        EXPECT_ANY_THROW(FrameProvider frameProvider(profileSPtr_, 0));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_FrameProvider, IsDefined)
+{
+    {
+        const FrameProvider frameProvider(profileSPtr_);
+
+        EXPECT_TRUE(frameProvider.isDefined());
+    }
+
+    // The profile is referred to weakly
+
+    {
+        const FrameProvider frameProvider(profileSPtr_);
+
+        profileSPtr_.reset();
+
+        EXPECT_FALSE(frameProvider.isDefined());
+        EXPECT_THROW(frameProvider.getTransformAt(Instant::J2000()), ostk::core::error::RuntimeError);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_FrameProvider, GetTransformAt)
+{
+    {
+        const FrameProvider frameProvider(profileSPtr_);
+
+        const Instant instant = Instant::J2000() + Duration::Minutes(1.0);
+
+        const Transform transform = frameProvider.getTransformAt(instant);
+
+        EXPECT_TRUE(transform.isDefined());
+        EXPECT_EQ(
+            FrameProvider::TransformFromState(profileSPtr_->getStateAt(instant).inFrame(Frame::GCRF())), transform
+        );
+        EXPECT_EQ(transform, frameProvider.getTransformAt(instant));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_FrameProvider, MemoizeState)
+{
+    {
+        const FrameProvider frameProvider(profileSPtr_);
+
+        EXPECT_NO_THROW(frameProvider.memoizeState(state_));
+
+        EXPECT_EQ(FrameProvider::TransformFromState(state_), frameProvider.getTransformAt(state_.getInstant()));
+    }
+
+    // Memoizing a state replaces the transform evaluated at its instant
+
+    {
+        const FrameProvider frameProvider(profileSPtr_);
+
+        const Transform evaluatedTransform = frameProvider.getTransformAt(state_.getInstant());
+
+        frameProvider.memoizeState(state_);
+
+        EXPECT_NE(evaluatedTransform, frameProvider.getTransformAt(state_.getInstant()));
+        EXPECT_EQ(FrameProvider::TransformFromState(state_), frameProvider.getTransformAt(state_.getInstant()));
+    }
+
+    // Clones share the memoized transforms
+
+    {
+        const FrameProvider frameProvider(profileSPtr_);
+        const Unique<FrameProvider> cloneUPtr(frameProvider.clone());
+
+        frameProvider.memoizeState(state_);
+
+        EXPECT_EQ(FrameProvider::TransformFromState(state_), cloneUPtr->getTransformAt(state_.getInstant()));
+    }
+
+    {
+        const FrameProvider frameProvider(profileSPtr_);
+
+        EXPECT_THROW(frameProvider.memoizeState(TrajectoryState::Undefined()), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_FrameProvider, TransformFromState)
+{
+    {
+        const Transform transform = FrameProvider::TransformFromState(state_);
+
+        EXPECT_TRUE(transform.isDefined());
+        EXPECT_EQ(state_.getInstant(), transform.getInstant());
+        EXPECT_NEAR(0.0, transform.applyToPosition(state_.getPosition().getCoordinates()).norm(), 1e-6);
+    }
+}
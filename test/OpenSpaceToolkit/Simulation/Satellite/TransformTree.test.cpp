@@ -0,0 +1,196 @@
+/// Apache License 2.0
+
+#include <algorithm>
+#include <cmath>
+
+#include <OpenSpaceToolkit/Simulation/Component.hpp>
+#include <OpenSpaceToolkit/Simulation/Satellite.hpp>
+#include <OpenSpaceToolkit/Simulation/Satellite/TransformTree.hpp>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+#include <OpenSpaceToolkit/Physics/Environment.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Time.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/Profile.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::Environment;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Time;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::flight::Profile;
+using ostk::astrodynamics::trajectory::Orbit;
+
+using ostk::simulation::Component;
+using ostk::simulation::Satellite;
+using ostk::simulation::satellite::TransformTree;
+
+class OpenSpaceToolkit_Simulation_Satellite_TransformTree : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        const Environment environment = Environment::Default();
+        const Orbit orbit = Orbit::SunSynchronous(
+            Instant::J2000(),
+            Length::Kilometers(500.0),
+            Time::Noon(),
+            environment.accessCelestialObjectWithName("Earth")
+        );
+
+        // A camera mounted a quarter turn about z, holding a lens mounted a quarter turn about x, and an antenna
+
+        const Quaternion quarterTurnZ = Quaternion::XYZS(0.0, 0.0, std::sin(M_PI / 4.0), std::cos(M_PI / 4.0));
+        const Quaternion quarterTurnX = Quaternion::XYZS(std::sin(M_PI / 4.0), 0.0, 0.0, std::cos(M_PI / 4.0));
+
+        satelliteSPtr_ = Satellite::Configure(
+            {"TransformTree-Satellite",
+             "TransformTree-Satellite",
+             Profile::LocalOrbitalFramePointing(orbit, Orbit::FrameType::VVLH),
+             {{"TransformTree-Camera",
+               "Camera",
+               Component::Type::Sensor,
+               {},
+               quarterTurnZ,
+               {},
+               {{"TransformTree-Lens", "Lens", Component::Type::Sensor, {}, quarterTurnX}}},
+              {"TransformTree-Antenna", "Antenna", Component::Type::Assembly}}},
+            nullptr
+        );
+    }
+
+    Shared<Satellite> satelliteSPtr_ = nullptr;
+
+    const Shared<const Frame>& frameOf(const String& aComponentName) const
+    {
+        return satelliteSPtr_->accessComponentWithName(aComponentName).accessFrame();
+    }
+
+    const Shared<const Frame>& lensFrame() const
+    {
+        return satelliteSPtr_->accessComponentWithName("Camera").accessComponentWithName("Lens").accessFrame();
+    }
+};
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_TransformTree, Constructor)
+{
+    {
+        EXPECT_NO_THROW(TransformTree transformTree(*satelliteSPtr_));
+    }
+
+    {
+        EXPECT_THROW(TransformTree transformTree(Satellite::Undefined()), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_TransformTree, Getters)
+{
+    const TransformTree transformTree(*satelliteSPtr_);
+
+    {
+        EXPECT_EQ(Size(4), transformTree.getSize());
+        EXPECT_EQ(Size(3), transformTree.getMountedFrameCount());
+
+        // Preorder: each frame comes after its parent
+
+        const Array<Shared<const Frame>> frames = transformTree.getFrames();
+
+        const auto indexOf = [&frames](const Shared<const Frame>& aFrameSPtr) -> Size
+        {
+            return std::find(frames.begin(), frames.end(), aFrameSPtr) - frames.begin();
+        };
+
+        EXPECT_EQ(Size(0), indexOf(satelliteSPtr_->accessFrame()));
+        EXPECT_LT(indexOf(frameOf("Camera")), indexOf(lensFrame()));
+        EXPECT_LT(indexOf(frameOf("Antenna")), frames.getSize());
+        EXPECT_LT(indexOf(lensFrame()), frames.getSize());
+    }
+
+    {
+        EXPECT_TRUE(transformTree.contains(satelliteSPtr_->accessFrame()));
+        EXPECT_TRUE(transformTree.contains(frameOf("Camera")));
+        EXPECT_TRUE(transformTree.contains(lensFrame()));
+        EXPECT_FALSE(transformTree.contains(Frame::GCRF()));
+        EXPECT_FALSE(transformTree.contains(nullptr));
+    }
+
+    {
+        const TransformTree copy(transformTree);
+
+        EXPECT_EQ(transformTree.getFrames(), copy.getFrames());
+        EXPECT_EQ(transformTree.getMountedFrameCount(), copy.getMountedFrameCount());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Satellite_TransformTree, GetTransformToGCRF)
+{
+    const TransformTree transformTree(*satelliteSPtr_);
+
+    // Composed transforms match those evaluated from the frame graph, at successive instants
+
+    {
+        const Array<Instant> instants = {
+            Instant::J2000(),
+            Instant::J2000() + Duration::Minutes(10.0),
+            Instant::J2000() + Duration::Minutes(10.0),
+            Instant::J2000() + Duration::Hours(1.0),
+        };
+
+        for (const auto& instant : instants)
+        {
+            for (const auto& frameSPtr : transformTree.getFrames())
+            {
+                const Transform transform = transformTree.getTransformToGCRF(frameSPtr, instant);
+                const Transform reference = frameSPtr->getTransformTo(Frame::GCRF(), instant);
+
+                EXPECT_EQ(instant, transform.getInstant());
+                EXPECT_TRUE(transform.applyToVector(Vector3d::UnitX())
+                                .isApprox(reference.applyToVector(Vector3d::UnitX()), 1e-12));
+                EXPECT_TRUE(transform.applyToVector(Vector3d::UnitZ())
+                                .isApprox(reference.applyToVector(Vector3d::UnitZ()), 1e-12));
+                EXPECT_NEAR(
+                    0.0,
+                    (transform.applyToPosition(Vector3d::UnitX()) - reference.applyToPosition(Vector3d::UnitX()))
+                        .norm(),
+                    1e-3
+                );
+            }
+        }
+    }
+
+    {
+        EXPECT_THROW(
+            transformTree.getTransformToGCRF(frameOf("Camera"), Instant::Undefined()),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            transformTree.getTransformToGCRF(nullptr, Instant::J2000()), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            transformTree.getTransformToGCRF(Frame::GCRF(), Instant::J2000()), ostk::core::error::RuntimeError
+        );
+    }
+}
@@ -1,10 +1,17 @@
 /// Apache License 2.0
 
+#include <chrono>
+#include <thread>
+#include <vector>
+
 #include <OpenSpaceToolkit/Simulation/Component.hpp>
 #include <OpenSpaceToolkit/Simulation/Component/Geometry.hpp>
 #include <OpenSpaceToolkit/Simulation/Component/State.hpp>
 #include <OpenSpaceToolkit/Simulation/Satellite.hpp>
+#include <OpenSpaceToolkit/Simulation/Satellite/FrameProvider.hpp>
 #include <OpenSpaceToolkit/Simulation/Simulator.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator/FrameRegistry.hpp>
+#include <OpenSpaceToolkit/Simulation/Utility/ThreadPool.hpp>
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Composite.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/LineString.hpp>
@@ -12,6 +19,7 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Polygon.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Pyramid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Object/Vector.hpp>
 
 #include <OpenSpaceToolkit/Astrodynamics/Flight/Profile.hpp>
 
@@ -19,7 +27,9 @@
 
 using ostk::core::container::Array;
 using ostk::core::container::Map;
+using ostk::core::type::Index;
 using ostk::core::type::Shared;
+using ostk::core::type::Size;
 using ostk::core::type::String;
 
 using ostk::mathematics::geometry::d3::object::Composite;
@@ -28,12 +38,16 @@ using ostk::mathematics::geometry::d3::object::Point;
 using ostk::mathematics::geometry::d3::object::Polygon;
 using ostk::mathematics::geometry::d3::object::Pyramid;
 using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::object::Vector3d;
 
 using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Transform;
 using ostk::physics::Environment;
+using ostk::physics::environment::object::Celestial;
 using ostk::physics::time::DateTime;
 using ostk::physics::time::Duration;
 using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
 using ostk::physics::time::Scale;
 using ostk::physics::time::Time;
 using ostk::physics::unit::Length;
@@ -41,13 +55,24 @@ using ostk::physics::unit::Length;
 using ostk::astrodynamics::flight::Profile;
 using ostk::astrodynamics::trajectory::Orbit;
 
+using TrajectoryState = ostk::astrodynamics::trajectory::State;
+using ObjectGeometry = ostk::physics::environment::object::Geometry;
+
 using ostk::simulation::Component;
 using ostk::simulation::component::Geometry;
 using ostk::simulation::component::State;
+using ostk::simulation::event::Detector;
 using ostk::simulation::Satellite;
 using ostk::simulation::SatelliteConfiguration;
+using ostk::simulation::satellite::FrameProvider;
 using ostk::simulation::Simulator;
 using ostk::simulation::SimulatorConfiguration;
+using ostk::simulation::simulator::Checkpoint;
+using ostk::simulation::simulator::FrameRegistry;
+using ostk::simulation::simulator::History;
+using ostk::simulation::simulator::Pacer;
+using ostk::simulation::simulator::StateTable;
+using ostk::simulation::utility::ThreadPool;
 
 class OpenSpaceToolkit_Simulation_Simulator : public ::testing::Test
 {
@@ -145,6 +170,90 @@ TEST_F(OpenSpaceToolkit_Simulation_Simulator, AccessSatelliteWithName)
     }
 }
 
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, AccessFrameRegistry)
+{
+    {
+        const Shared<FrameRegistry>& frameRegistrySPtr = simulatorSPtr_->accessFrameRegistry();
+
+        EXPECT_TRUE(frameRegistrySPtr->hasFrameWithName("Satellite [1]"));
+        EXPECT_TRUE(frameRegistrySPtr->hasFrameWithName("Component [2]"));
+        EXPECT_EQ(
+            simulatorSPtr_->accessSatelliteWithName(satelliteName_).accessFrame(),
+            frameRegistrySPtr->accessFrameWithName("Satellite [1]")
+        );
+        EXPECT_FALSE(Frame::Exists("Satellite [1]"));
+    }
+
+    // Simulators configured from the same satellite identifiers hold distinct frames
+
+    {
+        const SimulatorConfiguration simulatorConfiguration = {
+            environment_,
+            {{"1", satelliteName_, Profile::LocalOrbitalFramePointing(orbit_, Orbit::FrameType::VVLH)}}
+        };
+
+        Array<Shared<Simulator>> simulators = {nullptr, nullptr, nullptr, nullptr};
+        std::vector<std::thread> threads;
+
+        for (Index index = 0; index < simulators.getSize(); ++index)
+        {
+            threads.emplace_back(
+                [&simulators, &simulatorConfiguration, index]()
+                {
+                    simulators[index] = Simulator::Configure(simulatorConfiguration);
+                }
+            );
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (Index index = 0; index < simulators.getSize(); ++index)
+        {
+            const Shared<const Frame>& frameSPtr =
+                simulators[index]->accessSatelliteWithName(satelliteName_).accessFrame();
+
+            EXPECT_EQ(frameSPtr, simulators[index]->accessFrameRegistry()->accessFrameWithName("Satellite [1]"));
+            EXPECT_NE(frameSPtr, simulatorSPtr_->accessSatelliteWithName(satelliteName_).accessFrame());
+
+            for (Index otherIndex = 0; otherIndex < index; ++otherIndex)
+            {
+                EXPECT_NE(frameSPtr, simulators[otherIndex]->accessSatelliteWithName(satelliteName_).accessFrame());
+            }
+        }
+    }
+
+    {
+        EXPECT_THROW(Simulator::Undefined().accessFrameRegistry(), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, GetSatelliteHandle)
+{
+    {
+        const Simulator::SatelliteHandle handle = simulatorSPtr_->getSatelliteHandle(satelliteName_);
+
+        EXPECT_TRUE(handle.isDefined());
+        EXPECT_EQ(&simulatorSPtr_->accessSatelliteWithName(satelliteName_), &simulatorSPtr_->accessSatellite(handle));
+
+        // Handles remain valid across satellite changes, and on copies of the simulator
+
+        const Simulator simulatorCopy = *simulatorSPtr_;
+
+        simulatorSPtr_->removeSatelliteWithName(satelliteName_);
+
+        EXPECT_THROW(simulatorSPtr_->accessSatellite(handle), ostk::core::error::RuntimeError);
+        EXPECT_EQ(satelliteName_, simulatorCopy.accessSatellite(handle).getName());
+    }
+
+    {
+        EXPECT_THROW(simulatorSPtr_->getSatelliteHandle(""), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(simulatorSPtr_->getSatelliteHandle("NonExistentSatellite"), ostk::core::error::RuntimeError);
+    }
+}
+
 TEST_F(OpenSpaceToolkit_Simulation_Simulator, GetInstant)
 {
     {
@@ -182,111 +291,1445 @@ TEST_F(OpenSpaceToolkit_Simulation_Simulator, StepForward)
     }
 }
 
-TEST_F(OpenSpaceToolkit_Simulation_Simulator, Test_1)
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, StepBackward)
 {
     {
-        const Environment environment = Environment::Default();
+        const Instant instant = Instant::DateTime(DateTime(2020, 1, 1, 0, 1, 0), Scale::UTC);
 
-        const Orbit orbit = Orbit::SunSynchronous(
-            Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC),  // Epoch
-            Length::Kilometers(500.0),                                     // Altitude
-            Time(14, 0, 0),                                                // LTAN
-            environment.accessCelestialObjectWithName("Earth")             // Celestial object
-        );
+        simulatorSPtr_->setInstant(instant);
 
-        Shared<Simulator> simulatorSPtr = Simulator::Configure(
-            {environment,
-             {{"1",
-               "LoftSat-1",
-               Profile::LocalOrbitalFramePointing(orbit, Orbit::FrameType::VVLH),
-               {{"2",
-                 "Camera",
-                 Component::Type::Sensor,
-                 {"tag-a", "tag-b"},
-                 Quaternion::Unit(),
-                 {{"FOV",
-                   Composite {Pyramid {
-                       Polygon {
-                           {{{-0.1, -1.0}, {+0.1, -1.0}, {+0.1, +1.0}, {-0.1, +1.0}}},
-                           Point {0.0, 0.0, 1.0},
-                           {1.0, 0.0, 0.0},
-                           {0.0, 1.0, 0.0}
-                       },
-                       Point {0.0, 0.0, 0.0}
-                   }}}}}}}}}
+        const Duration duration = Duration::Seconds(60.0);
+
+        simulatorSPtr_->stepBackward(duration);
+
+        EXPECT_EQ(instant - duration, simulatorSPtr_->getInstant());
+    }
+
+    {
+        EXPECT_THROW(
+            Simulator::Undefined().stepBackward(Duration::Seconds(1.0)), ostk::core::error::runtime::Undefined
         );
+    }
+}
 
-        const Instant instant = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, StepForwardAdaptively)
+{
+    const Instant instant = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
 
-        simulatorSPtr->setInstant(instant);
+    const Duration minimumStep = Duration::Seconds(1.0);
+    const Duration maximumStep = Duration::Minutes(10.0);
 
-        const auto camera = simulatorSPtr->accessSatelliteWithName("LoftSat-1").accessComponentWithName("Camera");
+    {
+        simulatorSPtr_->setInstant(instant);
 
-        const auto cameraGeometry = camera.accessGeometryWithName("FOV");
-        const auto earthGeometry = environment.accessCelestialObjectWithName("Earth")->accessGeometry();
+        const Component& camera =
+            simulatorSPtr_->accessSatelliteWithName(satelliteName_).accessComponentWithName("Camera");
 
-        EXPECT_TRUE(cameraGeometry.intersects(earthGeometry));
+        const Array<Detector> detectors = {
+            {camera.getGeometries().accessFirst(),
+             *environment_.accessCelestialObjectWithName("Earth"),
+             Detector::Predicate::Intersects}
+        };
 
-        EXPECT_EQ(2, cameraGeometry.intersectionWith(earthGeometry).accessComposite().getObjectCount());
-        EXPECT_TRUE(cameraGeometry.intersectionWith(earthGeometry).accessComposite().accessObjectAt(0).is<LineString>()
+        const Duration step = simulatorSPtr_->stepForwardAdaptively(detectors, minimumStep, maximumStep);
+
+        EXPECT_LE(minimumStep, step);
+        EXPECT_GE(maximumStep, step);
+        EXPECT_EQ(instant + step, simulatorSPtr_->getInstant());
+
+        // The nadir-pointing camera stays far from the horizon: steps are much longer than the minimum step
+
+        EXPECT_LT(Duration::Minutes(1.0), step);
+    }
+
+    {
+        simulatorSPtr_->setInstant(instant);
+
+        EXPECT_EQ(maximumStep, simulatorSPtr_->stepForwardAdaptively({}, minimumStep, maximumStep));
+        EXPECT_EQ(instant + maximumStep, simulatorSPtr_->getInstant());
+    }
+
+    {
+        EXPECT_THROW(
+            simulatorSPtr_->stepForwardAdaptively({}, Duration::Zero(), maximumStep), ostk::core::error::runtime::Wrong
         );
-        EXPECT_TRUE(cameraGeometry.intersectionWith(earthGeometry).accessComposite().accessObjectAt(1).is<LineString>()
+        EXPECT_THROW(
+            simulatorSPtr_->stepForwardAdaptively({}, maximumStep, minimumStep), ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            Simulator::Undefined().stepForwardAdaptively({}, minimumStep, maximumStep),
+            ostk::core::error::runtime::Undefined
         );
     }
 }
 
-TEST_F(OpenSpaceToolkit_Simulation_Simulator, Undefined)
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, Evaluate)
 {
     {
-        EXPECT_FALSE(Simulator::Undefined().isDefined());
+        EXPECT_THROW(
+            Simulator::Undefined().evaluate({Instant::J2000()}), ostk::core::error::runtime::Undefined
+        );
+    }
+
+    {
+        EXPECT_THROW(simulatorSPtr_->evaluate(Array<Instant>::Empty()), ostk::core::error::runtime::Undefined);
+    }
+
+    {
+        const Instant startInstant = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
+        const Array<Instant> instants = {
+            startInstant, startInstant + Duration::Seconds(10.0), startInstant + Duration::Seconds(20.0)
+        };
+
+        simulatorSPtr_->setInstant(startInstant);
+
+        const Map<String, StateTable> stateTables = simulatorSPtr_->evaluate(instants);
+
+        EXPECT_EQ(1, stateTables.size());
+        EXPECT_EQ(startInstant, simulatorSPtr_->getInstant());
+
+        const StateTable& stateTable = stateTables.at(satelliteName_);
+
+        EXPECT_EQ(3, stateTable.getSize());
+        EXPECT_EQ(instants, stateTable.accessInstants());
+
+        EXPECT_EQ(3, stateTable.accessPositions().rows());
+        EXPECT_EQ(3, stateTable.accessPositions().cols());
+        EXPECT_EQ(4, stateTable.accessAttitudes().rows());
+
+        const Satellite& satellite = simulatorSPtr_->accessSatelliteWithName(satelliteName_);
+
+        for (Index index = 0; index < instants.getSize(); ++index)
+        {
+            const auto state = satellite.getStateAt(instants[index]);
+
+            EXPECT_TRUE(stateTable.accessPositions().col(index).isApprox(state.getPosition().getCoordinates(), 1e-12));
+            EXPECT_TRUE(stateTable.accessVelocities().col(index).isApprox(state.getVelocity().getCoordinates(), 1e-12));
+        }
+    }
+
+    // Time-sharded evaluation matches serial evaluation
+
+    {
+        const Instant startInstant = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
+        const Array<Instant> instants =
+            Interval::Closed(startInstant, startInstant + Duration::Hours(2.0)).generateGrid(Duration::Minutes(1.0));
+
+        const StateTable serialStateTable = simulatorSPtr_->evaluate(instants).at(satelliteName_);
+
+        simulatorSPtr_->setThreadCount(3);
+
+        const StateTable shardedStateTable = simulatorSPtr_->evaluate(instants).at(satelliteName_);
+
+        EXPECT_EQ(serialStateTable.accessInstants(), shardedStateTable.accessInstants());
+        EXPECT_EQ(serialStateTable.accessPositions(), shardedStateTable.accessPositions());
+        EXPECT_EQ(serialStateTable.accessVelocities(), shardedStateTable.accessVelocities());
+        EXPECT_EQ(serialStateTable.accessAttitudes(), shardedStateTable.accessAttitudes());
+
+        // Grids shorter than the shard count
+
+        EXPECT_EQ(1, simulatorSPtr_->evaluate({startInstant}).at(satelliteName_).getSize());
+
+        simulatorSPtr_->setThreadCount(0);
     }
 }
 
-TEST_F(OpenSpaceToolkit_Simulation_Simulator, RemoveSatelliteWithName)
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, ComputeCrossings)
 {
+    const Instant instant = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
+    const Component& camera = simulatorSPtr_->accessSatelliteWithName(satelliteName_).accessComponentWithName("Camera");
+
+    const Detector detector = {
+        camera.getGeometries().accessFirst(),
+        *environment_.accessCelestialObjectWithName("Earth"),
+        Detector::Predicate::Intersects
+    };
+
+    {
+        const Interval interval = Interval::Closed(instant, instant + Duration::Hours(6.0));
+        const Duration step = Duration::Minutes(1.0);
+
+        const Array<Detector::Crossing> referenceCrossings = detector.computeCrossings(interval, step);
+
+        for (const Size threadCount : {0, 1, 4})
+        {
+            simulatorSPtr_->setThreadCount(threadCount);
+
+            const Array<Detector::Crossing> crossings = simulatorSPtr_->computeCrossings(detector, interval, step);
+
+            ASSERT_EQ(referenceCrossings.getSize(), crossings.getSize());
+
+            for (Index index = 0; index < crossings.getSize(); ++index)
+            {
+                EXPECT_EQ(referenceCrossings[index].instant, crossings[index].instant);
+                EXPECT_EQ(referenceCrossings[index].type, crossings[index].type);
+            }
+        }
+    }
+
+    // Intervals off the sampling grid, and shorter than the shard count
+
+    {
+        simulatorSPtr_->setThreadCount(4);
+
+        const Interval interval = Interval::Closed(instant, instant + Duration::Seconds(3725.5));
+
+        const Array<Detector::Crossing> referenceCrossings =
+            detector.computeCrossings(interval, Duration::Minutes(7.0));
+        const Array<Detector::Crossing> crossings =
+            simulatorSPtr_->computeCrossings(detector, interval, Duration::Minutes(7.0));
+
+        ASSERT_EQ(referenceCrossings.getSize(), crossings.getSize());
+
+        for (Index index = 0; index < crossings.getSize(); ++index)
+        {
+            EXPECT_EQ(referenceCrossings[index].instant, crossings[index].instant);
+        }
+
+        EXPECT_EQ(
+            detector.computeCrossings(interval, Duration::Hours(2.0)).getSize(),
+            simulatorSPtr_->computeCrossings(detector, interval, Duration::Hours(2.0)).getSize()
+        );
+    }
+
     {
         EXPECT_THROW(
-            Simulator::Undefined().removeSatelliteWithName("TestSatellite"), ostk::core::error::runtime::Undefined
+            simulatorSPtr_->computeCrossings(detector, Interval::Undefined(), Duration::Minutes(1.0)),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            simulatorSPtr_->computeCrossings(
+                detector, Interval::Closed(instant, instant + Duration::Hours(1.0)), Duration::Zero()
+            ),
+            ostk::core::error::runtime::Wrong
+        );
+        EXPECT_THROW(
+            Simulator::Undefined().computeCrossings(
+                detector, Interval::Closed(instant, instant + Duration::Hours(1.0)), Duration::Minutes(1.0)
+            ),
+            ostk::core::error::runtime::Undefined
         );
     }
+}
 
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, GetThreadCount)
+{
     {
-        EXPECT_THROW(simulatorSPtr_->removeSatelliteWithName("NonExistentSatellite"), ostk::core::error::RuntimeError);
+        EXPECT_EQ(0, simulatorSPtr_->getThreadCount());
     }
 
     {
-        EXPECT_TRUE(simulatorSPtr_->hasSatelliteWithName(satelliteName_));
-        EXPECT_EQ(simulatorSPtr_->accessSatelliteMap().size(), 1);
+        EXPECT_THROW(Simulator::Undefined().getThreadCount(), ostk::core::error::runtime::Undefined);
+    }
+}
 
-        simulatorSPtr_->removeSatelliteWithName(satelliteName_);
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, SetThreadCount)
+{
+    {
+        simulatorSPtr_->setThreadCount(4);
 
-        EXPECT_FALSE(simulatorSPtr_->hasSatelliteWithName(satelliteName_));
-        EXPECT_EQ(simulatorSPtr_->accessSatelliteMap().size(), 0);
+        EXPECT_EQ(4, simulatorSPtr_->getThreadCount());
+
+        simulatorSPtr_->setThreadCount(0);
+
+        EXPECT_EQ(0, simulatorSPtr_->getThreadCount());
+    }
+
+    {
+        EXPECT_THROW(Simulator::Undefined().setThreadCount(2), ostk::core::error::runtime::Undefined);
     }
 }
 
-TEST_F(OpenSpaceToolkit_Simulation_Simulator, ClearSatellites)
+#if defined(__linux__)
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, SetProcessCount)
 {
+    const Instant instant = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
     {
-        EXPECT_THROW(Simulator::Undefined().clearSatellites(), ostk::core::error::runtime::Undefined);
+        EXPECT_EQ(0, simulatorSPtr_->getProcessCount());
+
+        simulatorSPtr_->setInstant(instant);
+        simulatorSPtr_->setProcessCount(2);
+
+        EXPECT_EQ(2, simulatorSPtr_->getProcessCount());
+
+        simulatorSPtr_->stepForward(Duration::Minutes(1.0));
+
+        // States are evaluated by the workers, in GCRF
+
+        const Instant stepInstant = instant + Duration::Minutes(1.0);
+
+        const TrajectoryState state = simulatorSPtr_->getSatelliteStateWithName(satelliteName_);
+        const TrajectoryState referenceState =
+            simulatorSPtr_->accessSatelliteWithName(satelliteName_).getStateAt(stepInstant).inFrame(Frame::GCRF());
+
+        EXPECT_EQ(stepInstant, state.getInstant());
+        EXPECT_TRUE(
+            state.getPosition().accessCoordinates().isApprox(referenceState.getPosition().accessCoordinates(), 1e-6)
+        );
+
+        simulatorSPtr_->setProcessCount(0);
+
+        EXPECT_EQ(0, simulatorSPtr_->getProcessCount());
+        EXPECT_NO_THROW(simulatorSPtr_->getSatelliteStateWithName(satelliteName_));
     }
 
     {
-        EXPECT_TRUE(simulatorSPtr_->hasSatelliteWithName(satelliteName_));
-        EXPECT_EQ(simulatorSPtr_->accessSatelliteMap().size(), 1);
+        // Update threads are stopped while the workers are forked, and started again
 
-        simulatorSPtr_->clearSatellites();
+        simulatorSPtr_->setThreadCount(2);
+        simulatorSPtr_->setInstant(instant);
+        simulatorSPtr_->setProcessCount(2);
 
-        EXPECT_FALSE(simulatorSPtr_->hasSatelliteWithName(satelliteName_));
-        EXPECT_EQ(simulatorSPtr_->accessSatelliteMap().size(), 0);
+        EXPECT_EQ(2, simulatorSPtr_->getThreadCount());
+        EXPECT_EQ(2, simulatorSPtr_->getProcessCount());
+
+        // Partitioned states are read in place, without any evaluation
+
+        const Size missCount = simulatorSPtr_->accessStateCache().getMissCount();
+
+        EXPECT_EQ(instant, simulatorSPtr_->getSatelliteStateWithName(satelliteName_).getInstant());
+        EXPECT_EQ(missCount, simulatorSPtr_->accessStateCache().getMissCount());
+
+        simulatorSPtr_->setProcessCount(0);
+        simulatorSPtr_->setThreadCount(0);
+    }
+
+    {
+        // Workers are not forked while another thread pool is running
+
+        const ThreadPool threadPool(2);
+
+        EXPECT_THROW(simulatorSPtr_->setProcessCount(2), ostk::core::error::RuntimeError);
+        EXPECT_EQ(0, simulatorSPtr_->getProcessCount());
+    }
+
+    {
+        EXPECT_THROW(Simulator::Undefined().setProcessCount(2), ostk::core::error::runtime::Undefined);
     }
 }
 
-TEST_F(OpenSpaceToolkit_Simulation_Simulator, Configure)
+#endif
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, History)
 {
+    const Instant instant = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+    const Duration step = Duration::Minutes(1.0);
+
+    const String cameraId = "2";
+
     {
-        const Array<SatelliteConfiguration> satelliteConfiguraitons = Array<SatelliteConfiguration>::Empty();
+        EXPECT_FALSE(simulatorSPtr_->accessHistory().isEnabled());
 
-        EXPECT_NO_THROW(Simulator::Configure(SimulatorConfiguration {environment_, satelliteConfiguraitons}));
+        simulatorSPtr_->setInstant(instant);
+        simulatorSPtr_->stepForward(step);
+
+        EXPECT_TRUE(simulatorSPtr_->accessHistory().isEmpty());
+    }
+
+    {
+        simulatorSPtr_->setHistoryMemoryBudget(1024 * 1024);
+
+        EXPECT_TRUE(simulatorSPtr_->accessHistory().isEnabled());
+        EXPECT_EQ(1024 * 1024, simulatorSPtr_->accessHistory().getMemoryBudget());
+
+        simulatorSPtr_->setInstant(instant);
+        simulatorSPtr_->setComponentStateWithId(cameraId, State(State::Status::Busy));
+
+        simulatorSPtr_->stepForward(step);
+        simulatorSPtr_->setComponentStateWithId(cameraId, State(State::Status::Idle));
+
+        simulatorSPtr_->stepForward(step);
+
+        EXPECT_EQ(Array<Instant>({instant, instant + step}), simulatorSPtr_->accessHistory().getInstants());
+
+        // Revisited instants are restored from the history, with the component states they were left with
+
+        simulatorSPtr_->stepBackward(step * 2.0);
+
+        EXPECT_EQ(instant, simulatorSPtr_->getInstant());
+        EXPECT_EQ(State(State::Status::Busy), simulatorSPtr_->getComponentStateWithId(cameraId));
+
+        const TrajectoryState state = simulatorSPtr_->getSatelliteStateWithName(satelliteName_);
+        const TrajectoryState referenceState =
+            simulatorSPtr_->accessSatelliteWithName(satelliteName_).getStateAt(instant).inFrame(Frame::GCRF());
+
+        EXPECT_EQ(instant, state.getInstant());
+        EXPECT_TRUE(
+            state.getPosition().accessCoordinates().isApprox(referenceState.getPosition().accessCoordinates(), 1e-6)
+        );
+
+        simulatorSPtr_->stepForward(step);
+
+        EXPECT_EQ(State(State::Status::Idle), simulatorSPtr_->getComponentStateWithId(cameraId));
+    }
+
+    // Forks share the history, and evolve it independently
+
+    {
+        const Shared<Simulator> forkSPtr = simulatorSPtr_->fork();
+
+        EXPECT_EQ(simulatorSPtr_->accessHistory().getSize(), forkSPtr->accessHistory().getSize());
+
+        forkSPtr->stepForward(step * 10.0);
+
+        EXPECT_EQ(simulatorSPtr_->accessHistory().getSize() + 1, forkSPtr->accessHistory().getSize());
+    }
+
+    // The budget bounds the history, evicting the oldest instants first
+
+    {
+        const Size entrySize = History::EstimateEntrySize(1, 1);
+
+        simulatorSPtr_->setHistoryMemoryBudget(2 * entrySize);
+
+        for (Index index = 0; index < 5; ++index)
+        {
+            simulatorSPtr_->stepForward(step);
+        }
+
+        EXPECT_EQ(2, simulatorSPtr_->accessHistory().getSize());
+        EXPECT_LE(simulatorSPtr_->accessHistory().getMemoryUsage(), 2 * entrySize);
+        EXPECT_EQ(simulatorSPtr_->getInstant() - step, simulatorSPtr_->accessHistory().getInstants().accessLast());
+    }
+
+    // Changing satellites clears the history, and a zero budget disables it
+
+    {
+        const Shared<Simulator> forkSPtr = simulatorSPtr_->fork();
+
+        forkSPtr->removeSatelliteWithName(satelliteName_);
+
+        EXPECT_TRUE(forkSPtr->accessHistory().isEmpty());
+        EXPECT_FALSE(simulatorSPtr_->accessHistory().isEmpty());
+    }
+
+    {
+        simulatorSPtr_->setHistoryMemoryBudget(0);
+
+        EXPECT_FALSE(simulatorSPtr_->accessHistory().isEnabled());
+        EXPECT_TRUE(simulatorSPtr_->accessHistory().isEmpty());
+    }
+
+    {
+        EXPECT_THROW(Simulator::Undefined().accessHistory(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Simulator::Undefined().setHistoryMemoryBudget(1024), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, Observers)
+{
+    const Instant instant = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
+    {
+        Array<String> calls = Array<String>::Empty();
+
+        const Index preStepObserverId = simulatorSPtr_->addPreStepObserver(
+            [&calls](const Simulator& aSimulator, const Instant& anInstant)
+            {
+                EXPECT_NE(anInstant, aSimulator.getInstant());
+                calls.add("Pre");
+            }
+        );
+
+        const Index satelliteObserverId = simulatorSPtr_->addSatelliteObserver(
+            [&calls, this](const Simulator& aSimulator, const Satellite& aSatellite, const TrajectoryState& aState)
+            {
+                EXPECT_EQ(satelliteName_, aSatellite.getName());
+                EXPECT_TRUE(aState.isDefined());
+                EXPECT_EQ(aSimulator.getInstant(), aState.getInstant());
+                calls.add("Satellite");
+            }
+        );
+
+        const Index postStepObserverId = simulatorSPtr_->addPostStepObserver(
+            [&calls](const Simulator& aSimulator, const Instant& anInstant)
+            {
+                EXPECT_EQ(anInstant, aSimulator.getInstant());
+                calls.add("Post");
+            }
+        );
+
+        EXPECT_NE(preStepObserverId, satelliteObserverId);
+        EXPECT_NE(satelliteObserverId, postStepObserverId);
+
+        simulatorSPtr_->setInstant(instant + Duration::Minutes(1.0));
+
+        EXPECT_EQ(Array<String>({"Pre", "Satellite", "Post"}), calls);
+
+        calls.clear();
+
+        simulatorSPtr_->setThreadCount(2);
+        simulatorSPtr_->stepForward(Duration::Minutes(1.0));
+        simulatorSPtr_->setThreadCount(0);
+
+        EXPECT_EQ(Array<String>({"Pre", "Satellite", "Post"}), calls);
+
+        calls.clear();
+
+        simulatorSPtr_->removeObserver(satelliteObserverId);
+
+        simulatorSPtr_->stepForward(Duration::Minutes(1.0));
+
+        EXPECT_EQ(Array<String>({"Pre", "Post"}), calls);
+
+        simulatorSPtr_->removeObserver(preStepObserverId);
+        simulatorSPtr_->removeObserver(postStepObserverId);
+
+        EXPECT_THROW(simulatorSPtr_->removeObserver(postStepObserverId), ostk::core::error::RuntimeError);
+    }
+
+    {
+        struct Counter
+        {
+            Size count = 0;
+
+            void onStep(const Simulator&, const Instant&)
+            {
+                count += 1;
+            }
+        };
+
+        Counter counter;
+
+        const Index observerId = simulatorSPtr_->addPostStepObserver(
+            Simulator::StepObserver::FromMethod<Counter, &Counter::onStep>(&counter)
+        );
+
+        simulatorSPtr_->run(instant + Duration::Minutes(5.0));
+
+        EXPECT_EQ(1, counter.count);
+
+        simulatorSPtr_->removeObserver(observerId);
+    }
+
+    {
+        Index observerId = 0;
+
+        observerId = simulatorSPtr_->addPreStepObserver(
+            [this, &observerId](const Simulator&, const Instant&)
+            {
+                simulatorSPtr_->removeObserver(observerId);
+            }
+        );
+
+        EXPECT_THROW(simulatorSPtr_->setInstant(instant), ostk::core::error::RuntimeError);
+
+        EXPECT_NO_THROW(simulatorSPtr_->removeObserver(observerId));
+    }
+
+    // Satellite observers get states through the state cache, shared with later queries at the same instant
+
+    {
+        const Index satelliteObserverId = simulatorSPtr_->addSatelliteObserver(
+            [](const Simulator&, const Satellite&, const TrajectoryState& aState)
+            {
+                EXPECT_TRUE(aState.isDefined());
+            }
+        );
+
+        simulatorSPtr_->setInstant(instant + Duration::Minutes(10.0));
+
+        EXPECT_FALSE(simulatorSPtr_->accessStateCache().isSatelliteDirty(satelliteName_));
+
+        const Size missCount = simulatorSPtr_->accessStateCache().getMissCount();
+
+        simulatorSPtr_->getSatelliteStateWithName(satelliteName_);
+
+        EXPECT_EQ(missCount, simulatorSPtr_->accessStateCache().getMissCount());
+
+        simulatorSPtr_->removeObserver(satelliteObserverId);
+    }
+
+    {
+        EXPECT_THROW(
+            simulatorSPtr_->addPreStepObserver(Simulator::StepObserver()), ostk::core::error::runtime::Undefined
+        );
+    }
+
+    {
+        const auto stepObserver = [](const Simulator&, const Instant&) {};
+        const auto satelliteObserver = [](const Simulator&, const Satellite&, const TrajectoryState&) {};
+
+        EXPECT_THROW(Simulator::Undefined().addPreStepObserver(stepObserver), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Simulator::Undefined().addPostStepObserver(stepObserver), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(
+            Simulator::Undefined().addSatelliteObserver(satelliteObserver), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(Simulator::Undefined().removeObserver(0), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, GetSatelliteStateWithName)
+{
+    {
+        EXPECT_THROW(simulatorSPtr_->getSatelliteStateWithName(""), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(
+            simulatorSPtr_->getSatelliteStateWithName("NonExistentSatellite"), ostk::core::error::RuntimeError
+        );
+    }
+
+    {
+        const Instant instant = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+        const Duration duration = Duration::Minutes(5.0);
+
+        const Satellite& satellite = simulatorSPtr_->accessSatelliteWithName(satelliteName_);
+
+        simulatorSPtr_->setInstant(instant);
+
+        const auto lazyState = simulatorSPtr_->getSatelliteStateWithName(satelliteName_);
+
+        EXPECT_EQ(instant, lazyState.getInstant());
+        EXPECT_EQ(satellite.getStateAt(instant), lazyState);
+
+        simulatorSPtr_->setThreadCount(4);
+
+        EXPECT_EQ(lazyState, simulatorSPtr_->getSatelliteStateWithName(satelliteName_));
+
+        simulatorSPtr_->stepForward(duration);
+
+        const auto updatedState = simulatorSPtr_->getSatelliteStateWithName(satelliteName_);
+
+        EXPECT_EQ(instant + duration, updatedState.getInstant());
+        EXPECT_EQ(satellite.getStateAt(instant + duration), updatedState);
+
+        simulatorSPtr_->setThreadCount(0);
+    }
+
+    // Satellite frames are seeded with the states evaluated by the simulator
+
+    {
+        const Instant instant = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+        const Duration duration = Duration::Minutes(5.0);
+
+        const Satellite& satellite = simulatorSPtr_->accessSatelliteWithName(satelliteName_);
+
+        const Shared<const FrameProvider> frameProviderSPtr =
+            std::dynamic_pointer_cast<const FrameProvider>(satellite.accessFrame()->accessProvider());
+
+        ASSERT_NE(nullptr, frameProviderSPtr);
+
+        // A stale transform at the next instant, to be replaced by the update phase
+
+        const TrajectoryState staleState = satellite.getStateAt(instant);
+
+        frameProviderSPtr->memoizeState({
+            instant + duration,
+            staleState.getPosition(),
+            staleState.getVelocity(),
+            staleState.getAttitude(),
+            staleState.getAngularVelocity(),
+            Frame::GCRF()
+        });
+
+        simulatorSPtr_->setInstant(instant);
+        simulatorSPtr_->setThreadCount(2);
+        simulatorSPtr_->stepForward(duration);
+
+        EXPECT_EQ(
+            FrameProvider::TransformFromState(simulatorSPtr_->getSatelliteStateWithName(satelliteName_)),
+            frameProviderSPtr->getTransformAt(instant + duration)
+        );
+
+        simulatorSPtr_->setThreadCount(0);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, StateCache)
+{
+    const Instant instant = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
+    const Component& camera =
+        simulatorSPtr_->accessSatelliteWithName(satelliteName_).accessComponentWithName("Camera");
+    const auto& cameraGeometry = camera.accessGeometryWithName("FOV");
+    const auto earthGeometry = environment_.accessCelestialObjectWithName("Earth")->accessGeometry();
+
+    {
+        simulatorSPtr_->setInstant(instant);
+
+        // Satellites are only evaluated once a query touches them, then reused at the same instant
+
+        EXPECT_TRUE(simulatorSPtr_->accessStateCache().isSatelliteDirty(satelliteName_));
+
+        const TrajectoryState state = simulatorSPtr_->getSatelliteStateWithName(satelliteName_);
+
+        EXPECT_FALSE(simulatorSPtr_->accessStateCache().isSatelliteDirty(satelliteName_));
+        EXPECT_EQ(state, simulatorSPtr_->getSatelliteStateWithName(satelliteName_));
+
+        EXPECT_TRUE(simulatorSPtr_->accessStateCache().isGeometryDirty(cameraGeometry));
+
+        const bool intersects = cameraGeometry.intersects(earthGeometry);
+
+        EXPECT_FALSE(simulatorSPtr_->accessStateCache().isGeometryDirty(cameraGeometry));
+        EXPECT_EQ(intersects, cameraGeometry.intersects(earthGeometry, instant));
+
+        // Geometries are resolved through the transform tree, and match those resolved through the frame graph
+
+        {
+            const ObjectGeometry expectedGeometry = cameraGeometry.getGeometryIn(Frame::GCRF(), instant);
+            const ObjectGeometry geometry = simulatorSPtr_->getGeometryInGCRF(cameraGeometry);
+
+            EXPECT_EQ(*Frame::GCRF(), *geometry.accessFrame());
+
+            const Pyramid& expectedPyramid = expectedGeometry.accessComposite().accessObjectAt(0).as<Pyramid>();
+            const Pyramid& pyramid = geometry.accessComposite().accessObjectAt(0).as<Pyramid>();
+
+            EXPECT_NEAR(0.0, (pyramid.accessApex().asVector() - expectedPyramid.accessApex().asVector()).norm(), 1e-3);
+
+            const Array<Point> expectedVertices = expectedPyramid.accessBase().getVertices();
+            const Array<Point> vertices = pyramid.accessBase().getVertices();
+
+            ASSERT_EQ(expectedVertices.getSize(), vertices.getSize());
+
+            for (Index index = 0; index < vertices.getSize(); ++index)
+            {
+                EXPECT_NEAR(0.0, (vertices[index].asVector() - expectedVertices[index].asVector()).norm(), 1e-3);
+            }
+        }
+
+        // Changing the instant marks everything dirty
+
+        simulatorSPtr_->stepForward(Duration::Minutes(1.0));
+
+        EXPECT_TRUE(simulatorSPtr_->accessStateCache().isSatelliteDirty(satelliteName_));
+        EXPECT_TRUE(simulatorSPtr_->accessStateCache().isGeometryDirty(cameraGeometry));
+
+        // Repeated sensor queries against a celestial target are cache hits after the first one
+
+        const Celestial& earth = *simulatorSPtr_->accessEnvironment().accessCelestialObjectWithName("Earth");
+
+        const Size hitCount = simulatorSPtr_->accessStateCache().getHitCount();
+        const Size missCount = simulatorSPtr_->accessStateCache().getMissCount();
+
+        for (Index index = 0; index < 5; ++index)
+        {
+            cameraGeometry.intersects(earth);
+        }
+
+        // Misses: the camera geometry, the camera frame transform it is resolved with, and the Earth geometry
+
+        EXPECT_EQ(missCount + 3, simulatorSPtr_->accessStateCache().getMissCount());
+        EXPECT_EQ(hitCount + 8, simulatorSPtr_->accessStateCache().getHitCount());
+
+        // Celestial objects outside of the simulator environment are not cached
+
+        const Shared<const Celestial> otherEarthSPtr = Environment::Default().accessCelestialObjectWithName("Earth");
+
+        const Size otherMissCount = simulatorSPtr_->accessStateCache().getMissCount();
+
+        EXPECT_EQ(
+            otherEarthSPtr->accessGeometry().in(Frame::GCRF(), simulatorSPtr_->getInstant()),
+            simulatorSPtr_->getCelestialGeometryInGCRF(*otherEarthSPtr)
+        );
+        EXPECT_EQ(otherMissCount, simulatorSPtr_->accessStateCache().getMissCount());
+
+        const Transform transform = simulatorSPtr_->getTransformToGCRF(camera.accessFrame());
+
+        EXPECT_FALSE(simulatorSPtr_->accessStateCache().isTransformDirty(camera.accessFrame()));
+
+        const Transform expectedTransform =
+            camera.accessFrame()->getTransformTo(Frame::GCRF(), instant + Duration::Minutes(1.0));
+
+        EXPECT_NEAR(
+            0.0,
+            (transform.applyToPosition(Vector3d::Zero()) - expectedTransform.applyToPosition(Vector3d::Zero())).norm(),
+            1e-3
+        );
+
+        for (Index index = 0; index < 3; ++index)
+        {
+            const Vector3d axis = Vector3d::Unit(index);
+
+            EXPECT_NEAR(0.0, (transform.applyToVector(axis) - expectedTransform.applyToVector(axis)).norm(), 1e-9);
+        }
+
+        EXPECT_EQ(
+            instant + Duration::Minutes(1.0), simulatorSPtr_->getSatelliteStateWithName(satelliteName_).getInstant()
+        );
+    }
+
+    {
+        EXPECT_THROW(
+            Simulator::Undefined().getGeometryInGCRF(cameraGeometry), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            Simulator::Undefined().getTransformToGCRF(camera.accessFrame()), ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, ComponentState)
+{
+    {
+        const Component& camera =
+            simulatorSPtr_->accessSatelliteWithName(satelliteName_).accessComponentWithName("Camera");
+
+        EXPECT_EQ(State(), simulatorSPtr_->getComponentStateWithId(camera.getId()));
+        EXPECT_EQ(State(), camera.getState());
+
+        simulatorSPtr_->setComponentStateWithId(camera.getId(), State(State::Status::Busy));
+
+        EXPECT_EQ(State(State::Status::Busy), simulatorSPtr_->getComponentStateWithId(camera.getId()));
+        EXPECT_EQ(State(State::Status::Busy), camera.getState());
+    }
+
+    {
+        EXPECT_THROW(simulatorSPtr_->getComponentStateWithId(""), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(
+            simulatorSPtr_->setComponentStateWithId("2", State::Undefined()), ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, ScheduleEvent)
+{
+    {
+        const Instant instant = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
+        simulatorSPtr_->setInstant(instant);
+
+        Array<Instant> firedInstants = Array<Instant>::Empty();
+
+        const auto callback = [&firedInstants](Simulator& aSimulator)
+        {
+            firedInstants.add(aSimulator.getInstant());
+        };
+
+        simulatorSPtr_->scheduleEvent(instant + Duration::Hours(2.0), callback);
+        simulatorSPtr_->scheduleEvent(instant + Duration::Hours(1.0), callback);
+
+        const Index cancelledEventId = simulatorSPtr_->scheduleEvent(instant + Duration::Hours(1.5), callback);
+
+        EXPECT_EQ(3, simulatorSPtr_->accessScheduler().getEventCount());
+
+        simulatorSPtr_->cancelEvent(cancelledEventId);
+
+        EXPECT_EQ(2, simulatorSPtr_->accessScheduler().getEventCount());
+
+        EXPECT_THROW(
+            simulatorSPtr_->scheduleEvent(instant - Duration::Seconds(1.0), callback), ostk::core::error::RuntimeError
+        );
+
+        simulatorSPtr_->run(instant + Duration::Days(1.0));
+
+        EXPECT_EQ(Array<Instant>({instant + Duration::Hours(1.0), instant + Duration::Hours(2.0)}), firedInstants);
+        EXPECT_EQ(instant + Duration::Days(1.0), simulatorSPtr_->getInstant());
+        EXPECT_TRUE(simulatorSPtr_->accessScheduler().isEmpty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, Run)
+{
+    {
+        const Instant instant = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
+        simulatorSPtr_->setInstant(instant);
+
+        Array<Instant> firedInstants = Array<Instant>::Empty();
+
+        // Each event schedules the next one, an hour later
+
+        std::function<void(Simulator&)> callback;
+
+        callback = [&firedInstants, &callback](Simulator& aSimulator)
+        {
+            firedInstants.add(aSimulator.getInstant());
+
+            aSimulator.scheduleEvent(aSimulator.getInstant() + Duration::Hours(1.0), callback);
+        };
+
+        simulatorSPtr_->scheduleEvent(instant, callback);
+
+        simulatorSPtr_->run(instant + Duration::Hours(3.5));
+
+        EXPECT_EQ(4, firedInstants.getSize());
+        EXPECT_EQ(instant + Duration::Hours(3.0), firedInstants.accessLast());
+        EXPECT_EQ(instant + Duration::Hours(3.5), simulatorSPtr_->getInstant());
+        EXPECT_EQ(instant + Duration::Hours(4.0), simulatorSPtr_->accessScheduler().getNextInstant());
+    }
+
+    {
+        EXPECT_THROW(
+            simulatorSPtr_->run(simulatorSPtr_->getInstant() - Duration::Seconds(1.0)), ostk::core::error::RuntimeError
+        );
+        EXPECT_THROW(Simulator::Undefined().run(Instant::J2000()), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, RunPaced)
+{
+    const Instant instant = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
+    {
+        simulatorSPtr_->setInstant(instant);
+
+        Array<Pacer::Frame> frames = Array<Pacer::Frame>::Empty();
+
+        const Pacer::Report report = simulatorSPtr_->runPaced(
+            instant + Duration::Minutes(9.5),
+            Pacer::AsFastAsPossible(Duration::Minutes(1.0)),
+            [&frames](Simulator&, const Pacer::Frame& aFrame)
+            {
+                frames.add(aFrame);
+            }
+        );
+
+        EXPECT_EQ(instant + Duration::Minutes(9.5), simulatorSPtr_->getInstant());
+        EXPECT_EQ(10, report.frameCount);
+        EXPECT_EQ(0, report.overrunCount);
+        EXPECT_EQ(Duration::Zero(), report.maximumLag);
+
+        ASSERT_EQ(10, frames.getSize());
+        EXPECT_EQ(0, frames.accessFirst().index);
+        EXPECT_EQ(instant + Duration::Minutes(1.0), frames.accessFirst().instant);
+        EXPECT_EQ(9, frames.accessLast().index);
+        EXPECT_EQ(instant + Duration::Minutes(9.5), frames.accessLast().instant);
+    }
+
+    {
+        simulatorSPtr_->setInstant(instant);
+
+        Size firedEventCount = 0;
+
+        simulatorSPtr_->scheduleEvent(
+            instant + Duration::Seconds(45.0),
+            [&firedEventCount](Simulator&)
+            {
+                firedEventCount += 1;
+            }
+        );
+
+        const Pacer::Report report = simulatorSPtr_->runPaced(
+            instant + Duration::Minutes(2.0), Pacer(600.0, Duration::Milliseconds(50.0))
+        );
+
+        EXPECT_EQ(instant + Duration::Minutes(2.0), simulatorSPtr_->getInstant());
+        EXPECT_EQ(1, firedEventCount);
+        EXPECT_EQ(4, report.frameCount);
+        EXPECT_LE(Duration::Milliseconds(200.0), report.wallClockDuration);
+        EXPECT_GE(600.0 + 1.0e-6, report.achievedTimeRatio);
+    }
+
+    // A slow event makes the second frame overrun
+
+    for (const auto& catchUpPolicy :
+         {Pacer::CatchUpPolicy::Skip, Pacer::CatchUpPolicy::Burst, Pacer::CatchUpPolicy::Stretch})
+    {
+        simulatorSPtr_->setInstant(instant);
+
+        simulatorSPtr_->scheduleEvent(
+            instant + Duration::Milliseconds(15.0),
+            [](Simulator&)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            }
+        );
+
+        Array<Pacer::Frame> frames = Array<Pacer::Frame>::Empty();
+
+        const Pacer::Report report = simulatorSPtr_->runPaced(
+            instant + Duration::Milliseconds(200.0),
+            Pacer(1.0, Duration::Milliseconds(10.0), catchUpPolicy),
+            [&frames](Simulator&, const Pacer::Frame& aFrame)
+            {
+                frames.add(aFrame);
+            }
+        );
+
+        EXPECT_LE(1, report.overrunCount);
+        EXPECT_LE(Duration::Milliseconds(30.0), report.maximumLag);
+        EXPECT_LE(Duration::Milliseconds(50.0), report.maximumComputeDuration);
+
+        ASSERT_LE(2, frames.getSize());
+        EXPECT_TRUE(frames[1].isOverrun);
+
+        if (catchUpPolicy == Pacer::CatchUpPolicy::Stretch)
+        {
+            EXPECT_LT(Duration::Milliseconds(30.0), frames[2].instant - frames[1].instant);
+        }
+        else
+        {
+            EXPECT_EQ(Duration::Milliseconds(10.0), frames[2].instant - frames[1].instant);
+        }
+    }
+
+    {
+        const Pacer pacer = Pacer::RealTime(Duration::Milliseconds(10.0));
+
+        EXPECT_THROW(
+            simulatorSPtr_->runPaced(simulatorSPtr_->getInstant() - Duration::Seconds(1.0), pacer),
+            ostk::core::error::RuntimeError
+        );
+        EXPECT_THROW(
+            simulatorSPtr_->runPaced(simulatorSPtr_->getInstant(), Pacer::Undefined()),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(Simulator::Undefined().runPaced(Instant::J2000(), pacer), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, ScheduleComponentStateChange)
+{
+    {
+        const Instant instant = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
+        simulatorSPtr_->setInstant(instant);
+
+        const Component& camera =
+            simulatorSPtr_->accessSatelliteWithName(satelliteName_).accessComponentWithName("Camera");
+
+        simulatorSPtr_->scheduleComponentStateChange(
+            instant + Duration::Hours(1.0), camera.getId(), State(State::Status::Idle)
+        );
+        simulatorSPtr_->scheduleComponentStateChange(
+            instant + Duration::Hours(2.0), camera.getId(), State(State::Status::Busy)
+        );
+
+        simulatorSPtr_->run(instant + Duration::Minutes(90.0));
+
+        EXPECT_EQ(State(State::Status::Idle), camera.getState());
+
+        simulatorSPtr_->run(instant + Duration::Hours(3.0));
+
+        EXPECT_EQ(State(State::Status::Busy), camera.getState());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, ScheduleCrossings)
+{
+    {
+        const Instant instant = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
+        simulatorSPtr_->setInstant(instant);
+
+        const Component& camera =
+            simulatorSPtr_->accessSatelliteWithName(satelliteName_).accessComponentWithName("Camera");
+
+        const Detector detector = {
+            camera.getGeometries().accessFirst(),
+            *environment_.accessCelestialObjectWithName("Earth"),
+            Detector::Predicate::Intersects
+        };
+
+        const Interval interval = Interval::Closed(instant, instant + Duration::Hours(1.0));
+
+        Array<Detector::Crossing> firedCrossings = Array<Detector::Crossing>::Empty();
+
+        const Array<Index> eventIds = simulatorSPtr_->scheduleCrossings(
+            detector,
+            interval,
+            Duration::Minutes(5.0),
+            [&firedCrossings](Simulator& aSimulator, const Detector::Crossing& aCrossing)
+            {
+                EXPECT_EQ(aCrossing.instant, aSimulator.getInstant());
+
+                firedCrossings.add(aCrossing);
+            }
+        );
+
+        EXPECT_EQ(detector.computeCrossings(interval, Duration::Minutes(5.0)).getSize(), eventIds.getSize());
+
+        simulatorSPtr_->run(interval.getEnd());
+
+        EXPECT_EQ(eventIds.getSize(), firedCrossings.getSize());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, Test_1)
+{
+    {
+        const Environment environment = Environment::Default();
+
+        const Orbit orbit = Orbit::SunSynchronous(
+            Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC),  // Epoch
+            Length::Kilometers(500.0),                                     // Altitude
+            Time(14, 0, 0),                                                // LTAN
+            environment.accessCelestialObjectWithName("Earth")             // Celestial object
+        );
+
+        Shared<Simulator> simulatorSPtr = Simulator::Configure(
+            {environment,
+             {{"1",
+               "LoftSat-1",
+               Profile::LocalOrbitalFramePointing(orbit, Orbit::FrameType::VVLH),
+               {{"2",
+                 "Camera",
+                 Component::Type::Sensor,
+                 {"tag-a", "tag-b"},
+                 Quaternion::Unit(),
+                 {{"FOV",
+                   Composite {Pyramid {
+                       Polygon {
+                           {{{-0.1, -1.0}, {+0.1, -1.0}, {+0.1, +1.0}, {-0.1, +1.0}}},
+                           Point {0.0, 0.0, 1.0},
+                           {1.0, 0.0, 0.0},
+                           {0.0, 1.0, 0.0}
+                       },
+                       Point {0.0, 0.0, 0.0}
+                   }}}}}}}}}
+        );
+
+        const Instant instant = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
+        simulatorSPtr->setInstant(instant);
+
+        const auto camera = simulatorSPtr->accessSatelliteWithName("LoftSat-1").accessComponentWithName("Camera");
+
+        const auto cameraGeometry = camera.accessGeometryWithName("FOV");
+        const auto earthGeometry = environment.accessCelestialObjectWithName("Earth")->accessGeometry();
+
+        EXPECT_TRUE(cameraGeometry.intersects(earthGeometry));
+
+        EXPECT_EQ(2, cameraGeometry.intersectionWith(earthGeometry).accessComposite().getObjectCount());
+        EXPECT_TRUE(cameraGeometry.intersectionWith(earthGeometry).accessComposite().accessObjectAt(0).is<LineString>()
+        );
+        EXPECT_TRUE(cameraGeometry.intersectionWith(earthGeometry).accessComposite().accessObjectAt(1).is<LineString>()
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, Fork)
+{
+    const Instant instant = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
+    {
+        simulatorSPtr_->setInstant(instant);
+        simulatorSPtr_->setComponentStateWithId("2", State(State::Status::Idle));
+
+        const Satellite& satellite = simulatorSPtr_->accessSatelliteWithName(satelliteName_);
+
+        const Shared<Simulator> forkSPtr = simulatorSPtr_->fork();
+
+        EXPECT_TRUE(forkSPtr->isDefined());
+        EXPECT_EQ(instant, forkSPtr->getInstant());
+
+        // Satellites are not copied by forking, nor by reading them from this simulator
+
+        EXPECT_EQ(&satellite, &simulatorSPtr_->accessSatelliteWithName(satelliteName_));
+
+        // The fork copies a satellite once, when it first hands it out, and binds it to itself
+
+        const Satellite& forkSatellite = forkSPtr->accessSatelliteWithName(satelliteName_);
+
+        EXPECT_NE(&satellite, &forkSatellite);
+        EXPECT_EQ(&forkSatellite, &forkSPtr->accessSatelliteWithName(satelliteName_));
+        EXPECT_EQ(&forkSatellite, &forkSPtr->accessSatellite(forkSPtr->getSatelliteHandle(satelliteName_)));
+        EXPECT_EQ(satellite.getId(), forkSatellite.getId());
+        EXPECT_EQ(satellite.accessFrame(), forkSatellite.accessFrame());
+        EXPECT_EQ(simulatorSPtr_.get(), &satellite.accessSimulator());
+        EXPECT_EQ(forkSPtr.get(), &forkSatellite.accessSimulator());
+
+        const Component& camera = satellite.accessComponentWithName("Camera");
+        const Component& forkCamera = forkSatellite.accessComponentWithName("Camera");
+
+        EXPECT_EQ(forkSPtr.get(), &forkCamera.accessSimulator());
+        EXPECT_EQ(&forkCamera, &forkCamera.accessGeometryWithName("FOV").accessComponent());
+
+        // Geometry shapes stay shared
+
+        EXPECT_EQ(
+            &camera.accessGeometryWithName("FOV").accessComposite(),
+            &forkCamera.accessGeometryWithName("FOV").accessComposite()
+        );
+
+        forkSPtr->setInstant(instant + Duration::Hours(1.0));
+        forkSPtr->setComponentStateWithId("2", State(State::Status::Busy));
+
+        EXPECT_EQ(instant, simulatorSPtr_->getInstant());
+        EXPECT_EQ(State(State::Status::Idle), simulatorSPtr_->getComponentStateWithId("2"));
+        EXPECT_EQ(instant + Duration::Hours(1.0), forkSPtr->getInstant());
+        EXPECT_EQ(State(State::Status::Busy), forkSPtr->getComponentStateWithId("2"));
+
+        EXPECT_EQ(State(State::Status::Idle), camera.getState());
+        EXPECT_EQ(State(State::Status::Busy), forkCamera.getState());
+
+        forkSPtr->removeSatelliteWithName(satelliteName_);
+
+        EXPECT_TRUE(simulatorSPtr_->hasSatelliteWithName(satelliteName_));
+        EXPECT_FALSE(forkSPtr->hasSatelliteWithName(satelliteName_));
+    }
+
+    {
+        simulatorSPtr_->setInstant(instant);
+
+        const Satellite& satellite = simulatorSPtr_->accessSatelliteWithName(satelliteName_);
+
+        const Shared<Simulator> forkSPtr = simulatorSPtr_->fork();
+
+        // Stepping the fork does not copy satellites
+
+        forkSPtr->stepForward(Duration::Minutes(10.0));
+
+        EXPECT_EQ(&satellite, &simulatorSPtr_->accessSatelliteWithName(satelliteName_));
+
+        // Satellites handed out to be modified are copied first, once, and keep their binding
+
+        const Shared<Satellite> satelliteSPtr = simulatorSPtr_->accessSatelliteMap().at(satelliteName_);
+
+        EXPECT_NE(&satellite, satelliteSPtr.get());
+        EXPECT_EQ(satelliteSPtr, simulatorSPtr_->accessSatelliteMap().at(satelliteName_));
+        EXPECT_EQ(satelliteSPtr.get(), &simulatorSPtr_->accessSatelliteWithName(satelliteName_));
+        EXPECT_EQ(simulatorSPtr_.get(), &satelliteSPtr->accessSimulator());
+    }
+
+    {
+        simulatorSPtr_->setThreadCount(2);
+        simulatorSPtr_->setInstant(instant);
+
+        const Shared<Simulator> forkSPtr = simulatorSPtr_->fork();
+
+        forkSPtr->stepForward(Duration::Minutes(10.0));
+
+        EXPECT_EQ(instant, simulatorSPtr_->getInstant());
+        EXPECT_NE(
+            simulatorSPtr_->getSatelliteStateWithName(satelliteName_),
+            forkSPtr->getSatelliteStateWithName(satelliteName_)
+        );
+    }
+
+    {
+        EXPECT_THROW(Simulator::Undefined().fork(), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, CreateCheckpoint)
+{
+    {
+        const Instant instant = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
+        simulatorSPtr_->setInstant(instant);
+        simulatorSPtr_->setComponentStateWithId("2", State(State::Status::Busy));
+
+        const Checkpoint checkpoint = simulatorSPtr_->createCheckpoint();
+
+        EXPECT_EQ(instant, checkpoint.getInstant());
+        ASSERT_EQ(1, checkpoint.accessSatelliteRecords().getSize());
+        EXPECT_EQ(satelliteName_, checkpoint.accessSatelliteRecords().accessFirst().name);
+        EXPECT_EQ(
+            simulatorSPtr_->getSatelliteStateWithName(satelliteName_),
+            checkpoint.accessSatelliteRecords().accessFirst().state
+        );
+    }
+
+    {
+        EXPECT_THROW(Simulator::Undefined().createCheckpoint(), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, Restore)
+{
+    const Instant instant = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
+    {
+        simulatorSPtr_->setInstant(instant + Duration::Hours(1.0));
+        simulatorSPtr_->setComponentStateWithId("2", State(State::Status::Busy));
+
+        const Checkpoint checkpoint = Checkpoint::FromBytes(simulatorSPtr_->createCheckpoint().toBytes());
+
+        simulatorSPtr_->setInstant(instant);
+        simulatorSPtr_->setComponentStateWithId("2", State(State::Status::Idle));
+        simulatorSPtr_->scheduleEvent(instant + Duration::Hours(2.0), [](Simulator&) {});
+
+        simulatorSPtr_->restore(checkpoint);
+
+        EXPECT_EQ(instant + Duration::Hours(1.0), simulatorSPtr_->getInstant());
+        EXPECT_EQ(State(State::Status::Busy), simulatorSPtr_->getComponentStateWithId("2"));
+        EXPECT_TRUE(simulatorSPtr_->accessScheduler().isEmpty());
+    }
+
+    // Recorded satellite states are reused by default, without an update phase
+
+    {
+        simulatorSPtr_->setInstant(instant + Duration::Hours(1.0));
+
+        const TrajectoryState expectedState = simulatorSPtr_->getSatelliteStateWithName(satelliteName_);
+        const Checkpoint checkpoint = simulatorSPtr_->createCheckpoint();
+
+        simulatorSPtr_->setInstant(instant);
+        simulatorSPtr_->restore(checkpoint);
+
+        const Size missCount = simulatorSPtr_->accessStateCache().getMissCount();
+
+        EXPECT_EQ(expectedState.inFrame(Frame::GCRF()), simulatorSPtr_->getSatelliteStateWithName(satelliteName_));
+        EXPECT_EQ(missCount, simulatorSPtr_->accessStateCache().getMissCount());
+        EXPECT_TRUE(simulatorSPtr_->accessStateCache().isSatelliteDirty(satelliteName_));
+    }
+
+    {
+        simulatorSPtr_->setThreadCount(2);
+        simulatorSPtr_->setInstant(instant + Duration::Hours(1.0));
+
+        const TrajectoryState expectedState = simulatorSPtr_->getSatelliteStateWithName(satelliteName_);
+        const Checkpoint checkpoint = simulatorSPtr_->createCheckpoint();
+
+        simulatorSPtr_->setInstant(instant);
+        simulatorSPtr_->restore(checkpoint);
+
+        EXPECT_EQ(expectedState.inFrame(Frame::GCRF()), simulatorSPtr_->getSatelliteStateWithName(satelliteName_));
+    }
+
+    {
+        const Checkpoint checkpoint = simulatorSPtr_->createCheckpoint();
+
+        const Shared<Simulator> otherSimulatorSPtr = Simulator::Configure(
+            {environment_, {{"1", "OtherSat", Profile::InertialPointing(orbit_, Quaternion::Unit())}}}
+        );
+
+        EXPECT_THROW(otherSimulatorSPtr->restore(checkpoint), ostk::core::error::RuntimeError);
+        EXPECT_THROW(simulatorSPtr_->restore(Checkpoint::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Simulator::Undefined().restore(checkpoint), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, Undefined)
+{
+    {
+        EXPECT_FALSE(Simulator::Undefined().isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, AddSatellites)
+{
+    Array<Shared<Satellite>> satellites = Array<Shared<Satellite>>::Empty();
+
+    for (const char* satelliteName : {"Sat-C", "Sat-A", "Sat-B"})
+    {
+        const String name = satelliteName;
+
+        satellites.add(Satellite::Configure(
+            {name, name, Profile::InertialPointing(orbit_, Quaternion::Unit())}, simulatorSPtr_
+        ));
+    }
+
+    {
+        EXPECT_THROW(Simulator::Undefined().addSatellites(satellites), ostk::core::error::runtime::Undefined);
+    }
+
+    // The batch is validated as a whole before any satellite is added
+
+    {
+        Array<Shared<Satellite>> invalidSatellites = satellites;
+        invalidSatellites.add(nullptr);
+
+        EXPECT_THROW(simulatorSPtr_->addSatellites(invalidSatellites), ostk::core::error::runtime::Undefined);
+        EXPECT_EQ(1, simulatorSPtr_->accessSatelliteMap().size());
+    }
+
+    {
+        simulatorSPtr_->addSatellites(satellites);
+
+        EXPECT_EQ(4, simulatorSPtr_->accessSatelliteMap().size());
+        EXPECT_TRUE(simulatorSPtr_->hasSatelliteWithName("Sat-A"));
+        EXPECT_TRUE(simulatorSPtr_->hasSatelliteWithName("Sat-B"));
+        EXPECT_TRUE(simulatorSPtr_->hasSatelliteWithName("Sat-C"));
+
+        // Names already used are kept
+
+        const Shared<Satellite> duplicateSatelliteSPtr = Satellite::Configure(
+            {"Sat-A-2", "Sat-A", Profile::InertialPointing(orbit_, Quaternion::Unit())}, simulatorSPtr_
+        );
+
+        simulatorSPtr_->addSatellites({duplicateSatelliteSPtr});
+
+        EXPECT_EQ(4, simulatorSPtr_->accessSatelliteMap().size());
+        EXPECT_EQ("Sat-A", simulatorSPtr_->accessSatelliteWithName("Sat-A").getId());
+
+        EXPECT_NO_THROW(simulatorSPtr_->addSatellites(Array<Shared<Satellite>>::Empty()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, RemoveSatellitesWithNames)
+{
+    {
+        EXPECT_THROW(
+            Simulator::Undefined().removeSatellitesWithNames({"Sat-A"}), ostk::core::error::runtime::Undefined
+        );
+    }
+
+    {
+        Array<Shared<Satellite>> satellites = Array<Shared<Satellite>>::Empty();
+
+        for (const char* satelliteName : {"Sat-A", "Sat-B", "Sat-C"})
+        {
+            const String name = satelliteName;
+
+            satellites.add(Satellite::Configure(
+                {name, name, Profile::InertialPointing(orbit_, Quaternion::Unit())}, simulatorSPtr_
+            ));
+        }
+
+        simulatorSPtr_->addSatellites(satellites);
+
+        // The batch is validated as a whole before any satellite is removed
+
+        EXPECT_THROW(
+            simulatorSPtr_->removeSatellitesWithNames({"Sat-A", "NonExistentSatellite"}),
+            ostk::core::error::RuntimeError
+        );
+        EXPECT_EQ(4, simulatorSPtr_->accessSatelliteMap().size());
+
+        simulatorSPtr_->removeSatellitesWithNames({"Sat-A", "Sat-C", "Sat-A"});
+
+        EXPECT_EQ(2, simulatorSPtr_->accessSatelliteMap().size());
+        EXPECT_FALSE(simulatorSPtr_->hasSatelliteWithName("Sat-A"));
+        EXPECT_TRUE(simulatorSPtr_->hasSatelliteWithName("Sat-B"));
+        EXPECT_FALSE(simulatorSPtr_->hasSatelliteWithName("Sat-C"));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, RemoveSatelliteWithName)
+{
+    {
+        EXPECT_THROW(
+            Simulator::Undefined().removeSatelliteWithName("TestSatellite"), ostk::core::error::runtime::Undefined
+        );
+    }
+
+    {
+        EXPECT_THROW(simulatorSPtr_->removeSatelliteWithName("NonExistentSatellite"), ostk::core::error::RuntimeError);
+    }
+
+    {
+        EXPECT_TRUE(simulatorSPtr_->hasSatelliteWithName(satelliteName_));
+        EXPECT_EQ(simulatorSPtr_->accessSatelliteMap().size(), 1);
+
+        simulatorSPtr_->removeSatelliteWithName(satelliteName_);
+
+        EXPECT_FALSE(simulatorSPtr_->hasSatelliteWithName(satelliteName_));
+        EXPECT_EQ(simulatorSPtr_->accessSatelliteMap().size(), 0);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, ClearSatellites)
+{
+    {
+        EXPECT_THROW(Simulator::Undefined().clearSatellites(), ostk::core::error::runtime::Undefined);
+    }
+
+    {
+        EXPECT_TRUE(simulatorSPtr_->hasSatelliteWithName(satelliteName_));
+        EXPECT_EQ(simulatorSPtr_->accessSatelliteMap().size(), 1);
+
+        simulatorSPtr_->clearSatellites();
+
+        EXPECT_FALSE(simulatorSPtr_->hasSatelliteWithName(satelliteName_));
+        EXPECT_EQ(simulatorSPtr_->accessSatelliteMap().size(), 0);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator, Configure)
+{
+    {
+        const Array<SatelliteConfiguration> satelliteConfiguraitons = Array<SatelliteConfiguration>::Empty();
+
+        EXPECT_NO_THROW(Simulator::Configure(SimulatorConfiguration {environment_, satelliteConfiguraitons}));
+
+        EXPECT_EQ(
+            4, Simulator::Configure(SimulatorConfiguration {environment_, satelliteConfiguraitons, 4})->getThreadCount()
+        );
     }
 }
@@ -0,0 +1,223 @@
+/// Apache License 2.0
+
+#include <cstdio>
+
+#include <OpenSpaceToolkit/Simulation/Component.hpp>
+#include <OpenSpaceToolkit/Simulation/Component/State.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator/Checkpoint.hpp>
+
+#include <OpenSpaceToolkit/Core/FileSystem/File.hpp>
+#include <OpenSpaceToolkit/Core/FileSystem/Path.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/Profile.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::filesystem::File;
+using ostk::core::filesystem::Path;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+using ostk::core::type::String;
+
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::Environment;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+using ostk::physics::time::Time;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::flight::Profile;
+using ostk::astrodynamics::trajectory::Orbit;
+
+using ostk::simulation::Component;
+using ostk::simulation::component::State;
+using ostk::simulation::Simulator;
+using ostk::simulation::simulator::Checkpoint;
+
+class OpenSpaceToolkit_Simulation_Simulator_Checkpoint : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        this->simulatorSPtr_->setInstant(instant_);
+        this->simulatorSPtr_->setComponentStateWithId("2", State(State::Status::Busy, true));
+
+        this->checkpoint_ = this->simulatorSPtr_->createCheckpoint();
+    }
+
+    const Environment environment_ = Environment::Default();
+
+    const Instant epoch_ = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+    const Instant instant_ = epoch_ + Duration::Nanoseconds(3600.0e9 + 123.0);
+
+    const Orbit orbit_ = Orbit::SunSynchronous(
+        epoch_,                                              // Epoch
+        Length::Kilometers(500.0),                           // Altitude
+        Time(14, 0, 0),                                      // LTAN
+        environment_.accessCelestialObjectWithName("Earth")  // Celestial object
+    );
+
+    const Shared<Simulator> simulatorSPtr_ = Simulator::Configure(
+        {environment_,
+         {{"1",
+           "LoftSat-1",
+           Profile::LocalOrbitalFramePointing(orbit_, Orbit::FrameType::VVLH),
+           {{"2",
+             "Camera",
+             Component::Type::Sensor,
+             {},
+             Quaternion::Unit(),
+             {},
+             {{"3", "Detector", Component::Type::Sensor, {}, Quaternion::Unit()}}}}}}}
+    );
+
+    Checkpoint checkpoint_ = Checkpoint::Undefined();
+};
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Checkpoint, Constructor)
+{
+    {
+        EXPECT_NO_THROW(Checkpoint(instant_, Array<Checkpoint::SatelliteRecord>::Empty()));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Checkpoint, StreamOperator)
+{
+    {
+        testing::internal::CaptureStdout();
+
+        EXPECT_NO_THROW(std::cout << checkpoint_ << std::endl);
+
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Checkpoint, IsDefined)
+{
+    {
+        EXPECT_TRUE(checkpoint_.isDefined());
+        EXPECT_FALSE(Checkpoint::Undefined().isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Checkpoint, Accessors)
+{
+    {
+        EXPECT_EQ(instant_, checkpoint_.getInstant());
+
+        const Array<Checkpoint::SatelliteRecord>& satelliteRecords = checkpoint_.accessSatelliteRecords();
+
+        ASSERT_EQ(1, satelliteRecords.getSize());
+
+        const Checkpoint::SatelliteRecord& satelliteRecord = satelliteRecords.accessFirst();
+
+        EXPECT_EQ("1", satelliteRecord.id);
+        EXPECT_EQ("LoftSat-1", satelliteRecord.name);
+        EXPECT_EQ(instant_, satelliteRecord.state.getInstant());
+
+        ASSERT_EQ(3, satelliteRecord.componentRecords.getSize());
+
+        EXPECT_EQ("1", satelliteRecord.componentRecords[0].id);
+        EXPECT_EQ(0, satelliteRecord.componentRecords[0].depth);
+        EXPECT_EQ("Camera", satelliteRecord.componentRecords[1].name);
+        EXPECT_EQ(1, satelliteRecord.componentRecords[1].depth);
+        EXPECT_EQ(State(State::Status::Busy, true), satelliteRecord.componentRecords[1].state);
+        EXPECT_EQ("Detector", satelliteRecord.componentRecords[2].name);
+        EXPECT_EQ(2, satelliteRecord.componentRecords[2].depth);
+        EXPECT_EQ(State(), satelliteRecord.componentRecords[2].state);
+    }
+
+    {
+        EXPECT_THROW(Checkpoint::Undefined().getInstant(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Checkpoint::Undefined().accessSatelliteRecords(), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Checkpoint, ToBytes)
+{
+    {
+        const String bytes = checkpoint_.toBytes();
+
+        ASSERT_LE(12, bytes.size());
+        EXPECT_EQ("OSTKSIMC", bytes.substr(0, 8));
+    }
+
+    {
+        EXPECT_THROW(Checkpoint::Undefined().toBytes(), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Checkpoint, FromBytes)
+{
+    {
+        const Checkpoint checkpoint = Checkpoint::FromBytes(checkpoint_.toBytes());
+
+        EXPECT_EQ(checkpoint_.getInstant(), checkpoint.getInstant());
+
+        const Checkpoint::SatelliteRecord& expectedSatelliteRecord = checkpoint_.accessSatelliteRecords().accessFirst();
+        const Checkpoint::SatelliteRecord& satelliteRecord = checkpoint.accessSatelliteRecords().accessFirst();
+
+        EXPECT_EQ(expectedSatelliteRecord.id, satelliteRecord.id);
+        EXPECT_EQ(expectedSatelliteRecord.name, satelliteRecord.name);
+        EXPECT_EQ(expectedSatelliteRecord.state.inFrame(Frame::GCRF()), satelliteRecord.state);
+
+        ASSERT_EQ(expectedSatelliteRecord.componentRecords.getSize(), satelliteRecord.componentRecords.getSize());
+
+        for (Index index = 0; index < satelliteRecord.componentRecords.getSize(); ++index)
+        {
+            EXPECT_EQ(expectedSatelliteRecord.componentRecords[index].id, satelliteRecord.componentRecords[index].id);
+            EXPECT_EQ(
+                expectedSatelliteRecord.componentRecords[index].state, satelliteRecord.componentRecords[index].state
+            );
+        }
+    }
+
+    {
+        const String bytes = checkpoint_.toBytes();
+
+        EXPECT_THROW(Checkpoint::FromBytes(""), ostk::core::error::RuntimeError);
+        EXPECT_THROW(Checkpoint::FromBytes("XXXXXXXX" + bytes.substr(8)), ostk::core::error::RuntimeError);
+        EXPECT_THROW(Checkpoint::FromBytes(bytes.substr(0, bytes.size() - 1)), ostk::core::error::RuntimeError);
+        EXPECT_THROW(Checkpoint::FromBytes(bytes + "X"), ostk::core::error::RuntimeError);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Checkpoint, SaveAndLoad)
+{
+    {
+        const File file = File::Path(Path::Parse("/tmp/OpenSpaceToolkit_Simulation_Simulator_Checkpoint.bin"));
+
+        checkpoint_.save(file);
+
+        const Checkpoint checkpoint = Checkpoint::Load(file);
+
+        std::remove(file.getPath().toString().c_str());
+
+        EXPECT_EQ(checkpoint_.toBytes(), checkpoint.toBytes());
+    }
+
+    {
+        EXPECT_THROW(
+            Checkpoint::Load(File::Path(Path::Parse("/tmp/OpenSpaceToolkit_Simulation_Simulator_Checkpoint.none"))),
+            ostk::core::error::RuntimeError
+        );
+        EXPECT_THROW(checkpoint_.save(File::Undefined()), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Checkpoint, Undefined)
+{
+    {
+        EXPECT_NO_THROW(Checkpoint::Undefined());
+    }
+}
@@ -0,0 +1,241 @@
+/// Apache License 2.0
+
+#include <cmath>
+#include <random>
+
+#include <OpenSpaceToolkit/Simulation/Satellite.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator/Ensemble.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+
+#include <OpenSpaceToolkit/Physics/Unit/Angle.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/Profile.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Real;
+using ostk::core::type::Size;
+
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+
+using ostk::physics::Environment;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::flight::Profile;
+using ostk::astrodynamics::trajectory::Orbit;
+
+using ostk::simulation::SatelliteConfiguration;
+using ostk::simulation::Simulator;
+using ostk::simulation::SimulatorConfiguration;
+using ostk::simulation::simulator::Ensemble;
+
+class OpenSpaceToolkit_Simulation_Simulator_Ensemble : public ::testing::Test
+{
+   protected:
+    const Environment environment_ = Environment::Default();
+
+    const Instant epoch_ = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
+    const SimulatorConfiguration baseConfiguration_ = {environment_};
+
+    // Each replica holds one satellite on a circular orbit, with an altitude dispersed in [500, 510] km
+
+    const Ensemble::Perturbation perturbation_ =
+        [this](const SimulatorConfiguration& aConfiguration, const Index&, const std::uint64_t& aSeed)
+    {
+        std::mt19937_64 generator(aSeed);
+        std::uniform_real_distribution<double> distribution(500.0, 510.0);
+
+        const Orbit orbit = Orbit::Circular(
+            epoch_,
+            Length::Kilometers(distribution(generator)),
+            Angle::Degrees(97.0),
+            aConfiguration.environment.accessCelestialObjectWithName("Earth")
+        );
+
+        return SimulatorConfiguration {
+            aConfiguration.environment,
+            {SatelliteConfiguration {"1", "LoftSat-1", Profile::InertialPointing(orbit, Quaternion::Unit())}}
+        };
+    };
+
+    // Outputs the orbital radius, and a copy of it only defined for some replicas
+
+    const Ensemble::Evaluation evaluation_ = [this](Simulator& aSimulator) -> Array<Real>
+    {
+        aSimulator.setInstant(epoch_);
+
+        const Real radius =
+            aSimulator.getSatelliteStateWithName("LoftSat-1").getPosition().getCoordinates().norm();
+
+        return {radius, (std::fmod(radius, 2.0) < 1.0) ? radius : Real::Undefined()};
+    };
+};
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Ensemble, Constructor)
+{
+    {
+        EXPECT_NO_THROW(Ensemble(baseConfiguration_, perturbation_, evaluation_, 10, 42));
+        EXPECT_NO_THROW(Ensemble(baseConfiguration_, perturbation_, evaluation_, 0, 42, 4));
+    }
+
+    {
+        EXPECT_THROW(Ensemble(baseConfiguration_, {}, evaluation_, 10, 42), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Ensemble(baseConfiguration_, perturbation_, {}, 10, 42), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(
+            Ensemble(baseConfiguration_, perturbation_, evaluation_, 10, 42, 0), ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Ensemble, Getters)
+{
+    {
+        const Ensemble ensemble(baseConfiguration_, perturbation_, evaluation_, 10, 42, 4);
+
+        EXPECT_EQ(10, ensemble.getReplicaCount());
+        EXPECT_EQ(42, ensemble.getSeed());
+        EXPECT_EQ(4, ensemble.getThreadCount());
+        EXPECT_EQ(Ensemble::GenerateSeed(42, 3), ensemble.getReplicaSeed(3));
+
+        EXPECT_THROW(ensemble.getReplicaSeed(10), ostk::core::error::RuntimeError);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Ensemble, Run)
+{
+    {
+        const Ensemble ensemble(baseConfiguration_, perturbation_, evaluation_, 50, 42, 4);
+
+        Array<Index> replicaIndices = Array<Index>::Empty();
+        Array<Real> radii = Array<Real>::Empty();
+
+        const Array<Ensemble::Statistics> statistics = ensemble.run(
+            [&replicaIndices, &radii](const Index& aReplicaIndex, const Array<Real>& anOutputArray)
+            {
+                replicaIndices.add(aReplicaIndex);
+                radii.add(anOutputArray.accessFirst());
+            }
+        );
+
+        ASSERT_EQ(50, replicaIndices.getSize());
+
+        for (Index index = 0; index < replicaIndices.getSize(); ++index)
+        {
+            EXPECT_EQ(index, replicaIndices[index]);
+        }
+
+        ASSERT_EQ(2, statistics.getSize());
+
+        const Ensemble::Statistics& radiusStatistics = statistics.accessFirst();
+
+        EXPECT_EQ(50, radiusStatistics.count);
+        EXPECT_LT(6878.0e3, radiusStatistics.minimum);
+        EXPECT_GT(6889.0e3, radiusStatistics.maximum);
+        EXPECT_LT(radiusStatistics.minimum, radiusStatistics.mean);
+        EXPECT_GT(radiusStatistics.maximum, radiusStatistics.mean);
+        EXPECT_LT(1.0e3, radiusStatistics.standardDeviation);
+        EXPECT_GT(5.0e3, radiusStatistics.standardDeviation);
+
+        EXPECT_GT(50, statistics[1].count);
+        EXPECT_LT(0, statistics[1].count);
+    }
+
+    {
+        const Array<Ensemble::Statistics> statistics =
+            Ensemble(baseConfiguration_, perturbation_, evaluation_, 1, 42).run();
+
+        EXPECT_EQ(1, statistics.accessFirst().count);
+        EXPECT_EQ(statistics.accessFirst().minimum, statistics.accessFirst().mean);
+        EXPECT_FALSE(statistics.accessFirst().standardDeviation.isDefined());
+    }
+
+    {
+        EXPECT_TRUE(Ensemble(baseConfiguration_, perturbation_, evaluation_, 0, 42).run().isEmpty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Ensemble, Run_Deterministic)
+{
+    {
+        const Ensemble ensemble_1(baseConfiguration_, perturbation_, evaluation_, 100, 42, 1);
+        const Ensemble ensemble_2(baseConfiguration_, perturbation_, evaluation_, 100, 42, 8);
+        const Ensemble ensemble_3(baseConfiguration_, perturbation_, evaluation_, 100, 43, 8);
+
+        const Array<Ensemble::Statistics> statistics_1 = ensemble_1.run();
+        const Array<Ensemble::Statistics> statistics_2 = ensemble_2.run();
+        const Array<Ensemble::Statistics> statistics_3 = ensemble_3.run();
+
+        for (Index index = 0; index < statistics_1.getSize(); ++index)
+        {
+            EXPECT_EQ(statistics_1[index].count, statistics_2[index].count);
+            EXPECT_EQ(statistics_1[index].mean, statistics_2[index].mean);
+            EXPECT_EQ(statistics_1[index].standardDeviation, statistics_2[index].standardDeviation);
+            EXPECT_EQ(statistics_1[index].minimum, statistics_2[index].minimum);
+            EXPECT_EQ(statistics_1[index].maximum, statistics_2[index].maximum);
+        }
+
+        EXPECT_NE(statistics_1.accessFirst().mean, statistics_3.accessFirst().mean);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Ensemble, Run_Failure)
+{
+    {
+        const Ensemble ensemble(
+            baseConfiguration_,
+            perturbation_,
+            [](Simulator&) -> Array<Real>
+            {
+                throw ostk::core::error::RuntimeError("Evaluation failure.");
+            },
+            10,
+            42,
+            4
+        );
+
+        EXPECT_THROW(ensemble.run(), ostk::core::error::RuntimeError);
+    }
+
+    {
+        const Ensemble ensemble(
+            baseConfiguration_,
+            perturbation_,
+            [](Simulator& aSimulator) -> Array<Real>
+            {
+                aSimulator.setInstant(Instant::J2000());
+
+                const Real radius =
+                    aSimulator.getSatelliteStateWithName("LoftSat-1").getPosition().getCoordinates().norm();
+
+                return Array<Real>((std::fmod(radius, 2.0) < 1.0) ? 1 : 2, radius);
+            },
+            50,
+            42,
+            4
+        );
+
+        EXPECT_THROW(ensemble.run(), ostk::core::error::RuntimeError);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Ensemble, GenerateSeed)
+{
+    {
+        EXPECT_EQ(Ensemble::GenerateSeed(42, 0), Ensemble::GenerateSeed(42, 0));
+        EXPECT_NE(Ensemble::GenerateSeed(42, 0), Ensemble::GenerateSeed(42, 1));
+        EXPECT_NE(Ensemble::GenerateSeed(42, 0), Ensemble::GenerateSeed(43, 0));
+
+        // SplitMix64 reference output for seed 0
+
+        EXPECT_EQ(0xE220A8397B1DCDAFULL, Ensemble::GenerateSeed(0, 0));
+    }
+}
@@ -0,0 +1,231 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Simulator/FrameRegistry.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame/Provider/Static.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::frame::Provider;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::time::Instant;
+
+using StaticProvider = ostk::physics::coordinate::frame::provider::Static;
+
+using ostk::simulation::simulator::FrameRegistry;
+
+class OpenSpaceToolkit_Simulation_Simulator_FrameRegistry : public ::testing::Test
+{
+   protected:
+    const Shared<const Provider> providerSPtr_ = std::make_shared<const StaticProvider>(
+        Transform::Passive(Instant::J2000(), {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, Quaternion::Unit(), {0.0, 0.0, 0.0})
+    );
+};
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_FrameRegistry, Constructor)
+{
+    {
+        EXPECT_NO_THROW(FrameRegistry frameRegistry);
+    }
+
+    {
+        const FrameRegistry frameRegistry;
+
+        EXPECT_EQ(Size(0), frameRegistry.getSize());
+        EXPECT_FALSE(frameRegistry.hasFrameWithName("FrameRegistry [Constructor]"));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_FrameRegistry, ConstructFrame)
+{
+    {
+        FrameRegistry frameRegistry;
+
+        const Shared<const Frame> frameSPtr =
+            frameRegistry.constructFrame("FrameRegistry [ConstructFrame]", false, Frame::GCRF(), providerSPtr_);
+
+        EXPECT_TRUE(frameSPtr->isDefined());
+        EXPECT_EQ("FrameRegistry [ConstructFrame]", frameSPtr->getName());
+        EXPECT_EQ(Size(1), frameRegistry.getSize());
+        EXPECT_TRUE(frameRegistry.hasFrameWithName("FrameRegistry [ConstructFrame]"));
+        EXPECT_EQ(frameSPtr, frameRegistry.accessFrameWithName("FrameRegistry [ConstructFrame]"));
+        EXPECT_FALSE(Frame::Exists("FrameRegistry [ConstructFrame]"));
+    }
+
+    // Registries hold frames of the same name independently
+
+    {
+        FrameRegistry firstFrameRegistry;
+        FrameRegistry secondFrameRegistry;
+
+        const Shared<const Frame> firstFrameSPtr =
+            firstFrameRegistry.constructFrame("FrameRegistry [ConstructFrame]", false, Frame::GCRF(), providerSPtr_);
+        const Shared<const Frame> secondFrameSPtr =
+            secondFrameRegistry.constructFrame("FrameRegistry [ConstructFrame]", false, Frame::GCRF(), providerSPtr_);
+
+        EXPECT_NE(firstFrameSPtr, secondFrameSPtr);
+        EXPECT_EQ(firstFrameSPtr, firstFrameRegistry.accessFrameWithName("FrameRegistry [ConstructFrame]"));
+        EXPECT_EQ(secondFrameSPtr, secondFrameRegistry.accessFrameWithName("FrameRegistry [ConstructFrame]"));
+    }
+
+    // Constructing a frame under the name of a live one replaces it
+
+    {
+        FrameRegistry frameRegistry;
+
+        const Shared<const Frame> firstFrameSPtr =
+            frameRegistry.constructFrame("FrameRegistry [ConstructFrame]", false, Frame::GCRF(), providerSPtr_);
+        const Shared<const Frame> secondFrameSPtr =
+            frameRegistry.constructFrame("FrameRegistry [ConstructFrame]", false, Frame::GCRF(), providerSPtr_);
+
+        EXPECT_NE(firstFrameSPtr, secondFrameSPtr);
+        EXPECT_EQ(Size(1), frameRegistry.getSize());
+        EXPECT_EQ(secondFrameSPtr, frameRegistry.accessFrameWithName("FrameRegistry [ConstructFrame]"));
+    }
+
+    {
+        FrameRegistry frameRegistry;
+
+        EXPECT_THROW(
+            frameRegistry.constructFrame("", false, Frame::GCRF(), providerSPtr_), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            frameRegistry.constructFrame("FrameRegistry [ConstructFrame]", false, nullptr, providerSPtr_),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            frameRegistry.constructFrame("FrameRegistry [ConstructFrame]", false, Frame::GCRF(), nullptr),
+            ostk::core::error::runtime::Undefined
+        );
+
+        EXPECT_EQ(Size(0), frameRegistry.getSize());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_FrameRegistry, AccessFrameWithName)
+{
+    {
+        const FrameRegistry frameRegistry;
+
+        EXPECT_THROW(frameRegistry.accessFrameWithName(""), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(
+            frameRegistry.accessFrameWithName("FrameRegistry [AccessFrameWithName]"), ostk::core::error::RuntimeError
+        );
+    }
+
+    // Frames are referred to weakly, and are released with their owners
+
+    {
+        FrameRegistry frameRegistry;
+
+        Shared<const Frame> frameSPtr =
+            frameRegistry.constructFrame("FrameRegistry [AccessFrameWithName]", false, Frame::GCRF(), providerSPtr_);
+
+        EXPECT_TRUE(frameRegistry.hasFrameWithName("FrameRegistry [AccessFrameWithName]"));
+
+        frameSPtr.reset();
+
+        EXPECT_EQ(Size(0), frameRegistry.getSize());
+        EXPECT_FALSE(frameRegistry.hasFrameWithName("FrameRegistry [AccessFrameWithName]"));
+        EXPECT_THROW(
+            frameRegistry.accessFrameWithName("FrameRegistry [AccessFrameWithName]"), ostk::core::error::RuntimeError
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_FrameRegistry, RemoveFrameWithName)
+{
+    {
+        FrameRegistry frameRegistry;
+
+        const Shared<const Frame> frameSPtr =
+            frameRegistry.constructFrame("FrameRegistry [RemoveFrameWithName]", false, Frame::GCRF(), providerSPtr_);
+
+        EXPECT_NO_THROW(frameRegistry.removeFrameWithName("FrameRegistry [RemoveFrameWithName]"));
+        EXPECT_NO_THROW(frameRegistry.removeFrameWithName("FrameRegistry [RemoveFrameWithName]"));
+
+        EXPECT_FALSE(frameRegistry.hasFrameWithName("FrameRegistry [RemoveFrameWithName]"));
+        EXPECT_TRUE(frameSPtr->isDefined());
+    }
+
+    {
+        FrameRegistry frameRegistry;
+
+        EXPECT_THROW(frameRegistry.removeFrameWithName(""), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_FrameRegistry, Clear)
+{
+    {
+        FrameRegistry frameRegistry;
+
+        const Shared<const Frame> firstFrameSPtr =
+            frameRegistry.constructFrame("FrameRegistry [Clear 1]", false, Frame::GCRF(), providerSPtr_);
+        const Shared<const Frame> secondFrameSPtr =
+            frameRegistry.constructFrame("FrameRegistry [Clear 2]", false, firstFrameSPtr, providerSPtr_);
+
+        EXPECT_EQ(Size(2), frameRegistry.getSize());
+
+        EXPECT_NO_THROW(frameRegistry.clear());
+
+        EXPECT_EQ(Size(0), frameRegistry.getSize());
+        EXPECT_FALSE(frameRegistry.hasFrameWithName("FrameRegistry [Clear 1]"));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_FrameRegistry, Print)
+{
+    {
+        const FrameRegistry frameRegistry;
+
+        testing::internal::CaptureStdout();
+
+        EXPECT_NO_THROW(frameRegistry.print(std::cout, true));
+        EXPECT_NO_THROW(std::cout << frameRegistry << std::endl);
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_FrameRegistry, StaticConstructFrame)
+{
+    {
+        const Shared<const Frame> firstFrameSPtr =
+            FrameRegistry::ConstructFrame("FrameRegistry [StaticConstructFrame]", false, Frame::GCRF(), providerSPtr_);
+        const Shared<const Frame> secondFrameSPtr =
+            FrameRegistry::ConstructFrame("FrameRegistry [StaticConstructFrame]", false, Frame::GCRF(), providerSPtr_);
+
+        EXPECT_TRUE(firstFrameSPtr->isDefined());
+        EXPECT_TRUE(secondFrameSPtr->isDefined());
+        EXPECT_NE(firstFrameSPtr, secondFrameSPtr);
+        EXPECT_FALSE(Frame::Exists("FrameRegistry [StaticConstructFrame]"));
+    }
+
+    {
+        EXPECT_THROW(
+            FrameRegistry::ConstructFrame("", false, Frame::GCRF(), providerSPtr_),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            FrameRegistry::ConstructFrame("FrameRegistry [StaticConstructFrame]", false, nullptr, providerSPtr_),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            FrameRegistry::ConstructFrame("FrameRegistry [StaticConstructFrame]", false, Frame::GCRF(), nullptr),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
@@ -0,0 +1,242 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Simulator/History.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::container::Map;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+
+using TrajectoryState = ostk::astrodynamics::trajectory::State;
+
+using ostk::simulation::component::State;
+using ostk::simulation::simulator::History;
+using ostk::simulation::utility::CopyOnWrite;
+
+class OpenSpaceToolkit_Simulation_Simulator_History : public ::testing::Test
+{
+   protected:
+    const Instant instant_ = Instant::J2000();
+
+    const Size entrySize_ = History::EstimateEntrySize(1, 1);
+
+    const CopyOnWrite<Map<String, State>> componentStateMap_ = {{{"camera", State(State::Status::Busy)}}};
+
+    Map<String, TrajectoryState> satelliteStatesAt(const Instant& anInstant) const
+    {
+        return {
+            {"sat-1",
+             {anInstant,
+              Position::Meters({7000e3, 0.0, 0.0}, Frame::GCRF()),
+              Velocity::MetersPerSecond({0.0, 7.5e3, 0.0}, Frame::GCRF()),
+              Quaternion::Unit(),
+              Vector3d::Zero(),
+              Frame::GCRF()}}
+        };
+    }
+};
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_History, Constructor)
+{
+    {
+        EXPECT_NO_THROW(History(0));
+        EXPECT_NO_THROW(History(1024));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_History, Getters)
+{
+    {
+        const History history(0);
+
+        EXPECT_FALSE(history.isEnabled());
+        EXPECT_TRUE(history.isEmpty());
+        EXPECT_EQ(0, history.getSize());
+        EXPECT_EQ(0, history.getMemoryUsage());
+        EXPECT_TRUE(history.getInstants().isEmpty());
+        EXPECT_FALSE(history.hasInstant(instant_));
+    }
+
+    {
+        const History history(1024);
+
+        EXPECT_TRUE(history.isEnabled());
+        EXPECT_EQ(1024, history.getMemoryBudget());
+
+        EXPECT_THROW(history.getSatelliteStatesAt(instant_), ostk::core::error::RuntimeError);
+        EXPECT_THROW(history.accessComponentStatesAt(instant_), ostk::core::error::RuntimeError);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_History, Record)
+{
+    {
+        History history(10 * entrySize_);
+
+        history.record(instant_, satelliteStatesAt(instant_), componentStateMap_);
+
+        ASSERT_TRUE(history.hasInstant(instant_));
+        EXPECT_EQ(1, history.getSize());
+        EXPECT_EQ(entrySize_, history.getMemoryUsage());
+
+        const Map<String, TrajectoryState> satelliteStates = history.getSatelliteStatesAt(instant_);
+
+        ASSERT_EQ(1, satelliteStates.size());
+
+        const TrajectoryState& state = satelliteStates.at("sat-1");
+        const TrajectoryState referenceState = satelliteStatesAt(instant_).at("sat-1");
+
+        EXPECT_EQ(instant_, state.getInstant());
+        EXPECT_TRUE(
+            state.getPosition().accessCoordinates().isApprox(referenceState.getPosition().accessCoordinates(), 1e-9)
+        );
+
+        // Component states are shared, not copied
+
+        EXPECT_EQ(&componentStateMap_.access(), &history.accessComponentStatesAt(instant_).access());
+    }
+
+    // Recording an instant again replaces its entry
+
+    {
+        History history(10 * entrySize_);
+
+        history.record(instant_, satelliteStatesAt(instant_), componentStateMap_);
+        history.record(instant_ + Duration::Seconds(1.0), satelliteStatesAt(instant_), componentStateMap_);
+        history.record(instant_, satelliteStatesAt(instant_), {{{"camera", State(State::Status::Idle)}}});
+
+        EXPECT_EQ(Array<Instant>({instant_ + Duration::Seconds(1.0), instant_}), history.getInstants());
+        EXPECT_EQ(State(State::Status::Idle), history.accessComponentStatesAt(instant_).access().at("camera"));
+    }
+
+    // Satellite states undefined or not at the instant are skipped
+
+    {
+        History history(10 * entrySize_);
+
+        Map<String, TrajectoryState> satelliteStates = satelliteStatesAt(instant_ + Duration::Seconds(1.0));
+        satelliteStates.insert({"sat-2", TrajectoryState::Undefined()});
+
+        history.record(instant_, satelliteStates, componentStateMap_);
+
+        EXPECT_TRUE(history.getSatelliteStatesAt(instant_).empty());
+    }
+
+    {
+        History history(10 * entrySize_);
+
+        EXPECT_THROW(
+            history.record(Instant::Undefined(), satelliteStatesAt(instant_), componentStateMap_),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_History, MemoryBudget)
+{
+    // The oldest entries are evicted first
+
+    {
+        History history(3 * entrySize_);
+
+        for (int index = 0; index < 5; ++index)
+        {
+            const Instant instant = instant_ + Duration::Seconds(index);
+
+            history.record(instant, satelliteStatesAt(instant), componentStateMap_);
+        }
+
+        EXPECT_EQ(3, history.getSize());
+        EXPECT_EQ(3 * entrySize_, history.getMemoryUsage());
+        EXPECT_FALSE(history.hasInstant(instant_ + Duration::Seconds(1.0)));
+        EXPECT_TRUE(history.hasInstant(instant_ + Duration::Seconds(2.0)));
+
+        history.setMemoryBudget(entrySize_);
+
+        EXPECT_EQ(Array<Instant>({instant_ + Duration::Seconds(4.0)}), history.getInstants());
+
+        history.setMemoryBudget(0);
+
+        EXPECT_TRUE(history.isEmpty());
+    }
+
+    // Eviction follows the recording order, not the instant order
+
+    {
+        History history(2 * entrySize_);
+
+        for (int index = 2; index >= 0; --index)
+        {
+            const Instant instant = instant_ + Duration::Seconds(index);
+
+            history.record(instant, satelliteStatesAt(instant), componentStateMap_);
+        }
+
+        EXPECT_EQ(Array<Instant>({instant_ + Duration::Seconds(1.0), instant_}), history.getInstants());
+        EXPECT_FALSE(history.hasInstant(instant_ + Duration::Seconds(2.0)));
+    }
+
+    // Entries larger than the budget are not recorded
+
+    {
+        History history(entrySize_ - 1);
+
+        history.record(instant_, satelliteStatesAt(instant_), componentStateMap_);
+
+        EXPECT_TRUE(history.isEmpty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_History, Clear)
+{
+    {
+        History history(10 * entrySize_);
+
+        history.record(instant_, satelliteStatesAt(instant_), componentStateMap_);
+        history.clear();
+
+        EXPECT_TRUE(history.isEmpty());
+        EXPECT_EQ(0, history.getMemoryUsage());
+        EXPECT_EQ(10 * entrySize_, history.getMemoryBudget());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_History, Print)
+{
+    {
+        History history(10 * entrySize_);
+
+        history.record(instant_, satelliteStatesAt(instant_), componentStateMap_);
+
+        testing::internal::CaptureStdout();
+
+        EXPECT_NO_THROW(history.print(std::cout, true));
+        EXPECT_NO_THROW(std::cout << history << std::endl);
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_History, EstimateEntrySize)
+{
+    {
+        EXPECT_LT(History::EstimateEntrySize(1, 0), History::EstimateEntrySize(2, 0));
+        EXPECT_LT(History::EstimateEntrySize(1, 0), History::EstimateEntrySize(1, 1));
+    }
+}
@@ -0,0 +1,120 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Simulator/Pacer.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Real;
+
+using ostk::physics::time::Duration;
+
+using ostk::simulation::simulator::Pacer;
+
+class OpenSpaceToolkit_Simulation_Simulator_Pacer : public ::testing::Test
+{
+   protected:
+    const Pacer pacer_ = {10.0, Duration::Milliseconds(100.0), Pacer::CatchUpPolicy::Burst};
+};
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Pacer, Constructor)
+{
+    {
+        EXPECT_NO_THROW(Pacer(1.0, Duration::Milliseconds(100.0)));
+        EXPECT_NO_THROW(Pacer(0.5, Duration::Seconds(1.0), Pacer::CatchUpPolicy::Stretch));
+    }
+
+    {
+        EXPECT_THROW(Pacer(Real::Undefined(), Duration::Seconds(1.0)), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Pacer(1.0, Duration::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Pacer(0.0, Duration::Seconds(1.0)), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(Pacer(1.0, Duration::Zero()), ostk::core::error::runtime::Wrong);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Pacer, StreamOperator)
+{
+    {
+        testing::internal::CaptureStdout();
+
+        EXPECT_NO_THROW(std::cout << pacer_ << std::endl);
+        EXPECT_NO_THROW(std::cout << Pacer::AsFastAsPossible(Duration::Seconds(1.0)) << std::endl);
+        EXPECT_NO_THROW(std::cout << Pacer::Undefined() << std::endl);
+
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Pacer, IsDefined)
+{
+    {
+        EXPECT_TRUE(pacer_.isDefined());
+        EXPECT_TRUE(Pacer::AsFastAsPossible(Duration::Seconds(1.0)).isDefined());
+        EXPECT_FALSE(Pacer::Undefined().isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Pacer, Getters)
+{
+    {
+        EXPECT_TRUE(pacer_.isPaced());
+        EXPECT_EQ(10.0, pacer_.getTimeRatio());
+        EXPECT_EQ(Duration::Milliseconds(100.0), pacer_.getFramePeriod());
+        EXPECT_EQ(Duration::Seconds(1.0), pacer_.getStep());
+        EXPECT_EQ(Pacer::CatchUpPolicy::Burst, pacer_.getCatchUpPolicy());
+    }
+
+    {
+        EXPECT_THROW(Pacer::Undefined().isPaced(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Pacer::Undefined().getTimeRatio(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Pacer::Undefined().getFramePeriod(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Pacer::Undefined().getStep(), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Pacer::Undefined().getCatchUpPolicy(), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Pacer, Undefined)
+{
+    {
+        EXPECT_NO_THROW(Pacer::Undefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Pacer, RealTime)
+{
+    {
+        const Pacer pacer = Pacer::RealTime(Duration::Milliseconds(100.0));
+
+        EXPECT_TRUE(pacer.isPaced());
+        EXPECT_EQ(1.0, pacer.getTimeRatio());
+        EXPECT_EQ(Duration::Milliseconds(100.0), pacer.getStep());
+        EXPECT_EQ(Pacer::CatchUpPolicy::Skip, pacer.getCatchUpPolicy());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Pacer, AsFastAsPossible)
+{
+    {
+        const Pacer pacer = Pacer::AsFastAsPossible(Duration::Seconds(10.0));
+
+        EXPECT_FALSE(pacer.isPaced());
+        EXPECT_FALSE(pacer.getTimeRatio().isDefined());
+        EXPECT_EQ(Duration::Zero(), pacer.getFramePeriod());
+        EXPECT_EQ(Duration::Seconds(10.0), pacer.getStep());
+    }
+
+    {
+        EXPECT_THROW(Pacer::AsFastAsPossible(Duration::Undefined()), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(Pacer::AsFastAsPossible(Duration::Zero()), ostk::core::error::runtime::Wrong);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Pacer, StringFromCatchUpPolicy)
+{
+    {
+        EXPECT_EQ("Skip", Pacer::StringFromCatchUpPolicy(Pacer::CatchUpPolicy::Skip));
+        EXPECT_EQ("Burst", Pacer::StringFromCatchUpPolicy(Pacer::CatchUpPolicy::Burst));
+        EXPECT_EQ("Stretch", Pacer::StringFromCatchUpPolicy(Pacer::CatchUpPolicy::Stretch));
+    }
+}
@@ -0,0 +1,180 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Component.hpp>
+#include <OpenSpaceToolkit/Simulation/Component/Geometry.hpp>
+#include <OpenSpaceToolkit/Simulation/Satellite.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator/Partition.hpp>
+#include <OpenSpaceToolkit/Simulation/Utility/ThreadPool.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Environment.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Duration.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Time.hpp>
+#include <OpenSpaceToolkit/Physics/Unit/Length.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/Profile.hpp>
+
+#include <Global.test.hpp>
+
+#if defined(__linux__)
+
+using ostk::core::container::Array;
+using ostk::core::container::Map;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+using ostk::core::type::String;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::Environment;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Time;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::flight::Profile;
+using ostk::astrodynamics::trajectory::Orbit;
+
+using TrajectoryState = ostk::astrodynamics::trajectory::State;
+
+using ostk::simulation::Component;
+using ostk::simulation::component::Geometry;
+using ostk::simulation::Satellite;
+using ostk::simulation::simulator::Partition;
+using ostk::simulation::utility::ThreadPool;
+
+class OpenSpaceToolkit_Simulation_Simulator_Partition : public ::testing::Test
+{
+   protected:
+    void SetUp() override
+    {
+        const Environment environment = Environment::Default();
+
+        for (Index index = 0; index < 5; ++index)
+        {
+            const Orbit orbit = Orbit::SunSynchronous(
+                Instant::J2000(),
+                Length::Kilometers(500.0 + (100.0 * index)),
+                Time::Noon(),
+                environment.accessCelestialObjectWithName("Earth")
+            );
+
+            this->satellites_.add(std::make_shared<const Satellite>(
+                String::Format("id-{}", index),
+                String::Format("LoftSat-{}", index),
+                Array<String>::Empty(),
+                Array<Shared<Geometry>>::Empty(),
+                Array<Shared<Component>>::Empty(),
+                nullptr,
+                std::make_shared<Profile>(Profile::LocalOrbitalFramePointing(orbit, Orbit::FrameType::VVLH)),
+                nullptr
+            ));
+        }
+    }
+
+    Array<Shared<const Satellite>> satellites_ = Array<Shared<const Satellite>>::Empty();
+};
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Partition, Constructor)
+{
+    {
+        EXPECT_NO_THROW(Partition(satellites_, 2));
+        EXPECT_NO_THROW(Partition(Array<Shared<const Satellite>>::Empty(), 2));
+    }
+
+    {
+        EXPECT_THROW(Partition(satellites_, 0), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(
+            Partition(Array<Shared<const Satellite>>({nullptr}), 2), ostk::core::error::runtime::Undefined
+        );
+    }
+
+    {
+        // Workers are not forked while thread pool workers are running
+
+        const ThreadPool threadPool(2);
+
+        EXPECT_THROW(Partition(satellites_, 2), ostk::core::error::RuntimeError);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Partition, Getters)
+{
+    {
+        const Partition partition(satellites_, 3);
+
+        EXPECT_EQ(3, partition.getProcessCount());
+        EXPECT_EQ(5, partition.getSatelliteCount());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Partition, GetStatesAt)
+{
+    // More workers than satellites leaves some workers idle
+
+    for (const auto processCount : {1, 2, 8})
+    {
+        Partition partition(satellites_, processCount);
+
+        for (const auto& instant : {Instant::J2000(), Instant::J2000() + Duration::Minutes(30.0)})
+        {
+            const Partition::View view = partition.getStatesAt(instant);
+
+            EXPECT_EQ(instant, view.getInstant());
+            EXPECT_TRUE(view.isCurrent());
+            EXPECT_EQ(satellites_.getSize(), view.getSatelliteStates().size());
+
+            for (const auto& satelliteSPtr : satellites_)
+            {
+                const TrajectoryState state = view.getSatelliteStateWithName(satelliteSPtr->getName());
+                const TrajectoryState referenceState = satelliteSPtr->getStateAt(instant).inFrame(Frame::GCRF());
+
+                EXPECT_EQ(instant, state.getInstant());
+                EXPECT_TRUE(state.getPosition().accessCoordinates().isApprox(
+                    referenceState.getPosition().accessCoordinates(), 1e-9
+                ));
+                EXPECT_TRUE(state.getVelocity().accessCoordinates().isApprox(
+                    referenceState.getVelocity().accessCoordinates(), 1e-9
+                ));
+            }
+        }
+    }
+
+    {
+        // Views are stale once the partition is evaluated again
+
+        Partition partition(satellites_, 2);
+
+        const Partition::View view = partition.getStatesAt(Instant::J2000());
+        const Partition::View nextView = partition.getStatesAt(Instant::J2000() + Duration::Minutes(1.0));
+
+        EXPECT_FALSE(view.isCurrent());
+        EXPECT_FALSE(view.getSatelliteStateWithName("LoftSat-0").isDefined());
+        EXPECT_TRUE(view.getSatelliteStates().empty());
+
+        EXPECT_TRUE(nextView.isCurrent());
+        EXPECT_TRUE(nextView.getSatelliteStateWithName("LoftSat-0").isDefined());
+        EXPECT_THROW(nextView.getSatelliteStateWithName("Unknown"), ostk::core::error::RuntimeError);
+    }
+
+    {
+        Partition partition(satellites_, 2);
+
+        EXPECT_THROW(partition.getStatesAt(Instant::Undefined()), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_Partition, Print)
+{
+    {
+        const Partition partition(satellites_, 2);
+
+        testing::internal::CaptureStdout();
+
+        EXPECT_NO_THROW(partition.print(std::cout, true));
+        EXPECT_NO_THROW(std::cout << partition << std::endl);
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    }
+}
+
+#endif
@@ -0,0 +1,398 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Component.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator/StateCache.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Composite.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+
+#include <OpenSpaceToolkit/Physics/Coordinate/Frame.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Position.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Transform.hpp>
+#include <OpenSpaceToolkit/Physics/Coordinate/Velocity.hpp>
+#include <OpenSpaceToolkit/Physics/Environment.hpp>
+#include <OpenSpaceToolkit/Physics/Time/Instant.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+using ostk::mathematics::geometry::d3::object::Composite;
+using ostk::mathematics::geometry::d3::object::Point;
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+using ostk::mathematics::object::Vector3d;
+
+using ostk::physics::coordinate::Frame;
+using ostk::physics::coordinate::Position;
+using ostk::physics::coordinate::Transform;
+using ostk::physics::coordinate::Velocity;
+using ostk::physics::Environment;
+using ostk::physics::environment::object::Celestial;
+using ostk::physics::time::Instant;
+
+using TrajectoryState = ostk::astrodynamics::trajectory::State;
+using ObjectGeometry = ostk::physics::environment::object::Geometry;
+
+using ostk::simulation::Component;
+using ostk::simulation::component::Geometry;
+using ostk::simulation::simulator::StateCache;
+
+class OpenSpaceToolkit_Simulation_Simulator_StateCache : public ::testing::Test
+{
+   protected:
+    const TrajectoryState state_ = {
+        Instant::J2000(),
+        Position::Meters({7000e3, 0.0, 0.0}, Frame::GCRF()),
+        Velocity::MetersPerSecond({0.0, 7.5e3, 0.0}, Frame::GCRF()),
+        Quaternion::Unit(),
+        Vector3d::Zero(),
+        Frame::GCRF()
+    };
+
+    const ObjectGeometry objectGeometry_ = {Composite {Point {1.0, 2.0, 3.0}}, Frame::GCRF()};
+
+    const Shared<const Component> componentSPtr_ = std::make_shared<const Component>(
+        "1",
+        "Camera",
+        Component::Type::Sensor,
+        Array<String>::Empty(),
+        Array<Shared<Geometry>>::Empty(),
+        Array<Shared<Component>>::Empty(),
+        nullptr,
+        Frame::GCRF(),
+        nullptr
+    );
+
+    const Geometry geometry_ = {"FOV", Composite {Point {0.0, 0.0, 1.0}}, componentSPtr_};
+
+    Size evaluationCount_ = 0;
+
+    TrajectoryState evaluateState()
+    {
+        evaluationCount_ += 1;
+
+        return state_;
+    }
+
+    ObjectGeometry evaluateGeometry()
+    {
+        evaluationCount_ += 1;
+
+        return objectGeometry_;
+    }
+};
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_StateCache, Constructor)
+{
+    {
+        EXPECT_NO_THROW(StateCache());
+    }
+
+    {
+        StateCache stateCache;
+
+        stateCache.getSatelliteState(
+            "sat-1",
+            [this]()
+            {
+                return this->evaluateState();
+            }
+        );
+
+        const StateCache copy(stateCache);
+
+        EXPECT_FALSE(copy.isSatelliteDirty("sat-1"));
+        EXPECT_EQ(stateCache.getGeneration(), copy.getGeneration());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_StateCache, GetSatelliteState)
+{
+    {
+        StateCache stateCache;
+
+        const auto evaluator = [this]()
+        {
+            return this->evaluateState();
+        };
+
+        EXPECT_TRUE(stateCache.isSatelliteDirty("sat-1"));
+
+        EXPECT_EQ(state_, stateCache.getSatelliteState("sat-1", evaluator));
+        EXPECT_EQ(state_, stateCache.getSatelliteState("sat-1", evaluator));
+
+        EXPECT_EQ(1, evaluationCount_);
+        EXPECT_FALSE(stateCache.isSatelliteDirty("sat-1"));
+        EXPECT_TRUE(stateCache.isSatelliteDirty("sat-2"));
+        EXPECT_EQ(1, stateCache.getSize());
+
+        // A new generation marks the entry dirty, until it is evaluated again
+
+        stateCache.invalidate();
+
+        EXPECT_TRUE(stateCache.isSatelliteDirty("sat-1"));
+        EXPECT_EQ(0, stateCache.getSize());
+
+        stateCache.getSatelliteState("sat-1", evaluator);
+
+        EXPECT_EQ(2, evaluationCount_);
+        EXPECT_FALSE(stateCache.isSatelliteDirty("sat-1"));
+    }
+
+    // Failed evaluations are not cached
+
+    {
+        StateCache stateCache;
+
+        EXPECT_ANY_THROW(stateCache.getSatelliteState(
+            "sat-1",
+            []() -> TrajectoryState
+            {
+                throw ostk::core::error::RuntimeError("Cannot evaluate.");
+            }
+        ));
+
+        EXPECT_TRUE(stateCache.isSatelliteDirty("sat-1"));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_StateCache, GetGeometry)
+{
+    {
+        StateCache stateCache;
+
+        const auto evaluator = [this]()
+        {
+            return this->evaluateGeometry();
+        };
+
+        EXPECT_TRUE(stateCache.isGeometryDirty(geometry_));
+
+        EXPECT_EQ(objectGeometry_, stateCache.getGeometry(geometry_, evaluator));
+        EXPECT_EQ(objectGeometry_, stateCache.getGeometry(geometry_, evaluator));
+
+        EXPECT_EQ(1, evaluationCount_);
+        EXPECT_FALSE(stateCache.isGeometryDirty(geometry_));
+
+        // Copies of a geometry share its entry
+
+        const Geometry geometryCopy = geometry_;
+
+        EXPECT_FALSE(stateCache.isGeometryDirty(geometryCopy));
+
+        stateCache.invalidate();
+
+        EXPECT_TRUE(stateCache.isGeometryDirty(geometry_));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_StateCache, GetCelestialGeometry)
+{
+    {
+        StateCache stateCache;
+
+        const Environment environment = Environment::Default();
+        const Shared<const Celestial> earthSPtr = environment.accessCelestialObjectWithName("Earth");
+
+        const auto evaluator = [this]()
+        {
+            return this->evaluateGeometry();
+        };
+
+        EXPECT_EQ(objectGeometry_, stateCache.getCelestialGeometry(earthSPtr, evaluator));
+        EXPECT_EQ(objectGeometry_, stateCache.getCelestialGeometry(earthSPtr, evaluator));
+
+        EXPECT_EQ(1, evaluationCount_);
+    }
+
+    // Distinct objects sharing a name have distinct entries
+
+    {
+        StateCache stateCache;
+
+        const Shared<const Celestial> earthSPtr = Environment::Default().accessCelestialObjectWithName("Earth");
+        const Shared<const Celestial> otherEarthSPtr = Environment::Default().accessCelestialObjectWithName("Earth");
+
+        const auto evaluator = [this]()
+        {
+            return this->evaluateGeometry();
+        };
+
+        stateCache.getCelestialGeometry(earthSPtr, evaluator);
+        stateCache.getCelestialGeometry(otherEarthSPtr, evaluator);
+        stateCache.getCelestialGeometry(earthSPtr, evaluator);
+
+        EXPECT_EQ(3, evaluationCount_);
+    }
+
+    {
+        StateCache stateCache;
+
+        EXPECT_THROW(
+            stateCache.getCelestialGeometry(
+                nullptr,
+                [this]()
+                {
+                    return this->evaluateGeometry();
+                }
+            ),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_StateCache, GetTransform)
+{
+    {
+        StateCache stateCache;
+
+        const Transform transform = Transform::Identity(Instant::J2000());
+
+        const auto evaluator = [this, &transform]()
+        {
+            evaluationCount_ += 1;
+
+            return transform;
+        };
+
+        EXPECT_TRUE(stateCache.isTransformDirty(Frame::ITRF()));
+
+        EXPECT_EQ(transform, stateCache.getTransform(Frame::ITRF(), evaluator));
+        EXPECT_EQ(transform, stateCache.getTransform(Frame::ITRF(), evaluator));
+
+        EXPECT_EQ(1, evaluationCount_);
+        EXPECT_FALSE(stateCache.isTransformDirty(Frame::ITRF()));
+        EXPECT_TRUE(stateCache.isTransformDirty(Frame::GCRF()));
+    }
+
+    // An entry is dirty for a frame allocated at the address of a destroyed one
+
+    {
+        StateCache stateCache;
+
+        const auto evaluator = [this]()
+        {
+            evaluationCount_ += 1;
+
+            return Transform::Identity(Instant::J2000());
+        };
+
+        const Shared<const Frame> frameSPtr = Frame::ITRF();
+        const Frame* framePtr = frameSPtr.get();
+
+        stateCache.getTransform(frameSPtr, evaluator);
+
+        EXPECT_FALSE(stateCache.isTransformDirty(frameSPtr));
+
+        // An aliasing pointer keeps the address, with a distinct owner
+
+        const Shared<const Frame> aliasSPtr = Shared<const Frame>(std::make_shared<int>(0), framePtr);
+
+        EXPECT_TRUE(stateCache.isTransformDirty(aliasSPtr));
+
+        stateCache.getTransform(aliasSPtr, evaluator);
+
+        EXPECT_EQ(3, evaluationCount_);
+        EXPECT_FALSE(stateCache.isTransformDirty(aliasSPtr));
+        EXPECT_TRUE(stateCache.isTransformDirty(frameSPtr));
+    }
+
+    {
+        StateCache stateCache;
+
+        EXPECT_THROW(stateCache.isTransformDirty(nullptr), ostk::core::error::runtime::Undefined);
+        EXPECT_THROW(
+            stateCache.getTransform(
+                nullptr,
+                []()
+                {
+                    return Transform::Undefined();
+                }
+            ),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_StateCache, Counters)
+{
+    {
+        StateCache stateCache;
+
+        const auto stateEvaluator = [this]()
+        {
+            return this->evaluateState();
+        };
+
+        const auto geometryEvaluator = [this]()
+        {
+            return this->evaluateGeometry();
+        };
+
+        EXPECT_EQ(0, stateCache.getHitCount());
+        EXPECT_EQ(0, stateCache.getMissCount());
+
+        stateCache.getSatelliteState("sat-1", stateEvaluator);
+        stateCache.getSatelliteState("sat-1", stateEvaluator);
+        stateCache.getGeometry(geometry_, geometryEvaluator);
+        stateCache.getGeometry(geometry_, geometryEvaluator);
+        stateCache.getGeometry(geometry_, geometryEvaluator);
+
+        EXPECT_EQ(3, stateCache.getHitCount());
+        EXPECT_EQ(2, stateCache.getMissCount());
+
+        // Counters persist across generations, until reset
+
+        stateCache.invalidate();
+        stateCache.getSatelliteState("sat-1", stateEvaluator);
+
+        EXPECT_EQ(3, stateCache.getHitCount());
+        EXPECT_EQ(3, stateCache.getMissCount());
+
+        stateCache.resetCounters();
+
+        EXPECT_EQ(0, stateCache.getHitCount());
+        EXPECT_EQ(0, stateCache.getMissCount());
+        EXPECT_FALSE(stateCache.isSatelliteDirty("sat-1"));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_StateCache, Clear)
+{
+    {
+        StateCache stateCache;
+
+        stateCache.getSatelliteState(
+            "sat-1",
+            [this]()
+            {
+                return this->evaluateState();
+            }
+        );
+
+        const auto generation = stateCache.getGeneration();
+
+        stateCache.clear();
+
+        EXPECT_TRUE(stateCache.isSatelliteDirty("sat-1"));
+        EXPECT_EQ(0, stateCache.getSize());
+        EXPECT_LT(generation, stateCache.getGeneration());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_StateCache, Print)
+{
+    {
+        const StateCache stateCache;
+
+        testing::internal::CaptureStdout();
+
+        EXPECT_NO_THROW(stateCache.print(std::cout, true));
+        EXPECT_NO_THROW(std::cout << stateCache << std::endl);
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    }
+}
@@ -0,0 +1,100 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Simulator/StateTable.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+
+using ostk::mathematics::object::MatrixXd;
+
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+
+using ostk::simulation::simulator::StateTable;
+
+class OpenSpaceToolkit_Simulation_Simulator_StateTable : public ::testing::Test
+{
+   protected:
+    const Array<Instant> instants_ = {Instant::J2000(), Instant::J2000() + Duration::Seconds(10.0)};
+
+    const MatrixXd positions_ = MatrixXd::Ones(3, 2) * 7000e3;
+    const MatrixXd velocities_ = MatrixXd::Ones(3, 2) * 7.5e3;
+    const MatrixXd attitudes_ = MatrixXd::Zero(4, 2);
+    const MatrixXd angularVelocities_ = MatrixXd::Zero(3, 2);
+};
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_StateTable, Constructor)
+{
+    {
+        EXPECT_NO_THROW(StateTable(instants_, positions_, velocities_, attitudes_, angularVelocities_));
+    }
+
+    {
+        EXPECT_ANY_THROW(StateTable(instants_, MatrixXd::Zero(3, 1), velocities_, attitudes_, angularVelocities_));
+        EXPECT_ANY_THROW(StateTable(instants_, positions_, velocities_, MatrixXd::Zero(3, 2), angularVelocities_));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_StateTable, IsDefined)
+{
+    {
+        EXPECT_TRUE(StateTable(instants_, positions_, velocities_, attitudes_, angularVelocities_).isDefined());
+    }
+
+    {
+        EXPECT_FALSE(StateTable::Undefined().isDefined());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_StateTable, Accessors)
+{
+    {
+        const StateTable stateTable = {instants_, positions_, velocities_, attitudes_, angularVelocities_};
+
+        EXPECT_EQ(2, stateTable.getSize());
+        EXPECT_EQ(instants_, stateTable.accessInstants());
+        EXPECT_EQ(positions_, stateTable.accessPositions());
+        EXPECT_EQ(velocities_, stateTable.accessVelocities());
+        EXPECT_EQ(attitudes_, stateTable.accessAttitudes());
+        EXPECT_EQ(angularVelocities_, stateTable.accessAngularVelocities());
+    }
+
+    {
+        EXPECT_EQ(0, StateTable::Undefined().getSize());
+        EXPECT_ANY_THROW(StateTable::Undefined().accessPositions());
+        EXPECT_ANY_THROW(StateTable::Undefined().getStateAt(0));
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_StateTable, Concatenate)
+{
+    {
+        const StateTable stateTable = {instants_, positions_, velocities_, attitudes_, angularVelocities_};
+
+        MatrixXd positions = positions_;
+        positions(0, 1) = 8000e3;
+
+        const StateTable otherStateTable = {
+            {Instant::J2000() + Duration::Seconds(20.0), Instant::J2000() + Duration::Seconds(30.0)},
+            positions,
+            velocities_,
+            attitudes_,
+            angularVelocities_
+        };
+
+        const StateTable concatenatedStateTable =
+            StateTable::Concatenate({stateTable, StateTable::Undefined(), otherStateTable});
+
+        ASSERT_EQ(4, concatenatedStateTable.getSize());
+        EXPECT_EQ(instants_[1], concatenatedStateTable.accessInstants()[1]);
+        EXPECT_EQ(Instant::J2000() + Duration::Seconds(30.0), concatenatedStateTable.accessInstants()[3]);
+        EXPECT_EQ(positions_, MatrixXd(concatenatedStateTable.accessPositions().leftCols(2)));
+        EXPECT_EQ(positions, MatrixXd(concatenatedStateTable.accessPositions().rightCols(2)));
+    }
+
+    {
+        EXPECT_FALSE(StateTable::Concatenate({}).isDefined());
+        EXPECT_FALSE(StateTable::Concatenate({StateTable::Undefined()}).isDefined());
+    }
+}
@@ -0,0 +1,252 @@
+/// Apache License 2.0
+
+#include <algorithm>
+
+#include <OpenSpaceToolkit/Simulation/Satellite.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator.hpp>
+#include <OpenSpaceToolkit/Simulation/Simulator/TimeRange.hpp>
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation/Rotation/Quaternion.hpp>
+
+#include <OpenSpaceToolkit/Physics/Unit/Angle.hpp>
+
+#include <OpenSpaceToolkit/Astrodynamics/Flight/Profile.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Index;
+using ostk::core::type::Shared;
+using ostk::core::type::Size;
+
+using ostk::mathematics::geometry::d3::transformation::rotation::Quaternion;
+
+using ostk::physics::Environment;
+using ostk::physics::time::DateTime;
+using ostk::physics::time::Duration;
+using ostk::physics::time::Instant;
+using ostk::physics::time::Interval;
+using ostk::physics::time::Scale;
+using ostk::physics::unit::Angle;
+using ostk::physics::unit::Length;
+
+using ostk::astrodynamics::flight::Profile;
+using ostk::astrodynamics::trajectory::Orbit;
+
+using TrajectoryState = ostk::astrodynamics::trajectory::State;
+
+using ostk::simulation::Simulator;
+using ostk::simulation::simulator::TimeRange;
+
+class OpenSpaceToolkit_Simulation_Simulator_TimeRange : public ::testing::Test
+{
+   protected:
+    const Environment environment_ = Environment::Default();
+
+    const Instant epoch_ = Instant::DateTime(DateTime(2020, 1, 1, 0, 0, 0), Scale::UTC);
+
+    const Orbit orbit_ = Orbit::Circular(
+        epoch_, Length::Kilometers(500.0), Angle::Degrees(97.0), environment_.accessCelestialObjectWithName("Earth")
+    );
+
+    const Shared<Simulator> simulatorSPtr_ = Simulator::Configure(
+        {environment_, {{"1", "LoftSat-1", Profile::InertialPointing(orbit_, Quaternion::Unit())}}}
+    );
+
+    const Interval interval_ = Interval::Closed(epoch_, epoch_ + Duration::Minutes(10.0));
+};
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_TimeRange, Constructor)
+{
+    {
+        EXPECT_NO_THROW(TimeRange(*simulatorSPtr_, interval_, Duration::Minutes(1.0)));
+        EXPECT_NO_THROW(TimeRange(*simulatorSPtr_, interval_, Duration::Minutes(1.0), 4, false));
+    }
+
+    {
+        EXPECT_THROW(
+            TimeRange(Simulator::Undefined(), interval_, Duration::Minutes(1.0)), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            TimeRange(*simulatorSPtr_, Interval::Undefined(), Duration::Minutes(1.0)),
+            ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(
+            TimeRange(*simulatorSPtr_, interval_, Duration::Undefined()), ostk::core::error::runtime::Undefined
+        );
+        EXPECT_THROW(TimeRange(*simulatorSPtr_, interval_, Duration::Zero()), ostk::core::error::runtime::Wrong);
+        EXPECT_THROW(
+            TimeRange(*simulatorSPtr_, interval_, Duration::Minutes(1.0), 0), ostk::core::error::runtime::Wrong
+        );
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_TimeRange, Getters)
+{
+    {
+        const TimeRange range = simulatorSPtr_->range(interval_, Duration::Minutes(1.0), 4, false);
+
+        EXPECT_EQ(interval_, range.getInterval());
+        EXPECT_EQ(Duration::Minutes(1.0), range.getStep());
+        EXPECT_EQ(11, range.getSize());
+        EXPECT_EQ(4, range.getChunkSize());
+        EXPECT_FALSE(range.isPrefetching());
+
+        EXPECT_EQ(epoch_, range.getInstantAt(0));
+        EXPECT_EQ(epoch_ + Duration::Minutes(3.0), range.getInstantAt(3));
+        EXPECT_EQ(epoch_ + Duration::Minutes(10.0), range.getInstantAt(10));
+
+        EXPECT_THROW(range.getInstantAt(11), ostk::core::error::RuntimeError);
+    }
+
+    // The end of the interval is included when off the grid
+
+    {
+        const TimeRange range = simulatorSPtr_->range(interval_, Duration::Minutes(3.0));
+
+        EXPECT_EQ(5, range.getSize());
+        EXPECT_EQ(epoch_ + Duration::Minutes(9.0), range.getInstantAt(3));
+        EXPECT_EQ(epoch_ + Duration::Minutes(10.0), range.getInstantAt(4));
+    }
+
+    {
+        const TimeRange range = simulatorSPtr_->range(Interval::Closed(epoch_, epoch_), Duration::Minutes(1.0));
+
+        EXPECT_EQ(1, range.getSize());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_TimeRange, Iterate)
+{
+    const Array<Instant> instants = interval_.generateGrid(Duration::Minutes(1.0));
+
+    for (const bool prefetch : {false, true})
+    {
+        const TimeRange range = simulatorSPtr_->range(interval_, Duration::Minutes(1.0), 4, prefetch);
+
+        Index index = 0;
+
+        for (const TimeRange::View& view : range)
+        {
+            ASSERT_LT(index, instants.getSize());
+
+            EXPECT_EQ(instants[index], view.getInstant());
+            EXPECT_EQ(index % 4, view.getIndex());
+
+            const TrajectoryState state = view.getSatelliteStateWithName("LoftSat-1");
+            const TrajectoryState referenceState =
+                simulatorSPtr_->accessSatelliteWithName("LoftSat-1").getStateAt(instants[index]);
+
+            EXPECT_EQ(instants[index], state.getInstant());
+            EXPECT_TRUE(
+                state.getPosition().accessCoordinates().isApprox(referenceState.getPosition().accessCoordinates(), 1e-6)
+            );
+
+            EXPECT_EQ(1, view.accessStateTableMap().size());
+            EXPECT_THROW(view.getSatelliteStateWithName("Unknown"), ostk::core::error::RuntimeError);
+
+            index += 1;
+        }
+
+        EXPECT_EQ(range.getSize(), index);
+    }
+
+    // Iterating does not move the simulation instant
+
+    {
+        simulatorSPtr_->setInstant(epoch_);
+
+        for (const TimeRange::View& view : simulatorSPtr_->range(interval_, Duration::Minutes(5.0)))
+        {
+            EXPECT_TRUE(view.getInstant().isDefined());
+        }
+
+        EXPECT_EQ(epoch_, simulatorSPtr_->getInstant());
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_TimeRange, Algorithms)
+{
+    const TimeRange range = simulatorSPtr_->range(interval_, Duration::Minutes(1.0), 2);
+
+    {
+        const Size count = std::count_if(
+            range.begin(),
+            range.end(),
+            [this](const TimeRange::View& aView)
+            {
+                return aView.getInstant() > (epoch_ + Duration::Minutes(4.5));
+            }
+        );
+
+        EXPECT_EQ(6, count);
+    }
+
+    // Early termination
+
+    {
+        const TimeRange::Iterator iterator = std::find_if(
+            range.begin(),
+            range.end(),
+            [this](const TimeRange::View& aView)
+            {
+                return aView.getInstant() == (epoch_ + Duration::Minutes(3.0));
+            }
+        );
+
+        ASSERT_NE(range.end(), iterator);
+        EXPECT_EQ(epoch_ + Duration::Minutes(3.0), iterator->getInstant());
+    }
+
+    // Passes are independent, and copies of an iterator share their position
+
+    {
+        TimeRange::Iterator first = range.begin();
+        TimeRange::Iterator second = range.begin();
+
+        ++first;
+
+        EXPECT_EQ(epoch_ + Duration::Minutes(1.0), first->getInstant());
+        EXPECT_EQ(epoch_, second->getInstant());
+        EXPECT_NE(first, second);
+
+        TimeRange::Iterator firstCopy = first;
+
+        firstCopy++;
+
+        EXPECT_EQ(epoch_ + Duration::Minutes(2.0), first->getInstant());
+    }
+
+    // Views outlive their iterator
+
+    {
+        Array<TimeRange::View> views = Array<TimeRange::View>::Empty();
+
+        for (const TimeRange::View& view : range)
+        {
+            views.add(view);
+        }
+
+        ASSERT_EQ(11, views.getSize());
+        EXPECT_EQ(epoch_, views.accessFirst().getInstant());
+        EXPECT_EQ(epoch_ + Duration::Minutes(10.0), views.accessLast().getInstant());
+    }
+
+    {
+        EXPECT_THROW(*range.end(), ostk::core::error::RuntimeError);
+        EXPECT_THROW(++range.end(), ostk::core::error::RuntimeError);
+    }
+}
+
+TEST_F(OpenSpaceToolkit_Simulation_Simulator_TimeRange, Print)
+{
+    {
+        const TimeRange range = simulatorSPtr_->range(interval_, Duration::Minutes(1.0));
+
+        testing::internal::CaptureStdout();
+
+        EXPECT_NO_THROW(range.print(std::cout, true));
+        EXPECT_NO_THROW(std::cout << range << std::endl);
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    }
+}
@@ -0,0 +1,85 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Utility/CopyOnWrite.hpp>
+
+#include <OpenSpaceToolkit/Core/Container/Map.hpp>
+#include <OpenSpaceToolkit/Core/Type/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Map;
+using ostk::core::type::Integer;
+using ostk::core::type::String;
+
+using ostk::simulation::utility::CopyOnWrite;
+
+using IntegerMap = CopyOnWrite<Map<String, Integer>>;
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_CopyOnWrite, Constructor)
+{
+    {
+        EXPECT_NO_THROW(IntegerMap());
+        EXPECT_NO_THROW(IntegerMap({{"a", 1}}));
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_CopyOnWrite, IsShared)
+{
+    {
+        const IntegerMap map({{"a", 1}});
+
+        EXPECT_FALSE(map.isShared());
+
+        const IntegerMap mapCopy = map;
+
+        EXPECT_TRUE(map.isShared());
+        EXPECT_TRUE(mapCopy.isShared());
+        EXPECT_EQ(&map.access(), &mapCopy.access());
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_CopyOnWrite, Edit)
+{
+    {
+        IntegerMap map({{"a", 1}});
+
+        const Map<String, Integer>* valuePtr = &map.access();
+
+        map.edit().insert_or_assign("a", 2);
+
+        EXPECT_EQ(valuePtr, &map.access());
+        EXPECT_EQ(2, map.access().at("a"));
+    }
+
+    {
+        const IntegerMap map({{"a", 1}});
+
+        IntegerMap mapCopy = map;
+
+        mapCopy.edit().insert_or_assign("a", 2);
+        mapCopy.edit().insert({"b", 3});
+
+        EXPECT_FALSE(map.isShared());
+        EXPECT_FALSE(mapCopy.isShared());
+        EXPECT_EQ(1, map.access().size());
+        EXPECT_EQ(1, map.access().at("a"));
+        EXPECT_EQ(2, mapCopy.access().size());
+        EXPECT_EQ(2, mapCopy.access().at("a"));
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_CopyOnWrite, Assign)
+{
+    {
+        const IntegerMap map({{"a", 1}});
+
+        IntegerMap mapCopy = map;
+
+        mapCopy.assign({});
+
+        EXPECT_FALSE(map.isShared());
+        EXPECT_EQ(1, map.access().size());
+        EXPECT_TRUE(mapCopy.access().empty());
+    }
+}
@@ -0,0 +1,120 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Utility/Delegate.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Integer.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Integer;
+
+using ostk::simulation::utility::Delegate;
+
+using IntegerDelegate = Delegate<Integer(const Integer&)>;
+
+namespace
+{
+
+Integer Double(const Integer& anInteger)
+{
+    return 2 * anInteger;
+}
+
+class Accumulator
+{
+   public:
+    Integer add(const Integer& anInteger)
+    {
+        total_ = total_ + anInteger;
+        return total_;
+    }
+
+   private:
+    Integer total_ = 0;
+};
+
+}  // namespace
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_Delegate, Constructor)
+{
+    {
+        EXPECT_NO_THROW(IntegerDelegate());
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_Delegate, IsDefined)
+{
+    {
+        EXPECT_FALSE(IntegerDelegate().isDefined());
+        EXPECT_TRUE(IntegerDelegate::FromFunction<&Double>().isDefined());
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_Delegate, Call)
+{
+    {
+        const IntegerDelegate delegate = IntegerDelegate::FromFunction<&Double>();
+
+        EXPECT_EQ(6, delegate(3));
+    }
+
+    {
+        EXPECT_THROW(IntegerDelegate()(3), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_Delegate, FromMethod)
+{
+    {
+        Accumulator accumulator;
+
+        const IntegerDelegate delegate = IntegerDelegate::FromMethod<Accumulator, &Accumulator::add>(&accumulator);
+
+        EXPECT_EQ(2, delegate(2));
+        EXPECT_EQ(5, delegate(3));
+
+        const IntegerDelegate delegateCopy = delegate;
+
+        EXPECT_EQ(9, delegateCopy(4));
+    }
+
+    {
+        EXPECT_THROW(
+            (IntegerDelegate::FromMethod<Accumulator, &Accumulator::add>(nullptr)),
+            ostk::core::error::runtime::Undefined
+        );
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_Delegate, FromCallable)
+{
+    {
+        Integer callCount = 0;
+
+        auto callable = [&callCount](const Integer& anInteger) -> Integer
+        {
+            callCount = callCount + 1;
+            return anInteger + 1;
+        };
+
+        const IntegerDelegate delegate = IntegerDelegate::FromCallable(&callable);
+
+        EXPECT_EQ(4, delegate(3));
+        EXPECT_EQ(1, callCount);
+    }
+
+    {
+        const std::function<Integer(const Integer&)> function = &Double;
+
+        const IntegerDelegate delegate = IntegerDelegate::FromCallable(&function);
+
+        EXPECT_EQ(8, delegate(4));
+    }
+
+    {
+        const std::function<Integer(const Integer&)>* functionPtr = nullptr;
+
+        EXPECT_THROW(IntegerDelegate::FromCallable(functionPtr), ostk::core::error::runtime::Undefined);
+    }
+}
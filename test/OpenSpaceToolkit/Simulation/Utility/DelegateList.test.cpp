@@ -0,0 +1,123 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Utility/DelegateList.hpp>
+
+#include <OpenSpaceToolkit/Core/Container/Array.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Integer.hpp>
+#include <OpenSpaceToolkit/Core/Type/Shared.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::container::Array;
+using ostk::core::type::Integer;
+using ostk::core::type::Shared;
+
+using ostk::simulation::utility::Delegate;
+using ostk::simulation::utility::DelegateList;
+
+using IntegerDelegate = Delegate<void(const Integer&)>;
+using IntegerDelegateList = DelegateList<void(const Integer&)>;
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_DelegateList, Constructor)
+{
+    {
+        EXPECT_NO_THROW(IntegerDelegateList());
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_DelegateList, Add)
+{
+    {
+        IntegerDelegateList delegateList;
+
+        EXPECT_TRUE(delegateList.isEmpty());
+
+        auto callable = [](const Integer&) {};
+
+        delegateList.add(0, IntegerDelegate::FromCallable(&callable));
+        delegateList.add(1, IntegerDelegate::FromCallable(&callable));
+
+        EXPECT_FALSE(delegateList.isEmpty());
+        EXPECT_EQ(2, delegateList.getSize());
+    }
+
+    {
+        IntegerDelegateList delegateList;
+
+        EXPECT_THROW(delegateList.add(0, IntegerDelegate()), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_DelegateList, Remove)
+{
+    {
+        IntegerDelegateList delegateList;
+
+        auto callable = [](const Integer&) {};
+
+        delegateList.add(0, IntegerDelegate::FromCallable(&callable));
+        delegateList.add(1, IntegerDelegate::FromCallable(&callable));
+
+        EXPECT_TRUE(delegateList.remove(0));
+        EXPECT_FALSE(delegateList.remove(0));
+        EXPECT_EQ(1, delegateList.getSize());
+    }
+
+    {
+        IntegerDelegateList delegateList;
+
+        const Shared<const std::function<void(const Integer&)>> functionSPtr =
+            std::make_shared<const std::function<void(const Integer&)>>([](const Integer&) {});
+
+        delegateList.add(0, IntegerDelegate::FromCallable(functionSPtr.get()), functionSPtr);
+
+        EXPECT_EQ(2, functionSPtr.use_count());
+
+        delegateList.remove(0);
+
+        EXPECT_EQ(1, functionSPtr.use_count());
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_DelegateList, Invoke)
+{
+    {
+        IntegerDelegateList delegateList;
+
+        Array<Integer> values = Array<Integer>::Empty();
+
+        auto first = [&values](const Integer& anInteger)
+        {
+            values.add(anInteger);
+        };
+
+        auto second = [&values](const Integer& anInteger)
+        {
+            values.add(10 * anInteger);
+        };
+
+        delegateList.add(0, IntegerDelegate::FromCallable(&first));
+        delegateList.add(1, IntegerDelegate::FromCallable(&second));
+
+        delegateList.invoke(2);
+
+        EXPECT_EQ(Array<Integer>({2, 20}), values);
+    }
+
+    {
+        IntegerDelegateList delegateList;
+
+        auto callable = [&delegateList](const Integer& anInteger)
+        {
+            delegateList.remove(anInteger);
+        };
+
+        delegateList.add(0, IntegerDelegate::FromCallable(&callable));
+
+        EXPECT_THROW(delegateList.invoke(0), ostk::core::error::RuntimeError);
+
+        EXPECT_EQ(1, delegateList.getSize());
+        EXPECT_TRUE(delegateList.remove(0));
+    }
+}
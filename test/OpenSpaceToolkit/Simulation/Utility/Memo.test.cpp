@@ -0,0 +1,190 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Utility/Memo.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::simulation::utility::Memo;
+
+using IndexMemo = Memo<Index, Index>;
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_Memo, Constructor)
+{
+    {
+        EXPECT_NO_THROW(IndexMemo(1));
+        EXPECT_NO_THROW(IndexMemo(8));
+    }
+
+    {
+        EXPECT_THROW(IndexMemo(0), ostk::core::error::runtime::Wrong);
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_Memo, Get)
+{
+    {
+        IndexMemo memo(2);
+
+        Size evaluationCount = 0;
+
+        const auto get = [&memo, &evaluationCount](const Index aKey) -> Index
+        {
+            return memo.get(
+                aKey,
+                [&evaluationCount, aKey]() -> Index
+                {
+                    evaluationCount += 1;
+
+                    return 10 * aKey;
+                }
+            );
+        };
+
+        EXPECT_EQ(2, memo.getCapacity());
+        EXPECT_EQ(0, memo.getSize());
+
+        EXPECT_EQ(10, get(1));
+        EXPECT_EQ(10, get(1));
+        EXPECT_EQ(20, get(2));
+        EXPECT_EQ(20, get(2));
+
+        EXPECT_EQ(2, evaluationCount);
+        EXPECT_EQ(2, memo.getSize());
+
+        // The oldest key is replaced once full
+
+        EXPECT_EQ(30, get(3));
+        EXPECT_EQ(20, get(2));
+        EXPECT_EQ(3, evaluationCount);
+
+        EXPECT_EQ(10, get(1));
+        EXPECT_EQ(4, evaluationCount);
+        EXPECT_EQ(2, memo.getSize());
+    }
+
+    // Failed evaluations are not memoized
+
+    {
+        IndexMemo memo(2);
+
+        EXPECT_ANY_THROW(memo.get(
+            1,
+            []() -> Index
+            {
+                throw ostk::core::error::RuntimeError("Cannot evaluate.");
+            }
+        ));
+
+        EXPECT_EQ(0, memo.getSize());
+    }
+
+    // A key stored by another caller during the evaluation is updated, not duplicated
+
+    {
+        IndexMemo memo(2);
+
+        EXPECT_EQ(
+            10,
+            memo.get(
+                1,
+                [&memo]() -> Index
+                {
+                    memo.set(1, 5);
+
+                    return 10;
+                }
+            )
+        );
+
+        EXPECT_EQ(1, memo.getSize());
+        EXPECT_EQ(
+            10,
+            memo.get(
+                1,
+                []() -> Index
+                {
+                    return 0;
+                }
+            )
+        );
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_Memo, Set)
+{
+    Size evaluationCount = 0;
+
+    IndexMemo memo(2);
+
+    const auto get = [&memo, &evaluationCount](const Index aKey) -> Index
+    {
+        return memo.get(
+            aKey,
+            [&evaluationCount, aKey]() -> Index
+            {
+                evaluationCount += 1;
+
+                return aKey * 10;
+            }
+        );
+    };
+
+    {
+        memo.set(1, 11);
+
+        EXPECT_EQ(11, get(1));
+        EXPECT_EQ(0, evaluationCount);
+        EXPECT_EQ(1, memo.getSize());
+    }
+
+    // Setting a memoized key replaces its value
+
+    {
+        EXPECT_EQ(20, get(2));
+
+        memo.set(2, 22);
+
+        EXPECT_EQ(22, get(2));
+        EXPECT_EQ(1, evaluationCount);
+        EXPECT_EQ(2, memo.getSize());
+    }
+
+    // The oldest key is replaced once full
+
+    {
+        memo.set(3, 33);
+
+        EXPECT_EQ(33, get(3));
+        EXPECT_EQ(22, get(2));
+        EXPECT_EQ(1, evaluationCount);
+
+        EXPECT_EQ(10, get(1));
+        EXPECT_EQ(2, evaluationCount);
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_Memo, Clear)
+{
+    {
+        IndexMemo memo(2);
+
+        memo.get(
+            1,
+            []() -> Index
+            {
+                return 10;
+            }
+        );
+
+        memo.clear();
+
+        EXPECT_EQ(0, memo.getSize());
+    }
+}
@@ -0,0 +1,109 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Utility/Symbol.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+using ostk::simulation::utility::Symbol;
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_Symbol, Constructor)
+{
+    {
+        EXPECT_NO_THROW(Symbol("sat-1"));
+    }
+
+    {
+        EXPECT_THROW(Symbol(""), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_Symbol, EqualToOperator)
+{
+    {
+        const Symbol symbol("sat-1");
+
+        EXPECT_TRUE(symbol == Symbol("sat-1"));
+        EXPECT_FALSE(symbol != Symbol("sat-1"));
+        EXPECT_TRUE(symbol != Symbol("sat-2"));
+        EXPECT_TRUE(symbol != Symbol::Undefined());
+        EXPECT_TRUE(Symbol::Undefined() == Symbol::Undefined());
+    }
+
+    // Equal names share a single interned record
+
+    {
+        EXPECT_EQ(&Symbol("sat-1").accessName(), &Symbol(String("sat-") + "1").accessName());
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_Symbol, StreamOperator)
+{
+    {
+        testing::internal::CaptureStdout();
+
+        EXPECT_NO_THROW(std::cout << Symbol("sat-1") << std::endl);
+        EXPECT_NO_THROW(std::cout << Symbol::Undefined() << std::endl);
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty());
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_Symbol, IsDefined)
+{
+    {
+        EXPECT_TRUE(Symbol("sat-1").isDefined());
+        EXPECT_FALSE(Symbol::Undefined().isDefined());
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_Symbol, AccessName)
+{
+    {
+        EXPECT_EQ("sat-1", Symbol("sat-1").accessName());
+    }
+
+    {
+        EXPECT_THROW(Symbol::Undefined().accessName(), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_Symbol, GetHash)
+{
+    {
+        EXPECT_EQ(Symbol::Hash("sat-1"), Symbol("sat-1").getHash());
+        EXPECT_EQ(Symbol("sat-1").getHash(), std::hash<Symbol> {}(Symbol("sat-1")));
+    }
+
+    {
+        EXPECT_THROW(Symbol::Undefined().getHash(), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_Symbol, GetInternedCount)
+{
+    // Names are released with the last symbol referring to them
+
+    {
+        const Size internedCount = Symbol::GetInternedCount();
+
+        {
+            const Symbol symbol("symbol-interned-count");
+            const Symbol otherSymbol("symbol-interned-count");
+            const Symbol symbolCopy = symbol;
+
+            EXPECT_EQ(internedCount + 1, Symbol::GetInternedCount());
+            EXPECT_EQ(otherSymbol, symbolCopy);
+        }
+
+        EXPECT_EQ(internedCount, Symbol::GetInternedCount());
+
+        EXPECT_EQ("symbol-interned-count", Symbol("symbol-interned-count").accessName());
+        EXPECT_EQ(internedCount, Symbol::GetInternedCount());
+    }
+}
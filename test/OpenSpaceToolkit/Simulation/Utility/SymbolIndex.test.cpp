@@ -0,0 +1,225 @@
+/// Apache License 2.0
+
+#include <OpenSpaceToolkit/Simulation/Utility/Symbol.hpp>
+#include <OpenSpaceToolkit/Simulation/Utility/SymbolIndex.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Type/Index.hpp>
+#include <OpenSpaceToolkit/Core/Type/Size.hpp>
+#include <OpenSpaceToolkit/Core/Type/String.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+using ostk::core::type::String;
+
+using ostk::simulation::utility::Symbol;
+using ostk::simulation::utility::SymbolIndex;
+
+using IndexMap = SymbolIndex<Index>;
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_SymbolIndex, Constructor)
+{
+    {
+        EXPECT_NO_THROW(IndexMap());
+    }
+
+    {
+        IndexMap indexMap;
+
+        indexMap.insert(Symbol("a"), 1);
+
+        const IndexMap indexMapCopy = indexMap;
+
+        indexMap.insert(Symbol("b"), 2);
+
+        EXPECT_EQ(1, indexMapCopy.getSize());
+        EXPECT_EQ(1, *indexMapCopy.find(Symbol("a")));
+        EXPECT_EQ(nullptr, indexMapCopy.find(Symbol("b")));
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_SymbolIndex, Insert)
+{
+    {
+        IndexMap indexMap;
+
+        EXPECT_TRUE(indexMap.isEmpty());
+
+        EXPECT_TRUE(indexMap.insert(Symbol("a"), 1));
+        EXPECT_FALSE(indexMap.insert(Symbol("a"), 2));
+
+        EXPECT_EQ(1, indexMap.getSize());
+        EXPECT_EQ(1, *indexMap.find(Symbol("a")));
+    }
+
+    {
+        IndexMap indexMap;
+
+        EXPECT_THROW(indexMap.insert(Symbol::Undefined(), 1), ostk::core::error::runtime::Undefined);
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_SymbolIndex, Find)
+{
+    // Enough values to grow the indexMap several times
+
+    {
+        IndexMap indexMap;
+
+        for (Index index = 0; index < 1000; ++index)
+        {
+            indexMap.insert(Symbol(String::Format("sat-{}", index)), index);
+        }
+
+        EXPECT_EQ(1000, indexMap.getSize());
+
+        for (Index index = 0; index < 1000; ++index)
+        {
+            const String name = String::Format("sat-{}", index);
+
+            ASSERT_NE(nullptr, indexMap.find(Symbol(name)));
+            ASSERT_NE(nullptr, indexMap.find(name));
+            EXPECT_EQ(index, *indexMap.find(Symbol(name)));
+            EXPECT_EQ(index, *indexMap.find(name));
+        }
+
+        EXPECT_EQ(nullptr, indexMap.find(Symbol("sat-1000")));
+        EXPECT_EQ(nullptr, indexMap.find(String("sat-1000")));
+        EXPECT_EQ(nullptr, indexMap.find(String("")));
+        EXPECT_EQ(nullptr, indexMap.find(Symbol::Undefined()));
+    }
+
+    {
+        const IndexMap indexMap;
+
+        EXPECT_EQ(nullptr, indexMap.find(Symbol("a")));
+        EXPECT_EQ(nullptr, indexMap.find(String("a")));
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_SymbolIndex, Erase)
+{
+    {
+        IndexMap indexMap;
+
+        for (Index index = 0; index < 100; ++index)
+        {
+            indexMap.insert(Symbol(String::Format("sat-{}", index)), index);
+        }
+
+        // Erasing shifts colliding values back, which must remain reachable
+
+        for (Index index = 0; index < 100; index += 2)
+        {
+            EXPECT_TRUE(indexMap.erase(Symbol(String::Format("sat-{}", index))));
+        }
+
+        EXPECT_FALSE(indexMap.erase(Symbol("sat-0")));
+        EXPECT_EQ(50, indexMap.getSize());
+
+        for (Index index = 0; index < 100; ++index)
+        {
+            const Index* valuePtr = indexMap.find(String::Format("sat-{}", index));
+
+            if ((index % 2) == 0)
+            {
+                EXPECT_EQ(nullptr, valuePtr);
+            }
+            else
+            {
+                ASSERT_NE(nullptr, valuePtr);
+                EXPECT_EQ(index, *valuePtr);
+            }
+        }
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_SymbolIndex, Handle)
+{
+    {
+        IndexMap indexMap;
+
+        indexMap.insert(Symbol("a"), 1);
+
+        const IndexMap::Handle handle = indexMap.getHandle(Symbol("a"));
+
+        EXPECT_TRUE(handle.isDefined());
+        EXPECT_EQ(indexMap.find(Symbol("a")), indexMap.resolve(handle));
+
+        // Handles taken before a modification fall back to a lookup
+
+        for (Index index = 0; index < 100; ++index)
+        {
+            indexMap.insert(Symbol(String::Format("sat-{}", index)), index);
+        }
+
+        ASSERT_NE(nullptr, indexMap.resolve(handle));
+        EXPECT_EQ(1, *indexMap.resolve(handle));
+
+        indexMap.erase(Symbol("a"));
+
+        EXPECT_EQ(nullptr, indexMap.resolve(handle));
+    }
+
+    // Handles taken from another indexMap are looked up
+
+    {
+        IndexMap indexMap;
+
+        indexMap.insert(Symbol("a"), 1);
+
+        const IndexMap indexMapCopy = indexMap;
+
+        const IndexMap::Handle handle = indexMap.getHandle(Symbol("a"));
+
+        EXPECT_EQ(indexMapCopy.find(Symbol("a")), indexMapCopy.resolve(handle));
+    }
+
+    {
+        const IndexMap indexMap;
+
+        EXPECT_FALSE(indexMap.getHandle(Symbol("a")).isDefined());
+    }
+
+    // Handles taken by name refer to the symbol held by the index, and do not intern absent names
+
+    {
+        IndexMap indexMap;
+
+        indexMap.insert(Symbol("a"), 1);
+
+        const IndexMap::Handle handle = indexMap.getHandle(String("a"));
+
+        EXPECT_TRUE(handle.isDefined());
+        EXPECT_EQ(Symbol("a"), handle.symbol);
+        EXPECT_EQ(indexMap.find(Symbol("a")), indexMap.resolve(handle));
+
+        const Size internedCount = Symbol::GetInternedCount();
+
+        const IndexMap::Handle absentHandle = indexMap.getHandle(String("symbol-index-absent"));
+
+        EXPECT_FALSE(absentHandle.isDefined());
+        EXPECT_EQ(nullptr, indexMap.resolve(absentHandle));
+        EXPECT_EQ(nullptr, indexMap.find(String("symbol-index-absent")));
+        EXPECT_EQ(internedCount, Symbol::GetInternedCount());
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_SymbolIndex, Clear)
+{
+    {
+        IndexMap indexMap;
+
+        indexMap.insert(Symbol("a"), 1);
+        indexMap.reserve(100);
+
+        EXPECT_EQ(1, *indexMap.find(Symbol("a")));
+
+        indexMap.clear();
+
+        EXPECT_TRUE(indexMap.isEmpty());
+        EXPECT_EQ(nullptr, indexMap.find(Symbol("a")));
+    }
+}
@@ -0,0 +1,128 @@
+/// Apache License 2.0
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include <OpenSpaceToolkit/Simulation/Utility/ThreadPool.hpp>
+
+#include <Global.test.hpp>
+
+using ostk::core::type::Index;
+using ostk::core::type::Size;
+
+using ostk::simulation::utility::ThreadPool;
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_ThreadPool, Constructor)
+{
+    {
+        EXPECT_NO_THROW(ThreadPool threadPool(1));
+        EXPECT_NO_THROW(ThreadPool threadPool(4));
+    }
+
+    {
+        EXPECT_ANY_THROW(ThreadPool threadPool(0));
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_ThreadPool, GetThreadCount)
+{
+    {
+        EXPECT_EQ(1, ThreadPool(1).getThreadCount());
+        EXPECT_EQ(4, ThreadPool(4).getThreadCount());
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_ThreadPool, GetWorkerCount)
+{
+    {
+        const Size workerCount = ThreadPool::GetWorkerCount();
+
+        {
+            const ThreadPool threadPool(4);
+            const ThreadPool otherThreadPool(2);
+
+            EXPECT_EQ(workerCount + 4, ThreadPool::GetWorkerCount());
+        }
+
+        EXPECT_EQ(workerCount, ThreadPool::GetWorkerCount());
+    }
+}
+
+TEST(OpenSpaceToolkit_Simulation_Utilities_ThreadPool, ParallelFor)
+{
+    for (const Size threadCount : {1, 2, 4, 8})
+    {
+        ThreadPool threadPool(threadCount);
+
+        for (const Size count : {0, 1, 7, 1000})
+        {
+            std::vector<Size> values(count, 0);
+
+            threadPool.parallelFor(
+                count,
+                [&values](const Index& anIndex)
+                {
+                    values[anIndex] += anIndex + 1;
+                }
+            );
+
+            for (Index index = 0; index < count; ++index)
+            {
+                EXPECT_EQ(index + 1, values[index]);
+            }
+        }
+    }
+
+    {
+        ThreadPool threadPool(4);
+
+        std::atomic<Size> callCount(0);
+
+        threadPool.parallelFor(
+            8,
+            [&threadPool, &callCount](const Index&)
+            {
+                threadPool.parallelFor(
+                    8,
+                    [&callCount](const Index&)
+                    {
+                        ++callCount;
+                    }
+                );
+            }
+        );
+
+        EXPECT_EQ(64, callCount.load());
+    }
+
+    {
+        ThreadPool threadPool(4);
+
+        EXPECT_THROW(
+            threadPool.parallelFor(
+                100,
+                [](const Index& anIndex)
+                {
+                    if (anIndex == 42)
+                    {
+                        throw std::runtime_error("Failure");
+                    }
+                }
+            ),
+            std::runtime_error
+        );
+
+        Size callCount = 0;
+
+        EXPECT_NO_THROW(threadPool.parallelFor(
+            1,
+            [&callCount](const Index&)
+            {
+                ++callCount;
+            }
+        ));
+
+        EXPECT_EQ(1, callCount);
+    }
+}